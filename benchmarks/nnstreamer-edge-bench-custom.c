@@ -0,0 +1,420 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   nnstreamer-edge-bench-custom.c
+ * @date   14 October 2026
+ * @brief  In-process loopback custom connection to benchmark the custom connection path of nnstreamer-edge.
+ * @see    https://github.com/nnstreamer/nnstreamer-edge
+ * @author agent <agent@local>
+ * @bug    No known bugs except for NYI items
+ * @note   The instance with the info 'LISTENER' is the query server or publisher, other instances connect to it.
+ * The data sent by the connected instance is delivered to every listener, and the data sent by the listener is delivered to every connected instance.
+ */
+
+#include <pthread.h>
+#include "nnstreamer-edge-custom.h"
+#include "nnstreamer-edge-log.h"
+#include "nnstreamer-edge-util.h"
+#include "nnstreamer-edge.h"
+
+/**
+ * @brief Data structure for the loopback custom connection.
+ */
+typedef struct _nns_edge_bench_custom_s
+{
+  bool is_listener;
+  bool is_started;
+  bool is_connected;
+  nns_edge_event_cb event_cb;
+  void *user_data;
+  struct _nns_edge_bench_custom_s *next;
+} nns_edge_bench_custom_s;
+
+/**
+ * @brief The list of the instances in this process.
+ * @note The lock is recursive, the receiver may send the response in the event callback.
+ */
+static nns_edge_bench_custom_s *g_instances = NULL;
+static pthread_mutex_t g_lock;
+static pthread_once_t g_lock_once = PTHREAD_ONCE_INIT;
+
+/**
+ * @brief Initialize the recursive lock of the instance list.
+ */
+static void
+_bench_custom_init_lock (void)
+{
+  pthread_mutexattr_t attr;
+
+  pthread_mutexattr_init (&attr);
+  pthread_mutexattr_settype (&attr, PTHREAD_MUTEX_RECURSIVE);
+  pthread_mutex_init (&g_lock, &attr);
+  pthread_mutexattr_destroy (&attr);
+}
+
+/**
+ * @brief Lock the instance list.
+ */
+static inline void
+_bench_custom_lock (void)
+{
+  pthread_once (&g_lock_once, _bench_custom_init_lock);
+  pthread_mutex_lock (&g_lock);
+}
+
+/**
+ * @brief Unlock the instance list.
+ */
+static inline void
+_bench_custom_unlock (void)
+{
+  pthread_mutex_unlock (&g_lock);
+}
+
+/**
+ * @brief Check the instance is the peer of given instance.
+ */
+static inline bool
+_bench_custom_is_peer (nns_edge_bench_custom_s * custom_h,
+    nns_edge_bench_custom_s * peer)
+{
+  if (peer == custom_h || !peer->is_started)
+    return false;
+
+  if (custom_h->is_listener)
+    return (!peer->is_listener && peer->is_connected);
+
+  return (custom_h->is_connected && peer->is_listener);
+}
+
+/**
+ * @brief Get the description of the loopback custom connection.
+ */
+static const char *
+nns_edge_bench_custom_get_description (void)
+{
+  return "bench-loopback";
+}
+
+/**
+ * @brief Create the loopback custom connection.
+ */
+static int
+nns_edge_bench_custom_create (void **priv)
+{
+  nns_edge_bench_custom_s *custom_h;
+
+  if (!priv) {
+    nns_edge_loge ("Invalid param, handle should not be null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  custom_h = (nns_edge_bench_custom_s *) calloc (1,
+      sizeof (nns_edge_bench_custom_s));
+  if (!custom_h) {
+    nns_edge_loge ("Failed to allocate memory for edge custom handle.");
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+  }
+
+  _bench_custom_lock ();
+  custom_h->next = g_instances;
+  g_instances = custom_h;
+  _bench_custom_unlock ();
+
+  *priv = custom_h;
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Close the loopback custom connection.
+ */
+static int
+nns_edge_bench_custom_close (void *priv)
+{
+  nns_edge_bench_custom_s *custom_h = (nns_edge_bench_custom_s *) priv;
+  nns_edge_bench_custom_s **it;
+
+  if (!custom_h) {
+    nns_edge_loge ("Invalid param, handle should not be null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  _bench_custom_lock ();
+  for (it = &g_instances; *it; it = &(*it)->next) {
+    if (*it == custom_h) {
+      *it = custom_h->next;
+      break;
+    }
+  }
+  _bench_custom_unlock ();
+
+  SAFE_FREE (custom_h);
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Start the loopback custom connection.
+ */
+static int
+nns_edge_bench_custom_start (void *priv)
+{
+  nns_edge_bench_custom_s *custom_h = (nns_edge_bench_custom_s *) priv;
+
+  if (!custom_h) {
+    nns_edge_loge ("Invalid param, handle should not be null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  _bench_custom_lock ();
+  custom_h->is_started = true;
+  _bench_custom_unlock ();
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Stop the loopback custom connection.
+ */
+static int
+nns_edge_bench_custom_stop (void *priv)
+{
+  nns_edge_bench_custom_s *custom_h = (nns_edge_bench_custom_s *) priv;
+
+  if (!custom_h) {
+    nns_edge_loge ("Invalid param, handle should not be null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  _bench_custom_lock ();
+  custom_h->is_started = false;
+  custom_h->is_connected = false;
+  _bench_custom_unlock ();
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Connect to the listener in this process.
+ */
+static int
+nns_edge_bench_custom_connect (void *priv)
+{
+  nns_edge_bench_custom_s *custom_h = (nns_edge_bench_custom_s *) priv;
+
+  if (!custom_h) {
+    nns_edge_loge ("Invalid param, handle should not be null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  _bench_custom_lock ();
+  custom_h->is_connected = true;
+  _bench_custom_unlock ();
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Subscribe is not supported, the subscriber connects to the publisher.
+ */
+static int
+nns_edge_bench_custom_subscribe (void *priv)
+{
+  return NNS_EDGE_ERROR_NOT_SUPPORTED;
+}
+
+/**
+ * @brief Check the peer exists. The listener is connected if there is a connected instance.
+ */
+static int
+nns_edge_bench_custom_is_connected (void *priv)
+{
+  nns_edge_bench_custom_s *custom_h = (nns_edge_bench_custom_s *) priv;
+  nns_edge_bench_custom_s *it;
+  int ret = NNS_EDGE_ERROR_CONNECTION_FAILURE;
+
+  if (!custom_h) {
+    nns_edge_loge ("Invalid param, handle should not be null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  _bench_custom_lock ();
+  if (custom_h->is_started) {
+    for (it = g_instances; it; it = it->next) {
+      if (_bench_custom_is_peer (custom_h, it)) {
+        ret = NNS_EDGE_ERROR_NONE;
+        break;
+      }
+    }
+  }
+  _bench_custom_unlock ();
+
+  return ret;
+}
+
+/**
+ * @brief Discovery is not supported.
+ */
+static int
+nns_edge_bench_custom_start_discovery (void *priv)
+{
+  return NNS_EDGE_ERROR_NOT_SUPPORTED;
+}
+
+/**
+ * @brief Discovery is not supported.
+ */
+static int
+nns_edge_bench_custom_stop_discovery (void *priv)
+{
+  return NNS_EDGE_ERROR_NOT_SUPPORTED;
+}
+
+/**
+ * @brief Set the event callback to deliver new data.
+ */
+static int
+nns_edge_bench_custom_set_event_cb (void *priv, nns_edge_event_cb cb,
+    void *user_data)
+{
+  nns_edge_bench_custom_s *custom_h = (nns_edge_bench_custom_s *) priv;
+
+  if (!custom_h) {
+    nns_edge_loge ("Invalid param, handle should not be null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  _bench_custom_lock ();
+  custom_h->event_cb = cb;
+  custom_h->user_data = user_data;
+  _bench_custom_unlock ();
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Deliver the data to the peers. The receiver copies the data in the event callback.
+ * @note The event callback is invoked while holding the lock, it should not release the edge handle.
+ */
+static int
+nns_edge_bench_custom_send_data (void *priv, nns_edge_data_h data_h)
+{
+  nns_edge_bench_custom_s *custom_h = (nns_edge_bench_custom_s *) priv;
+  nns_edge_bench_custom_s *it;
+  int ret = NNS_EDGE_ERROR_CONNECTION_FAILURE;
+
+  if (!custom_h || !data_h) {
+    nns_edge_loge ("Invalid param, handle or data should not be null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  _bench_custom_lock ();
+  for (it = g_instances; it; it = it->next) {
+    if (!_bench_custom_is_peer (custom_h, it))
+      continue;
+
+    ret = nns_edge_event_invoke_callback (it->event_cb, it->user_data,
+        NNS_EDGE_EVENT_NEW_DATA_RECEIVED, data_h, sizeof (nns_edge_data_h),
+        NULL);
+    if (NNS_EDGE_ERROR_NONE != ret)
+      nns_edge_logw ("Failed to deliver new data to the peer.");
+  }
+  _bench_custom_unlock ();
+
+  return ret;
+}
+
+/**
+ * @brief Deliver the array of data to the peers, holding the lock once for the batch.
+ */
+static int
+nns_edge_bench_custom_send_batch (void *priv, nns_edge_data_h * data_h,
+    unsigned int count)
+{
+  nns_edge_bench_custom_s *custom_h = (nns_edge_bench_custom_s *) priv;
+  unsigned int i;
+  int ret = NNS_EDGE_ERROR_NONE;
+
+  if (!custom_h || !data_h || count == 0U) {
+    nns_edge_loge ("Invalid param, handle or data should not be null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  _bench_custom_lock ();
+  for (i = 0; i < count && NNS_EDGE_ERROR_NONE == ret; i++)
+    ret = nns_edge_bench_custom_send_data (priv, data_h[i]);
+  _bench_custom_unlock ();
+
+  return ret;
+}
+
+/**
+ * @brief Set the information of the loopback custom connection. The key 'LISTENER' is supported only.
+ */
+static int
+nns_edge_bench_custom_set_info (void *priv, const char *key, const char *value)
+{
+  nns_edge_bench_custom_s *custom_h = (nns_edge_bench_custom_s *) priv;
+
+  if (!custom_h || !key || !value) {
+    nns_edge_loge ("Invalid param, handle, key or value should not be null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (0 == strcasecmp (key, "LISTENER")) {
+    _bench_custom_lock ();
+    custom_h->is_listener = (0 == strcasecmp (value, "true"));
+    _bench_custom_unlock ();
+    return NNS_EDGE_ERROR_NONE;
+  }
+
+  return NNS_EDGE_ERROR_NOT_SUPPORTED;
+}
+
+/**
+ * @brief The loopback custom connection does not provide the information.
+ */
+static int
+nns_edge_bench_custom_get_info (void *priv, const char *key, char **value)
+{
+  return NNS_EDGE_ERROR_NOT_SUPPORTED;
+}
+
+/**
+ * @brief The function table of the loopback custom connection.
+ */
+static nns_edge_custom_s edge_bench_custom_h = {
+  .nns_edge_custom_get_description = nns_edge_bench_custom_get_description,
+  .nns_edge_custom_create = nns_edge_bench_custom_create,
+  .nns_edge_custom_close = nns_edge_bench_custom_close,
+  .nns_edge_custom_start = nns_edge_bench_custom_start,
+  .nns_edge_custom_stop = nns_edge_bench_custom_stop,
+  .nns_edge_custom_connect = nns_edge_bench_custom_connect,
+  .nns_edge_custom_subscribe = nns_edge_bench_custom_subscribe,
+  .nns_edge_custom_is_connected = nns_edge_bench_custom_is_connected,
+  .nns_edge_custom_start_discovery = nns_edge_bench_custom_start_discovery,
+  .nns_edge_custom_stop_discovery = nns_edge_bench_custom_stop_discovery,
+  .nns_edge_custom_set_event_cb = nns_edge_bench_custom_set_event_cb,
+  .nns_edge_custom_send_data = nns_edge_bench_custom_send_data,
+  .nns_edge_custom_set_info = nns_edge_bench_custom_set_info,
+  .nns_edge_custom_get_info = nns_edge_bench_custom_get_info,
+  .nns_edge_custom_send_batch = nns_edge_bench_custom_send_batch
+};
+
+/**
+ * @brief Get the function table of the loopback custom connection.
+ */
+const nns_edge_custom_s *
+nns_edge_custom_get_instance (void)
+{
+  return &edge_bench_custom_h;
+}
+
+/**
+ * @brief Get the version of custom connection interface.
+ */
+unsigned int
+nns_edge_custom_get_version (void)
+{
+  return NNS_EDGE_CUSTOM_VERSION;
+}
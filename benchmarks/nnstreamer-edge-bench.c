@@ -0,0 +1,1295 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   nnstreamer-edge-bench.c
+ * @date   14 October 2026
+ * @brief  Throughput and latency benchmark of the edge transports.
+ * @see    https://github.com/nnstreamer/nnstreamer-edge
+ * @author agent <agent@local>
+ * @bug    No known bugs except for NYI items
+ * @note   Every node runs in this process. The sender writes the timestamp in the metadata of edge data, and the receiver measures the latency with it.
+ * The CPU time is measured for the whole process, it includes the cost of both sender and receiver.
+ */
+
+#include <getopt.h>
+#include <pthread.h>
+#include <sys/resource.h>
+#include "nnstreamer-edge.h"
+#include "nnstreamer-edge-log.h"
+#include "nnstreamer-edge-util.h"
+
+#if defined(ENABLE_CUSTOM_CONNECTION)
+#include "nnstreamer-edge-custom.h"
+#endif
+
+/**
+ * @brief The maximum number of values in a sweep list.
+ */
+#define BENCH_LIST_MAX (32U)
+
+/**
+ * @brief The keys in the metadata of edge data.
+ */
+#define BENCH_KEY_TS "bench-ts"
+#define BENCH_KEY_SEQ "bench-seq"
+#define BENCH_KEY_ID "bench-id"
+#define BENCH_KEY_PAD "bench-pad"
+
+/**
+ * @brief The sequence of the message to check the subscribers are ready.
+ */
+#define BENCH_SEQ_SYNC "sync"
+
+/**
+ * @brief Enumeration for the scenario.
+ */
+typedef enum {
+  BENCH_SCENARIO_PUBSUB = 0,
+  BENCH_SCENARIO_QUERY,
+  BENCH_SCENARIO_HYBRID,
+
+  BENCH_SCENARIO_MAX
+} bench_scenario_e;
+
+/**
+ * @brief Enumeration for the transport.
+ */
+typedef enum {
+  BENCH_TRANSPORT_TCP = 0,
+  BENCH_TRANSPORT_MQTT,
+  BENCH_TRANSPORT_CUSTOM,
+
+  BENCH_TRANSPORT_MAX
+} bench_transport_e;
+
+/**
+ * @brief Enumeration for the output format.
+ */
+typedef enum {
+  BENCH_FORMAT_JSON = 0,
+  BENCH_FORMAT_CSV
+} bench_format_e;
+
+static const char *bench_scenario_names[] = {
+  [BENCH_SCENARIO_PUBSUB] = "pubsub",
+  [BENCH_SCENARIO_QUERY] = "query",
+  [BENCH_SCENARIO_HYBRID] = "hybrid",
+};
+
+static const char *bench_transport_names[] = {
+  [BENCH_TRANSPORT_TCP] = "tcp",
+  [BENCH_TRANSPORT_MQTT] = "mqtt",
+  [BENCH_TRANSPORT_CUSTOM] = "custom",
+};
+
+/**
+ * @brief The list of the values to sweep.
+ */
+typedef struct
+{
+  unsigned int num;
+  unsigned int values[BENCH_LIST_MAX];
+} bench_list_s;
+
+/**
+ * @brief The options of the benchmark.
+ */
+typedef struct
+{
+  bool scenarios[BENCH_SCENARIO_MAX];
+  bool transports[BENCH_TRANSPORT_MAX];
+  bench_list_s payloads;
+  bench_list_s mems;
+  bench_list_s metas;
+  bench_list_s clients;
+  unsigned int count;
+  unsigned int warmup;
+  unsigned int window;
+  unsigned int timeout;
+  char *broker_host;
+  int broker_port;
+  char *custom_lib;
+  bench_format_e format;
+  FILE *out;
+  bool help;
+} bench_option_s;
+
+/**
+ * @brief A case of the sweep.
+ */
+typedef struct
+{
+  bench_scenario_e scenario;
+  bench_transport_e transport;
+  unsigned int payload;
+  unsigned int mems;
+  unsigned int meta;
+  unsigned int clients;
+} bench_case_s;
+
+typedef struct _bench_run_s bench_run_s;
+
+/**
+ * @brief The receiving node (query client or subscriber).
+ */
+typedef struct
+{
+  bench_run_s *run;
+  unsigned int id;
+  nns_edge_h handle;
+  pthread_t thread;
+  bool has_thread;
+  bool failed;
+  bool synced;
+  unsigned int received;
+} bench_client_s;
+
+/**
+ * @brief The state of a benchmark run.
+ */
+struct _bench_run_s
+{
+  const bench_option_s *option;
+  bench_case_s c;
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
+  nns_edge_h server;
+  bench_client_s *clients;
+  void **mems;
+  char *pad;
+  int64_t *samples;
+  unsigned int num_samples;
+  unsigned int max_samples;
+  unsigned int received;
+  unsigned int synced;
+  unsigned int ready;
+  bool started;
+};
+
+/**
+ * @brief The result of a benchmark run.
+ */
+typedef struct
+{
+  unsigned int messages;
+  unsigned int received;
+  int64_t p50;
+  int64_t p99;
+  double msgs_per_sec;
+  double cpu_per_msg;
+} bench_result_s;
+
+/**
+ * @brief Get the CPU time (microseconds) of this process.
+ */
+static int64_t
+_bench_get_cpu_time (void)
+{
+  struct rusage usage;
+
+  if (getrusage (RUSAGE_SELF, &usage) != 0)
+    return 0;
+
+  return ((int64_t) usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000
+      + usage.ru_utime.tv_usec + usage.ru_stime.tv_usec;
+}
+
+/**
+ * @brief Get the absolute time to wait for the condition.
+ */
+static void
+_bench_get_deadline (unsigned int timeout, struct timespec *ts)
+{
+  clock_gettime (CLOCK_REALTIME, ts);
+  ts->tv_sec += timeout;
+}
+
+/**
+ * @brief Compare the latency samples for qsort.
+ */
+static int
+_bench_compare_sample (const void *a, const void *b)
+{
+  int64_t va = *(const int64_t *) a;
+  int64_t vb = *(const int64_t *) b;
+
+  return (va > vb) - (va < vb);
+}
+
+/**
+ * @brief Get the value in the metadata of edge data as integer.
+ */
+static bool
+_bench_get_meta_int (nns_edge_data_h data_h, const char *key, int64_t * value)
+{
+  char *val = NULL;
+  char *end = NULL;
+  bool valid;
+
+  if (NNS_EDGE_ERROR_NONE != nns_edge_data_get_info (data_h, key, &val))
+    return false;
+
+  *value = strtoll (val, &end, 10);
+  valid = (end != val && *end == '\0');
+  SAFE_FREE (val);
+
+  return valid;
+}
+
+/**
+ * @brief Set the integer value in the metadata of edge data.
+ */
+static int
+_bench_set_meta_int (nns_edge_data_h data_h, const char *key, int64_t value)
+{
+  char val[32];
+
+  snprintf (val, sizeof (val), "%lld", (long long) value);
+  return nns_edge_data_set_info (data_h, key, val);
+}
+
+/**
+ * @brief Handle new data in the receiving node, and add the latency sample.
+ */
+static void
+_bench_client_received (bench_client_s * client, nns_edge_data_h data_h)
+{
+  bench_run_s *run = client->run;
+  int64_t now, ts, seq, id;
+  char *val = NULL;
+
+  now = nns_edge_get_monotonic_time ();
+
+  if (NNS_EDGE_ERROR_NONE == nns_edge_data_get_info (data_h, BENCH_KEY_SEQ,
+          &val) && 0 == strcmp (val, BENCH_SEQ_SYNC)) {
+    SAFE_FREE (val);
+
+    pthread_mutex_lock (&run->lock);
+    if (!client->synced) {
+      client->synced = true;
+      run->synced++;
+      pthread_cond_broadcast (&run->cond);
+    }
+    pthread_mutex_unlock (&run->lock);
+    return;
+  }
+  SAFE_FREE (val);
+
+  /* The custom connection delivers the response to every client. */
+  if (_bench_get_meta_int (data_h, BENCH_KEY_ID, &id) && id != client->id)
+    return;
+
+  if (!_bench_get_meta_int (data_h, BENCH_KEY_TS, &ts) ||
+      !_bench_get_meta_int (data_h, BENCH_KEY_SEQ, &seq)) {
+    nns_edge_logw ("Received data does not have the benchmark info.");
+    return;
+  }
+
+  pthread_mutex_lock (&run->lock);
+  if (seq >= (int64_t) run->option->warmup &&
+      run->num_samples < run->max_samples)
+    run->samples[run->num_samples++] = now - ts;
+  client->received++;
+  run->received++;
+  pthread_cond_broadcast (&run->cond);
+  pthread_mutex_unlock (&run->lock);
+}
+
+/**
+ * @brief Edge event callback of the receiving node.
+ */
+static int
+_bench_client_event_cb (nns_edge_event_h event_h, void *user_data)
+{
+  bench_client_s *client = (bench_client_s *) user_data;
+  nns_edge_event_e event = NNS_EDGE_EVENT_UNKNOWN;
+  nns_edge_data_h data_h;
+
+  if (!client)
+    return NNS_EDGE_ERROR_NONE;
+
+  if (NNS_EDGE_ERROR_NONE != nns_edge_event_get_type (event_h, &event) ||
+      event != NNS_EDGE_EVENT_NEW_DATA_RECEIVED)
+    return NNS_EDGE_ERROR_NONE;
+
+  if (NNS_EDGE_ERROR_NONE != nns_edge_event_parse_new_data (event_h, &data_h))
+    return NNS_EDGE_ERROR_NONE;
+
+  _bench_client_received (client, data_h);
+  nns_edge_data_destroy (data_h);
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Edge event callback of the query server, send the data back to the client.
+ */
+static int
+_bench_server_event_cb (nns_edge_event_h event_h, void *user_data)
+{
+  bench_run_s *run = (bench_run_s *) user_data;
+  nns_edge_event_e event = NNS_EDGE_EVENT_UNKNOWN;
+  nns_edge_data_h data_h;
+
+  if (!run)
+    return NNS_EDGE_ERROR_NONE;
+
+  if (NNS_EDGE_ERROR_NONE != nns_edge_event_get_type (event_h, &event) ||
+      event != NNS_EDGE_EVENT_NEW_DATA_RECEIVED)
+    return NNS_EDGE_ERROR_NONE;
+
+  if (NNS_EDGE_ERROR_NONE != nns_edge_event_parse_new_data (event_h, &data_h))
+    return NNS_EDGE_ERROR_NONE;
+
+  if (NNS_EDGE_ERROR_NONE != nns_edge_send (run->server, data_h))
+    nns_edge_logw ("Failed to send the response.");
+
+  nns_edge_data_destroy (data_h);
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Create the edge data to send, the memories are shared with the run.
+ */
+static int
+_bench_create_data (bench_run_s * run, nns_edge_data_h * data_h)
+{
+  unsigned int i;
+  int ret;
+
+  ret = nns_edge_data_create (data_h);
+  if (NNS_EDGE_ERROR_NONE != ret)
+    return ret;
+
+  for (i = 0; i < run->c.mems; i++) {
+    ret = nns_edge_data_add (*data_h, run->mems[i], run->c.payload, NULL);
+    if (NNS_EDGE_ERROR_NONE != ret)
+      goto error;
+  }
+
+  if (run->pad) {
+    ret = nns_edge_data_set_info (*data_h, BENCH_KEY_PAD, run->pad);
+    if (NNS_EDGE_ERROR_NONE != ret)
+      goto error;
+  }
+
+  return NNS_EDGE_ERROR_NONE;
+
+error:
+  nns_edge_data_destroy (*data_h);
+  *data_h = NULL;
+  return ret;
+}
+
+/**
+ * @brief Send the data with the sequence and current time.
+ */
+static int
+_bench_send (nns_edge_h handle, nns_edge_data_h data_h, const char *seq)
+{
+  int ret;
+
+  ret = nns_edge_data_set_info (data_h, BENCH_KEY_SEQ, seq);
+  if (NNS_EDGE_ERROR_NONE == ret)
+    ret = _bench_set_meta_int (data_h, BENCH_KEY_TS,
+        nns_edge_get_monotonic_time ());
+  if (NNS_EDGE_ERROR_NONE == ret)
+    ret = nns_edge_send (handle, data_h);
+
+  return ret;
+}
+
+/**
+ * @brief Create the edge handle of the node.
+ */
+static int
+_bench_create_handle (bench_run_s * run, const char *id,
+    nns_edge_node_type_e node_type, nns_edge_h * handle)
+{
+  nns_edge_connect_type_e connect_type;
+
+  if (BENCH_SCENARIO_HYBRID == run->c.scenario) {
+    connect_type = NNS_EDGE_CONNECT_TYPE_HYBRID;
+  } else if (BENCH_TRANSPORT_MQTT == run->c.transport) {
+    connect_type = NNS_EDGE_CONNECT_TYPE_MQTT;
+  } else if (BENCH_TRANSPORT_CUSTOM == run->c.transport) {
+#if defined(ENABLE_CUSTOM_CONNECTION)
+    return nns_edge_custom_create_handle (id, run->option->custom_lib,
+        node_type, handle);
+#else
+    return NNS_EDGE_ERROR_NOT_SUPPORTED;
+#endif
+  } else {
+    connect_type = NNS_EDGE_CONNECT_TYPE_TCP;
+  }
+
+  return nns_edge_create_handle (id, connect_type, node_type, handle);
+}
+
+/**
+ * @brief Create and start the sending node (query server or publisher).
+ */
+static int
+_bench_start_server (bench_run_s * run, const char *topic, int *port)
+{
+  nns_edge_node_type_e node_type;
+  char *val;
+  int ret;
+
+  node_type = (BENCH_SCENARIO_PUBSUB == run->c.scenario) ?
+      NNS_EDGE_NODE_TYPE_PUB : NNS_EDGE_NODE_TYPE_QUERY_SERVER;
+
+  ret = _bench_create_handle (run, "bench-server", node_type, &run->server);
+  if (NNS_EDGE_ERROR_NONE != ret)
+    return ret;
+
+  if (NNS_EDGE_NODE_TYPE_QUERY_SERVER == node_type) {
+    ret = nns_edge_set_event_callback (run->server, _bench_server_event_cb,
+        run);
+    if (NNS_EDGE_ERROR_NONE != ret)
+      return ret;
+  }
+
+  if (BENCH_TRANSPORT_CUSTOM == run->c.transport) {
+    ret = nns_edge_set_info (run->server, "LISTENER", "true");
+  } else if (BENCH_TRANSPORT_TCP == run->c.transport) {
+    *port = nns_edge_get_available_port ();
+    if (*port <= 0)
+      return NNS_EDGE_ERROR_IO;
+
+    val = nns_edge_strdup_printf ("%d", *port);
+    ret = nns_edge_set_info (run->server, "IP", "127.0.0.1");
+    if (NNS_EDGE_ERROR_NONE == ret)
+      ret = nns_edge_set_info (run->server, "PORT", val);
+    SAFE_FREE (val);
+  }
+
+  if (NNS_EDGE_ERROR_NONE == ret && topic) {
+    val = nns_edge_strdup_printf ("%d", run->option->broker_port);
+    ret = nns_edge_set_info (run->server, "DEST_HOST",
+        run->option->broker_host);
+    if (NNS_EDGE_ERROR_NONE == ret)
+      ret = nns_edge_set_info (run->server, "DEST_PORT", val);
+    if (NNS_EDGE_ERROR_NONE == ret)
+      ret = nns_edge_set_info (run->server, "TOPIC", topic);
+    SAFE_FREE (val);
+  }
+
+  if (NNS_EDGE_ERROR_NONE == ret)
+    ret = nns_edge_start (run->server);
+
+  return ret;
+}
+
+/**
+ * @brief Create the receiving node and connect it to the sending node.
+ */
+static int
+_bench_start_client (bench_run_s * run, bench_client_s * client,
+    const char *topic, int port)
+{
+  nns_edge_node_type_e node_type;
+  char *id;
+  int ret;
+
+  node_type = (BENCH_SCENARIO_PUBSUB == run->c.scenario) ?
+      NNS_EDGE_NODE_TYPE_SUB : NNS_EDGE_NODE_TYPE_QUERY_CLIENT;
+
+  id = nns_edge_strdup_printf ("bench-client-%u", client->id);
+  ret = _bench_create_handle (run, id, node_type, &client->handle);
+  SAFE_FREE (id);
+  if (NNS_EDGE_ERROR_NONE != ret)
+    return ret;
+
+  ret = nns_edge_set_event_callback (client->handle, _bench_client_event_cb,
+      client);
+  if (NNS_EDGE_ERROR_NONE == ret && topic)
+    ret = nns_edge_set_info (client->handle, "TOPIC", topic);
+  if (NNS_EDGE_ERROR_NONE == ret)
+    ret = nns_edge_start (client->handle);
+  if (NNS_EDGE_ERROR_NONE != ret)
+    return ret;
+
+  if (BENCH_TRANSPORT_TCP == run->c.transport &&
+      BENCH_SCENARIO_HYBRID != run->c.scenario) {
+    ret = nns_edge_connect (client->handle, "127.0.0.1", port);
+  } else if (BENCH_TRANSPORT_CUSTOM == run->c.transport) {
+    /* The loopback custom connection ignores the address. */
+    ret = nns_edge_connect (client->handle, "127.0.0.1", 1);
+  } else {
+    ret = nns_edge_connect (client->handle, run->option->broker_host,
+        run->option->broker_port);
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Wait for the connection of the edge handle.
+ */
+static int
+_bench_wait_connection (const bench_option_s * option, nns_edge_h handle)
+{
+  int64_t deadline;
+
+  deadline = nns_edge_get_monotonic_time () + option->timeout * 1000000LL;
+  while (NNS_EDGE_ERROR_NONE != nns_edge_is_connected (handle)) {
+    if (nns_edge_get_monotonic_time () > deadline)
+      return NNS_EDGE_ERROR_CONNECTION_FAILURE;
+    usleep (10000);
+  }
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Send the messages to check every subscriber receives the data.
+ */
+static int
+_bench_sync_subscribers (bench_run_s * run, nns_edge_data_h data_h)
+{
+  struct timespec ts;
+  int64_t deadline;
+  bool done;
+  int ret;
+
+  deadline = nns_edge_get_monotonic_time () +
+      run->option->timeout * 1000000LL;
+
+  do {
+    /* The publisher may not accept the connection yet, retry until the deadline. */
+    ret = _bench_send (run->server, data_h, BENCH_SEQ_SYNC);
+
+    pthread_mutex_lock (&run->lock);
+    _bench_get_deadline (0U, &ts);
+    ts.tv_nsec += 20000000L;
+    if (ts.tv_nsec >= 1000000000L) {
+      ts.tv_sec++;
+      ts.tv_nsec -= 1000000000L;
+    }
+    if (run->synced < run->c.clients)
+      pthread_cond_timedwait (&run->cond, &run->lock, &ts);
+    done = (run->synced >= run->c.clients);
+    pthread_mutex_unlock (&run->lock);
+
+    if (!done && nns_edge_get_monotonic_time () > deadline)
+      return (NNS_EDGE_ERROR_NONE != ret) ? ret :
+          NNS_EDGE_ERROR_CONNECTION_FAILURE;
+  } while (!done);
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Wait until the receiving nodes receive given number of messages.
+ */
+static bool
+_bench_wait_received (bench_run_s * run, unsigned int count)
+{
+  struct timespec ts;
+  int err = 0;
+
+  pthread_mutex_lock (&run->lock);
+  _bench_get_deadline (run->option->timeout, &ts);
+  while (run->received < count && err == 0)
+    err = pthread_cond_timedwait (&run->cond, &run->lock, &ts);
+  err = (run->received < count);
+  pthread_mutex_unlock (&run->lock);
+
+  return !err;
+}
+
+/**
+ * @brief Publish the messages. The number of in-flight messages is bounded by the window.
+ */
+static int
+_bench_run_pubsub (bench_run_s * run, int64_t * elapsed, int64_t * cpu)
+{
+  const bench_option_s *option = run->option;
+  nns_edge_data_h data_h;
+  struct timespec ts;
+  unsigned int seq, total, clients;
+  int64_t start, cpu_start;
+  char val[16];
+  int ret, err;
+
+  ret = _bench_create_data (run, &data_h);
+  if (NNS_EDGE_ERROR_NONE != ret)
+    return ret;
+
+  ret = _bench_sync_subscribers (run, data_h);
+  if (NNS_EDGE_ERROR_NONE != ret)
+    goto done;
+
+  clients = run->c.clients;
+  total = option->warmup + option->count;
+
+  start = nns_edge_get_monotonic_time ();
+  cpu_start = _bench_get_cpu_time ();
+
+  for (seq = 0; seq < total; seq++) {
+    if (seq == option->warmup && seq > 0U) {
+      /* Start measurement after receiving every warmup message. */
+      if (!_bench_wait_received (run, seq * clients))
+        break;
+
+      start = nns_edge_get_monotonic_time ();
+      cpu_start = _bench_get_cpu_time ();
+    }
+
+    pthread_mutex_lock (&run->lock);
+    _bench_get_deadline (option->timeout, &ts);
+    err = 0;
+    while (seq * clients - run->received >= option->window * clients &&
+        err == 0)
+      err = pthread_cond_timedwait (&run->cond, &run->lock, &ts);
+    pthread_mutex_unlock (&run->lock);
+    if (err != 0)
+      break;
+
+    snprintf (val, sizeof (val), "%u", seq);
+    ret = _bench_send (run->server, data_h, val);
+    if (NNS_EDGE_ERROR_NONE != ret)
+      break;
+  }
+
+  _bench_wait_received (run, total * clients);
+  *elapsed = nns_edge_get_monotonic_time () - start;
+  *cpu = _bench_get_cpu_time () - cpu_start;
+
+done:
+  nns_edge_data_destroy (data_h);
+  return ret;
+}
+
+/**
+ * @brief Send the request and wait for the response.
+ */
+static bool
+_bench_client_request (bench_client_s * client, nns_edge_data_h data_h,
+    unsigned int seq)
+{
+  bench_run_s *run = client->run;
+  struct timespec ts;
+  char val[16];
+  int err = 0;
+
+  snprintf (val, sizeof (val), "%u", seq);
+  if (NNS_EDGE_ERROR_NONE != _bench_send (client->handle, data_h, val))
+    return false;
+
+  pthread_mutex_lock (&run->lock);
+  _bench_get_deadline (run->option->timeout, &ts);
+  while (client->received <= seq && err == 0)
+    err = pthread_cond_timedwait (&run->cond, &run->lock, &ts);
+  err = (client->received <= seq);
+  pthread_mutex_unlock (&run->lock);
+
+  return !err;
+}
+
+/**
+ * @brief Thread of the query client, send the request after receiving the response.
+ */
+static void *
+_bench_client_thread (void *arg)
+{
+  bench_client_s *client = (bench_client_s *) arg;
+  bench_run_s *run = client->run;
+  const bench_option_s *option = run->option;
+  nns_edge_data_h data_h = NULL;
+  unsigned int seq;
+
+  if (NNS_EDGE_ERROR_NONE != _bench_create_data (run, &data_h) ||
+      NNS_EDGE_ERROR_NONE != _bench_set_meta_int (data_h, BENCH_KEY_ID,
+          client->id))
+    client->failed = true;
+
+  for (seq = 0; seq < option->warmup && !client->failed; seq++)
+    client->failed = !_bench_client_request (client, data_h, seq);
+
+  /* Wait for other clients, then main thread starts the measurement. */
+  pthread_mutex_lock (&run->lock);
+  run->ready++;
+  pthread_cond_broadcast (&run->cond);
+  while (!run->started)
+    pthread_cond_wait (&run->cond, &run->lock);
+  pthread_mutex_unlock (&run->lock);
+
+  for (; seq < option->warmup + option->count && !client->failed; seq++)
+    client->failed = !_bench_client_request (client, data_h, seq);
+
+  if (data_h)
+    nns_edge_data_destroy (data_h);
+
+  return NULL;
+}
+
+/**
+ * @brief Run the query clients in parallel.
+ */
+static int
+_bench_run_query (bench_run_s * run, int64_t * elapsed, int64_t * cpu)
+{
+  unsigned int i, num = 0U;
+  int64_t start, cpu_start;
+  int ret = NNS_EDGE_ERROR_NONE;
+
+  for (i = 0; i < run->c.clients; i++) {
+    if (pthread_create (&run->clients[i].thread, NULL, _bench_client_thread,
+            &run->clients[i]) != 0) {
+      nns_edge_loge ("Failed to create the thread of query client.");
+      ret = NNS_EDGE_ERROR_UNKNOWN;
+      break;
+    }
+    run->clients[i].has_thread = true;
+    num++;
+  }
+
+  pthread_mutex_lock (&run->lock);
+  while (run->ready < num)
+    pthread_cond_wait (&run->cond, &run->lock);
+  start = nns_edge_get_monotonic_time ();
+  cpu_start = _bench_get_cpu_time ();
+  run->started = true;
+  pthread_cond_broadcast (&run->cond);
+  pthread_mutex_unlock (&run->lock);
+
+  for (i = 0; i < run->c.clients; i++) {
+    if (run->clients[i].has_thread)
+      pthread_join (run->clients[i].thread, NULL);
+  }
+
+  *elapsed = nns_edge_get_monotonic_time () - start;
+  *cpu = _bench_get_cpu_time () - cpu_start;
+
+  return ret;
+}
+
+/**
+ * @brief Release the resources of the run. The receiving nodes are released before the sending node.
+ */
+static void
+_bench_release_run (bench_run_s * run)
+{
+  unsigned int i;
+
+  if (run->clients) {
+    for (i = 0; i < run->c.clients; i++) {
+      if (run->clients[i].handle)
+        nns_edge_release_handle (run->clients[i].handle);
+    }
+  }
+
+  if (run->server)
+    nns_edge_release_handle (run->server);
+
+  if (run->mems) {
+    for (i = 0; i < run->c.mems; i++)
+      SAFE_FREE (run->mems[i]);
+  }
+
+  SAFE_FREE (run->mems);
+  SAFE_FREE (run->clients);
+  SAFE_FREE (run->samples);
+  SAFE_FREE (run->pad);
+  pthread_cond_destroy (&run->cond);
+  pthread_mutex_destroy (&run->lock);
+}
+
+/**
+ * @brief Prepare the nodes and messages of the run.
+ */
+static int
+_bench_prepare_run (bench_run_s * run, const char *topic)
+{
+  unsigned int i;
+  int port = 0;
+  int ret;
+
+  run->mems = (void **) calloc (run->c.mems, sizeof (void *));
+  run->clients = (bench_client_s *) calloc (run->c.clients,
+      sizeof (bench_client_s));
+  run->max_samples = run->option->count * run->c.clients;
+  run->samples = (int64_t *) calloc (run->max_samples, sizeof (int64_t));
+  if (!run->mems || !run->clients || !run->samples)
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+
+  for (i = 0; i < run->c.mems; i++) {
+    run->mems[i] = malloc (run->c.payload);
+    if (!run->mems[i])
+      return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+    memset (run->mems[i], (int) (i + 1U), run->c.payload);
+  }
+
+  if (run->c.meta > 0U) {
+    run->pad = (char *) malloc (run->c.meta + 1U);
+    if (!run->pad)
+      return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+    memset (run->pad, 'x', run->c.meta);
+    run->pad[run->c.meta] = '\0';
+  }
+
+  ret = _bench_start_server (run, topic, &port);
+  if (NNS_EDGE_ERROR_NONE != ret) {
+    nns_edge_loge ("Failed to start the server node.");
+    return ret;
+  }
+
+  /* Wait for the server to listen. */
+  usleep (100000);
+
+  for (i = 0; i < run->c.clients; i++) {
+    run->clients[i].run = run;
+    run->clients[i].id = i;
+
+    ret = _bench_start_client (run, &run->clients[i], topic, port);
+    if (NNS_EDGE_ERROR_NONE != ret) {
+      nns_edge_loge ("Failed to start the client node %u.", i);
+      return ret;
+    }
+  }
+
+  if (BENCH_SCENARIO_PUBSUB != run->c.scenario) {
+    for (i = 0; i < run->c.clients; i++) {
+      ret = _bench_wait_connection (run->option, run->clients[i].handle);
+      if (NNS_EDGE_ERROR_NONE != ret) {
+        nns_edge_loge ("Failed to connect the client node %u.", i);
+        return ret;
+      }
+    }
+  }
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Run a case of the sweep.
+ */
+static int
+_bench_run_case (const bench_option_s * option, const bench_case_s * c,
+    unsigned int index, bench_result_s * result)
+{
+  bench_run_s run;
+  char *topic = NULL;
+  int64_t elapsed = 0, cpu = 0;
+  int ret;
+
+  memset (&run, 0, sizeof (bench_run_s));
+  run.option = option;
+  run.c = *c;
+  pthread_mutex_init (&run.lock, NULL);
+  pthread_cond_init (&run.cond, NULL);
+
+  if (BENCH_TRANSPORT_MQTT == c->transport ||
+      BENCH_SCENARIO_HYBRID == c->scenario)
+    topic = nns_edge_strdup_printf ("nns-edge-bench/%d/%u", (int) getpid (),
+        index);
+
+  ret = _bench_prepare_run (&run, topic);
+  if (NNS_EDGE_ERROR_NONE == ret) {
+    if (BENCH_SCENARIO_PUBSUB == c->scenario)
+      ret = _bench_run_pubsub (&run, &elapsed, &cpu);
+    else
+      ret = _bench_run_query (&run, &elapsed, &cpu);
+  }
+
+  if (NNS_EDGE_ERROR_NONE == ret) {
+    memset (result, 0, sizeof (bench_result_s));
+    result->messages = run.max_samples;
+    result->received = run.num_samples;
+
+    if (run.num_samples > 0U) {
+      qsort (run.samples, run.num_samples, sizeof (int64_t),
+          _bench_compare_sample);
+      result->p50 = run.samples[(run.num_samples - 1U) * 50U / 100U];
+      result->p99 = run.samples[(run.num_samples - 1U) * 99U / 100U];
+      result->cpu_per_msg = (double) cpu / run.num_samples;
+    }
+
+    if (elapsed > 0)
+      result->msgs_per_sec = run.num_samples * 1000000.0 / elapsed;
+  }
+
+  _bench_release_run (&run);
+  SAFE_FREE (topic);
+
+  return ret;
+}
+
+/**
+ * @brief Check the case is available. Query over MQTT is not supported and hybrid uses TCP for data.
+ */
+static bool
+_bench_case_is_valid (const bench_case_s * c)
+{
+  if (BENCH_SCENARIO_QUERY == c->scenario)
+    return (BENCH_TRANSPORT_MQTT != c->transport);
+
+  if (BENCH_SCENARIO_HYBRID == c->scenario)
+    return (BENCH_TRANSPORT_TCP == c->transport);
+
+  return true;
+}
+
+/**
+ * @brief Print the result of the case.
+ */
+static void
+_bench_print_result (const bench_option_s * option, const bench_case_s * c,
+    const bench_result_s * r)
+{
+  if (BENCH_FORMAT_CSV == option->format) {
+    fprintf (option->out, "%s,%s,%u,%u,%u,%u,%u,%u,%lld,%lld,%.1f,%.2f\n",
+        bench_scenario_names[c->scenario], bench_transport_names[c->transport],
+        c->payload, c->mems, c->meta, c->clients, r->messages, r->received,
+        (long long) r->p50, (long long) r->p99, r->msgs_per_sec,
+        r->cpu_per_msg);
+  } else {
+    fprintf (option->out, "{\"scenario\":\"%s\",\"transport\":\"%s\",\"payload\":%u,"
+        "\"mems\":%u,\"meta\":%u,\"clients\":%u,\"messages\":%u,"
+        "\"received\":%u,\"p50_us\":%lld,\"p99_us\":%lld,"
+        "\"msgs_per_sec\":%.1f,\"cpu_us_per_msg\":%.2f}\n",
+        bench_scenario_names[c->scenario], bench_transport_names[c->transport],
+        c->payload, c->mems, c->meta, c->clients, r->messages, r->received,
+        (long long) r->p50, (long long) r->p99, r->msgs_per_sec,
+        r->cpu_per_msg);
+  }
+  fflush (option->out);
+}
+
+/**
+ * @brief Parse the comma separated list of the names.
+ */
+static bool
+_bench_parse_names (const char *value, const char **names, unsigned int num,
+    bool *selected)
+{
+  char *list, *token, *saveptr = NULL;
+  unsigned int i;
+  bool valid = true;
+
+  memset (selected, 0, sizeof (bool) * num);
+  list = nns_edge_strdup (value);
+  if (!list)
+    return false;
+
+  for (token = strtok_r (list, ",", &saveptr); token && valid;
+      token = strtok_r (NULL, ",", &saveptr)) {
+    for (i = 0; i < num; i++) {
+      if (0 == strcasecmp (token, names[i])) {
+        selected[i] = true;
+        break;
+      }
+    }
+    valid = (i < num);
+  }
+
+  SAFE_FREE (list);
+  return valid;
+}
+
+/**
+ * @brief Parse the comma separated list of the numbers.
+ */
+static bool
+_bench_parse_list (const char *value, bench_list_s * list,
+    unsigned long min, unsigned long max)
+{
+  char *str, *token, *end, *saveptr = NULL;
+  unsigned long val;
+  bool valid = true;
+
+  list->num = 0U;
+  str = nns_edge_strdup (value);
+  if (!str)
+    return false;
+
+  for (token = strtok_r (str, ",", &saveptr); token && valid;
+      token = strtok_r (NULL, ",", &saveptr)) {
+    end = NULL;
+    val = strtoul (token, &end, 10);
+    valid = (end != token && *end == '\0' && token[0] != '-' && val >= min &&
+        val <= max && list->num < BENCH_LIST_MAX);
+    if (valid)
+      list->values[list->num++] = (unsigned int) val;
+  }
+
+  SAFE_FREE (str);
+  return (valid && list->num > 0U);
+}
+
+/**
+ * @brief Parse the number.
+ */
+static bool
+_bench_parse_uint (const char *value, unsigned int *result,
+    unsigned long min, unsigned long max)
+{
+  bench_list_s list;
+
+  if (!_bench_parse_list (value, &list, min, max) || list.num != 1U)
+    return false;
+
+  *result = list.values[0];
+  return true;
+}
+
+/**
+ * @brief Print the usage.
+ */
+static void
+_bench_print_usage (const char *name)
+{
+  printf ("Usage: %s [OPTION]...\n"
+      "Run the throughput and latency benchmark of the edge transports.\n"
+      "The lists are comma separated, every combination of the lists is run.\n\n"
+      "  --scenario LIST     pubsub, query, hybrid (default pubsub,query)\n"
+      "  --transport LIST    tcp, mqtt, custom (default tcp)\n"
+      "  --payload LIST      size in bytes of each memory (default 1024)\n"
+      "  --mems LIST         number of memories in edge data (default 1)\n"
+      "  --meta LIST         size in bytes of padding metadata (default 0)\n"
+      "  --clients LIST      number of query clients or subscribers (default 1)\n"
+      "  --count N           number of measured messages per client (default 1000)\n"
+      "  --warmup N          number of messages before measurement (default 100)\n"
+      "  --window N          max in-flight messages of publisher (default 16)\n"
+      "  --timeout SEC       max time to wait for the data (default 10)\n"
+      "  --broker HOST:PORT  MQTT broker for mqtt and hybrid (default 127.0.0.1:1883)\n"
+      "  --custom-lib PATH   custom connection library (default %s)\n"
+      "  --format FORMAT     json or csv (default json)\n"
+      "  --output FILE       write the results to the file, the log of nnstreamer-edge is printed to stdout (default stdout)\n"
+      "  --help              print this message\n", name,
+      NNS_EDGE_BENCH_CUSTOM_LIB);
+}
+
+/**
+ * @brief Parse the address of the MQTT broker.
+ */
+static bool
+_bench_parse_broker (const char *value, bench_option_s * option)
+{
+  const char *sep;
+  unsigned int port;
+
+  sep = strrchr (value, ':');
+  if (!sep || sep == value || !_bench_parse_uint (sep + 1, &port, 1UL,
+          65535UL))
+    return false;
+
+  SAFE_FREE (option->broker_host);
+  option->broker_host = nns_edge_strndup (value, (size_t) (sep - value));
+  option->broker_port = (int) port;
+  return (option->broker_host != NULL);
+}
+
+/**
+ * @brief Parse the options.
+ */
+static bool
+_bench_parse_options (int argc, char **argv, bench_option_s * option)
+{
+  static const struct option long_options[] = {
+    {"scenario", required_argument, NULL, 's'},
+    {"transport", required_argument, NULL, 't'},
+    {"payload", required_argument, NULL, 'p'},
+    {"mems", required_argument, NULL, 'm'},
+    {"meta", required_argument, NULL, 'M'},
+    {"clients", required_argument, NULL, 'c'},
+    {"count", required_argument, NULL, 'n'},
+    {"warmup", required_argument, NULL, 'w'},
+    {"window", required_argument, NULL, 'W'},
+    {"timeout", required_argument, NULL, 'T'},
+    {"broker", required_argument, NULL, 'b'},
+    {"custom-lib", required_argument, NULL, 'l'},
+    {"format", required_argument, NULL, 'f'},
+    {"output", required_argument, NULL, 'o'},
+    {"help", no_argument, NULL, 'h'},
+    {NULL, 0, NULL, 0}
+  };
+  int opt;
+  bool valid = true;
+
+  while (valid && (opt = getopt_long (argc, argv, "h", long_options,
+              NULL)) != -1) {
+    switch (opt) {
+      case 's':
+        valid = _bench_parse_names (optarg, bench_scenario_names,
+            BENCH_SCENARIO_MAX, option->scenarios);
+        break;
+      case 't':
+        valid = _bench_parse_names (optarg, bench_transport_names,
+            BENCH_TRANSPORT_MAX, option->transports);
+        break;
+      case 'p':
+        valid = _bench_parse_list (optarg, &option->payloads, 1UL,
+            UINT32_MAX);
+        break;
+      case 'm':
+        valid = _bench_parse_list (optarg, &option->mems, 1UL,
+            NNS_EDGE_DATA_LIMIT);
+        break;
+      case 'M':
+        valid = _bench_parse_list (optarg, &option->metas, 0UL, 1048576UL);
+        break;
+      case 'c':
+        valid = _bench_parse_list (optarg, &option->clients, 1UL, 256UL);
+        break;
+      case 'n':
+        valid = _bench_parse_uint (optarg, &option->count, 1UL, 10000000UL);
+        break;
+      case 'w':
+        valid = _bench_parse_uint (optarg, &option->warmup, 0UL, 10000000UL);
+        break;
+      case 'W':
+        valid = _bench_parse_uint (optarg, &option->window, 1UL, 4096UL);
+        break;
+      case 'T':
+        valid = _bench_parse_uint (optarg, &option->timeout, 1UL, 3600UL);
+        break;
+      case 'b':
+        valid = _bench_parse_broker (optarg, option);
+        break;
+      case 'l':
+        SAFE_FREE (option->custom_lib);
+        option->custom_lib = nns_edge_strdup (optarg);
+        break;
+      case 'f':
+        if (0 == strcasecmp (optarg, "json"))
+          option->format = BENCH_FORMAT_JSON;
+        else if (0 == strcasecmp (optarg, "csv"))
+          option->format = BENCH_FORMAT_CSV;
+        else
+          valid = false;
+        break;
+      case 'o':
+        if (option->out != stdout)
+          fclose (option->out);
+        option->out = fopen (optarg, "w");
+        if (!option->out) {
+          fprintf (stderr, "Cannot open the output file %s.\n", optarg);
+          option->out = stdout;
+          valid = false;
+        }
+        break;
+      case 'h':
+        option->help = true;
+        break;
+      default:
+        valid = false;
+        break;
+    }
+  }
+
+  if (valid && optind < argc)
+    valid = false;
+
+  return valid;
+}
+
+/**
+ * @brief Set the default options.
+ */
+static void
+_bench_init_options (bench_option_s * option)
+{
+  memset (option, 0, sizeof (bench_option_s));
+
+  option->scenarios[BENCH_SCENARIO_PUBSUB] = true;
+  option->scenarios[BENCH_SCENARIO_QUERY] = true;
+  option->transports[BENCH_TRANSPORT_TCP] = true;
+  option->payloads.num = 1U;
+  option->payloads.values[0] = 1024U;
+  option->mems.num = 1U;
+  option->mems.values[0] = 1U;
+  option->metas.num = 1U;
+  option->metas.values[0] = 0U;
+  option->clients.num = 1U;
+  option->clients.values[0] = 1U;
+  option->count = 1000U;
+  option->warmup = 100U;
+  option->window = 16U;
+  option->timeout = 10U;
+  option->broker_host = nns_edge_strdup ("127.0.0.1");
+  option->broker_port = 1883;
+  option->custom_lib = nns_edge_strdup (NNS_EDGE_BENCH_CUSTOM_LIB);
+  option->format = BENCH_FORMAT_JSON;
+  option->out = stdout;
+}
+
+/**
+ * @brief Main function of the benchmark.
+ */
+int
+main (int argc, char **argv)
+{
+  bench_option_s option;
+  bench_case_s c;
+  bench_result_s result;
+  unsigned int s, t, p, m, d, n, index = 0U;
+  int ret, status = 0;
+
+  _bench_init_options (&option);
+
+  if (!_bench_parse_options (argc, argv, &option) || option.help) {
+    _bench_print_usage (argv[0]);
+    status = option.help ? 0 : 1;
+    goto done;
+  }
+
+  if (BENCH_FORMAT_CSV == option.format)
+    fprintf (option.out, "scenario,transport,payload,mems,meta,clients,"
+        "messages,received,p50_us,p99_us,msgs_per_sec,cpu_us_per_msg\n");
+
+  for (s = 0; s < BENCH_SCENARIO_MAX; s++) {
+    for (t = 0; t < BENCH_TRANSPORT_MAX; t++) {
+      if (!option.scenarios[s] || !option.transports[t])
+        continue;
+
+      c.scenario = (bench_scenario_e) s;
+      c.transport = (bench_transport_e) t;
+      if (!_bench_case_is_valid (&c)) {
+        fprintf (stderr, "Skip %s over %s, it is not supported.\n",
+            bench_scenario_names[s], bench_transport_names[t]);
+        continue;
+      }
+
+      for (p = 0; p < option.payloads.num; p++) {
+        for (m = 0; m < option.mems.num; m++) {
+          for (d = 0; d < option.metas.num; d++) {
+            for (n = 0; n < option.clients.num; n++) {
+              c.payload = option.payloads.values[p];
+              c.mems = option.mems.values[m];
+              c.meta = option.metas.values[d];
+              c.clients = option.clients.values[n];
+
+              ret = _bench_run_case (&option, &c, index++, &result);
+              if (NNS_EDGE_ERROR_NOT_SUPPORTED == ret) {
+                fprintf (stderr, "Skip %s over %s, it is not supported in "
+                    "this build.\n", bench_scenario_names[s],
+                    bench_transport_names[t]);
+                continue;
+              } else if (NNS_EDGE_ERROR_NONE != ret) {
+                fprintf (stderr, "Failed to run %s over %s (error %d).\n",
+                    bench_scenario_names[s], bench_transport_names[t], ret);
+                status = 1;
+                continue;
+              }
+
+              _bench_print_result (&option, &c, &result);
+              if (result.received < result.messages)
+                status = 1;
+            }
+          }
+        }
+      }
+    }
+  }
+
+done:
+  if (option.out != stdout)
+    fclose (option.out);
+  SAFE_FREE (option.broker_host);
+  SAFE_FREE (option.custom_lib);
+  return status;
+}
@@ -19,10 +19,18 @@
 extern "C" {
 #endif /* __cplusplus */
 
+/**
+ * @brief The version of custom connection interface.
+ * @details Version 1 has the functions from nns_edge_custom_get_description to nns_edge_custom_get_info.
+ * Version 2 appends the optional functions to send the batch of data and to allocate the buffers of the custom connection.
+ */
+#define NNS_EDGE_CUSTOM_VERSION 2U
+
 /**
  * @brief NNStreamer Edge custom connection definition. This is used to define a custom connection.
  * The user should implement the functions and provide them using nns_edge_custom_get_instance().
  * Refer to the example in nnstreamer-edge-custom-test.c for more details.
+ * @note NNStreamer-edge reads the functions added in version 2 only if the library provides nns_edge_custom_get_version() and it returns 2 or higher. The library built with version 1 works without changes.
  */
 typedef struct
 {
@@ -40,6 +48,11 @@ typedef struct
   int (*nns_edge_custom_send_data) (void *priv, nns_edge_data_h data_h);
   int (*nns_edge_custom_set_info) (void *priv, const char *key, const char *value);
   int (*nns_edge_custom_get_info) (void *priv, const char *key, char **value);
+
+  /* Optional functions since version 2, set NULL if not supported. */
+  int (*nns_edge_custom_send_batch) (void *priv, nns_edge_data_h *data_h, unsigned int count); /**< Send the array of data at once. If null, nns_edge_custom_send_data is called for each data. */
+  int (*nns_edge_custom_alloc_buffer) (void *priv, nns_size_t size, void **data); /**< Allocate the buffer for the memory of edge data, e.g., in the registered memory region. */
+  void (*nns_edge_custom_release_buffer) (void *data); /**< Release the buffer allocated with nns_edge_custom_alloc_buffer. This is used as the destroy callback of the memory in edge data. */
 } nns_edge_custom_s;
 
 /**
@@ -47,6 +60,12 @@ typedef struct
  */
 const nns_edge_custom_s * nns_edge_custom_get_instance (void);
 
+/**
+ * @brief Get the version of custom connection interface, the library implementing the functions added in version 2 should return #NNS_EDGE_CUSTOM_VERSION.
+ * @note This function is optional. If the library does not provide it, the custom connection is handled as version 1.
+ */
+unsigned int nns_edge_custom_get_version (void);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
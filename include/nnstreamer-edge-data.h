@@ -33,6 +33,19 @@ typedef int64_t nns_ssize_t;
  */
 typedef void (*nns_edge_data_destroy_cb) (void *data);
 
+/**
+ * @brief Callback called to allocate the memory of nnstreamer-edge data.
+ * @param[in] size The size of the memory.
+ * @param[in] user_data The user data given with nns_edge_data_set_allocator().
+ * @return Newly allocated memory, or NULL if failed to allocate.
+ */
+typedef void *(*nns_edge_data_alloc_cb) (nns_size_t size, void *user_data);
+
+/**
+ * @brief Callback called to release the memory allocated with #nns_edge_data_alloc_cb.
+ */
+typedef void (*nns_edge_data_free_cb) (void *data, void *user_data);
+
 /**
  * @brief Create a handle used for data transmission.
  * @remarks If the function succeeds, @a data_h should be released using nns_edge_data_destroy().
@@ -164,6 +177,52 @@ int nns_edge_data_get_info (nns_edge_data_h data_h, const char *key, char **valu
  */
 int nns_edge_data_clear_info (nns_edge_data_h data_h);
 
+/**
+ * @brief Set the client ID to route edge data. It is same as setting the information with the key 'client_id'.
+ * @note The client ID is kept in the data handle and cleared with nns_edge_data_clear_info().
+ * @param[in] data_h The edge data handle.
+ * @param[in] client_id The client ID of the connection to send the data.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int nns_edge_data_set_client_id (nns_edge_data_h data_h, int64_t client_id);
+
+/**
+ * @brief Get the client ID to route edge data. The edge handle sets the client ID of the connection when receiving the data.
+ * @param[in] data_h The edge data handle.
+ * @param[out] client_id The client ID of the data.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid, or the data does not have the client ID.
+ */
+int nns_edge_data_get_client_id (nns_edge_data_h data_h, int64_t *client_id);
+
+/**
+ * @brief Get the request ID of edge data. The query client sets new request ID when sending the request with nns_edge_send_request(), and the response has same request ID.
+ * @note The request ID is kept in the data handle like the client ID, it is also available with the info key 'request_id'. The query server keeps the request ID if it sends the received data or its copy.
+ * @param[in] data_h The edge data handle.
+ * @param[out] request_id The request ID of the data.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid, or the data does not have the request ID.
+ */
+int nns_edge_data_get_request_id (nns_edge_data_h data_h, uint64_t *request_id);
+
+/**
+ * @brief Get the round-trip time of the request. The query client measures it when receiving the response of the request sent with nns_edge_send_request().
+ * @param[in] data_h The edge data handle.
+ * @param[out] rtt The round-trip time in microseconds.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid, or the round-trip time is not measured.
+ */
+int nns_edge_data_get_request_rtt (nns_edge_data_h data_h, int64_t *rtt);
+
 /**
  * @brief Validate edge data handle.
  * @param[in] data_h The edge data handle.
@@ -213,6 +272,21 @@ int nns_edge_data_deserialize_meta (nns_edge_data_h data_h, const void *data, co
  */
 int nns_edge_data_serialize (nns_edge_data_h data_h, void **data, nns_size_t *data_len);
 
+/**
+ * @brief Serialize entire edge data (meta data + raw data) into the buffer of the caller, without allocating new buffer.
+ * @details If @a data is NULL or @a data_len is less than the size of serialized edge data, this function returns #NNS_EDGE_ERROR_OUT_OF_MEMORY and @a len has the required size. Then call this function again with the buffer of the size.
+ * @param[in] data_h The handle to the edge data.
+ * @param[out] data The buffer to store the serialized edge data.
+ * @param[in] data_len The size of the buffer.
+ * @param[out] len A pointer to store the length of the serialized edge data.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #NNS_EDGE_ERROR_OUT_OF_MEMORY The buffer is not enough to store the serialized edge data.
+ */
+int nns_edge_data_serialize_into (nns_edge_data_h data_h, void *data, nns_size_t data_len, nns_size_t *len);
+
 /**
  * @brief Deserialize entire edge data (meta data + raw data).
  * @param[in] data_h The handle to the edge data.
@@ -225,6 +299,21 @@ int nns_edge_data_serialize (nns_edge_data_h data_h, void **data, nns_size_t *da
  */
 int nns_edge_data_deserialize (nns_edge_data_h data_h, const void *data, const nns_size_t data_len);
 
+/**
+ * @brief Deserialize entire edge data (meta data + raw data) without copying the memories.
+ * @details The memories in edge data refer to the slices of given buffer. If the function succeeds, the edge data takes the ownership of the buffer, and @a destroy_cb is called for the buffer when the memories are removed or the last reference of the edge data is destroyed.
+ * @note The memories are not aligned, these have the offsets in serialized buffer.
+ * @param[in] data_h The handle to the edge data.
+ * @param[in] data The serialized edge data.
+ * @param[in] data_len Length of the serialized edge data.
+ * @param[in] destroy_cb The callback to release the buffer. It can be null if the caller releases the buffer after destroying the edge data.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int nns_edge_data_deserialize_nocopy (nns_edge_data_h data_h, void *data, const nns_size_t data_len, nns_edge_data_destroy_cb destroy_cb);
+
 /**
  * @brief Check given data is serialized buffer.
  * @param[in] data A serialized edge data to check.
@@ -236,6 +325,22 @@ int nns_edge_data_deserialize (nns_edge_data_h data_h, const void *data, const n
  */
 int nns_edge_data_is_serialized (const void *data, const nns_size_t data_len);
 
+/**
+ * @brief Set the allocator of the memories which nnstreamer-edge allocates for edge data.
+ * @details The allocator is used for the memories of the received data, the copied data (nns_edge_data_copy()) and the deserialized data (nns_edge_data_deserialize()), so the memories can be placed in the region the application prefers, e.g., huge pages, NUMA-local or pinned memory.
+ * The allocator is used in every edge handle of the process. Set null to both callbacks to use the default allocator.
+ * @note The allocator cannot be changed while there are memories allocated with current allocator and not released yet. It is recommended to set it before creating the edge handles.
+ * @param[in] alloc_cb The callback to allocate the memory.
+ * @param[in] free_cb The callback to release the memory.
+ * @param[in] user_data The user data passed to the callbacks.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #NNS_EDGE_ERROR_IO The memories allocated with current allocator are not released yet.
+ */
+int nns_edge_data_set_allocator (nns_edge_data_alloc_cb alloc_cb, nns_edge_data_free_cb free_cb, void *user_data);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -33,6 +33,9 @@ typedef enum {
   NNS_EDGE_EVENT_CONNECTION_COMPLETED,
   NNS_EDGE_EVENT_CONNECTION_FAILURE,
   NNS_EDGE_EVENT_DEVICE_FOUND,
+  NNS_EDGE_EVENT_NEW_BATCH_RECEIVED, /**< Batch of received data, if the edge handle is set to invoke the callback once for each batch. (BATCH_EVENT=BATCH) */
+  NNS_EDGE_EVENT_STATISTICS, /**< Statistics of edge handle, invoked periodically if the interval is set. (STATISTICS_INTERVAL) */
+  NNS_EDGE_EVENT_NEW_CHUNK_RECEIVED, /**< Chunk of large edge data, if the edge handle is set to invoke the callback for each chunk. (CHUNK_EVENT=TRUE) */
 
   NNS_EDGE_EVENT_CUSTOM = 0x01000000
 } nns_edge_event_e;
@@ -57,7 +60,7 @@ typedef int (*nns_edge_event_cb) (nns_edge_event_h event_h, void *user_data);
 int nns_edge_event_get_type (nns_edge_event_h event_h, nns_edge_event_e *event);
 
 /**
- * @brief Parse edge event (NNS_EDGE_EVENT_NEW_DATA_RECEIVED) and get received data.
+ * @brief Parse edge event (NNS_EDGE_EVENT_NEW_DATA_RECEIVED or NNS_EDGE_EVENT_NEW_CHUNK_RECEIVED) and get received data.
  * @remarks If the function succeeds, @a data_h should be released using nns_edge_data_destroy().
  * @param[in] event_h The edge event handle.
  * @param[out] data_h Handle of received data.
@@ -67,6 +70,28 @@ int nns_edge_event_get_type (nns_edge_event_h event_h, nns_edge_event_e *event);
  */
 int nns_edge_event_parse_new_data (nns_edge_event_h event_h, nns_edge_data_h *data_h);
 
+/**
+ * @brief Parse edge event (NNS_EDGE_EVENT_NEW_BATCH_RECEIVED) and get the number of data in the batch.
+ * @param[in] event_h The edge event handle.
+ * @param[out] count The number of received data.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid
+ */
+int nns_edge_event_parse_batch_count (nns_edge_event_h event_h, unsigned int *count);
+
+/**
+ * @brief Parse edge event (NNS_EDGE_EVENT_NEW_BATCH_RECEIVED) and get received data of given index.
+ * @remarks If the function succeeds, @a data_h should be released using nns_edge_data_destroy().
+ * @param[in] event_h The edge event handle.
+ * @param[in] index The index of the data in the batch.
+ * @param[out] data_h Handle of received data.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid
+ */
+int nns_edge_event_parse_batch_data (nns_edge_event_h event_h, unsigned int index, nns_edge_data_h *data_h);
+
 /**
  * @brief Parse edge event (NNS_EDGE_EVENT_CAPABILITY) and get capability string.
  * @remarks If the function succeeds, @a capability should be released using free().
@@ -78,6 +103,17 @@ int nns_edge_event_parse_new_data (nns_edge_event_h event_h, nns_edge_data_h *da
  */
 int nns_edge_event_parse_capability (nns_edge_event_h event_h, char **capability);
 
+/**
+ * @brief Parse edge event (NNS_EDGE_EVENT_STATISTICS) and get statistics string.
+ * @remarks If the function succeeds, @a statistics should be released using free().
+ * @param[in] event_h The edge event handle.
+ * @param[out] statistics Statistics string, comma separated 'name=value' pairs. It is same as the value of the information 'STATISTICS'.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid
+ */
+int nns_edge_event_parse_statistics (nns_edge_event_h event_h, char **statistics);
+
 /**
  * @brief Util function to invoke event callback.
  * @param[in] event_cb Callback for the nnstreamer edge event.
@@ -47,6 +47,7 @@ typedef enum {
   NNS_EDGE_CONNECT_TYPE_MQTT,
   NNS_EDGE_CONNECT_TYPE_HYBRID,
   NNS_EDGE_CONNECT_TYPE_CUSTOM,
+  NNS_EDGE_CONNECT_TYPE_UDS, /**< Unix domain socket for the nodes running on same host. If the host is an absolute path, the node listens on the socket file and the port is ignored. Otherwise the socket name in the abstract namespace is made from the host and port. */
 
   NNS_EDGE_CONNECT_TYPE_UNKNOWN
 } nns_edge_connect_type_e;
@@ -63,6 +64,14 @@ typedef enum {
   NNS_EDGE_NODE_TYPE_UNKNOWN,
 } nns_edge_node_type_e;
 
+/**
+ * @brief Enumeration for the flags to send edge data.
+ */
+typedef enum {
+  NNS_EDGE_SEND_FLAG_NONE = 0,
+  NNS_EDGE_SEND_FLAG_TRANSFER = (1 << 0), /**< Transfer the ownership of edge data to the edge handle. The data is sent without copying the memories. */
+} nns_edge_send_flag_e;
+
 /**
  * @brief Create a handle representing an instance of edge-AI connection between a server and client (query) or a data publisher and scriber.
  * @remarks If the function succeeds, @a edge_h should be released using nns_edge_release_handle().
@@ -295,6 +304,52 @@ int nns_edge_disconnect (nns_edge_h edge_h);
  */
 int nns_edge_send (nns_edge_h edge_h, nns_edge_data_h data_h);
 
+/**
+ * @brief Send data to destination (broker or connected node) with the flags, asynchronously.
+ * @remarks If #NNS_EDGE_SEND_FLAG_TRANSFER is set and the function succeeds, the edge handle takes the ownership of @a data_h. Do not access or release @a data_h after calling this function. The memories in @a data_h are released using the destroy callback when the data is sent to all connected nodes. If the function fails, the caller still owns @a data_h.
+ * @param[in] edge_h The edge handle.
+ * @param[in] data_h The edge data to be sent.
+ * @param[in] flags The bitwise-OR of #nns_edge_send_flag_e.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #NNS_EDGE_ERROR_IO Failed to transfer the data.
+ */
+int nns_edge_send_full (nns_edge_h edge_h, nns_edge_data_h data_h, unsigned int flags);
+
+/**
+ * @brief Allocate the buffer to fill the memory of edge data to be sent.
+ * @details The custom connection may provide the buffer in its own memory (e.g., the memory region registered to the device) to send the data without copying. Otherwise, the buffer is allocated using nns_edge_malloc().
+ * Add the buffer into edge data with @a destroy_cb using nns_edge_data_add(), and send it using nns_edge_send_full() with #NNS_EDGE_SEND_FLAG_TRANSFER to avoid copying the memory.
+ * @param[in] edge_h The edge handle.
+ * @param[in] size The size of the buffer.
+ * @param[out] data The allocated buffer.
+ * @param[out] destroy_cb The callback to release the buffer.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #NNS_EDGE_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int nns_edge_alloc_buffer (nns_edge_h edge_h, nns_size_t size, void **data, nns_edge_data_destroy_cb *destroy_cb);
+
+/**
+ * @brief Send the request from query client to the server with new request ID, asynchronously.
+ * @details The query client keeps several requests in flight. The response of the server has same request ID, get it with nns_edge_data_get_request_id() and the round-trip time with nns_edge_data_get_request_rtt() when receiving the data. If the number of in-flight requests reaches REQUEST_WINDOW, this function waits for the response of previous request or until the oldest request exceeds REQUEST_TIMEOUT. The waiting is cancelled when the edge handle is stopped or released, and the requests sent to the closed connection are dropped from the window.
+ * @note The server should send the received data or its copy to keep the request ID. The request ID is delivered to the node which supports compact header.
+ * @param[in] edge_h The edge handle of query client.
+ * @param[in] data_h The edge data to be sent. The edge handle sends the copy of the data.
+ * @param[out] request_id The request ID of the data. It can be null.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_NOT_SUPPORTED Not supported, the edge handle is not query client.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #NNS_EDGE_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ * @retval #NNS_EDGE_ERROR_IO Failed to transfer the data.
+ */
+int nns_edge_send_request (nns_edge_h edge_h, nns_edge_data_h data_h, uint64_t *request_id);
+
 /**
  * @brief Check whether edge is connected or not.
  * @param[in] edge_h The edge handle.
@@ -319,13 +374,51 @@ int nns_edge_is_connected (nns_edge_h edge_h);
  * key                  | value
  * ---------------------|--------------------------------------------------------------
  * CAPS or CAPABILITY   | capability strings.
- * IP or HOST           | IP address of the node to accept connection from other node.
+ * IP or HOST           | IP address of the node to accept connection from other node. With NNS_EDGE_CONNECT_TYPE_UDS, it can be the absolute path of the socket file.
  * PORT                 | Port of the node to accept connection from other node. The value should be 0 or higher, if the port is set to 0 then the available port is allocated.
  * DEST_IP or DEST_HOST | IP address of the destination node. In case of TCP connection, it is the IP address of the destination node, and in the case of Hybrid or MQTT connection, it is the IP address of the broker.
  * DEST_PORT            | Port of the destination node. In case of TCP connection, it is the port number of the destination node, and in the case of Hybrid or MQTT connection, it is the port number of the broker. The value should be 0 or higher.
  * TOPIC                | Topic used to publish/subscribe to/from the broker.
- * QUEUE_SIZE           | Max number of data in the queue, when sending edge data to other node. Default 0 means unlimited. N:<leaky [NEW, OLD]> where leaky 'OLD' drops old buffer (default NEW). (e.g., QUEUE_SIZE=5:OLD drops old buffer and pushes new data when queue size reaches 5.)
+ * QUEUE_SIZE           | Max number of data in the queue, when sending edge data to other node. Default 0 means unlimited. N:<leaky [NEW, OLD]> where leaky 'OLD' drops old buffer (default NEW). (e.g., QUEUE_SIZE=5:OLD drops old buffer and pushes new data when queue size reaches 5.) The max size is 65536. If the size is set before starting the edge handle, the queue is preallocated with given size. After starting the edge handle, the preallocated queue is not reallocated, so the new size should not be larger than the preallocated size and 0 (unlimited) is not allowed.
  * ID or CLIENT_ID      | Unique identifier of the edge handle or client ID. (Read-only)
+ * IO_MODE              | I/O mode to handle the TCP connections, it should be set before starting the edge handle. THREAD (default) creates a message thread for each connection. REACTOR:<N workers> watches all sockets in one event thread and handles ready sockets in N worker threads (default 4). (e.g., IO_MODE=REACTOR:8)
+ * POOL_SIZE            | Max number of buffers kept in each size class of the pool, to reuse the buffers when receiving data from other node. Default 0 means the pool is disabled. (e.g., POOL_SIZE=4)
+ * CONN_QUEUE_SIZE      | Max number of data in the queue of each connection, to send data to the connected nodes in parallel (fan-out). Default 0 means the send thread sends data to each node in turn. N:<leaky [NEW, OLD]> where leaky 'NEW' drops new data for the lagging node only (default OLD). It is applied to the queue created after setting the value, the queue of each connection is preallocated with given size. (e.g., CONN_QUEUE_SIZE=4:OLD)
+ * DISPATCH_THREADS     | Number of worker threads to invoke the event callback for new data (max 64), it should be set before starting the edge handle. The message thread pushes the copy of received data into the queue of the worker and reads next data without waiting for the callback. The data from same node is delivered in order by one worker. Default 0 means the message thread invokes the callback. It is applied to TCP, UDS and hybrid connections. (e.g., DISPATCH_THREADS=2)
+ * DISPATCH_QUEUE_SIZE  | Max number of events in the queue of each dispatch worker, it should be set before starting the edge handle. 0 means unlimited. N:<leaky [NEW, OLD]> where leaky 'NEW' drops new data if the callback is slow (default 64:OLD).
+ * BATCH_COUNT          | Max number of edge data sent in one message (max 64). It should be set before starting the edge handle. The send thread sends the batch when it reaches max count, BATCH_BYTES or BATCH_DELAY. Default 0 means disabled. It is applied to the connected node which supports it, and it is not applied in fan-out mode (CONN_QUEUE_SIZE). (e.g., BATCH_COUNT=16)
+ * BATCH_BYTES          | Max bytes of the memories in one batch. Default 0 means no limit.
+ * BATCH_DELAY          | Max delay in microseconds for the first data in the batch to wait for next data. Default 0 means the batch is sent when the send queue is empty. (e.g., BATCH_DELAY=2000)
+ * BATCH_EVENT          | Event type to receive the batch. SPLIT (default) invokes NNS_EDGE_EVENT_NEW_DATA_RECEIVED for each data in the batch. BATCH invokes NNS_EDGE_EVENT_NEW_BATCH_RECEIVED once for the batch.
+ * REQUEST_WINDOW       | Max number of in-flight requests of query client (max 4096), which are sent with nns_edge_send_request() and waiting for the response. It should be set before starting the edge handle. (default 64)
+ * REQUEST_TIMEOUT      | Timeout in milliseconds to wait for the response of the request. The request is removed from the window after timeout. 0 means no timeout. (default 10000)
+ * REQUEST_COUNT        | Number of in-flight requests of query client. (Read-only)
+ * SERVER_COUNT         | Max number of servers the query client connects to (max 64). It requires DUPLEX connection mode. In hybrid type, the client connects to the servers found from the broker, otherwise call nns_edge_connect() for each server. (default 1)
+ * CONFLATE             | TRUE or FALSE (default). If TRUE, the node sends and delivers the latest data only, it should be set before starting the edge handle. The sender keeps the latest data not sent yet for each connection (the data waiting in the queue is replaced with new data), and the receiver does not invoke the callback for the data if newer data is already received. In MQTT and custom connections, the sender skips the data if newer data is in the send queue. With DISPATCH_THREADS, the events waiting in the queue of the worker are not skipped.
+ * LOAD_BALANCE         | Policy of query client to select the server to send data, it should be set before starting the edge handle. NONE (default) sends data to the client ID in data or all servers. ROUND_ROBIN sends data to each server in turn. LEAST_OUTSTANDING selects the server with the fewest requests waiting for the response, plus the load of the server. LOWEST_LATENCY selects the server with the lowest round-trip time.
+ * LOAD                 | Load of query server advertised to the clients in hybrid type. The server publishes new load to the broker when it is changed, and the client gets it when connecting to the server. (default 0)
+ * FLOW_CREDITS         | Number of data the connected node can send before receiving the callback result of this node (max 65535), it should be set before starting the edge handle. This node grants the credits to the sender after the handshake, and grants them again as the event callback consumes received data, so the sender does not fill the socket buffers with the data this node cannot handle. Default 0 means disabled. It is applied to TCP, UDS and hybrid connections, and the sender should support it. (e.g., FLOW_CREDITS=8)
+ * FLOW_CONTROL         | Policy to send data when the connected node does not grant the credits (see FLOW_CREDITS). DROP (default) drops new data until the node grants new credits. COALESCE keeps the latest data and sends it when the node grants new credits.
+ * SHM_SIZE             | Size in bytes of the shared memory ring to send data to the node running on same host. The node on same host maps the memories of received data from the ring without copying data over the socket. If the ring is full, data is sent with the socket. Default 0 means disabled. It is applied to the connection created after setting the value. (e.g., SHM_SIZE=16777216)
+ * CONNECTION_MODE      | Connection mode of query client, it should be set before starting the edge handle. PAIR (default) starts the listener and the server connects to it to send the results. DUPLEX sends the requests and receives the results with one socket, the client does not start the listener and it works behind NAT. The server should support duplex connection.
+ * HANDSHAKE_WORKERS    | Number of worker threads to handle the handshake of accepted sockets, it should be set before starting the edge handle. The listener passes new socket to the worker and accepts next socket without waiting for the peer. (default 4)
+ * HANDSHAKE_TIMEOUT    | Timeout in milliseconds to send and receive the handshake messages with the peer of accepted socket. The connection is closed if the peer does not respond in time. 0 means no timeout. (default 5000)
+ * DATA_HEADER          | Header format to send edge data. AUTO (default) uses compact header if the connected node supports it, and legacy header in MQTT connection. COMPACT also uses compact header in MQTT connection, all subscribers should support it. LEGACY always uses fixed size header for old nodes.
+ * MQTT_QOS             | QoS level (0, 1 or 2) to publish edge data in MQTT connection. 0 sends data without the acknowledgement of the broker. (default 1)
+ * MQTT_RETAIN          | TRUE (default) or FALSE. If TRUE, the broker keeps the last edge data and delivers it to new subscriber. Set FALSE for the stream of data.
+ * MQTT_HOST_QOS        | QoS level (0, 1 or 2) to publish the host info of the server in hybrid connection. (default 1)
+ * MQTT_HOST_RETAIN     | TRUE (default) or FALSE. If TRUE, the broker keeps the host info of the server, then the client started later finds the server.
+ * COMPRESSION          | Compression of the memories to send, NONE (default), ZLIB, LZ4 or ZSTD. The algorithm is available if its library is found when building nnstreamer-edge. The memory is compressed only if the connected node supports the algorithm, and the memory which does not compress is sent as it is. It is applied to the connection created after setting the value. In MQTT connection, all subscribers should support the compression.
+ * COMPRESSION_THRESHOLD | Size in bytes of the memory to compress. The smaller memory is sent without compression. (default 1024)
+ * CHUNK_SIZE           | Size in bytes of the chunk to send large edge data (min 1024), it should be set before starting the edge handle. The edge data larger than the chunk size is split into the chunks, and each connection sends one chunk of each large data in turn with other data, so the small data is not delayed by the large data. The data may be received in different order. The chunks are sent without shared memory and compression. Default 0 means disabled. It is applied to TCP, UDS and hybrid connections, and the receiver should support it. The data is sent with the queue of each connection (see CONN_QUEUE_SIZE) and BATCH_COUNT is not applied. (e.g., CHUNK_SIZE=1048576)
+ * CHUNK_EVENT          | TRUE or FALSE (default). It should be set before starting the edge handle. If TRUE, the receiver does not keep the memories of large edge data and invokes NNS_EDGE_EVENT_NEW_CHUNK_RECEIVED for each chunk. The data in the event has one memory of the chunk and the information 'chunk_id' (ID of the edge data in the connection), 'mem_index', 'mem_count', 'mem_size' (total size of the memory), 'chunk_offset' (offset in the memory) and 'chunk_last' (TRUE for the last chunk). The first chunk also has the information of the edge data.
+ * CAPABILITY_CACHE     | TRUE or FALSE (default). If TRUE, the query client keeps the capability and version of the server accepted by NNS_EDGE_EVENT_CAPABILITY, and does not invoke the event again when it connects to the server with same capability and version.
+ * CONNECT_PARALLEL     | The number of servers (1 ~ 8, default 1) the query client connects in parallel when it finds new server in hybrid connection. The first server connected is used and the others are closed. The server failed to connect is not tried again for a while (100 ms ~ 5 seconds, doubled for each failure) until it announces itself again.
+ * STANDBY              | TRUE or FALSE (default). It should be set before starting the edge handle and is applied to the query client in duplex mode. If TRUE, the query client keeps one more connection to other server after the handshake, and sends data to the standby server without new handshake when the connection is lost. In TCP and UDS connection, the standby server is given with nns_edge_connect() after the first connection. In hybrid connection, the query client finds it using the broker.
+ * STATISTICS           | Statistics of the edge handle, comma separated 'name=value' pairs. (Read-only) frames_sent, bytes_sent, frames_received and bytes_received count the edge data and the size of its memories (the data sent to N nodes is counted N times, and the size of the serialized message in MQTT connection). send_errors is the number of failures to send data. queue_depth and queue_dropped are the number of data in the send queue and dropped by the leaky option of QUEUE_SIZE. conn_dropped is the number of data dropped in the queues of CONN_QUEUE_SIZE. credit_dropped is the number of data dropped or replaced by newer data without the credits of FLOW_CREDITS. conflated is the number of old data skipped by CONFLATE. With STATISTICS_TIMING, it also has the count, average, max, 50th and 99th percentile in microseconds of serialize, send and callback durations (e.g., send_p99_us). The received data is not counted in the custom connection.
+ * STATISTICS_CONNECTIONS | Statistics of each connection separated by ';', with client_id, frames_sent, bytes_sent, frames_received, bytes_received, queue_depth and queue_dropped of the connection. (Read-only)
+ * STATISTICS_TIMING    | TRUE or FALSE (default). If TRUE, the edge handle measures the durations to prepare and send the data, and to invoke the event callback for new data.
+ * STATISTICS_INTERVAL  | Interval in milliseconds to invoke NNS_EDGE_EVENT_STATISTICS while the edge handle is started. The event has the value of STATISTICS, see nns_edge_event_parse_statistics(). Default 0 means disabled. (e.g., STATISTICS_INTERVAL=1000)
  */
 int nns_edge_set_info (nns_edge_h edge_h, const char *key, const char *value);
 
@@ -3,6 +3,7 @@
 # Default features for Tizen releases
 %define     mqtt_support 1
 %define     custom_connection_support 1
+%define     compression_support 1
 
 # Define features for TV releases
 %if "%{?profile}" == "tv"
@@ -36,6 +37,12 @@ BuildRequires:  pkgconfig(dlog)
 BuildRequires:  pkgconfig(libmosquitto)
 %endif
 
+%if 0%{?compression_support}
+BuildRequires:  pkgconfig(zlib)
+BuildRequires:  pkgconfig(liblz4)
+BuildRequires:  pkgconfig(libzstd)
+%endif
+
 %if 0%{?unit_test}
 BuildRequires:  gtest-devel
 BuildRequires:  procps
@@ -94,6 +101,12 @@ HTML pages of lcov results of nnstreamer-edge generated during rpm build
 %define enable_custom_connection -DENABLE_CUSTOM_CONNECTION=OFF
 %endif
 
+%if 0%{?compression_support}
+%define enable_compression -DENABLE_COMPRESSION=ON
+%else
+%define enable_compression -DENABLE_COMPRESSION=OFF
+%endif
+
 %prep
 %setup -q
 cp %{SOURCE1001} .
@@ -120,7 +133,8 @@ pushd build
 %cmake .. \
     -DCMAKE_INSTALL_PREFIX=%{_prefix} \
     -DVERSION=%{version} \
-    %{enable_tizen} %{enable_unittest} %{enable_mqtt} %{enable_custom_connection}
+    %{enable_tizen} %{enable_unittest} %{enable_mqtt} %{enable_custom_connection} \
+    %{enable_compression}
 
 make %{?jobs:-j%jobs}
 popd
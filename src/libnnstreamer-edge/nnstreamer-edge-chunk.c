@@ -0,0 +1,302 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   nnstreamer-edge-chunk.c
+ * @date   14 October 2026
+ * @brief  Chunked transfer of large edge data.
+ * @see    https://github.com/nnstreamer/nnstreamer-edge
+ * @author agent <agent@local>
+ * @bug    No known bugs except for NYI items
+ */
+
+#include "nnstreamer-edge-chunk.h"
+#include "nnstreamer-edge-data-internal.h"
+#include "nnstreamer-edge-log.h"
+#include "nnstreamer-edge-request.h"
+
+/**
+ * @brief Check the edge data should be sent in chunks, the connected node should support it.
+ */
+bool
+nns_edge_chunk_is_needed (nns_edge_conn_s * conn, nns_edge_data_h data_h)
+{
+  if (conn->chunk_size == 0U || !(conn->features & NNS_EDGE_FEATURE_CHUNK))
+    return false;
+
+  return (nns_edge_stats_get_data_size (data_h) > conn->chunk_size);
+}
+
+/**
+ * @brief Send next chunk of the edge data. Each chunk has the part of one memory, max chunk_size bytes.
+ * @param[out] done True if the last chunk of the edge data is sent.
+ */
+int
+nns_edge_chunk_send (nns_edge_conn_s * conn, nns_edge_chunk_tx_s * tx,
+    int64_t client_id, bool *done)
+{
+  nns_edge_cmd_s cmd;
+  nns_edge_chunk_desc_s desc;
+  nns_size_t size, len;
+  unsigned int num;
+  void *mem;
+  int ret;
+
+  ret = nns_edge_data_get_count (tx->data_h, &num);
+  if (ret == NNS_EDGE_ERROR_NONE)
+    ret = nns_edge_data_get (tx->data_h, tx->index, &mem, &size);
+  if (ret != NNS_EDGE_ERROR_NONE) {
+    nns_edge_loge ("Failed to get the memory to send the chunk.");
+    return ret;
+  }
+
+  len = size - tx->offset;
+  if (len > conn->chunk_size)
+    len = conn->chunk_size;
+
+  memset (&desc, 0, sizeof (nns_edge_chunk_desc_s));
+  desc.transfer_id = tx->transfer_id;
+  desc.index = tx->index;
+  desc.num = num;
+  desc.last = (tx->index + 1U == num && tx->offset + len == size) ? 1U : 0U;
+  desc.mem_size = size;
+  desc.offset = tx->offset;
+
+  nns_edge_cmd_init (&cmd, _NNS_EDGE_CMD_TRANSFER_CHUNK, client_id);
+  cmd.info.num = 2U;
+  cmd.mem[0] = &desc;
+  cmd.info.mem_size[0] = sizeof (nns_edge_chunk_desc_s);
+  cmd.mem[1] = (char *) mem + tx->offset;
+  cmd.info.mem_size[1] = len;
+
+  if (tx->index == 0U && tx->offset == 0U) {
+    /* The serialized metadata is cached in edge data, do not release it. */
+    ret = nns_edge_data_get_serialized_meta (tx->data_h,
+        (const void **) &cmd.meta, &cmd.info.meta_size);
+    if (ret != NNS_EDGE_ERROR_NONE) {
+      nns_edge_loge ("Failed to serialize meta");
+      return ret;
+    }
+
+    if (nns_edge_data_get_request_id (tx->data_h, &cmd.request_id) !=
+        NNS_EDGE_ERROR_NONE)
+      cmd.request_id = 0;
+  }
+
+  ret = nns_edge_cmd_send (conn, &cmd);
+  if (ret != NNS_EDGE_ERROR_NONE) {
+    nns_edge_loge ("Failed to send the chunk to destination (%s:%d).",
+        conn->host, conn->port);
+    return ret;
+  }
+
+  tx->offset += len;
+  if (tx->offset >= size) {
+    tx->index++;
+    tx->offset = 0U;
+  }
+
+  *done = (desc.last != 0U);
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Release the edge data being received in chunks.
+ */
+void
+nns_edge_chunk_clear (nns_edge_conn_s * conn)
+{
+  nns_edge_chunk_rx_s *rx;
+  unsigned int i;
+
+  for (i = 0; i < conn->chunk_rx_len; i++) {
+    rx = &conn->chunk_rx[i];
+
+    if (rx->mem)
+      nns_edge_data_free_mem (rx->mem);
+    nns_edge_data_destroy (rx->data_h);
+    memset (rx, 0, sizeof (nns_edge_chunk_rx_s));
+  }
+
+  conn->chunk_rx_len = 0U;
+}
+
+/**
+ * @brief Invoke the callback for the chunk, the receiver does not keep the memories of edge data.
+ * @note The edge data in the event has one memory of the chunk, and the information of the chunk. The first chunk also has the information of edge data.
+ */
+static int
+_nns_edge_chunk_dispatch (nns_edge_handle_s * eh, nns_edge_conn_s * conn,
+    nns_edge_cmd_s * cmd, nns_edge_chunk_desc_s * desc, int64_t client_id)
+{
+  nns_edge_data_h data_h;
+  char value[32];
+  int ret;
+
+  if (!conn->recv_data) {
+    ret = nns_edge_data_create (&conn->recv_data);
+    if (ret != NNS_EDGE_ERROR_NONE) {
+      nns_edge_loge ("Failed to create data handle in msg thread.");
+      conn->recv_data = NULL;
+      return NNS_EDGE_ERROR_NONE;
+    }
+  }
+  data_h = conn->recv_data;
+
+  nns_edge_data_add (data_h, cmd->mem[1], cmd->info.mem_size[1], NULL);
+
+  if (cmd->info.meta_size > 0)
+    nns_edge_data_deserialize_meta (data_h, cmd->meta, cmd->info.meta_size);
+  else
+    nns_edge_data_clear_info (data_h);
+
+  snprintf (value, sizeof (value), "%u", desc->transfer_id);
+  nns_edge_data_set_info (data_h, "chunk_id", value);
+  snprintf (value, sizeof (value), "%u", desc->index);
+  nns_edge_data_set_info (data_h, "mem_index", value);
+  snprintf (value, sizeof (value), "%u", desc->num);
+  nns_edge_data_set_info (data_h, "mem_count", value);
+  snprintf (value, sizeof (value), "%llu", (unsigned long long) desc->mem_size);
+  nns_edge_data_set_info (data_h, "mem_size", value);
+  snprintf (value, sizeof (value), "%llu", (unsigned long long) desc->offset);
+  nns_edge_data_set_info (data_h, "chunk_offset", value);
+  nns_edge_data_set_info (data_h, "chunk_last", desc->last ? "TRUE" : "FALSE");
+
+  nns_edge_data_set_client_id (data_h, client_id);
+  nns_edge_request_set_data (eh, data_h, cmd->request_id);
+
+  /* Count the edge data and grant its credit with the last chunk. */
+  if (conn->stats) {
+    nns_edge_stats_count (conn->stats->received, desc->last,
+        cmd->info.mem_size[1]);
+    nns_edge_stats_count (conn->received, desc->last, cmd->info.mem_size[1]);
+  }
+  if (desc->last)
+    nns_edge_balance_done (eh, conn);
+
+  /* The dispatch worker may take the data of the connection, new data is created with next chunk. */
+  if (nns_edge_dispatch_data (eh, conn, NNS_EDGE_EVENT_NEW_CHUNK_RECEIVED,
+          &conn->recv_data, 1U, desc->last, client_id,
+          cmd) != NNS_EDGE_ERROR_NONE)
+    nns_edge_logw ("The server does not accept data from client.");
+
+  if (conn->recv_data)
+    nns_edge_data_clear (conn->recv_data);
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Add the chunk into the edge data being received, and invoke the callback when all chunks are received.
+ */
+int
+nns_edge_chunk_process (nns_edge_handle_s * eh, nns_edge_conn_s * conn,
+    nns_edge_cmd_s * cmd, int64_t client_id)
+{
+  nns_edge_chunk_desc_s desc;
+  nns_edge_chunk_rx_s *rx = NULL;
+  nns_edge_data_h data_h;
+  uint64_t request_id;
+  nns_size_t len;
+  unsigned int i, count = 0U;
+
+  if (cmd->info.num != 2U ||
+      cmd->info.mem_size[0] != sizeof (nns_edge_chunk_desc_s))
+    goto invalid;
+
+  memcpy (&desc, cmd->mem[0], sizeof (nns_edge_chunk_desc_s));
+  len = cmd->info.mem_size[1];
+
+  if (desc.num == 0U || desc.num > NNS_EDGE_DATA_LIMIT ||
+      desc.index >= desc.num || len == 0U || desc.offset >= desc.mem_size ||
+      len > desc.mem_size - desc.offset)
+    goto invalid;
+
+  if (eh->chunk_event)
+    return _nns_edge_chunk_dispatch (eh, conn, cmd, &desc, client_id);
+
+  for (i = 0; i < conn->chunk_rx_len; i++) {
+    if (conn->chunk_rx[i].transfer_id == desc.transfer_id) {
+      rx = &conn->chunk_rx[i];
+      break;
+    }
+  }
+
+  if (!rx) {
+    /* New edge data starts with the first chunk of the first memory. */
+    if (desc.index != 0U || desc.offset != 0U ||
+        conn->chunk_rx_len >= NNS_EDGE_CHUNK_TRANSFERS)
+      goto invalid;
+
+    rx = &conn->chunk_rx[conn->chunk_rx_len];
+    memset (rx, 0, sizeof (nns_edge_chunk_rx_s));
+
+    if (nns_edge_data_create (&rx->data_h) != NNS_EDGE_ERROR_NONE) {
+      nns_edge_loge ("Failed to create data handle to receive the chunks.");
+      rx->data_h = NULL;
+      return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+    }
+
+    rx->transfer_id = desc.transfer_id;
+    rx->request_id = cmd->request_id;
+    conn->chunk_rx_len++;
+
+    if (cmd->info.meta_size > 0)
+      nns_edge_data_deserialize_meta (rx->data_h, cmd->meta,
+          cmd->info.meta_size);
+  }
+
+  nns_edge_data_get_count (rx->data_h, &count);
+
+  if (desc.offset == 0U) {
+    /* The memories are sent in order, allocate next memory with its first chunk. */
+    if (rx->mem || count != desc.index)
+      goto invalid;
+
+    rx->mem = nns_edge_data_alloc_mem (desc.mem_size);
+    if (!rx->mem) {
+      nns_edge_loge ("Failed to allocate memory to receive the chunks.");
+      return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+    }
+
+    rx->mem_size = desc.mem_size;
+    rx->received = 0U;
+  } else if (!rx->mem || count != desc.index ||
+      rx->mem_size != desc.mem_size || rx->received != desc.offset) {
+    goto invalid;
+  }
+
+  memcpy ((char *) rx->mem + desc.offset, cmd->mem[1], len);
+  rx->received += len;
+
+  if (rx->received == rx->mem_size) {
+    if (nns_edge_data_add (rx->data_h, rx->mem, rx->mem_size,
+            nns_edge_data_free_mem) != NNS_EDGE_ERROR_NONE)
+      goto invalid;
+
+    rx->mem = NULL;
+    count++;
+  }
+
+  if (desc.last) {
+    if (rx->mem || count != desc.num)
+      goto invalid;
+
+    data_h = rx->data_h;
+    request_id = rx->request_id;
+
+    conn->chunk_rx_len--;
+    memmove (rx, rx + 1, (char *) &conn->chunk_rx[conn->chunk_rx_len] -
+        (char *) rx);
+
+    /* The data has the memories of the chunks, the dispatch worker may take it. */
+    nns_edge_deliver_data (eh, conn, &data_h, request_id, client_id, NULL);
+    if (data_h)
+      nns_edge_data_destroy (data_h);
+  }
+
+  return NNS_EDGE_ERROR_NONE;
+
+invalid:
+  nns_edge_loge ("Invalid chunk from the connected node.");
+  return NNS_EDGE_ERROR_IO;
+}
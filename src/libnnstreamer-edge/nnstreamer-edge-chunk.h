@@ -0,0 +1,53 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   nnstreamer-edge-chunk.h
+ * @date   14 October 2026
+ * @brief  Chunked transfer of large edge data.
+ * @see    https://github.com/nnstreamer/nnstreamer-edge
+ * @author agent <agent@local>
+ * @note   This file is internal header for nnstreamer-edge. DO NOT export this file.
+ * @bug    No known bugs except for NYI items
+ */
+
+#ifndef __NNSTREAMER_EDGE_CHUNK_H__
+#define __NNSTREAMER_EDGE_CHUNK_H__
+
+#include "nnstreamer-edge-internal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @brief Check the edge data should be sent in chunks, the connected node should support it.
+ */
+bool nns_edge_chunk_is_needed (nns_edge_conn_s *conn, nns_edge_data_h data_h);
+
+/**
+ * @brief Send next chunk of the edge data. Each chunk has the part of one memory, max chunk_size bytes.
+ * @param[in] conn The connection to send the chunk.
+ * @param[in,out] tx The edge data sent in chunks, the position of next chunk is updated.
+ * @param[in] client_id The client ID of the connection.
+ * @param[out] done True if the last chunk of the edge data is sent.
+ * @return 0 on success. Otherwise a negative error value.
+ */
+int nns_edge_chunk_send (nns_edge_conn_s *conn, nns_edge_chunk_tx_s *tx, int64_t client_id, bool *done);
+
+/**
+ * @brief Release the edge data being received in chunks.
+ */
+void nns_edge_chunk_clear (nns_edge_conn_s *conn);
+
+/**
+ * @brief Add the chunk into the edge data being received, and invoke the callback when all chunks are received.
+ * @note If CHUNK_EVENT is set, the callback is invoked for each chunk and the receiver does not keep the memories.
+ * @return 0 on success. Otherwise the chunk is invalid, the connection should be removed.
+ */
+int nns_edge_chunk_process (nns_edge_handle_s *eh, nns_edge_conn_s *conn, nns_edge_cmd_s *cmd, int64_t client_id);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __NNSTREAMER_EDGE_CHUNK_H__ */
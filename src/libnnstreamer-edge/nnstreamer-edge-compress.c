@@ -0,0 +1,292 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   nnstreamer-edge-compress.c
+ * @date   14 October 2026
+ * @brief  Util functions to compress the memories of edge data.
+ * @see    https://github.com/nnstreamer/nnstreamer-edge
+ * @author agent <agent@local>
+ * @bug    No known bugs except for NYI items
+ */
+
+#if defined(ENABLE_ZLIB)
+#include <zlib.h>
+#endif
+#if defined(ENABLE_LZ4)
+#include <lz4.h>
+#endif
+#if defined(ENABLE_ZSTD)
+#include <zstd.h>
+#endif
+
+#include "nnstreamer-edge-compress.h"
+#include "nnstreamer-edge-log.h"
+#include "nnstreamer-edge-util.h"
+
+/**
+ * @brief The compression level, prefer the speed to bound the cost of sending data.
+ */
+#define NNS_EDGE_COMPRESS_LEVEL_ZLIB (1)
+#define NNS_EDGE_COMPRESS_LEVEL_ZSTD (1)
+
+/**
+ * @brief The names of the compression algorithms, the index is nns_edge_compress_e.
+ */
+static const char *_nns_edge_compress_names[] = {
+  [NNS_EDGE_COMPRESS_NONE] = "NONE",
+  [NNS_EDGE_COMPRESS_ZLIB] = "ZLIB",
+  [NNS_EDGE_COMPRESS_LZ4] = "LZ4",
+  [NNS_EDGE_COMPRESS_ZSTD] = "ZSTD",
+};
+
+/**
+ * @brief Get the compression algorithm from given name.
+ */
+nns_edge_compress_e
+nns_edge_compress_parse (const char *name)
+{
+  unsigned int i;
+
+  if (!STR_IS_VALID (name))
+    return NNS_EDGE_COMPRESS_UNKNOWN;
+
+  for (i = 0; i < NNS_EDGE_COMPRESS_UNKNOWN; i++) {
+    if (0 == strcasecmp (name, _nns_edge_compress_names[i]))
+      return (nns_edge_compress_e) i;
+  }
+
+  return NNS_EDGE_COMPRESS_UNKNOWN;
+}
+
+/**
+ * @brief Get the name of the compression algorithm.
+ */
+const char *
+nns_edge_compress_get_name (nns_edge_compress_e type)
+{
+  if (type < NNS_EDGE_COMPRESS_NONE || type >= NNS_EDGE_COMPRESS_UNKNOWN)
+    return NULL;
+
+  return _nns_edge_compress_names[type];
+}
+
+/**
+ * @brief Get the feature bit to advertise the compression algorithm.
+ */
+uint32_t
+nns_edge_compress_get_feature (nns_edge_compress_e type)
+{
+  switch (type) {
+    case NNS_EDGE_COMPRESS_ZLIB:
+      return NNS_EDGE_FEATURE_COMPRESS_ZLIB;
+    case NNS_EDGE_COMPRESS_LZ4:
+      return NNS_EDGE_FEATURE_COMPRESS_LZ4;
+    case NNS_EDGE_COMPRESS_ZSTD:
+      return NNS_EDGE_FEATURE_COMPRESS_ZSTD;
+    default:
+      break;
+  }
+
+  return 0U;
+}
+
+/**
+ * @brief Check the compression algorithm is available in this build.
+ */
+bool
+nns_edge_compress_is_supported (nns_edge_compress_e type)
+{
+  uint32_t feature = nns_edge_compress_get_feature (type);
+
+  return (feature != 0U && (NNS_EDGE_FEATURE_ALL & feature));
+}
+
+#if defined(ENABLE_ZLIB)
+/**
+ * @brief Compress the memory with zlib.
+ */
+static int
+_nns_edge_compress_zlib (const void *src, nns_size_t src_len, void *dst,
+    nns_size_t * dst_len)
+{
+  uLongf len = (uLongf) * dst_len;
+
+  if (Z_OK != compress2 ((Bytef *) dst, &len, (const Bytef *) src,
+          (uLong) src_len, NNS_EDGE_COMPRESS_LEVEL_ZLIB))
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+
+  *dst_len = (nns_size_t) len;
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Decompress the memory with zlib.
+ */
+static int
+_nns_edge_decompress_zlib (const void *src, nns_size_t src_len, void *dst,
+    nns_size_t dst_len)
+{
+  uLongf len = (uLongf) dst_len;
+
+  if (Z_OK != uncompress ((Bytef *) dst, &len, (const Bytef *) src,
+          (uLong) src_len) || len != (uLongf) dst_len)
+    return NNS_EDGE_ERROR_IO;
+
+  return NNS_EDGE_ERROR_NONE;
+}
+#endif /* ENABLE_ZLIB */
+
+#if defined(ENABLE_LZ4)
+/**
+ * @brief Compress the memory with lz4.
+ */
+static int
+_nns_edge_compress_lz4 (const void *src, nns_size_t src_len, void *dst,
+    nns_size_t * dst_len)
+{
+  int len, cap;
+
+  if (src_len > LZ4_MAX_INPUT_SIZE)
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+
+  cap = (*dst_len > (nns_size_t) INT_MAX) ? INT_MAX : (int) *dst_len;
+  len = LZ4_compress_default ((const char *) src, (char *) dst, (int) src_len,
+      cap);
+  if (len <= 0)
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+
+  *dst_len = (nns_size_t) len;
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Decompress the memory with lz4.
+ */
+static int
+_nns_edge_decompress_lz4 (const void *src, nns_size_t src_len, void *dst,
+    nns_size_t dst_len)
+{
+  int len;
+
+  if (src_len > (nns_size_t) INT_MAX || dst_len > (nns_size_t) INT_MAX)
+    return NNS_EDGE_ERROR_IO;
+
+  len = LZ4_decompress_safe ((const char *) src, (char *) dst, (int) src_len,
+      (int) dst_len);
+  if (len < 0 || (nns_size_t) len != dst_len)
+    return NNS_EDGE_ERROR_IO;
+
+  return NNS_EDGE_ERROR_NONE;
+}
+#endif /* ENABLE_LZ4 */
+
+#if defined(ENABLE_ZSTD)
+/**
+ * @brief Compress the memory with zstd.
+ */
+static int
+_nns_edge_compress_zstd (const void *src, nns_size_t src_len, void *dst,
+    nns_size_t * dst_len)
+{
+  size_t len;
+
+  len = ZSTD_compress (dst, *dst_len, src, src_len,
+      NNS_EDGE_COMPRESS_LEVEL_ZSTD);
+  if (ZSTD_isError (len))
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+
+  *dst_len = (nns_size_t) len;
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Decompress the memory with zstd.
+ */
+static int
+_nns_edge_decompress_zstd (const void *src, nns_size_t src_len, void *dst,
+    nns_size_t dst_len)
+{
+  size_t len;
+
+  len = ZSTD_decompress (dst, dst_len, src, src_len);
+  if (ZSTD_isError (len) || len != dst_len)
+    return NNS_EDGE_ERROR_IO;
+
+  return NNS_EDGE_ERROR_NONE;
+}
+#endif /* ENABLE_ZSTD */
+
+/**
+ * @brief Compress the memory into given buffer.
+ */
+int
+nns_edge_compress (nns_edge_compress_e type, const void *src,
+    nns_size_t src_len, void *dst, nns_size_t * dst_len)
+{
+  if (!src || src_len == 0 || !dst || !dst_len || *dst_len == 0) {
+    nns_edge_loge ("Invalid param, one of the given param is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  switch (type) {
+#if defined(ENABLE_ZLIB)
+    case NNS_EDGE_COMPRESS_ZLIB:
+      return _nns_edge_compress_zlib (src, src_len, dst, dst_len);
+#endif
+#if defined(ENABLE_LZ4)
+    case NNS_EDGE_COMPRESS_LZ4:
+      return _nns_edge_compress_lz4 (src, src_len, dst, dst_len);
+#endif
+#if defined(ENABLE_ZSTD)
+    case NNS_EDGE_COMPRESS_ZSTD:
+      return _nns_edge_compress_zstd (src, src_len, dst, dst_len);
+#endif
+    default:
+      break;
+  }
+
+  nns_edge_loge ("The compression algorithm (%d) is not supported.", type);
+  return NNS_EDGE_ERROR_NOT_SUPPORTED;
+}
+
+/**
+ * @brief Decompress the memory into given buffer.
+ */
+int
+nns_edge_decompress (nns_edge_compress_e type, const void *src,
+    nns_size_t src_len, void *dst, nns_size_t dst_len)
+{
+  int ret;
+
+  if (!src || src_len == 0 || !dst || dst_len == 0) {
+    nns_edge_loge ("Invalid param, one of the given param is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  switch (type) {
+#if defined(ENABLE_ZLIB)
+    case NNS_EDGE_COMPRESS_ZLIB:
+      ret = _nns_edge_decompress_zlib (src, src_len, dst, dst_len);
+      break;
+#endif
+#if defined(ENABLE_LZ4)
+    case NNS_EDGE_COMPRESS_LZ4:
+      ret = _nns_edge_decompress_lz4 (src, src_len, dst, dst_len);
+      break;
+#endif
+#if defined(ENABLE_ZSTD)
+    case NNS_EDGE_COMPRESS_ZSTD:
+      ret = _nns_edge_decompress_zstd (src, src_len, dst, dst_len);
+      break;
+#endif
+    default:
+      nns_edge_loge ("The compression algorithm (%d) is not supported.", type);
+      return NNS_EDGE_ERROR_NOT_SUPPORTED;
+  }
+
+  if (NNS_EDGE_ERROR_NONE != ret)
+    nns_edge_loge ("Failed to decompress the memory, invalid compressed data.");
+
+  return ret;
+}
@@ -0,0 +1,98 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   nnstreamer-edge-compress.h
+ * @date   14 October 2026
+ * @brief  Util functions to compress the memories of edge data.
+ * @see    https://github.com/nnstreamer/nnstreamer-edge
+ * @author agent <agent@local>
+ * @note   This file is internal header for nnstreamer-edge. DO NOT export this file.
+ * @bug    No known bugs except for NYI items
+ */
+
+#ifndef __NNSTREAMER_EDGE_COMPRESS_H__
+#define __NNSTREAMER_EDGE_COMPRESS_H__
+
+#include <stdbool.h>
+#include "nnstreamer-edge.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @brief Enumeration for the compression algorithm. The algorithm is available if the library is found when building nnstreamer-edge.
+ */
+typedef enum {
+  NNS_EDGE_COMPRESS_NONE = 0,
+  NNS_EDGE_COMPRESS_ZLIB,
+  NNS_EDGE_COMPRESS_LZ4,
+  NNS_EDGE_COMPRESS_ZSTD,
+
+  NNS_EDGE_COMPRESS_UNKNOWN
+} nns_edge_compress_e;
+
+/**
+ * @brief The default size in bytes of the memory to compress. Small memory is sent without compression.
+ */
+#define NNS_EDGE_COMPRESS_THRESHOLD (1024U)
+
+/**
+ * @brief Get the compression algorithm from given name (NONE, ZLIB, LZ4 or ZSTD), case-insensitive.
+ * @return The compression algorithm, or NNS_EDGE_COMPRESS_UNKNOWN if given name is invalid.
+ */
+nns_edge_compress_e nns_edge_compress_parse (const char *name);
+
+/**
+ * @brief Get the name of the compression algorithm.
+ * @return The name of the algorithm, or NULL if given algorithm is invalid. DO NOT release returned value.
+ */
+const char *nns_edge_compress_get_name (nns_edge_compress_e type);
+
+/**
+ * @brief Get the feature bit to advertise the compression algorithm, see NNS_EDGE_FEATURE_ALL.
+ * @return The feature bit, or 0 if given algorithm is invalid or NNS_EDGE_COMPRESS_NONE.
+ */
+uint32_t nns_edge_compress_get_feature (nns_edge_compress_e type);
+
+/**
+ * @brief Check the compression algorithm is available in this build.
+ */
+bool nns_edge_compress_is_supported (nns_edge_compress_e type);
+
+/**
+ * @brief Compress the memory into given buffer.
+ * @note The caller sets the size of the buffer smaller than the memory, then the function fails if the memory does not compress.
+ * @param[in] type The compression algorithm.
+ * @param[in] src The memory to compress.
+ * @param[in] src_len The size of the memory.
+ * @param[out] dst The buffer to write the compressed memory.
+ * @param[in,out] dst_len The size of the buffer, and the size of the compressed memory on success.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_NOT_SUPPORTED Given algorithm is not available.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #NNS_EDGE_ERROR_OUT_OF_MEMORY The compressed memory is larger than the buffer.
+ */
+int nns_edge_compress (nns_edge_compress_e type, const void *src, nns_size_t src_len, void *dst, nns_size_t *dst_len);
+
+/**
+ * @brief Decompress the memory into given buffer.
+ * @param[in] type The compression algorithm.
+ * @param[in] src The compressed memory.
+ * @param[in] src_len The size of the compressed memory.
+ * @param[out] dst The buffer to write the original memory.
+ * @param[in] dst_len The size of the original memory.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_NOT_SUPPORTED Given algorithm is not available.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #NNS_EDGE_ERROR_IO The compressed memory is broken or the size of the original memory is different.
+ */
+int nns_edge_decompress (nns_edge_compress_e type, const void *src, nns_size_t src_len, void *dst, nns_size_t dst_len);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __NNSTREAMER_EDGE_COMPRESS_H__ */
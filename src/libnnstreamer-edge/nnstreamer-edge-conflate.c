@@ -0,0 +1,47 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   nnstreamer-edge-conflate.c
+ * @date   14 October 2026
+ * @brief  Conflation of received edge data, to deliver the latest data only.
+ * @see    https://github.com/nnstreamer/nnstreamer-edge
+ * @author agent <agent@local>
+ * @bug    No known bugs except for NYI items
+ */
+
+#include "nnstreamer-edge-conflate.h"
+
+/**
+ * @brief Check the connection has received newer data, to skip the old data in conflation mode.
+ * @note This peeks the magic and command of next header without consuming it. Other commands (e.g., credits), partial header and closed socket are not newer data.
+ */
+bool
+nns_edge_conflate_has_newer (nns_edge_handle_s * eh, nns_edge_conn_s * conn)
+{
+  uint32_t peek[2];
+  nns_ssize_t rret;
+
+  if (!eh->conflate)
+    return false;
+
+  rret = recv (conn->sockfd, peek, sizeof (peek), MSG_PEEK | MSG_DONTWAIT);
+  if (rret != (nns_ssize_t) sizeof (peek))
+    return false;
+
+  if (peek[0] != NNS_EDGE_MAGIC && peek[0] != NNS_EDGE_MAGIC_COMPACT)
+    return false;
+
+  switch (peek[1]) {
+    case _NNS_EDGE_CMD_TRANSFER_DATA:
+    case _NNS_EDGE_CMD_TRANSFER_SHM:
+    case _NNS_EDGE_CMD_TRANSFER_BATCH:
+    case _NNS_EDGE_CMD_TRANSFER_COMPRESSED:
+    case _NNS_EDGE_CMD_TRANSFER_CHUNK:
+      return true;
+    default:
+      break;
+  }
+
+  return false;
+}
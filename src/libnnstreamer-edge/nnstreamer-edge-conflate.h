@@ -0,0 +1,32 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   nnstreamer-edge-conflate.h
+ * @date   14 October 2026
+ * @brief  Conflation of received edge data, to deliver the latest data only.
+ * @see    https://github.com/nnstreamer/nnstreamer-edge
+ * @author agent <agent@local>
+ * @note   This file is internal header for nnstreamer-edge. DO NOT export this file.
+ * @bug    No known bugs except for NYI items
+ */
+
+#ifndef __NNSTREAMER_EDGE_CONFLATE_H__
+#define __NNSTREAMER_EDGE_CONFLATE_H__
+
+#include "nnstreamer-edge-internal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @brief Check the connection has received newer data, to skip the old data in conflation mode.
+ * @note This peeks the magic and command of next header without consuming it. Other commands (e.g., credits), partial header and closed socket are not newer data.
+ */
+bool nns_edge_conflate_has_newer (nns_edge_handle_s *eh, nns_edge_conn_s *conn);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __NNSTREAMER_EDGE_CONFLATE_H__ */
@@ -0,0 +1,218 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   nnstreamer-edge-credit.c
+ * @date   14 October 2026
+ * @brief  Credit-based flow control between the edge nodes.
+ * @see    https://github.com/nnstreamer/nnstreamer-edge
+ * @author agent <agent@local>
+ * @bug    No known bugs except for NYI items
+ */
+
+#include "nnstreamer-edge-credit.h"
+#include "nnstreamer-edge-data-internal.h"
+#include "nnstreamer-edge-log.h"
+
+/**
+ * @brief Send the credits to the peer, the peer sends given number of data more.
+ */
+static int
+_nns_edge_credit_send (nns_edge_conn_s * conn, int64_t client_id,
+    uint32_t credits)
+{
+  nns_edge_cmd_s cmd;
+
+  nns_edge_cmd_init (&cmd, _NNS_EDGE_CMD_CREDIT, client_id);
+  cmd.info.num = 1;
+  cmd.info.mem_size[0] = sizeof (uint32_t);
+  cmd.mem[0] = &credits;
+
+  return nns_edge_cmd_send (conn, &cmd);
+}
+
+/**
+ * @brief Add the credits of the connection.
+ * @param[in] granted True if the peer grants the credits. Otherwise the credits are returned, which is ignored if the peer has not granted the credits.
+ * @return The pending data to be sent with new credits, or NULL. Caller should release it.
+ */
+static nns_edge_data_h
+_nns_edge_credit_add (nns_edge_conn_s * conn, unsigned int credits,
+    bool granted)
+{
+  nns_edge_data_h pending = NULL;
+
+  nns_edge_lock (&conn->credit);
+  if (granted)
+    conn->credit.enabled = true;
+
+  if (conn->credit.enabled) {
+    conn->credit.credits = (credits > UINT_MAX - conn->credit.credits) ?
+        UINT_MAX : conn->credit.credits + credits;
+    if (conn->credit.credits > 0U) {
+      pending = conn->credit.pending;
+      conn->credit.pending = NULL;
+    }
+  }
+  nns_edge_unlock (&conn->credit);
+
+  return pending;
+}
+
+/**
+ * @brief Push the pending data into the send queue again, and release it.
+ */
+static void
+_nns_edge_credit_resend (nns_edge_handle_s * eh, nns_edge_data_h pending,
+    int64_t client_id)
+{
+  nns_edge_data_h data_h;
+
+  if (!pending)
+    return;
+
+  /* The data may not have the client ID, push the copy to send it to this connection only. */
+  if (nns_edge_data_copy (pending, &data_h) == NNS_EDGE_ERROR_NONE) {
+    nns_edge_data_set_client_id (data_h, client_id);
+
+    if (nns_edge_queue_push (eh->send_queue, data_h, sizeof (nns_edge_data_h),
+            nns_edge_data_release_handle) != NNS_EDGE_ERROR_NONE)
+      nns_edge_data_destroy (data_h);
+  }
+  nns_edge_data_destroy (pending);
+}
+
+/**
+ * @brief Grant the credits to the peer of the client ID, the credits are sent with the connection sending data to the peer.
+ * @param[in] consumed The number of consumed data, or 0 to grant the initial credits after the handshake.
+ */
+void
+nns_edge_credit_grant (nns_edge_handle_s * eh, int64_t client_id,
+    unsigned int consumed)
+{
+  nns_edge_conn_data_s *conn_data;
+  nns_edge_conn_s *conn;
+  unsigned int credits = 0U;
+
+  if (eh->flow_credits == 0U)
+    return;
+
+  /* Hold the lock of the connections until sending the credits, the connection may be removed in other thread. */
+  nns_edge_conn_rdlock (eh);
+  conn_data = nns_edge_get_connection (eh, client_id);
+  conn = conn_data ? conn_data->sink_conn : NULL;
+  if (!conn || !(conn->features & NNS_EDGE_FEATURE_CREDIT)) {
+    nns_edge_conn_unlock (eh);
+    return;
+  }
+
+  nns_edge_lock (&conn->credit);
+  if (consumed == 0U) {
+    credits = eh->flow_credits;
+    conn->credit.consumed = 0U;
+  } else {
+    /* Grant the credits when half of the window is consumed, not for each data. */
+    conn->credit.consumed += consumed;
+    if (conn->credit.consumed >= (eh->flow_credits + 1U) / 2U) {
+      credits = conn->credit.consumed;
+      conn->credit.consumed = 0U;
+    }
+  }
+  nns_edge_unlock (&conn->credit);
+
+  if (credits > 0U &&
+      _nns_edge_credit_send (conn, client_id, credits) != NNS_EDGE_ERROR_NONE)
+    nns_edge_logw ("Failed to grant the credits to the connected node.");
+  nns_edge_conn_unlock (eh);
+}
+
+/**
+ * @brief Take a credit to send the data. Without the credit, drop the data or keep the latest data per flow policy.
+ * @return true if the data can be sent to the connection.
+ */
+bool
+nns_edge_credit_take (nns_edge_handle_s * eh, nns_edge_conn_s * conn,
+    nns_edge_data_h data_h)
+{
+  nns_edge_data_h dropped = NULL;
+  bool available = true;
+
+  if (!conn)
+    return true;
+
+  nns_edge_lock (&conn->credit);
+  if (!conn->credit.enabled) {
+    /* The peer does not grant the credits, send data without flow control. */
+  } else if (conn->credit.credits > 0U) {
+    conn->credit.credits--;
+  } else {
+    available = false;
+
+    if (NNS_EDGE_FLOW_COALESCE == eh->flow_policy) {
+      dropped = conn->credit.pending;
+      nns_edge_data_ref (data_h);
+      conn->credit.pending = data_h;
+    } else {
+      dropped = data_h;
+    }
+
+    if (dropped && conn->stats)
+      nns_edge_stats_add (conn->stats->credit_dropped, 1U);
+  }
+  nns_edge_unlock (&conn->credit);
+
+  if (dropped && dropped != data_h)
+    nns_edge_data_destroy (dropped);
+
+  return available;
+}
+
+/**
+ * @brief Add the credits granted by the peer. The pending data is pushed into the send queue again.
+ */
+int
+nns_edge_credit_received (nns_edge_handle_s * eh, nns_edge_conn_s * conn,
+    nns_edge_cmd_s * cmd, int64_t client_id)
+{
+  nns_edge_conn_data_s *conn_data;
+  nns_edge_data_h pending;
+  uint32_t credits;
+
+  if (cmd->info.num != 1 || cmd->info.mem_size[0] != sizeof (uint32_t)) {
+    nns_edge_loge ("Invalid credits from the connected node.");
+    return NNS_EDGE_ERROR_IO;
+  }
+
+  memcpy (&credits, cmd->mem[0], sizeof (uint32_t));
+
+  /**
+   * The query node in pair mode sends data with other connection of the peer.
+   * The connection of publisher or duplex mode is not set yet if the message thread receives the credits before finishing the handshake.
+   */
+  nns_edge_conn_rdlock (eh);
+  conn_data = nns_edge_get_connection (eh, client_id);
+  if (conn_data && conn_data->sink_conn)
+    conn = conn_data->sink_conn;
+
+  pending = _nns_edge_credit_add (conn, credits, true);
+  nns_edge_conn_unlock (eh);
+
+  _nns_edge_credit_resend (eh, pending, client_id);
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Give back the credits of the data dropped before sending it to the peer, e.g., in the queue of the connection.
+ */
+void
+nns_edge_credit_return (nns_edge_handle_s * eh, nns_edge_conn_s * conn,
+    unsigned int count, int64_t client_id)
+{
+  nns_edge_data_h pending;
+
+  if (count == 0U)
+    return;
+
+  pending = _nns_edge_credit_add (conn, count, false);
+  _nns_edge_credit_resend (eh, pending, client_id);
+}
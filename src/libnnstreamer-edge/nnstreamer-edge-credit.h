@@ -0,0 +1,49 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   nnstreamer-edge-credit.h
+ * @date   14 October 2026
+ * @brief  Credit-based flow control between the edge nodes.
+ * @see    https://github.com/nnstreamer/nnstreamer-edge
+ * @author agent <agent@local>
+ * @note   This file is internal header for nnstreamer-edge. DO NOT export this file.
+ * @bug    No known bugs except for NYI items
+ */
+
+#ifndef __NNSTREAMER_EDGE_CREDIT_H__
+#define __NNSTREAMER_EDGE_CREDIT_H__
+
+#include "nnstreamer-edge-internal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @brief Grant the credits to the peer of the client ID, the credits are sent with the connection sending data to the peer.
+ * @param[in] consumed The number of consumed data, or 0 to grant the initial credits after the handshake.
+ */
+void nns_edge_credit_grant (nns_edge_handle_s *eh, int64_t client_id, unsigned int consumed);
+
+/**
+ * @brief Take a credit to send the data. Without the credit, drop the data or keep the latest data per flow policy.
+ * @return true if the data can be sent to the connection.
+ */
+bool nns_edge_credit_take (nns_edge_handle_s *eh, nns_edge_conn_s *conn, nns_edge_data_h data_h);
+
+/**
+ * @brief Add the credits granted by the peer. The pending data is pushed into the send queue again.
+ */
+int nns_edge_credit_received (nns_edge_handle_s *eh, nns_edge_conn_s *conn, nns_edge_cmd_s *cmd, int64_t client_id);
+
+/**
+ * @brief Give back the credits of the data dropped before sending it to the peer, e.g., in the queue of the connection.
+ * @note The data dropped after taking the credit never reaches the peer, so the peer does not grant its credit again.
+ */
+void nns_edge_credit_return (nns_edge_handle_s *eh, nns_edge_conn_s *conn, unsigned int count, int64_t client_id);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __NNSTREAMER_EDGE_CREDIT_H__ */
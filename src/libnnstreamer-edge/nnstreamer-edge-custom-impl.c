@@ -11,6 +11,7 @@
  */
 
 #include <dlfcn.h>
+#include <stddef.h>
 
 #include "nnstreamer-edge-custom-impl.h"
 #include "nnstreamer-edge-log.h"
@@ -23,10 +24,17 @@ typedef struct
 {
   void *dl_handle;
   nns_edge_custom_s *instance;
+  nns_edge_custom_s funcs; /**< the functions copied from the library, the functions of the newer version are null if the library does not support it */
   void *priv;
 } custom_connection_s;
 
 typedef const nns_edge_custom_s *custom_get_instance (void);
+typedef unsigned int custom_get_version (void);
+
+/**
+ * @brief The size of the functions in version 1.
+ */
+#define CUSTOM_FUNCS_SIZE_V1 (offsetof (nns_edge_custom_s, nns_edge_custom_send_batch))
 
 /**
  * @brief Internal function to load custom library.
@@ -36,6 +44,8 @@ _load_custom_library (custom_connection_s * custom, const char *lib_path)
 {
   void *handle;
   nns_edge_custom_s *custom_h;
+  custom_get_version *get_version;
+  unsigned int version = 1U;
   int ret = NNS_EDGE_ERROR_UNKNOWN;
 
   handle = dlopen (lib_path, RTLD_LAZY);
@@ -58,8 +68,28 @@ _load_custom_library (custom_connection_s * custom, const char *lib_path)
     goto error;
   }
 
+  /* The library built with version 1 does not have the functions of version 2. */
+  get_version = (custom_get_version *) dlsym (handle,
+      "nns_edge_custom_get_version");
+  if (get_version)
+    version = get_version ();
+
+  if (version >= 2U) {
+    memcpy (&custom->funcs, custom_h, sizeof (nns_edge_custom_s));
+
+    if (!custom->funcs.nns_edge_custom_alloc_buffer !=
+        !custom->funcs.nns_edge_custom_release_buffer) {
+      nns_edge_logw
+          ("The custom library should provide both functions to allocate and release the buffer, ignore them.");
+      custom->funcs.nns_edge_custom_alloc_buffer = NULL;
+      custom->funcs.nns_edge_custom_release_buffer = NULL;
+    }
+  } else {
+    memcpy (&custom->funcs, custom_h, CUSTOM_FUNCS_SIZE_V1);
+  }
+
   custom->dl_handle = handle;
-  custom->instance = custom_h;
+  custom->instance = &custom->funcs;
   ret = NNS_EDGE_ERROR_NONE;
 
 error:
@@ -334,6 +364,83 @@ nns_edge_custom_send_data (nns_edge_custom_connection_h handle,
   return ret;
 }
 
+/**
+ * @brief Internal function to send the array of data to custom connection. If the library does not support the batch, send the data one by one.
+ */
+int
+nns_edge_custom_send_batch (nns_edge_custom_connection_h handle,
+    nns_edge_data_h * data_h, unsigned int count)
+{
+  custom_connection_s *custom = (custom_connection_s *) handle;
+  nns_edge_custom_s *custom_h;
+  unsigned int i;
+  int ret;
+
+  if (!custom || !custom->instance)
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  if (!data_h || count == 0U)
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  for (i = 0; i < count; i++) {
+    ret = nns_edge_data_is_valid (data_h[i]);
+    if (NNS_EDGE_ERROR_NONE != ret)
+      return ret;
+  }
+
+  custom_h = custom->instance;
+
+  if (!custom_h->nns_edge_custom_send_batch) {
+    for (i = 0; i < count; i++) {
+      ret = nns_edge_custom_send_data (handle, data_h[i]);
+      if (NNS_EDGE_ERROR_NONE != ret)
+        return ret;
+    }
+
+    return NNS_EDGE_ERROR_NONE;
+  }
+
+  ret = custom_h->nns_edge_custom_send_batch (custom->priv, data_h, count);
+  if (NNS_EDGE_ERROR_NONE != ret) {
+    nns_edge_loge ("Failed to send the batch of data to custom connection.");
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Internal function to allocate the buffer of custom connection.
+ */
+int
+nns_edge_custom_alloc_buffer (nns_edge_custom_connection_h handle,
+    nns_size_t size, void **data, nns_edge_data_destroy_cb * destroy_cb)
+{
+  custom_connection_s *custom = (custom_connection_s *) handle;
+  nns_edge_custom_s *custom_h;
+  int ret;
+
+  if (!custom || !custom->instance)
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  if (size == 0 || !data || !destroy_cb)
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  custom_h = custom->instance;
+
+  if (!custom_h->nns_edge_custom_alloc_buffer)
+    return NNS_EDGE_ERROR_NOT_SUPPORTED;
+
+  *data = NULL;
+  ret = custom_h->nns_edge_custom_alloc_buffer (custom->priv, size, data);
+  if (NNS_EDGE_ERROR_NONE != ret || !*data) {
+    nns_edge_loge ("Failed to allocate the buffer of custom connection.");
+    return (NNS_EDGE_ERROR_NONE != ret) ? ret : NNS_EDGE_ERROR_OUT_OF_MEMORY;
+  }
+
+  *destroy_cb = custom_h->nns_edge_custom_release_buffer;
+  return NNS_EDGE_ERROR_NONE;
+}
+
 /**
  * @brief Internal function to set information to custom connection.
  */
@@ -72,6 +72,18 @@ int nns_edge_custom_is_connected (nns_edge_custom_connection_h handle);
  */
 int nns_edge_custom_send_data (nns_edge_custom_connection_h handle, nns_edge_data_h data_h);
 
+/**
+ * @brief Internal function to send the array of data to custom connection. If the library does not support the batch, send the data one by one.
+ */
+int nns_edge_custom_send_batch (nns_edge_custom_connection_h handle, nns_edge_data_h *data_h, unsigned int count);
+
+/**
+ * @brief Internal function to allocate the buffer of custom connection.
+ * @param[out] data The allocated buffer.
+ * @param[out] destroy_cb The callback to release the buffer.
+ */
+int nns_edge_custom_alloc_buffer (nns_edge_custom_connection_h handle, nns_size_t size, void **data, nns_edge_data_destroy_cb *destroy_cb);
+
 /**
  * @brief Internal function to set information to custom connection.
  */
@@ -92,6 +104,8 @@ int nns_edge_custom_get_info (nns_edge_custom_connection_h handle, const char *k
 #define nns_edge_custom_connect(...) (NNS_EDGE_ERROR_NOT_SUPPORTED)
 #define nns_edge_custom_is_connected(...) (NNS_EDGE_ERROR_NOT_SUPPORTED)
 #define nns_edge_custom_send_data(...) (NNS_EDGE_ERROR_NOT_SUPPORTED)
+#define nns_edge_custom_send_batch(...) (NNS_EDGE_ERROR_NOT_SUPPORTED)
+#define nns_edge_custom_alloc_buffer(...) (NNS_EDGE_ERROR_NOT_SUPPORTED)
 #define nns_edge_custom_set_info(...) (NNS_EDGE_ERROR_NOT_SUPPORTED)
 #define nns_edge_custom_get_info(...) (NNS_EDGE_ERROR_NOT_SUPPORTED)
 #endif /* ENABLE_CUSTOM_CONNECTION */
@@ -0,0 +1,82 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   nnstreamer-edge-data-internal.h
+ * @date   14 October 2026
+ * @brief  Internal util functions for edge data.
+ * @see    https://github.com/nnstreamer/nnstreamer
+ * @author agent <agent@local>
+ * @bug    No known bugs except for NYI items
+ * @note   This file is internal header to handle edge data. DO NOT export this file.
+ */
+
+#ifndef __NNSTREAMER_EDGE_DATA_INTERNAL_H__
+#define __NNSTREAMER_EDGE_DATA_INTERNAL_H__
+
+#include "nnstreamer-edge-data.h"
+#include "nnstreamer-edge-compress.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @brief Enumeration for the header format of the serialized edge data.
+ */
+typedef enum {
+  NNS_EDGE_DATA_HEADER_LEGACY = 0, /**< Fixed size header with NNS_EDGE_DATA_LIMIT sizes, every version can parse it. */
+  NNS_EDGE_DATA_HEADER_COMPACT /**< Variable size header with the sizes of given memories only. */
+} nns_edge_data_header_e;
+
+/**
+ * @brief Internal function to increase the reference count of edge data. The data is released when nns_edge_data_destroy() is called for every reference.
+ * @note The data should not be changed while other thread holds the reference.
+ * @return The edge data handle, or NULL if given handle is invalid.
+ */
+nns_edge_data_h nns_edge_data_ref (nns_edge_data_h data_h);
+
+/**
+ * @brief Internal function to allocate the memory of edge data with the allocator set by nns_edge_data_set_allocator().
+ * @note The memory should be released using nns_edge_data_free_mem().
+ */
+void *nns_edge_data_alloc_mem (nns_size_t size);
+
+/**
+ * @brief Internal function to release the memory allocated with nns_edge_data_alloc_mem(). This can be used as the destroy callback of the memory in edge data.
+ */
+void nns_edge_data_free_mem (void *data);
+
+/**
+ * @brief Internal function to get the serialized metadata in edge data without copying it.
+ * @note DO NOT release returned data. The data is available until the information of edge data is changed.
+ */
+int nns_edge_data_get_serialized_meta (nns_edge_data_h data_h, const void **data, nns_size_t *data_len);
+
+/**
+ * @brief Internal function to set the request ID and round-trip time (microseconds) of edge data. If request ID is 0, the data does not have the request ID.
+ */
+int nns_edge_data_set_request (nns_edge_data_h data_h, uint64_t request_id, int64_t rtt);
+
+/**
+ * @brief Internal function to serialize edge data with given header format. Caller should release the returned data using free().
+ */
+int nns_edge_data_serialize_full (nns_edge_data_h data_h, nns_edge_data_header_e header, void **data, nns_size_t *data_len);
+
+/**
+ * @brief Internal function to serialize edge data with given header format into the buffer of the caller. See nns_edge_data_serialize_into().
+ */
+int nns_edge_data_serialize_into_full (nns_edge_data_h data_h, nns_edge_data_header_e header, void *data, nns_size_t data_len, nns_size_t *len);
+
+/**
+ * @brief Internal function to serialize edge data into the buffer of the caller, the memories are compressed with given algorithm.
+ * @note The memory smaller than the threshold or the memory which does not compress is written without compression.
+ * If the buffer is null or smaller than the size without compression, this function returns NNS_EDGE_ERROR_OUT_OF_MEMORY and @a len is the required size.
+ * The serialized data has new header format, nns_edge_data_deserialize() of old version cannot parse it.
+ */
+int nns_edge_data_serialize_compressed_into (nns_edge_data_h data_h, nns_edge_compress_e compress, nns_size_t threshold, void *data, nns_size_t data_len, nns_size_t *len);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __NNSTREAMER_EDGE_DATA_INTERNAL_H__ */
@@ -10,12 +10,67 @@
  * @bug    No known bugs except for NYI items
  */
 
+#include <errno.h>
+#include <inttypes.h>
 #include "nnstreamer-edge-data.h"
+#include "nnstreamer-edge-data-internal.h"
 #include "nnstreamer-edge-log.h"
 #include "nnstreamer-edge-util.h"
 #include "nnstreamer-edge-metadata.h"
 
 #define NNS_EDGE_DATA_KEY (0xeddaedda)
+#define NNS_EDGE_DATA_COMPACT_KEY (0xeddaedd1)
+#define NNS_EDGE_DATA_COMPRESS_KEY (0xeddaedd2)
+
+/**
+ * @brief The info key of the client ID, the value is kept in the data handle instead of metadata.
+ */
+#define NNS_EDGE_DATA_KEY_CLIENT_ID "client_id"
+
+/**
+ * @brief The info key of the request ID, the value is kept in the data handle instead of metadata.
+ */
+#define NNS_EDGE_DATA_KEY_REQUEST_ID "request_id"
+
+/**
+ * @brief Internal data structure for the callbacks of the allocator. It is not changed after setting the allocator.
+ */
+typedef struct _nns_edge_data_hooks_s nns_edge_data_hooks_s;
+
+/**
+ * @brief Internal data structure for the callbacks of the allocator. It is not changed after setting the allocator.
+ */
+struct _nns_edge_data_hooks_s
+{
+  nns_edge_data_alloc_cb alloc_cb;
+  nns_edge_data_free_cb free_cb;
+  void *user_data;
+  nns_edge_data_hooks_s *retired; /**< previous callbacks which may be used by other thread when the allocator is changed */
+};
+
+/**
+ * @brief Internal data structure for the allocator of the memories in edge data.
+ * @note Allocating and releasing the memory do not lock the allocator. The counter is updated atomically and the callbacks are loaded atomically.
+ */
+typedef struct
+{
+  pthread_mutex_t lock; /**< lock to set the allocator */
+  nns_edge_data_hooks_s *hooks;
+  uint64_t allocated; /**< the number of memories allocated and not released yet */
+} nns_edge_data_allocator_s;
+
+/**
+ * @brief The default callbacks of the allocator, use nns_edge_malloc() and nns_edge_free().
+ */
+static nns_edge_data_hooks_s g_default_hooks = { 0 };
+
+/**
+ * @brief The allocator of the memories in edge data.
+ */
+static nns_edge_data_allocator_s g_allocator = {
+  .lock = PTHREAD_MUTEX_INITIALIZER,
+  .hooks = &g_default_hooks,
+};
 
 /**
  * @brief Internal data structure for the header of the serialized edge data.
@@ -29,6 +84,31 @@ typedef struct
   nns_size_t meta_len;
 } nns_edge_data_header_s;
 
+/**
+ * @brief Internal data structure for the compact header of the serialized edge data, followed by the sizes of memories.
+ */
+typedef struct
+{
+  uint32_t key;
+  uint32_t num_mem;
+  uint64_t version;
+  nns_size_t meta_len;
+} nns_edge_data_compact_header_s;
+
+/**
+ * @brief Internal data structure for the header of the serialized edge data with compressed memories.
+ * @note The header is followed by the sizes of memories and the original sizes of memories (0 if the memory is not compressed).
+ */
+typedef struct
+{
+  uint32_t key;
+  uint32_t num_mem;
+  uint64_t version;
+  nns_size_t meta_len;
+  uint32_t compress; /**< compression algorithm, see nns_edge_compress_e. */
+  uint32_t reserved;
+} nns_edge_data_compress_header_s;
+
 /**
  * @brief Internal data structure for edge data.
  */
@@ -36,11 +116,242 @@ typedef struct
 {
   uint32_t magic;
   pthread_mutex_t lock;
+  unsigned int refcount;
   uint32_t num;
   nns_edge_raw_data_s data[NNS_EDGE_DATA_LIMIT];
   nns_edge_metadata_h metadata;
+
+  /* client ID to route the data, also available with the info key 'client_id' */
+  bool has_client_id;
+  int64_t client_id;
+
+  /* request ID to match the response with the request (0 means none), and round-trip time in microseconds (negative if not measured) */
+  uint64_t request_id;
+  int64_t request_rtt;
+
+  /* serialized buffer which the memories refer to, released when the memories are removed */
+  void *payload;
+  nns_edge_data_destroy_cb payload_destroy_cb;
 } nns_edge_data_s;
 
+/**
+ * @brief Internal function to parse the client ID string. Returns false if the value is not a number.
+ */
+static bool
+_nns_edge_data_parse_client_id (const char *value, int64_t * client_id)
+{
+  char *end = NULL;
+  long long id;
+
+  if (!STR_IS_VALID (value))
+    return false;
+
+  errno = 0;
+  id = strtoll (value, &end, 10);
+  if (errno != 0 || *end != '\0')
+    return false;
+
+  *client_id = (int64_t) id;
+  return true;
+}
+
+/**
+ * @brief Internal function to parse the request ID string. Returns false if the value is not a positive number.
+ */
+static bool
+_nns_edge_data_parse_request_id (const char *value, uint64_t * request_id)
+{
+  char *end = NULL;
+  unsigned long long id;
+
+  if (!STR_IS_VALID (value) || value[0] == '-')
+    return false;
+
+  errno = 0;
+  id = strtoull (value, &end, 10);
+  if (errno != 0 || *end != '\0' || id == 0ULL)
+    return false;
+
+  *request_id = (uint64_t) id;
+  return true;
+}
+
+/**
+ * @brief Internal function to serialize the information of edge data, including the client ID.
+ * @note This function should be called with lock. The serialized data is compatible with old version having the client ID in metadata.
+ */
+static int
+_nns_edge_data_serialize_info (nns_edge_data_s * ed, void **data,
+    nns_size_t * data_len)
+{
+  nns_edge_metadata_h meta;
+  char *val;
+  int ret;
+
+  if (!ed->has_client_id)
+    return nns_edge_metadata_serialize (ed->metadata, data, data_len);
+
+  ret = nns_edge_metadata_create (&meta);
+  if (NNS_EDGE_ERROR_NONE != ret)
+    return ret;
+
+  ret = nns_edge_metadata_copy (meta, ed->metadata);
+  if (NNS_EDGE_ERROR_NONE == ret) {
+    val = nns_edge_strdup_printf ("%lld", (long long) ed->client_id);
+    ret = nns_edge_metadata_set (meta, NNS_EDGE_DATA_KEY_CLIENT_ID, val);
+    SAFE_FREE (val);
+  }
+
+  if (NNS_EDGE_ERROR_NONE == ret)
+    ret = nns_edge_metadata_serialize (meta, data, data_len);
+
+  nns_edge_metadata_destroy (meta);
+  return ret;
+}
+
+/**
+ * @brief Internal function to release the serialized buffer which the memories refer to.
+ * @note This function should be called with lock.
+ */
+static void
+_nns_edge_data_release_payload (nns_edge_data_s * ed)
+{
+  if (ed->payload && ed->payload_destroy_cb)
+    ed->payload_destroy_cb (ed->payload);
+
+  ed->payload = NULL;
+  ed->payload_destroy_cb = NULL;
+}
+
+/**
+ * @brief Set the allocator of the memories which nnstreamer-edge allocates for edge data.
+ */
+int
+nns_edge_data_set_allocator (nns_edge_data_alloc_cb alloc_cb,
+    nns_edge_data_free_cb free_cb, void *user_data)
+{
+  nns_edge_data_hooks_s *hooks = &g_default_hooks;
+  nns_edge_data_hooks_s *old;
+  uint64_t allocated;
+
+  if (!alloc_cb != !free_cb) {
+    nns_edge_loge
+        ("Invalid param, set both callbacks to allocate and release the memory.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (alloc_cb) {
+    hooks = (nns_edge_data_hooks_s *) calloc (1, sizeof (nns_edge_data_hooks_s));
+    if (!hooks) {
+      nns_edge_loge ("Failed to allocate memory for the allocator.");
+      return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+    }
+
+    hooks->alloc_cb = alloc_cb;
+    hooks->free_cb = free_cb;
+    hooks->user_data = user_data;
+  }
+
+  nns_edge_lock (&g_allocator);
+  allocated = __atomic_load_n (&g_allocator.allocated, __ATOMIC_SEQ_CST);
+  if (allocated > 0U) {
+    nns_edge_unlock (&g_allocator);
+    nns_edge_loge ("Cannot change the allocator, %" PRIu64
+        " memories are not released yet.", allocated);
+    if (hooks != &g_default_hooks)
+      SAFE_FREE (hooks);
+    return NNS_EDGE_ERROR_IO;
+  }
+
+  old = __atomic_exchange_n (&g_allocator.hooks, hooks, __ATOMIC_SEQ_CST);
+
+  /**
+   * Other thread counts the memory before loading the callbacks.
+   * If the counter is still 0, no thread uses previous callbacks. Otherwise keep them to prevent invalid access.
+   */
+  if (old != &g_default_hooks) {
+    if (__atomic_load_n (&g_allocator.allocated, __ATOMIC_SEQ_CST) == 0U) {
+      hooks->retired = old->retired;
+      old->retired = NULL;
+      SAFE_FREE (old);
+    } else {
+      hooks->retired = old;
+    }
+  }
+  nns_edge_unlock (&g_allocator);
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to allocate the memory of edge data with the allocator set by nns_edge_data_set_allocator().
+ */
+void *
+nns_edge_data_alloc_mem (nns_size_t size)
+{
+  nns_edge_data_hooks_s *hooks;
+  void *mem = NULL;
+
+  /* Count the memory first, the allocator cannot be changed until the memory is released. */
+  __atomic_fetch_add (&g_allocator.allocated, 1U, __ATOMIC_SEQ_CST);
+  hooks = __atomic_load_n (&g_allocator.hooks, __ATOMIC_SEQ_CST);
+
+  if (hooks->alloc_cb) {
+    if (size > 0)
+      mem = hooks->alloc_cb (size, hooks->user_data);
+
+    if (!mem)
+      nns_edge_loge ("Failed to allocate memory (%" PRIu64
+          ") with the allocator.", size);
+  } else {
+    mem = nns_edge_malloc (size);
+  }
+
+  if (!mem)
+    __atomic_fetch_sub (&g_allocator.allocated, 1U, __ATOMIC_SEQ_CST);
+
+  return mem;
+}
+
+/**
+ * @brief Internal function to release the memory allocated with nns_edge_data_alloc_mem().
+ */
+void
+nns_edge_data_free_mem (void *data)
+{
+  nns_edge_data_hooks_s *hooks;
+
+  if (!data)
+    return;
+
+  hooks = __atomic_load_n (&g_allocator.hooks, __ATOMIC_SEQ_CST);
+
+  if (hooks->free_cb)
+    hooks->free_cb (data, hooks->user_data);
+  else
+    nns_edge_free (data);
+
+  __atomic_fetch_sub (&g_allocator.allocated, 1U, __ATOMIC_SEQ_CST);
+}
+
+/**
+ * @brief Internal function to allocate new memory of edge data and copy bytes.
+ */
+static void *
+_nns_edge_data_memdup (const void *data, nns_size_t size)
+{
+  void *mem = NULL;
+
+  if (data && size > 0) {
+    mem = nns_edge_data_alloc_mem (size);
+
+    if (mem)
+      memcpy (mem, data, size);
+  }
+
+  return mem;
+}
+
 /**
  * @brief Create nnstreamer edge data.
  */
@@ -63,6 +374,8 @@ nns_edge_data_create (nns_edge_data_h * data_h)
   nns_edge_lock_init (ed);
   nns_edge_handle_set_magic (ed, NNS_EDGE_MAGIC);
   nns_edge_metadata_create (&ed->metadata);
+  ed->refcount = 1U;
+  ed->request_rtt = -1;
 
   *data_h = ed;
   return NNS_EDGE_ERROR_NONE;
@@ -89,6 +402,13 @@ nns_edge_data_destroy (nns_edge_data_h data_h)
   }
 
   nns_edge_lock (ed);
+  if (ed->refcount > 1U) {
+    /* Other reference holds the data, release the reference only. */
+    ed->refcount--;
+    nns_edge_unlock (ed);
+    return NNS_EDGE_ERROR_NONE;
+  }
+
   nns_edge_handle_set_magic (ed, NNS_EDGE_MAGIC_DEAD);
 
   for (i = 0; i < ed->num; i++) {
@@ -96,6 +416,7 @@ nns_edge_data_destroy (nns_edge_data_h data_h)
       ed->data[i].destroy_cb (ed->data[i].data);
   }
 
+  _nns_edge_data_release_payload (ed);
   nns_edge_metadata_destroy (ed->metadata);
 
   nns_edge_unlock (ed);
@@ -104,6 +425,27 @@ nns_edge_data_destroy (nns_edge_data_h data_h)
   return NNS_EDGE_ERROR_NONE;
 }
 
+/**
+ * @brief Increase the reference count of edge data.
+ */
+nns_edge_data_h
+nns_edge_data_ref (nns_edge_data_h data_h)
+{
+  nns_edge_data_s *ed;
+
+  ed = (nns_edge_data_s *) data_h;
+  if (!nns_edge_handle_is_valid (ed)) {
+    nns_edge_loge ("Invalid param, given edge data is invalid.");
+    return NULL;
+  }
+
+  nns_edge_lock (ed);
+  ed->refcount++;
+  nns_edge_unlock (ed);
+
+  return data_h;
+}
+
 /**
  * @brief Internal wrapper function of the nns_edge_data_destroy() to avoid build warning of the incompatibe type casting. (See nns_edge_data_destroy_cb())
  */
@@ -180,7 +522,7 @@ nns_edge_data_copy (nns_edge_data_h data_h, nns_edge_data_h * new_data_h)
 
   copied->num = ed->num;
   for (i = 0; i < ed->num; i++) {
-    copied->data[i].data = nns_edge_memdup (ed->data[i].data,
+    copied->data[i].data = _nns_edge_data_memdup (ed->data[i].data,
         ed->data[i].data_len);
 
     if (!copied->data[i].data) {
@@ -191,9 +533,14 @@ nns_edge_data_copy (nns_edge_data_h data_h, nns_edge_data_h * new_data_h)
     }
 
     copied->data[i].data_len = ed->data[i].data_len;
-    copied->data[i].destroy_cb = nns_edge_free;
+    copied->data[i].destroy_cb = nns_edge_data_free_mem;
   }
 
+  copied->has_client_id = ed->has_client_id;
+  copied->client_id = ed->client_id;
+  copied->request_id = ed->request_id;
+  copied->request_rtt = ed->request_rtt;
+
   ret = nns_edge_metadata_copy (copied->metadata, ed->metadata);
 
 done:
@@ -279,6 +626,7 @@ nns_edge_data_clear (nns_edge_data_h data_h)
     ed->data[i].destroy_cb = NULL;
   }
   ed->num = 0;
+  _nns_edge_data_release_payload (ed);
 
   nns_edge_unlock (ed);
 
@@ -385,7 +733,17 @@ nns_edge_data_set_info (nns_edge_data_h data_h, const char *key,
   }
 
   nns_edge_lock (ed);
-  ret = nns_edge_metadata_set (ed->metadata, key, value);
+  if (0 == strcasecmp (key, NNS_EDGE_DATA_KEY_CLIENT_ID) &&
+      _nns_edge_data_parse_client_id (value, &ed->client_id)) {
+    ed->has_client_id = true;
+    ret = NNS_EDGE_ERROR_NONE;
+  } else if (0 == strcasecmp (key, NNS_EDGE_DATA_KEY_REQUEST_ID) &&
+      _nns_edge_data_parse_request_id (value, &ed->request_id)) {
+    ed->request_rtt = -1;
+    ret = NNS_EDGE_ERROR_NONE;
+  } else {
+    ret = nns_edge_metadata_set (ed->metadata, key, value);
+  }
   nns_edge_unlock (ed);
 
   return ret;
@@ -422,7 +780,17 @@ nns_edge_data_get_info (nns_edge_data_h data_h, const char *key, char **value)
   }
 
   nns_edge_lock (ed);
-  ret = nns_edge_metadata_get (ed->metadata, key, value);
+  if (ed->has_client_id && 0 == strcasecmp (key, NNS_EDGE_DATA_KEY_CLIENT_ID)) {
+    *value = nns_edge_strdup_printf ("%lld", (long long) ed->client_id);
+    ret = (*value) ? NNS_EDGE_ERROR_NONE : NNS_EDGE_ERROR_OUT_OF_MEMORY;
+  } else if (ed->request_id > 0 &&
+      0 == strcasecmp (key, NNS_EDGE_DATA_KEY_REQUEST_ID)) {
+    *value = nns_edge_strdup_printf ("%llu",
+        (unsigned long long) ed->request_id);
+    ret = (*value) ? NNS_EDGE_ERROR_NONE : NNS_EDGE_ERROR_OUT_OF_MEMORY;
+  } else {
+    ret = nns_edge_metadata_get (ed->metadata, key, value);
+  }
   nns_edge_unlock (ed);
 
   return ret;
@@ -449,25 +817,23 @@ nns_edge_data_clear_info (nns_edge_data_h data_h)
   }
 
   nns_edge_lock (ed);
-  ret = nns_edge_metadata_destroy (ed->metadata);
-  if (NNS_EDGE_ERROR_NONE != ret)
-    goto done;
-  ret = nns_edge_metadata_create (&ed->metadata);
-done:
+  ed->has_client_id = false;
+  ed->client_id = 0;
+  ed->request_id = 0;
+  ed->request_rtt = -1;
+  ret = nns_edge_metadata_clear (ed->metadata);
   nns_edge_unlock (ed);
 
   return ret;
 }
 
 /**
- * @brief Serialize metadata in edge data.
+ * @brief Set the client ID to route edge data.
  */
 int
-nns_edge_data_serialize_meta (nns_edge_data_h data_h, void **data,
-    nns_size_t * data_len)
+nns_edge_data_set_client_id (nns_edge_data_h data_h, int64_t client_id)
 {
   nns_edge_data_s *ed;
-  int ret;
 
   ed = (nns_edge_data_s *) data_h;
   if (!ed) {
@@ -481,21 +847,22 @@ nns_edge_data_serialize_meta (nns_edge_data_h data_h, void **data,
   }
 
   nns_edge_lock (ed);
-  ret = nns_edge_metadata_serialize (ed->metadata, data, data_len);
+  ed->has_client_id = true;
+  ed->client_id = client_id;
   nns_edge_unlock (ed);
 
-  return ret;
+  return NNS_EDGE_ERROR_NONE;
 }
 
 /**
- * @brief Deserialize metadata in edge data.
+ * @brief Get the client ID to route edge data.
  */
 int
-nns_edge_data_deserialize_meta (nns_edge_data_h data_h, const void *data,
-    const nns_size_t data_len)
+nns_edge_data_get_client_id (nns_edge_data_h data_h, int64_t * client_id)
 {
   nns_edge_data_s *ed;
-  int ret;
+  char *val = NULL;
+  int ret = NNS_EDGE_ERROR_NONE;
 
   ed = (nns_edge_data_s *) data_h;
   if (!ed) {
@@ -503,107 +870,71 @@ nns_edge_data_deserialize_meta (nns_edge_data_h data_h, const void *data,
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
 
+  if (!client_id) {
+    nns_edge_loge ("Invalid param, client_id should not be null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
   if (!nns_edge_handle_is_valid (ed)) {
     nns_edge_loge ("Invalid param, given edge data is invalid.");
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
 
   nns_edge_lock (ed);
-  ret = nns_edge_metadata_deserialize (ed->metadata, data, data_len);
+  if (ed->has_client_id) {
+    *client_id = ed->client_id;
+  } else if (nns_edge_metadata_get (ed->metadata, NNS_EDGE_DATA_KEY_CLIENT_ID,
+          &val) != NNS_EDGE_ERROR_NONE
+      || !_nns_edge_data_parse_client_id (val, client_id)) {
+    /* The data from old version may have the client ID in metadata. */
+    ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
   nns_edge_unlock (ed);
 
+  SAFE_FREE (val);
   return ret;
 }
 
 /**
- * @brief Serialize edge data (meta data + raw data).
+ * @brief Set the request ID and round-trip time of edge data.
  */
 int
-nns_edge_data_serialize (nns_edge_data_h data_h, void **data, nns_size_t * len)
+nns_edge_data_set_request (nns_edge_data_h data_h, uint64_t request_id,
+    int64_t rtt)
 {
   nns_edge_data_s *ed;
-  nns_edge_data_header_s edata_header;
-  void *meta_serialized = NULL;
-  nns_size_t total, header_len, data_len;
-  char *serialized, *ptr;
-  unsigned int n;
-  int ret;
 
   ed = (nns_edge_data_s *) data_h;
-  if (!ed || !data || !len) {
-    nns_edge_loge ("Invalid param, one of the given param is null.");
-    return NNS_EDGE_ERROR_INVALID_PARAMETER;
-  }
-
   if (!nns_edge_handle_is_valid (ed)) {
     nns_edge_loge ("Invalid param, given edge data is invalid.");
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
 
   nns_edge_lock (ed);
-  header_len = sizeof (nns_edge_data_header_s);
-
-  data_len = 0;
-  edata_header.key = NNS_EDGE_DATA_KEY;
-  edata_header.version = nns_edge_generate_version_key ();
-  edata_header.num_mem = ed->num;
-  for (n = 0; n < ed->num; n++) {
-    edata_header.data_len[n] = ed->data[n].data_len;
-    data_len += ed->data[n].data_len;
-  }
-
-  ret = nns_edge_metadata_serialize (ed->metadata, &meta_serialized,
-      &edata_header.meta_len);
-  if (NNS_EDGE_ERROR_NONE != ret) {
-    goto done;
-  }
-
-  total = header_len + data_len + edata_header.meta_len;
-
-  serialized = ptr = (char *) nns_edge_malloc (total);
-  if (!serialized) {
-    ret = NNS_EDGE_ERROR_OUT_OF_MEMORY;
-    goto done;
-  }
-
-  /** Copy serialization header of edge data */
-  memcpy (ptr, &edata_header, header_len);
-  ptr += header_len;
-
-  /** Copy edge data */
-  for (n = 0; n < ed->num; n++) {
-    memcpy (ptr, ed->data[n].data, ed->data[n].data_len);
-    ptr += ed->data[n].data_len;
-  }
-
-  /** Copy edge meta data */
-  memcpy (ptr, meta_serialized, edata_header.meta_len);
-
-  *data = serialized;
-  *len = total;
-
-done:
-  SAFE_FREE (meta_serialized);
+  ed->request_id = request_id;
+  ed->request_rtt = (request_id > 0) ? rtt : -1;
   nns_edge_unlock (ed);
-  return ret;
+
+  return NNS_EDGE_ERROR_NONE;
 }
 
 /**
- * @brief Deserialize metadata in edge data.
+ * @brief Get the request ID of edge data.
  */
 int
-nns_edge_data_deserialize (nns_edge_data_h data_h, const void *data,
-    const nns_size_t data_len)
+nns_edge_data_get_request_id (nns_edge_data_h data_h, uint64_t * request_id)
 {
   nns_edge_data_s *ed;
-  nns_edge_data_header_s *header;
-  int ret;
-  unsigned int n;
-  char *ptr;
+  int ret = NNS_EDGE_ERROR_NONE;
 
   ed = (nns_edge_data_s *) data_h;
-  if (!ed || !data) {
-    nns_edge_loge ("Invalid param, one of the given param is null.");
+  if (!ed) {
+    nns_edge_loge ("Invalid param, given edge data handle is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!request_id) {
+    nns_edge_loge ("Invalid param, request_id should not be null.");
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
 
@@ -612,74 +943,725 @@ nns_edge_data_deserialize (nns_edge_data_h data_h, const void *data,
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
 
-  ret = nns_edge_data_is_serialized (data, data_len);
-  if (ret != NNS_EDGE_ERROR_NONE)
-    return ret;
-
   nns_edge_lock (ed);
-  header = (nns_edge_data_header_s *) data;
-  ptr = (char *) data + sizeof (nns_edge_data_header_s);
-
-  ed->num = header->num_mem;
-  for (n = 0; n < ed->num; n++) {
-    ed->data[n].data = nns_edge_memdup (ptr, header->data_len[n]);
-    ed->data[n].data_len = header->data_len[n];
-    ed->data[n].destroy_cb = nns_edge_free;
-
-    ptr += header->data_len[n];
-  }
-
-  ret = nns_edge_metadata_deserialize (ed->metadata, ptr, header->meta_len);
-
+  if (ed->request_id > 0)
+    *request_id = ed->request_id;
+  else
+    ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
   nns_edge_unlock (ed);
+
   return ret;
 }
 
 /**
- * @brief Check given data is serialized buffer.
+ * @brief Get the round-trip time of the request, measured when the query client receives the response.
  */
 int
-nns_edge_data_is_serialized (const void *data, const nns_size_t data_len)
+nns_edge_data_get_request_rtt (nns_edge_data_h data_h, int64_t * rtt)
 {
-  nns_edge_data_header_s *header;
-  nns_size_t total;
-  unsigned int n;
+  nns_edge_data_s *ed;
+  int ret = NNS_EDGE_ERROR_NONE;
 
-  if (!data) {
-    nns_edge_loge ("Invalid param, given data is null.");
+  ed = (nns_edge_data_s *) data_h;
+  if (!ed) {
+    nns_edge_loge ("Invalid param, given edge data handle is null.");
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
 
-  header = (nns_edge_data_header_s *) data;
-  if (header->key != NNS_EDGE_DATA_KEY) {
-    nns_edge_loge ("Invalid param, given data has invalid format.");
+  if (!rtt) {
+    nns_edge_loge ("Invalid param, rtt should not be null.");
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
 
-  if (!nns_edge_parse_version_key (header->version, NULL, NULL, NULL)) {
-    nns_edge_loge ("Invalid param, given data has invalid version.");
+  if (!nns_edge_handle_is_valid (ed)) {
+    nns_edge_loge ("Invalid param, given edge data is invalid.");
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
 
-  /**
-   * @todo The number of memories in data.
+  nns_edge_lock (ed);
+  if (ed->request_id > 0 && ed->request_rtt >= 0)
+    *rtt = ed->request_rtt;
+  else
+    ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+  nns_edge_unlock (ed);
+
+  return ret;
+}
+
+/**
+ * @brief Serialize metadata in edge data.
+ */
+int
+nns_edge_data_serialize_meta (nns_edge_data_h data_h, void **data,
+    nns_size_t * data_len)
+{
+  nns_edge_data_s *ed;
+  int ret;
+
+  ed = (nns_edge_data_s *) data_h;
+  if (!ed) {
+    nns_edge_loge ("Invalid param, given edge data handle is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!nns_edge_handle_is_valid (ed)) {
+    nns_edge_loge ("Invalid param, given edge data is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (ed);
+  ret = nns_edge_metadata_serialize (ed->metadata, data, data_len);
+  nns_edge_unlock (ed);
+
+  return ret;
+}
+
+/**
+ * @brief Get the serialized metadata in edge data without copying it.
+ */
+int
+nns_edge_data_get_serialized_meta (nns_edge_data_h data_h, const void **data,
+    nns_size_t * data_len)
+{
+  nns_edge_data_s *ed;
+  int ret;
+
+  ed = (nns_edge_data_s *) data_h;
+  if (!ed) {
+    nns_edge_loge ("Invalid param, given edge data handle is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!nns_edge_handle_is_valid (ed)) {
+    nns_edge_loge ("Invalid param, given edge data is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (ed);
+  ret = nns_edge_metadata_get_serialized (ed->metadata, data, data_len);
+  nns_edge_unlock (ed);
+
+  return ret;
+}
+
+/**
+ * @brief Deserialize metadata in edge data.
+ */
+int
+nns_edge_data_deserialize_meta (nns_edge_data_h data_h, const void *data,
+    const nns_size_t data_len)
+{
+  nns_edge_data_s *ed;
+  int ret;
+
+  ed = (nns_edge_data_s *) data_h;
+  if (!ed) {
+    nns_edge_loge ("Invalid param, given edge data handle is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!nns_edge_handle_is_valid (ed)) {
+    nns_edge_loge ("Invalid param, given edge data is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (ed);
+  ret = nns_edge_metadata_deserialize (ed->metadata, data, data_len);
+  nns_edge_unlock (ed);
+
+  return ret;
+}
+
+/**
+ * @brief Parse the header of serialized edge data, and get the memory info.
+ */
+static int
+_nns_edge_data_parse_header (const void *data, const nns_size_t data_len,
+    uint32_t * num_mem, const nns_size_t ** mem_len,
+    const nns_size_t ** orig_len, uint32_t * compress, nns_size_t * meta_len,
+    nns_size_t * header_len)
+{
+  uint32_t key;
+  uint64_t version;
+  const nns_size_t *sizes, *orig = NULL;
+  nns_size_t total, hlen, mlen;
+  uint32_t num, type = NNS_EDGE_COMPRESS_NONE;
+  unsigned int n;
+
+  if (data_len < sizeof (uint32_t)) {
+    nns_edge_loge ("Invalid param, given data has invalid format.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  key = *((const uint32_t *) data);
+  if (key == NNS_EDGE_DATA_KEY) {
+    const nns_edge_data_header_s *header = (const nns_edge_data_header_s *) data;
+
+    if (data_len < sizeof (nns_edge_data_header_s)) {
+      nns_edge_loge ("Invalid param, given data has invalid data size.");
+      return NNS_EDGE_ERROR_INVALID_PARAMETER;
+    }
+
+    version = header->version;
+    num = header->num_mem;
+    sizes = header->data_len;
+    mlen = header->meta_len;
+    hlen = sizeof (nns_edge_data_header_s);
+  } else if (key == NNS_EDGE_DATA_COMPACT_KEY) {
+    const nns_edge_data_compact_header_s *header =
+        (const nns_edge_data_compact_header_s *) data;
+
+    if (data_len < sizeof (nns_edge_data_compact_header_s)) {
+      nns_edge_loge ("Invalid param, given data has invalid data size.");
+      return NNS_EDGE_ERROR_INVALID_PARAMETER;
+    }
+
+    version = header->version;
+    num = header->num_mem;
+    sizes = (const nns_size_t *) (header + 1);
+    mlen = header->meta_len;
+    hlen = sizeof (nns_edge_data_compact_header_s);
+  } else if (key == NNS_EDGE_DATA_COMPRESS_KEY) {
+    const nns_edge_data_compress_header_s *header =
+        (const nns_edge_data_compress_header_s *) data;
+
+    if (data_len < sizeof (nns_edge_data_compress_header_s)) {
+      nns_edge_loge ("Invalid param, given data has invalid data size.");
+      return NNS_EDGE_ERROR_INVALID_PARAMETER;
+    }
+
+    version = header->version;
+    num = header->num_mem;
+    sizes = (const nns_size_t *) (header + 1);
+    mlen = header->meta_len;
+    type = header->compress;
+    hlen = sizeof (nns_edge_data_compress_header_s);
+
+    if (!nns_edge_compress_is_supported ((nns_edge_compress_e) type)) {
+      nns_edge_loge ("Invalid param, the compression (%u) is not supported.",
+          type);
+      return NNS_EDGE_ERROR_INVALID_PARAMETER;
+    }
+  } else {
+    nns_edge_loge ("Invalid param, given data has invalid format.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!nns_edge_parse_version_key (version, NULL, NULL, NULL)) {
+    nns_edge_loge ("Invalid param, given data has invalid version.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  /**
+   * @todo The number of memories in data.
    * Total number of memories in edge-data should be less than NNS_EDGE_DATA_LIMIT.
    * Fetch nns-edge version info and check allowed memories if NNS_EDGE_DATA_LIMIT is updated.
    */
-  if (header->num_mem > NNS_EDGE_DATA_LIMIT) {
+  if (num > NNS_EDGE_DATA_LIMIT) {
     nns_edge_loge ("Invalid param, given data has invalid memories.");
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
 
+  if (key == NNS_EDGE_DATA_COMPACT_KEY) {
+    /* Check the length of the memory sizes before accessing it. */
+    hlen += num * sizeof (nns_size_t);
+  } else if (key == NNS_EDGE_DATA_COMPRESS_KEY) {
+    /* The original sizes follow the memory sizes. */
+    hlen += 2U * num * sizeof (nns_size_t);
+    orig = sizes + num;
+  }
+
+  if (data_len < hlen) {
+    nns_edge_loge ("Invalid param, given data has invalid data size.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
   /* Check mem size */
-  total = sizeof (nns_edge_data_header_s) + header->meta_len;
-  for (n = 0; n < header->num_mem; n++)
-    total += header->data_len[n];
+  total = hlen + mlen;
+  for (n = 0; n < num; n++)
+    total += sizes[n];
 
   if (total != data_len) {
     nns_edge_loge ("Invalid param, given data has invalid data size.");
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
 
+  if (num_mem)
+    *num_mem = num;
+  if (mem_len)
+    *mem_len = sizes;
+  if (orig_len)
+    *orig_len = orig;
+  if (compress)
+    *compress = type;
+  if (meta_len)
+    *meta_len = mlen;
+  if (header_len)
+    *header_len = hlen;
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Serialize edge data (meta data + raw data).
+ */
+int
+nns_edge_data_serialize (nns_edge_data_h data_h, void **data, nns_size_t * len)
+{
+  return nns_edge_data_serialize_full (data_h, NNS_EDGE_DATA_HEADER_LEGACY,
+      data, len);
+}
+
+/**
+ * @brief Internal function to get the size of serialized edge data.
+ * @note This function should be called with lock.
+ */
+static nns_size_t
+_nns_edge_data_get_serialized_size (nns_edge_data_s * ed,
+    nns_edge_data_header_e header, nns_size_t meta_len)
+{
+  nns_size_t total;
+  unsigned int n;
+
+  if (header == NNS_EDGE_DATA_HEADER_COMPACT) {
+    total = sizeof (nns_edge_data_compact_header_s) +
+        ed->num * sizeof (nns_size_t);
+  } else {
+    total = sizeof (nns_edge_data_header_s);
+  }
+
+  for (n = 0; n < ed->num; n++)
+    total += ed->data[n].data_len;
+
+  return total + meta_len;
+}
+
+/**
+ * @brief Internal function to write the header, memories and metadata of edge data into given buffer.
+ * @note This function should be called with lock. The buffer should have the serialized size.
+ */
+static void
+_nns_edge_data_write (nns_edge_data_s * ed, nns_edge_data_header_e header,
+    const void *meta_serialized, nns_size_t meta_len, char *ptr)
+{
+  nns_edge_data_header_s edata_header;
+  nns_edge_data_compact_header_s compact_header;
+  unsigned int n;
+
+  /** Copy serialization header of edge data */
+  if (header == NNS_EDGE_DATA_HEADER_COMPACT) {
+    compact_header.key = NNS_EDGE_DATA_COMPACT_KEY;
+    compact_header.num_mem = ed->num;
+    compact_header.version = nns_edge_generate_version_key ();
+    compact_header.meta_len = meta_len;
+
+    memcpy (ptr, &compact_header, sizeof (nns_edge_data_compact_header_s));
+    ptr += sizeof (nns_edge_data_compact_header_s);
+
+    for (n = 0; n < ed->num; n++) {
+      memcpy (ptr, &ed->data[n].data_len, sizeof (nns_size_t));
+      ptr += sizeof (nns_size_t);
+    }
+  } else {
+    memset (&edata_header, 0, sizeof (nns_edge_data_header_s));
+    edata_header.key = NNS_EDGE_DATA_KEY;
+    edata_header.version = nns_edge_generate_version_key ();
+    edata_header.num_mem = ed->num;
+    for (n = 0; n < ed->num; n++)
+      edata_header.data_len[n] = ed->data[n].data_len;
+    edata_header.meta_len = meta_len;
+
+    memcpy (ptr, &edata_header, sizeof (nns_edge_data_header_s));
+    ptr += sizeof (nns_edge_data_header_s);
+  }
+
+  /** Copy edge data */
+  for (n = 0; n < ed->num; n++) {
+    memcpy (ptr, ed->data[n].data, ed->data[n].data_len);
+    ptr += ed->data[n].data_len;
+  }
+
+  /** Copy edge meta data */
+  if (meta_len > 0)
+    memcpy (ptr, meta_serialized, meta_len);
+}
+
+/**
+ * @brief Internal function to check the param to serialize edge data.
+ */
+static bool
+_nns_edge_data_check_serialize_param (nns_edge_data_s * ed,
+    nns_edge_data_header_e header)
+{
+  if (!nns_edge_handle_is_valid (ed)) {
+    nns_edge_loge ("Invalid param, given edge data is invalid.");
+    return false;
+  }
+
+  if (header != NNS_EDGE_DATA_HEADER_LEGACY &&
+      header != NNS_EDGE_DATA_HEADER_COMPACT) {
+    nns_edge_loge ("Invalid param, given header format is invalid.");
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Serialize edge data with given header format.
+ */
+int
+nns_edge_data_serialize_full (nns_edge_data_h data_h,
+    nns_edge_data_header_e header, void **data, nns_size_t * len)
+{
+  nns_edge_data_s *ed;
+  void *meta_serialized = NULL;
+  nns_size_t total, meta_len;
+  char *serialized;
+  int ret;
+
+  ed = (nns_edge_data_s *) data_h;
+  if (!ed || !data || !len) {
+    nns_edge_loge ("Invalid param, one of the given param is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!_nns_edge_data_check_serialize_param (ed, header))
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  nns_edge_lock (ed);
+
+  ret = _nns_edge_data_serialize_info (ed, &meta_serialized, &meta_len);
+  if (NNS_EDGE_ERROR_NONE != ret) {
+    goto done;
+  }
+
+  total = _nns_edge_data_get_serialized_size (ed, header, meta_len);
+
+  serialized = (char *) nns_edge_malloc (total);
+  if (!serialized) {
+    ret = NNS_EDGE_ERROR_OUT_OF_MEMORY;
+    goto done;
+  }
+
+  _nns_edge_data_write (ed, header, meta_serialized, meta_len, serialized);
+
+  *data = serialized;
+  *len = total;
+
+done:
+  SAFE_FREE (meta_serialized);
+  nns_edge_unlock (ed);
+  return ret;
+}
+
+/**
+ * @brief Serialize edge data with given header format into the buffer of the caller.
+ */
+int
+nns_edge_data_serialize_into_full (nns_edge_data_h data_h,
+    nns_edge_data_header_e header, void *data, nns_size_t data_len,
+    nns_size_t * len)
+{
+  nns_edge_data_s *ed;
+  void *meta_serialized = NULL;
+  nns_size_t total, meta_len;
+  int ret;
+
+  ed = (nns_edge_data_s *) data_h;
+  if (!ed || !len) {
+    nns_edge_loge ("Invalid param, one of the given param is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!_nns_edge_data_check_serialize_param (ed, header))
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  nns_edge_lock (ed);
+
+  ret = _nns_edge_data_serialize_info (ed, &meta_serialized, &meta_len);
+  if (NNS_EDGE_ERROR_NONE != ret) {
+    goto done;
+  }
+
+  total = _nns_edge_data_get_serialized_size (ed, header, meta_len);
+  *len = total;
+
+  if (!data || data_len < total) {
+    /* The caller gets the size and prepares the buffer. */
+    ret = NNS_EDGE_ERROR_OUT_OF_MEMORY;
+    goto done;
+  }
+
+  _nns_edge_data_write (ed, header, meta_serialized, meta_len, (char *) data);
+
+done:
+  SAFE_FREE (meta_serialized);
+  nns_edge_unlock (ed);
+  return ret;
+}
+
+/**
+ * @brief Internal function to write edge data with compressed memories into given buffer.
+ * @note This function should be called with lock. The buffer should have the serialized size without compression.
+ * @return The length of the serialized data.
+ */
+static nns_size_t
+_nns_edge_data_write_compressed (nns_edge_data_s * ed,
+    nns_edge_compress_e compress, nns_size_t threshold,
+    const void *meta_serialized, nns_size_t meta_len, char *data)
+{
+  nns_edge_data_compress_header_s header;
+  nns_size_t len, orig;
+  char *sizes, *ptr;
+  unsigned int n;
+
+  header.key = NNS_EDGE_DATA_COMPRESS_KEY;
+  header.num_mem = ed->num;
+  header.version = nns_edge_generate_version_key ();
+  header.meta_len = meta_len;
+  header.compress = (uint32_t) compress;
+  header.reserved = 0;
+  memcpy (data, &header, sizeof (nns_edge_data_compress_header_s));
+
+  sizes = data + sizeof (nns_edge_data_compress_header_s);
+  ptr = sizes + 2U * ed->num * sizeof (nns_size_t);
+
+  for (n = 0; n < ed->num; n++) {
+    len = orig = ed->data[n].data_len;
+
+    /* The buffer is smaller than the memory, compressing fails if the memory does not compress. */
+    if (len > 1U && len >= threshold) {
+      len--;
+      if (NNS_EDGE_ERROR_NONE != nns_edge_compress (compress,
+              ed->data[n].data, orig, ptr, &len))
+        len = orig;
+    }
+
+    if (len == orig) {
+      memcpy (ptr, ed->data[n].data, len);
+      orig = 0;
+    }
+
+    memcpy (sizes + n * sizeof (nns_size_t), &len, sizeof (nns_size_t));
+    memcpy (sizes + (ed->num + n) * sizeof (nns_size_t), &orig,
+        sizeof (nns_size_t));
+    ptr += len;
+  }
+
+  if (meta_len > 0)
+    memcpy (ptr, meta_serialized, meta_len);
+
+  return (nns_size_t) (ptr - data) + meta_len;
+}
+
+/**
+ * @brief Serialize edge data into the buffer of the caller, the memories are compressed with given algorithm.
+ */
+int
+nns_edge_data_serialize_compressed_into (nns_edge_data_h data_h,
+    nns_edge_compress_e compress, nns_size_t threshold, void *data,
+    nns_size_t data_len, nns_size_t * len)
+{
+  nns_edge_data_s *ed;
+  void *meta_serialized = NULL;
+  nns_size_t total, meta_len;
+  unsigned int n;
+  int ret;
+
+  ed = (nns_edge_data_s *) data_h;
+  if (!ed || !len) {
+    nns_edge_loge ("Invalid param, one of the given param is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!nns_edge_handle_is_valid (ed)) {
+    nns_edge_loge ("Invalid param, given edge data is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!nns_edge_compress_is_supported (compress)) {
+    nns_edge_loge ("Invalid param, the compression (%d) is not supported.",
+        compress);
+    return NNS_EDGE_ERROR_NOT_SUPPORTED;
+  }
+
+  nns_edge_lock (ed);
+
+  ret = _nns_edge_data_serialize_info (ed, &meta_serialized, &meta_len);
+  if (NNS_EDGE_ERROR_NONE != ret) {
+    goto done;
+  }
+
+  /* The compressed memory is smaller than the original, the buffer has the size without compression. */
+  total = sizeof (nns_edge_data_compress_header_s) +
+      2U * ed->num * sizeof (nns_size_t) + meta_len;
+  for (n = 0; n < ed->num; n++)
+    total += ed->data[n].data_len;
+
+  *len = total;
+
+  if (!data || data_len < total) {
+    /* The caller gets the size and prepares the buffer. */
+    ret = NNS_EDGE_ERROR_OUT_OF_MEMORY;
+    goto done;
+  }
+
+  *len = _nns_edge_data_write_compressed (ed, compress, threshold,
+      meta_serialized, meta_len, (char *) data);
+
+done:
+  SAFE_FREE (meta_serialized);
+  nns_edge_unlock (ed);
+  return ret;
+}
+
+/**
+ * @brief Serialize entire edge data into the buffer of the caller.
+ */
+int
+nns_edge_data_serialize_into (nns_edge_data_h data_h, void *data,
+    nns_size_t data_len, nns_size_t * len)
+{
+  return nns_edge_data_serialize_into_full (data_h,
+      NNS_EDGE_DATA_HEADER_LEGACY, data, data_len, len);
+}
+
+/**
+ * @brief Internal function to decompress the memory of serialized edge data into new buffer.
+ */
+static int
+_nns_edge_data_decompress (nns_edge_raw_data_s * raw, nns_edge_compress_e type,
+    const void *data, nns_size_t data_len, nns_size_t orig_len)
+{
+  void *mem;
+  int ret;
+
+  mem = nns_edge_data_alloc_mem (orig_len);
+  if (!mem) {
+    nns_edge_loge ("Failed to allocate memory to decompress edge data.");
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+  }
+
+  ret = nns_edge_decompress (type, data, data_len, mem, orig_len);
+  if (NNS_EDGE_ERROR_NONE != ret) {
+    nns_edge_data_free_mem (mem);
+    return ret;
+  }
+
+  raw->data = mem;
+  raw->data_len = orig_len;
+  raw->destroy_cb = nns_edge_data_free_mem;
   return NNS_EDGE_ERROR_NONE;
 }
+
+/**
+ * @brief Internal function to deserialize edge data. If copy is false, the memories refer to given buffer.
+ */
+static int
+_nns_edge_data_deserialize (nns_edge_data_h data_h, const void *data,
+    const nns_size_t data_len, bool copy)
+{
+  nns_edge_data_s *ed;
+  const nns_size_t *mem_len, *orig_len;
+  nns_size_t meta_len, header_len;
+  uint32_t num_mem, compress;
+  int ret;
+  unsigned int n;
+  char *ptr;
+
+  ed = (nns_edge_data_s *) data_h;
+  if (!ed || !data) {
+    nns_edge_loge ("Invalid param, one of the given param is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!nns_edge_handle_is_valid (ed)) {
+    nns_edge_loge ("Invalid param, given edge data is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  ret = _nns_edge_data_parse_header (data, data_len, &num_mem, &mem_len,
+      &orig_len, &compress, &meta_len, &header_len);
+  if (ret != NNS_EDGE_ERROR_NONE)
+    return ret;
+
+  nns_edge_lock (ed);
+  ptr = (char *) data + header_len;
+
+  ed->num = num_mem;
+  for (n = 0; n < ed->num; n++) {
+    if (orig_len && orig_len[n] > 0) {
+      /* The compressed memory is always decompressed into new buffer. */
+      ret = _nns_edge_data_decompress (&ed->data[n],
+          (nns_edge_compress_e) compress, ptr, mem_len[n], orig_len[n]);
+      if (NNS_EDGE_ERROR_NONE != ret) {
+        ed->num = n;
+        goto done;
+      }
+    } else {
+      ed->data[n].data = copy ? _nns_edge_data_memdup (ptr, mem_len[n]) : ptr;
+      ed->data[n].data_len = mem_len[n];
+      ed->data[n].destroy_cb = copy ? nns_edge_data_free_mem : NULL;
+    }
+
+    ptr += mem_len[n];
+  }
+
+  ret = nns_edge_metadata_deserialize (ed->metadata, ptr, meta_len);
+
+done:
+  nns_edge_unlock (ed);
+  return ret;
+}
+
+/**
+ * @brief Deserialize metadata in edge data.
+ */
+int
+nns_edge_data_deserialize (nns_edge_data_h data_h, const void *data,
+    const nns_size_t data_len)
+{
+  return _nns_edge_data_deserialize (data_h, data, data_len, true);
+}
+
+/**
+ * @brief Deserialize entire edge data without copying the memories.
+ */
+int
+nns_edge_data_deserialize_nocopy (nns_edge_data_h data_h, void *data,
+    const nns_size_t data_len, nns_edge_data_destroy_cb destroy_cb)
+{
+  nns_edge_data_s *ed;
+  int ret;
+
+  ret = _nns_edge_data_deserialize (data_h, data, data_len, false);
+  if (NNS_EDGE_ERROR_NONE != ret)
+    return ret;
+
+  /* The memories refer to the buffer, release it with the memories. */
+  ed = (nns_edge_data_s *) data_h;
+
+  nns_edge_lock (ed);
+  _nns_edge_data_release_payload (ed);
+  ed->payload = data;
+  ed->payload_destroy_cb = destroy_cb;
+  nns_edge_unlock (ed);
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Check given data is serialized buffer.
+ */
+int
+nns_edge_data_is_serialized (const void *data, const nns_size_t data_len)
+{
+  if (!data) {
+    nns_edge_loge ("Invalid param, given data is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  return _nns_edge_data_parse_header (data, data_len, NULL, NULL, NULL, NULL,
+      NULL, NULL);
+}
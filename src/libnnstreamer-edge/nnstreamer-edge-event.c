@@ -220,7 +220,7 @@ nns_edge_event_get_type (nns_edge_event_h event_h, nns_edge_event_e * event)
 }
 
 /**
- * @brief Parse edge event (NNS_EDGE_EVENT_NEW_DATA_RECEIVED) and get received data.
+ * @brief Parse edge event (NNS_EDGE_EVENT_NEW_DATA_RECEIVED or NNS_EDGE_EVENT_NEW_CHUNK_RECEIVED) and get received data.
  */
 int
 nns_edge_event_parse_new_data (nns_edge_event_h event_h,
@@ -243,7 +243,8 @@ nns_edge_event_parse_new_data (nns_edge_event_h event_h,
 
   nns_edge_lock (ee);
 
-  if (ee->event == NNS_EDGE_EVENT_NEW_DATA_RECEIVED) {
+  if (ee->event == NNS_EDGE_EVENT_NEW_DATA_RECEIVED ||
+      ee->event == NNS_EDGE_EVENT_NEW_CHUNK_RECEIVED) {
     ret = nns_edge_data_copy ((nns_edge_data_h) ee->data.data, data_h);
   } else {
     nns_edge_loge ("The edge event has invalid event type.");
@@ -254,6 +255,81 @@ nns_edge_event_parse_new_data (nns_edge_event_h event_h,
   return ret;
 }
 
+/**
+ * @brief Parse edge event (NNS_EDGE_EVENT_NEW_BATCH_RECEIVED) and get the number of data in the batch.
+ */
+int
+nns_edge_event_parse_batch_count (nns_edge_event_h event_h,
+    unsigned int *count)
+{
+  nns_edge_event_s *ee;
+  int ret = NNS_EDGE_ERROR_NONE;
+
+  ee = (nns_edge_event_s *) event_h;
+
+  if (!nns_edge_handle_is_valid (ee)) {
+    nns_edge_loge ("Invalid param, given edge event is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!count) {
+    nns_edge_loge ("Invalid param, count should not be null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (ee);
+
+  if (ee->event == NNS_EDGE_EVENT_NEW_BATCH_RECEIVED) {
+    *count = (unsigned int) (ee->data.data_len / sizeof (nns_edge_data_h));
+  } else {
+    nns_edge_loge ("The edge event has invalid event type.");
+    ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_unlock (ee);
+  return ret;
+}
+
+/**
+ * @brief Parse edge event (NNS_EDGE_EVENT_NEW_BATCH_RECEIVED) and get received data of given index.
+ */
+int
+nns_edge_event_parse_batch_data (nns_edge_event_h event_h, unsigned int index,
+    nns_edge_data_h * data_h)
+{
+  nns_edge_event_s *ee;
+  nns_edge_data_h *batch;
+  int ret = NNS_EDGE_ERROR_NONE;
+
+  ee = (nns_edge_event_s *) event_h;
+
+  if (!nns_edge_handle_is_valid (ee)) {
+    nns_edge_loge ("Invalid param, given edge event is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!data_h) {
+    nns_edge_loge ("Invalid param, data_h should not be null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (ee);
+
+  if (ee->event != NNS_EDGE_EVENT_NEW_BATCH_RECEIVED) {
+    nns_edge_loge ("The edge event has invalid event type.");
+    ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+  } else if (index >= ee->data.data_len / sizeof (nns_edge_data_h)) {
+    nns_edge_loge ("Invalid param, given index %u is out of range.", index);
+    ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+  } else {
+    batch = (nns_edge_data_h *) ee->data.data;
+    ret = nns_edge_data_copy (batch[index], data_h);
+  }
+
+  nns_edge_unlock (ee);
+  return ret;
+}
+
 /**
  * @brief Parse edge event (NNS_EDGE_EVENT_CAPABILITY) and get capability string.
  */
@@ -287,3 +363,37 @@ nns_edge_event_parse_capability (nns_edge_event_h event_h, char **capability)
   nns_edge_unlock (ee);
   return ret;
 }
+
+/**
+ * @brief Parse edge event (NNS_EDGE_EVENT_STATISTICS) and get statistics string.
+ */
+int
+nns_edge_event_parse_statistics (nns_edge_event_h event_h, char **statistics)
+{
+  nns_edge_event_s *ee;
+  int ret = NNS_EDGE_ERROR_NONE;
+
+  ee = (nns_edge_event_s *) event_h;
+
+  if (!nns_edge_handle_is_valid (ee)) {
+    nns_edge_loge ("Invalid param, given edge event is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!statistics) {
+    nns_edge_loge ("Invalid param, statistics should not be null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (ee);
+
+  if (ee->event == NNS_EDGE_EVENT_STATISTICS) {
+    *statistics = nns_edge_strdup (ee->data.data);
+  } else {
+    nns_edge_loge ("The edge event has invalid event type.");
+    ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_unlock (ee);
+  return ret;
+}
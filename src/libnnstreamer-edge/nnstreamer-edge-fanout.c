@@ -0,0 +1,204 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   nnstreamer-edge-fanout.c
+ * @date   14 October 2026
+ * @brief  Parallel fan-out, each connection has its own queue and thread to send data.
+ * @see    https://github.com/nnstreamer/nnstreamer-edge
+ * @author agent <agent@local>
+ * @bug    No known bugs except for NYI items
+ */
+
+#include "nnstreamer-edge-chunk.h"
+#include "nnstreamer-edge-credit.h"
+#include "nnstreamer-edge-data-internal.h"
+#include "nnstreamer-edge-fanout.h"
+#include "nnstreamer-edge-log.h"
+
+/**
+ * @brief Thread to send data to a connection in fan-out mode.
+ * @note In chunked transfer, the thread sends one chunk of each large data in turn, and sends new data from the queue between the chunks.
+ */
+static void *
+_nns_edge_fanout_send_thread (void *thread_data)
+{
+  nns_edge_thread_data_s *_tdata = (nns_edge_thread_data_s *) thread_data;
+  nns_edge_conn_s *conn;
+  nns_edge_chunk_tx_s chunks[NNS_EDGE_CHUNK_TRANSFERS];
+  nns_edge_chunk_tx_s *tx;
+  nns_edge_data_h data_h;
+  nns_size_t data_size;
+  int64_t client_id;
+  uint32_t transfer_id = 0U;
+  unsigned int active = 0U, turn = 0U;
+  bool done;
+  int ret;
+
+  conn = _tdata->conn;
+  client_id = _tdata->client_id;
+  SAFE_FREE (_tdata);
+
+  while (conn->sending) {
+    ret = NNS_EDGE_ERROR_UNKNOWN;
+
+    /* Wake up periodically to check the state, the queue is cleared when closing the connection. */
+    if (active == 0U) {
+      ret = nns_edge_queue_wait_pop (conn->send_queue, 100U, &data_h,
+          &data_size);
+    } else if (active < NNS_EDGE_CHUNK_TRANSFERS) {
+      ret = nns_edge_queue_pop (conn->send_queue, &data_h, &data_size);
+    }
+
+    if (NNS_EDGE_ERROR_NONE == ret) {
+      if (nns_edge_chunk_is_needed (conn, data_h)) {
+        tx = &chunks[active++];
+        memset (tx, 0, sizeof (nns_edge_chunk_tx_s));
+        tx->data_h = data_h;
+        tx->transfer_id = ++transfer_id;
+        tx->bytes = nns_edge_stats_get_data_size (data_h);
+        tx->start = nns_edge_stats_start (conn->stats);
+      } else {
+        if (conn->sending &&
+            NNS_EDGE_ERROR_NONE != nns_edge_transfer_data (conn, data_h,
+                client_id)) {
+          /* The send thread removes the connection when pushing next data. */
+          conn->send_failed = true;
+          conn->sending = false;
+        }
+
+        nns_edge_data_destroy (data_h);
+      }
+    }
+
+    if (active == 0U || !conn->sending)
+      continue;
+
+    if (turn >= active)
+      turn = 0U;
+    tx = &chunks[turn];
+
+    done = false;
+    ret = nns_edge_chunk_send (conn, tx, client_id, &done);
+    if (ret != NNS_EDGE_ERROR_NONE || done) {
+      nns_edge_conn_stats_sent (conn, tx->start, 1U, tx->bytes, ret);
+      if (ret != NNS_EDGE_ERROR_NONE) {
+        conn->send_failed = true;
+        conn->sending = false;
+      }
+
+      nns_edge_data_destroy (tx->data_h);
+      active--;
+      memmove (tx, tx + 1, (active - turn) * sizeof (nns_edge_chunk_tx_s));
+    } else {
+      turn++;
+    }
+  }
+
+  while (active > 0U)
+    nns_edge_data_destroy (chunks[--active].data_h);
+
+  return NULL;
+}
+
+/**
+ * @brief Push data into the queue of the connection in fan-out mode. The queue and thread are created when pushing first data.
+ * @note The data is dropped if the queue of the connection is full, it does not block other connections.
+ */
+int
+nns_edge_fanout_push (nns_edge_handle_s * eh, nns_edge_conn_s * conn,
+    nns_edge_data_h data_h, int64_t client_id)
+{
+  nns_edge_thread_data_s *thread_data;
+  nns_edge_queue_leak_e leaky;
+  uint64_t dropped = 0, total = 0;
+  unsigned int limit;
+  int ret;
+
+  if (conn->send_failed)
+    return NNS_EDGE_ERROR_IO;
+
+  if (!conn->send_queue) {
+    /* In conflation mode, the queue keeps the latest data only. */
+    limit = eh->conflate ? 1U : eh->fanout_limit;
+    leaky = eh->conflate ? NNS_EDGE_QUEUE_LEAK_OLD : eh->fanout_leaky;
+
+    ret = nns_edge_queue_create_full (&conn->send_queue, limit);
+    if (NNS_EDGE_ERROR_NONE != ret) {
+      nns_edge_loge ("Failed to create send queue of the connection.");
+      return ret;
+    }
+
+    nns_edge_queue_set_limit (conn->send_queue, limit, leaky);
+  }
+
+  if (!conn->send_thread) {
+    thread_data =
+        (nns_edge_thread_data_s *) calloc (1, sizeof (nns_edge_thread_data_s));
+    if (!thread_data) {
+      nns_edge_loge ("Failed to allocate edge thread data.");
+      return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+    }
+
+    thread_data->eh = eh;
+    thread_data->conn = conn;
+    thread_data->client_id = client_id;
+
+    conn->sending = true;
+    if (pthread_create (&conn->send_thread, NULL, _nns_edge_fanout_send_thread,
+            thread_data) != 0) {
+      nns_edge_loge ("Failed to create sender thread of the connection.");
+      conn->sending = false;
+      conn->send_thread = 0;
+      SAFE_FREE (thread_data);
+      return NNS_EDGE_ERROR_IO;
+    }
+  }
+
+  /* Each connection holds the reference of the data until sending it. */
+  nns_edge_queue_get_dropped (conn->send_queue, &dropped);
+  nns_edge_data_ref (data_h);
+  ret = nns_edge_queue_push (conn->send_queue, data_h,
+      sizeof (nns_edge_data_h), nns_edge_data_release_handle);
+  if (NNS_EDGE_ERROR_NONE != ret) {
+    nns_edge_logd ("The queue of the connection is full, drop the data.");
+    nns_edge_data_destroy (data_h);
+  }
+
+  /* The data dropped in the queue has taken the credit, give it back. */
+  nns_edge_queue_get_dropped (conn->send_queue, &total);
+  if (total > dropped)
+    nns_edge_credit_return (eh, conn, (unsigned int) (total - dropped),
+        client_id);
+  else if (NNS_EDGE_ERROR_NONE != ret)
+    nns_edge_credit_return (eh, conn, 1U, client_id);
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Stop the thread sending data to the connection, and release the queue of the connection.
+ */
+void
+nns_edge_fanout_stop (nns_edge_conn_s * conn)
+{
+  conn->sending = false;
+  if (conn->send_queue)
+    nns_edge_queue_clear (conn->send_queue);
+  if (conn->send_thread) {
+    pthread_join (conn->send_thread, NULL);
+    conn->send_thread = 0;
+  }
+  if (conn->send_queue) {
+    uint64_t dropped = 0;
+
+    /* Keep the number of dropped data after closing the connection. */
+    if (conn->stats &&
+        nns_edge_queue_get_dropped (conn->send_queue, &dropped) ==
+        NNS_EDGE_ERROR_NONE)
+      nns_edge_stats_add (conn->stats->conn_dropped, dropped);
+
+    nns_edge_queue_destroy (conn->send_queue);
+    conn->send_queue = NULL;
+  }
+}
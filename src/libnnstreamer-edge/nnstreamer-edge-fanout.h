@@ -0,0 +1,44 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   nnstreamer-edge-fanout.h
+ * @date   14 October 2026
+ * @brief  Parallel fan-out, each connection has its own queue and thread to send data.
+ * @see    https://github.com/nnstreamer/nnstreamer-edge
+ * @author agent <agent@local>
+ * @note   This file is internal header for nnstreamer-edge. DO NOT export this file.
+ * @bug    No known bugs except for NYI items
+ */
+
+#ifndef __NNSTREAMER_EDGE_FANOUT_H__
+#define __NNSTREAMER_EDGE_FANOUT_H__
+
+#include "nnstreamer-edge-internal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @brief Push data into the queue of the connection in fan-out mode. The queue and thread are created when pushing first data.
+ * @note The data is dropped if the queue of the connection is full, it does not block other connections.
+ * In conflation mode, the queue keeps the latest data only. In chunked transfer, the thread sends one chunk of each large data in turn.
+ * @param[in] eh The edge handle.
+ * @param[in] conn The connection to send data.
+ * @param[in] data_h The edge data, the connection holds its reference until sending it.
+ * @param[in] client_id The client ID of the connection.
+ * @return 0 on success. NNS_EDGE_ERROR_IO if sending data to the connection has failed, the connection should be removed.
+ */
+int nns_edge_fanout_push (nns_edge_handle_s *eh, nns_edge_conn_s *conn, nns_edge_data_h data_h, int64_t client_id);
+
+/**
+ * @brief Stop the thread sending data to the connection, and release the queue of the connection.
+ * @note The number of data dropped in the queue is added into the statistics of edge handle.
+ */
+void nns_edge_fanout_stop (nns_edge_conn_s *conn);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __NNSTREAMER_EDGE_FANOUT_H__ */
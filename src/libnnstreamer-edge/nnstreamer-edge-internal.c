@@ -10,149 +10,92 @@
  * @bug    No known bugs except for NYI items
  */
 
-#include <arpa/inet.h>
-#include <netdb.h>
+#include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
 #include <poll.h>
+#include <sys/uio.h>
 
 #include "nnstreamer-edge-data.h"
+#include "nnstreamer-edge-data-internal.h"
 #include "nnstreamer-edge-event.h"
 #include "nnstreamer-edge-log.h"
 #include "nnstreamer-edge-util.h"
 #include "nnstreamer-edge-queue.h"
 #include "nnstreamer-edge-metadata.h"
+#include "nnstreamer-edge-pool.h"
 #include "nnstreamer-edge-mqtt.h"
 #include "nnstreamer-edge-custom-impl.h"
+#include "nnstreamer-edge-reactor.h"
+#include "nnstreamer-edge-shm.h"
+#include "nnstreamer-edge-socket.h"
+#include "nnstreamer-edge-compress.h"
+#include "nnstreamer-edge-stats.h"
+#include "nnstreamer-edge-internal.h"
+#include "nnstreamer-edge-chunk.h"
+#include "nnstreamer-edge-fanout.h"
+#include "nnstreamer-edge-request.h"
+#include "nnstreamer-edge-credit.h"
+#include "nnstreamer-edge-conflate.h"
+#include "nnstreamer-edge-server.h"
+
+#if defined(__linux__)
+#include <sys/eventfd.h>
+#define NNS_EDGE_HAVE_EVENTFD 1
+#endif
 
 #ifndef MSG_NOSIGNAL
 #define MSG_NOSIGNAL 0
 #endif
 
+#ifndef IOV_MAX
+#define IOV_MAX 1024
+#endif
+
 /**
  * @brief The maximum length of pending connections to accept socket.
  */
 #define N_BACKLOG 10
 
 /**
- * @brief Data structure for edge handle.
+ * @brief The default number of worker threads in reactor mode.
  */
-typedef struct
-{
-  uint32_t magic;
-  pthread_mutex_t lock;
-  pthread_cond_t cond;
-  char *id;
-  char *topic;
-  nns_edge_connect_type_e connect_type;
-  char *host; /**< host name or IP address */
-  int port; /**< port number (0~65535, default 0 to get available port.) */
-  char *dest_host; /**< destination IP address (broker or target device) */
-  int dest_port; /**< destination port number (broker or target device) */
-  nns_edge_node_type_e node_type;
-  nns_edge_metadata_h metadata;
-  bool is_started;
-
-  /* Edge event callback and user data */
-  nns_edge_event_cb event_cb;
-  void *user_data;
-
-  int64_t client_id;
-  char *caps_str;
-
-  /* list of connection data */
-  void *connections;
-
-  /* socket listener */
-  bool listening;
-  int listener_fd;
-  pthread_t listener_thread;
-
-  /* thread and queue to send data */
-  bool sending;
-  nns_edge_queue_h send_queue;
-  pthread_t send_thread;
-
-  /* MQTT handle */
-  void *broker_h;
-
-  /* Data for custom connection */
-  nns_edge_custom_connection_h custom_connection_h;
-} nns_edge_handle_s;
+#define N_REACTOR_WORKERS 4
 
 /**
- * @brief enum for nnstreamer edge query commands.
+ * @brief The default number of worker threads to handle the handshake of accepted sockets.
  */
-typedef enum
-{
-  _NNS_EDGE_CMD_ERROR = 0,
-  _NNS_EDGE_CMD_TRANSFER_DATA,
-  _NNS_EDGE_CMD_HOST_INFO,
-  _NNS_EDGE_CMD_CAPABILITY,
-  _NNS_EDGE_CMD_END
-} nns_edge_cmd_e;
+#define N_HANDSHAKE_WORKERS 4
 
 /**
- * @brief Structure for edge command info. It should be fixed size.
+ * @brief The default timeout (milliseconds) to send and receive the handshake messages.
  */
-typedef struct
-{
-  uint32_t magic;
-  uint32_t cmd; /**< enum for query commands, see nns_edge_cmd_e. */
-  uint64_t version;
-  int64_t client_id;
-
-  /* memory info */
-  uint32_t num;
-  nns_size_t mem_size[NNS_EDGE_DATA_LIMIT];
-  nns_size_t meta_size;
-} nns_edge_cmd_info_s;
+#define NNS_EDGE_HANDSHAKE_TIMEOUT 5000U
 
 /**
- * @brief Structure for edge command and buffers.
+ * @brief The max number of data in the send queue, the queue is preallocated with QUEUE_SIZE.
  */
-typedef struct
-{
-  nns_edge_cmd_info_s info;
-  void *mem[NNS_EDGE_DATA_LIMIT];
-  void *meta;
-} nns_edge_cmd_s;
+#define NNS_EDGE_QUEUE_SIZE_LIMIT 65536U
 
 /**
- * @brief Data structure for connection data.
+ * @brief The max number of worker threads to invoke the event callback for new data.
  */
-typedef struct _nns_edge_conn_data_s nns_edge_conn_data_s;
+#define NNS_EDGE_DISPATCH_THREADS_LIMIT 64U
 
 /**
- * @brief Data structure for edge connection.
+ * @brief The default max number of events in the queue of each dispatch worker.
  */
-typedef struct
-{
-  char *host;
-  int port;
-  bool running;
-  pthread_t msg_thread;
-  int sockfd;
-} nns_edge_conn_s;
+#define NNS_EDGE_DISPATCH_QUEUE_SIZE 64U
 
 /**
- * @brief Data structure for connection data.
+ * @brief The max number of released events kept to be reused, if the queue of dispatch worker is unlimited.
  */
-struct _nns_edge_conn_data_s
-{
-  nns_edge_conn_s *src_conn;
-  nns_edge_conn_s *sink_conn;
-  int64_t id;
-  nns_edge_conn_data_s *next;
-};
+#define NNS_EDGE_DISPATCH_POOL_LIMIT 256U
 
 /**
- * @brief Structures for thread data of message handling.
+ * @brief The initial size of the hash table to find the connection.
  */
-typedef struct
-{
-  nns_edge_handle_s *eh;
-  int64_t client_id;
-  nns_edge_conn_s *conn;
-} nns_edge_thread_data_s;
+#define NNS_EDGE_CONN_TABLE_MIN_SIZE 16U
 
 /**
  * @brief Parse the message received from the MQTT broker and connect to the server directly.
@@ -160,71 +103,98 @@ typedef struct
 static int _mqtt_hybrid_direct_connection (nns_edge_handle_s * eh);
 
 /**
- * @brief Set socket option. nnstreamer-edge handles TCP connection now.
+ * @brief Register the standby connection when other connection is lost.
  */
-static void
-_set_socket_option (int fd)
+static int _nns_edge_standby_promote (nns_edge_handle_s * eh);
+
+/**
+ * @brief Connect to the known servers which are not connected, and make the standby connection.
+ */
+static int _nns_edge_connect_known_servers (nns_edge_handle_s * eh);
+
+/**
+ * @brief Skip the transferred bytes in the io vector. Returns the number of remained vectors.
+ */
+static int
+_skip_iov (struct iovec **iov, int iovcnt, nns_size_t size)
 {
-  int nodelay = 1;
+  struct iovec *v = *iov;
+
+  while (iovcnt > 0 && size >= v->iov_len) {
+    size -= v->iov_len;
+    v++;
+    iovcnt--;
+  }
 
-  /* setting TCP_NODELAY to true in order to avoid packet batching as known as Nagle's algorithm */
-  if (setsockopt (fd, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof (int)) < 0)
-    nns_edge_logw ("Failed to set TCP delay option.");
+  if (iovcnt > 0 && size > 0) {
+    /* Partially transferred */
+    v->iov_base = (char *) v->iov_base + size;
+    v->iov_len -= size;
+  }
+
+  *iov = v;
+  return iovcnt;
 }
 
 /**
- * @brief Fill socket address struct from host name and port number.
+ * @brief Send the io vector to connected socket with one system call, retry if partially sent.
+ * @note The io vector is updated while sending data.
  */
 static bool
-_fill_socket_addr (struct sockaddr_in *saddr, const char *host, const int port)
+_send_raw_iov (nns_edge_conn_s * conn, struct iovec *iov, int iovcnt)
 {
-  /** @todo handle protocol (ipv4 and ipv6) */
-  saddr->sin_family = AF_INET;
-  saddr->sin_port = htons (port);
-
-  if ((saddr->sin_addr.s_addr = inet_addr (host)) == INADDR_NONE) {
-    int ret;
-    char *port_str = NULL;
-    struct addrinfo hints;
-    struct addrinfo *addrs = NULL;
+  struct msghdr msg;
+  nns_ssize_t rret;
+  bool ret = true;
 
-    memset (&hints, 0, sizeof (hints));
-    hints.ai_family = AF_INET;
-    hints.ai_socktype = SOCK_STREAM;
+  pthread_mutex_lock (&conn->send_lock);
+  while (iovcnt > 0) {
+    memset (&msg, 0, sizeof (struct msghdr));
+    msg.msg_iov = iov;
+    msg.msg_iovlen = (iovcnt > IOV_MAX) ? IOV_MAX : iovcnt;
 
-    if (port > 0)
-      port_str = nns_edge_strdup_printf ("%d", port);
-    ret = getaddrinfo (host, port_str, &hints, &addrs);
-    SAFE_FREE (port_str);
+    rret = sendmsg (conn->sockfd, &msg, MSG_NOSIGNAL);
+    if (rret < 0 && errno == EINTR)
+      continue;
 
-    if (ret != 0 || addrs == NULL)
-      return false;
+    if (rret <= 0) {
+      nns_edge_loge ("Failed to send raw data.");
+      ret = false;
+      break;
+    }
 
-    memcpy (saddr, addrs->ai_addr, addrs->ai_addrlen);
-    freeaddrinfo (addrs);
+    iovcnt = _skip_iov (&iov, iovcnt, (nns_size_t) rret);
   }
+  pthread_mutex_unlock (&conn->send_lock);
 
-  return true;
+  return ret;
 }
 
 /**
- * @brief Send data to connected socket.
+ * @brief Receive the io vector from connected socket, retry if partially received.
+ * @note The io vector is updated while receiving data.
  */
 static bool
-_send_raw_data (nns_edge_conn_s * conn, void *data, nns_size_t size)
+_receive_raw_iov (nns_edge_conn_s * conn, struct iovec *iov, int iovcnt)
 {
-  nns_size_t sent = 0;
+  struct msghdr msg;
   nns_ssize_t rret;
 
-  while (sent < size) {
-    rret = send (conn->sockfd, (char *) data + sent, size - sent, MSG_NOSIGNAL);
+  while (iovcnt > 0) {
+    memset (&msg, 0, sizeof (struct msghdr));
+    msg.msg_iov = iov;
+    msg.msg_iovlen = (iovcnt > IOV_MAX) ? IOV_MAX : iovcnt;
+
+    rret = recvmsg (conn->sockfd, &msg, 0);
+    if (rret < 0 && errno == EINTR)
+      continue;
 
     if (rret <= 0) {
-      nns_edge_loge ("Failed to send raw data.");
+      nns_edge_loge ("Failed to receive raw data.");
       return false;
     }
 
-    sent += rret;
+    iovcnt = _skip_iov (&iov, iovcnt, (nns_size_t) rret);
   }
 
   return true;
@@ -286,8 +256,8 @@ _nns_edge_check_connection (nns_edge_conn_s * conn)
 /**
  * @brief initialize edge command.
  */
-static void
-_nns_edge_cmd_init (nns_edge_cmd_s * cmd, nns_edge_cmd_e c, int64_t cid)
+void
+nns_edge_cmd_init (nns_edge_cmd_s * cmd, nns_edge_cmd_e c, int64_t cid)
 {
   if (!cmd)
     return;
@@ -315,11 +285,20 @@ _nns_edge_cmd_clear (nns_edge_cmd_s * cmd)
   nns_edge_handle_set_magic (&cmd->info, NNS_EDGE_MAGIC_DEAD);
 
   for (i = 0; i < cmd->info.num; i++) {
-    SAFE_FREE (cmd->mem[i]);
+    if (cmd->pool)
+      nns_edge_pool_release (cmd->pool, cmd->mem[i], cmd->info.mem_size[i]);
+    else
+      nns_edge_data_free_mem (cmd->mem[i]);
+    cmd->mem[i] = NULL;
     cmd->info.mem_size[i] = 0U;
   }
 
-  SAFE_FREE (cmd->meta);
+  if (cmd->pool) {
+    nns_edge_pool_release (cmd->pool, cmd->meta, cmd->info.meta_size);
+    cmd->meta = NULL;
+  } else {
+    SAFE_FREE (cmd->meta);
+  }
 
   cmd->info.cmd = _NNS_EDGE_CMD_ERROR;
   cmd->info.version = 0;
@@ -361,11 +340,59 @@ _nns_edge_cmd_is_valid (nns_edge_cmd_s * cmd)
 }
 
 /**
- * @brief Send edge command to connected device.
+ * @brief Fill the io vector with the header of edge command, according to the header format of the connected node.
+ * @return The number of filled vectors. (max 3)
  */
 static int
-_nns_edge_cmd_send (nns_edge_conn_s * conn, nns_edge_cmd_s * cmd)
+_nns_edge_cmd_fill_header (nns_edge_conn_s * conn, nns_edge_cmd_s * cmd,
+    nns_edge_cmd_header_s * header, nns_edge_cmd_header_ext_s * ext,
+    struct iovec *iov)
+{
+  int iovcnt = 0;
+
+  if (conn->features & NNS_EDGE_FEATURE_COMPACT_HEADER) {
+    header->magic = NNS_EDGE_MAGIC_COMPACT;
+    header->cmd = cmd->info.cmd;
+    header->version = cmd->info.version;
+    header->client_id = cmd->info.client_id;
+    header->num = cmd->info.num;
+    header->header_len = sizeof (nns_edge_cmd_header_s) +
+        cmd->info.num * sizeof (nns_size_t);
+    header->meta_size = cmd->info.meta_size;
+
+    iov[iovcnt].iov_base = header;
+    iov[iovcnt++].iov_len = sizeof (nns_edge_cmd_header_s);
+
+    if (cmd->info.num > 0) {
+      iov[iovcnt].iov_base = cmd->info.mem_size;
+      iov[iovcnt++].iov_len = cmd->info.num * sizeof (nns_size_t);
+    }
+
+    if (cmd->request_id > 0) {
+      ext->request_id = cmd->request_id;
+      header->header_len += sizeof (nns_edge_cmd_header_ext_s);
+
+      iov[iovcnt].iov_base = ext;
+      iov[iovcnt++].iov_len = sizeof (nns_edge_cmd_header_ext_s);
+    }
+  } else {
+    iov[iovcnt].iov_base = &cmd->info;
+    iov[iovcnt++].iov_len = sizeof (nns_edge_cmd_info_s);
+  }
+
+  return iovcnt;
+}
+
+/**
+ * @brief Send edge command to connected device.
+ */
+int
+nns_edge_cmd_send (nns_edge_conn_s * conn, nns_edge_cmd_s * cmd)
 {
+  struct iovec iov[NNS_EDGE_DATA_LIMIT + 4];
+  nns_edge_cmd_header_s header;
+  nns_edge_cmd_header_ext_s ext;
+  int iovcnt = 0;
   unsigned int n;
 
   if (!conn) {
@@ -383,23 +410,25 @@ _nns_edge_cmd_send (nns_edge_conn_s * conn, nns_edge_cmd_s * cmd)
     return NNS_EDGE_ERROR_IO;
   }
 
-  if (!_send_raw_data (conn, &cmd->info, sizeof (nns_edge_cmd_info_s))) {
-    nns_edge_loge ("Failed to send command to socket.");
-    return NNS_EDGE_ERROR_IO;
-  }
+  /* Send header, memories and metadata at once. */
+  iovcnt = _nns_edge_cmd_fill_header (conn, cmd, &header, &ext, iov);
 
   for (n = 0; n < cmd->info.num; n++) {
-    if (!_send_raw_data (conn, cmd->mem[n], cmd->info.mem_size[n])) {
-      nns_edge_loge ("Failed to send %uth memory to socket.", n);
-      return NNS_EDGE_ERROR_IO;
-    }
+    if (cmd->info.mem_size[n] == 0)
+      continue;
+
+    iov[iovcnt].iov_base = cmd->mem[n];
+    iov[iovcnt++].iov_len = cmd->info.mem_size[n];
   }
 
   if (cmd->info.meta_size > 0) {
-    if (!_send_raw_data (conn, cmd->meta, cmd->info.meta_size)) {
-      nns_edge_loge ("Failed to send metadata to socket.");
-      return NNS_EDGE_ERROR_IO;
-    }
+    iov[iovcnt].iov_base = cmd->meta;
+    iov[iovcnt++].iov_len = cmd->info.meta_size;
+  }
+
+  if (!_send_raw_iov (conn, iov, iovcnt)) {
+    nns_edge_loge ("Failed to send command to socket.");
+    return NNS_EDGE_ERROR_IO;
   }
 
   return NNS_EDGE_ERROR_NONE;
@@ -407,11 +436,14 @@ _nns_edge_cmd_send (nns_edge_conn_s * conn, nns_edge_cmd_s * cmd)
 
 /**
  * @brief Receive edge command from connected device.
- * @note Before calling this function, you should initialize edge-cmd by using _nns_edge_cmd_init().
+ * @note Before calling this function, you should initialize edge-cmd by using nns_edge_cmd_init().
  */
 static int
 _nns_edge_cmd_receive (nns_edge_conn_s * conn, nns_edge_cmd_s * cmd)
 {
+  struct iovec iov[NNS_EDGE_DATA_LIMIT + 1];
+  nns_edge_cmd_header_s header;
+  int iovcnt = 0;
   unsigned int n;
   int ret = NNS_EDGE_ERROR_NONE;
 
@@ -423,14 +455,74 @@ _nns_edge_cmd_receive (nns_edge_conn_s * conn, nns_edge_cmd_s * cmd)
     return NNS_EDGE_ERROR_IO;
   }
 
-  if (!_receive_raw_data (conn, &cmd->info, sizeof (nns_edge_cmd_info_s))) {
+  /**
+   * Receive the fixed part of compact header first, legacy header is longer than it.
+   * Then check the magic and receive remained header.
+   */
+  if (!_receive_raw_data (conn, &header, sizeof (nns_edge_cmd_header_s))) {
     nns_edge_loge ("Failed to receive command from socket.");
     return NNS_EDGE_ERROR_IO;
   }
 
-  if (!_nns_edge_cmd_is_valid (cmd)) {
-    nns_edge_loge ("Failed to receive command, invalid command.");
-    return NNS_EDGE_ERROR_IO;
+  if (header.magic == NNS_EDGE_MAGIC_COMPACT) {
+    nns_size_t ext_len;
+
+    cmd->info.cmd = header.cmd;
+    cmd->info.version = header.version;
+    cmd->info.client_id = header.client_id;
+    cmd->info.num = header.num;
+    cmd->info.meta_size = header.meta_size;
+
+    if (!_nns_edge_cmd_is_valid (cmd) ||
+        header.header_len < sizeof (nns_edge_cmd_header_s) +
+        header.num * sizeof (nns_size_t)) {
+      nns_edge_loge ("Failed to receive command, invalid command.");
+      return NNS_EDGE_ERROR_IO;
+    }
+
+    /* Skip unknown fields from newer version. */
+    ext_len = header.header_len - sizeof (nns_edge_cmd_header_s) -
+        header.num * sizeof (nns_size_t);
+    if (ext_len > NNS_EDGE_CMD_HEADER_EXT_MAX) {
+      nns_edge_loge ("Failed to receive command, invalid header length.");
+      return NNS_EDGE_ERROR_IO;
+    }
+
+    if (header.num > 0 || ext_len > 0) {
+      char ext[NNS_EDGE_CMD_HEADER_EXT_MAX];
+      nns_edge_cmd_header_ext_s header_ext;
+
+      iov[iovcnt].iov_base = cmd->info.mem_size;
+      iov[iovcnt++].iov_len = header.num * sizeof (nns_size_t);
+      iov[iovcnt].iov_base = ext;
+      iov[iovcnt++].iov_len = ext_len;
+
+      if (!_receive_raw_iov (conn, iov, iovcnt)) {
+        nns_edge_loge ("Failed to receive command from socket.");
+        return NNS_EDGE_ERROR_IO;
+      }
+
+      if (ext_len >= sizeof (nns_edge_cmd_header_ext_s)) {
+        memcpy (&header_ext, ext, sizeof (nns_edge_cmd_header_ext_s));
+        cmd->request_id = header_ext.request_id;
+      }
+
+      iovcnt = 0;
+    }
+  } else {
+    memcpy (&cmd->info, &header, sizeof (nns_edge_cmd_header_s));
+
+    if (!_receive_raw_data (conn,
+            (char *) &cmd->info + sizeof (nns_edge_cmd_header_s),
+            sizeof (nns_edge_cmd_info_s) - sizeof (nns_edge_cmd_header_s))) {
+      nns_edge_loge ("Failed to receive command from socket.");
+      return NNS_EDGE_ERROR_IO;
+    }
+
+    if (!_nns_edge_cmd_is_valid (cmd)) {
+      nns_edge_loge ("Failed to receive command, invalid command.");
+      return NNS_EDGE_ERROR_IO;
+    }
   }
 
   nns_edge_logd ("Received command:%d (num:%u)", cmd->info.cmd, cmd->info.num);
@@ -440,34 +532,42 @@ _nns_edge_cmd_receive (nns_edge_conn_s * conn, nns_edge_cmd_s * cmd)
     return NNS_EDGE_ERROR_IO;
   }
 
+  /* Allocate all buffers first and receive memories and metadata at once. */
+  cmd->pool = conn->pool;
   for (n = 0; n < cmd->info.num; n++) {
-    cmd->mem[n] = nns_edge_malloc (cmd->info.mem_size[n]);
+    cmd->mem[n] = cmd->pool ?
+        nns_edge_pool_alloc (cmd->pool, cmd->info.mem_size[n]) :
+        nns_edge_data_alloc_mem (cmd->info.mem_size[n]);
     if (!cmd->mem[n]) {
       nns_edge_loge ("Failed to allocate memory to receive data from socket.");
       ret = NNS_EDGE_ERROR_OUT_OF_MEMORY;
       goto error;
     }
 
-    if (!_receive_raw_data (conn, cmd->mem[n], cmd->info.mem_size[n])) {
-      nns_edge_loge ("Failed to receive %uth memory from socket.", n++);
-      ret = NNS_EDGE_ERROR_IO;
-      goto error;
+    if (cmd->info.mem_size[n] > 0) {
+      iov[iovcnt].iov_base = cmd->mem[n];
+      iov[iovcnt++].iov_len = cmd->info.mem_size[n];
     }
   }
 
   if (cmd->info.meta_size > 0) {
-    cmd->meta = nns_edge_malloc (cmd->info.meta_size);
+    cmd->meta = cmd->pool ?
+        nns_edge_pool_alloc (cmd->pool, cmd->info.meta_size) :
+        nns_edge_malloc (cmd->info.meta_size);
     if (!cmd->meta) {
       nns_edge_loge ("Failed to allocate memory to receive meta from socket.");
       ret = NNS_EDGE_ERROR_OUT_OF_MEMORY;
       goto error;
     }
 
-    if (!_receive_raw_data (conn, cmd->meta, cmd->info.meta_size)) {
-      nns_edge_loge ("Failed to receive metadata from socket.");
-      ret = NNS_EDGE_ERROR_IO;
-      goto error;
-    }
+    iov[iovcnt].iov_base = cmd->meta;
+    iov[iovcnt++].iov_len = cmd->info.meta_size;
+  }
+
+  if (!_receive_raw_iov (conn, iov, iovcnt)) {
+    nns_edge_loge ("Failed to receive memories and metadata from socket.");
+    ret = NNS_EDGE_ERROR_IO;
+    goto error;
   }
 
   return NNS_EDGE_ERROR_NONE;
@@ -478,693 +578,3176 @@ error:
 }
 
 /**
- * @brief Internal function to send edge data.
+ * @brief Check the connected node is running on same host.
  */
-static int
-_nns_edge_transfer_data (nns_edge_conn_s * conn, nns_edge_data_h data_h,
-    int64_t client_id)
+static bool
+_nns_edge_is_local_peer (int sockfd)
 {
-  nns_edge_cmd_s cmd;
-  unsigned int i;
-  int ret;
-
-  _nns_edge_cmd_init (&cmd, _NNS_EDGE_CMD_TRANSFER_DATA, client_id);
-
-  ret = nns_edge_data_get_count (data_h, &cmd.info.num);
-  if (ret != NNS_EDGE_ERROR_NONE) {
-    nns_edge_loge ("Failed to get data count");
-    return ret;
-  }
+  struct sockaddr_in local, peer;
+  socklen_t len;
 
-  for (i = 0; i < cmd.info.num; i++) {
-    ret = nns_edge_data_get (data_h, i, &cmd.mem[i], &cmd.info.mem_size[i]);
-    if (ret != NNS_EDGE_ERROR_NONE) {
-      nns_edge_loge ("Failed to get data");
-      return ret;
-    }
-  }
+  len = sizeof (local);
+  if (getsockname (sockfd, (struct sockaddr *) &local, &len) < 0)
+    return false;
 
-  ret = nns_edge_data_serialize_meta (data_h, &cmd.meta, &cmd.info.meta_size);
-  if (ret != NNS_EDGE_ERROR_NONE) {
-    nns_edge_loge ("Failed to serialize meta");
-    return ret;
-  }
+  /* Unix domain socket is always connected to the node on same host. */
+  if (local.sin_family == AF_UNIX)
+    return true;
 
-  ret = _nns_edge_cmd_send (conn, &cmd);
-  SAFE_FREE (cmd.meta);
+  if (local.sin_family != AF_INET)
+    return false;
 
-  if (ret != NNS_EDGE_ERROR_NONE) {
-    nns_edge_loge ("Failed to send edge data to destination (%s:%d).",
-        conn->host, conn->port);
-  }
+  len = sizeof (peer);
+  if (getpeername (sockfd, (struct sockaddr *) &peer, &len) < 0 ||
+      peer.sin_family != AF_INET)
+    return false;
 
-  return ret;
+  return (local.sin_addr.s_addr == peer.sin_addr.s_addr);
 }
 
 /**
- * @brief Close connection
+ * @brief Create the shared memory ring to send data, if the connected node is running on same host and supports it.
+ * @note The ring is created when sending first data, the name of the ring is sent to the node.
  */
 static bool
-_nns_edge_close_connection (nns_edge_conn_s * conn)
+_nns_edge_shm_prepare (nns_edge_conn_s * conn, int64_t client_id)
 {
-  if (!conn)
+  nns_edge_cmd_s cmd;
+  nns_edge_shm_h shm;
+  const char *name;
+
+  if (conn->shm_send)
+    return true;
+
+  if (conn->shm_checked)
     return false;
 
-  /* Stop and clear the message thread. */
-  conn->running = false;
-  if (conn->msg_thread) {
-    pthread_join (conn->msg_thread, NULL);
-    conn->msg_thread = 0;
+  conn->shm_checked = true;
+  if (conn->shm_size == 0 || !(conn->features & NNS_EDGE_FEATURE_SHM) ||
+      !_nns_edge_is_local_peer (conn->sockfd))
+    return false;
+
+  if (nns_edge_shm_create (conn->shm_size, &shm) != NNS_EDGE_ERROR_NONE) {
+    nns_edge_logw ("Failed to create shared memory, send data with socket.");
+    return false;
   }
 
-  if (conn->sockfd >= 0) {
-    nns_edge_cmd_s cmd;
+  name = nns_edge_shm_get_name (shm);
 
-    /* Send error before closing the socket. */
-    nns_edge_logd ("Send error cmd to close connection.");
-    _nns_edge_cmd_init (&cmd, _NNS_EDGE_CMD_ERROR, 0);
-    _nns_edge_cmd_send (conn, &cmd);
+  nns_edge_cmd_init (&cmd, _NNS_EDGE_CMD_SHM_INFO, client_id);
+  cmd.info.num = 1;
+  cmd.info.mem_size[0] = strlen (name) + 1;
+  cmd.mem[0] = (void *) name;
 
-    if (close (conn->sockfd) < 0)
-      nns_edge_logw ("Failed to close socket.");
-    conn->sockfd = -1;
+  if (nns_edge_cmd_send (conn, &cmd) != NNS_EDGE_ERROR_NONE) {
+    nns_edge_logw ("Failed to send shared memory info, send data with socket.");
+    nns_edge_shm_close (shm);
+    return false;
   }
 
-  SAFE_FREE (conn->host);
-  SAFE_FREE (conn);
+  conn->shm_send = shm;
   return true;
 }
 
 /**
- * @brief Release connection data and its resources.
+ * @brief Write the memories and the metadata of edge data into the record of shared memory ring, then the command has the descriptor of the record only.
+ * @note The memories of edge data are written once into the record, the socket sends the descriptor as the doorbell.
+ * @return false if the ring does not have enough space, the command is not changed.
  */
-static void
-_nns_edge_release_connection_data (nns_edge_conn_data_s * cdata)
+static bool
+_nns_edge_shm_fill_cmd (nns_edge_conn_s * conn, nns_edge_cmd_s * cmd,
+    nns_edge_shm_desc_s * desc)
 {
-  if (cdata) {
-    _nns_edge_close_connection (cdata->src_conn);
-    _nns_edge_close_connection (cdata->sink_conn);
-    SAFE_FREE (cdata);
-  }
-}
+  nns_size_t total = 0, pos = 0, meta_size;
+  char *addr;
+  unsigned int i;
 
-/**
- * @brief Get nnstreamer-edge connection data.
- * @note This function should be called with handle lock.
- */
-static nns_edge_conn_data_s *
-_nns_edge_get_connection (nns_edge_handle_s * eh, int64_t client_id)
-{
-  nns_edge_conn_data_s *cdata;
+  for (i = 0; i < cmd->info.num; i++)
+    total += NNS_EDGE_SHM_ALIGN_SIZE (cmd->info.mem_size[i]);
 
-  cdata = (nns_edge_conn_data_s *) eh->connections;
+  /* The large metadata is sent with the command. */
+  meta_size = (cmd->info.meta_size <= UINT32_MAX) ? cmd->info.meta_size : 0U;
+  total += meta_size;
 
-  while (cdata) {
-    if (cdata->id == client_id)
-      return cdata;
+  addr = (char *) nns_edge_shm_alloc (conn->shm_send, total, &desc->offset);
+  if (!addr)
+    return false;
 
-    cdata = cdata->next;
+  desc->num = cmd->info.num;
+  for (i = 0; i < cmd->info.num; i++) {
+    memcpy (addr + pos, cmd->mem[i], cmd->info.mem_size[i]);
+    desc->mem_size[i] = cmd->info.mem_size[i];
+    pos += NNS_EDGE_SHM_ALIGN_SIZE (cmd->info.mem_size[i]);
   }
 
-  return NULL;
+  desc->meta_size = (uint32_t) meta_size;
+  if (meta_size > 0U) {
+    memcpy (addr + pos, cmd->meta, meta_size);
+    cmd->meta = NULL;
+    cmd->info.meta_size = 0U;
+  }
+
+  cmd->info.cmd = _NNS_EDGE_CMD_TRANSFER_SHM;
+  cmd->info.num = 1;
+  cmd->info.mem_size[0] = sizeof (nns_edge_shm_desc_s);
+  cmd->mem[0] = desc;
+
+  return true;
 }
 
 /**
- * @brief Get nnstreamer-edge connection data.
- * @note This function should be called with handle lock.
+ * @brief Compress the memories of edge data into the buffer of the connection, if the connected node supports the compression.
+ * @note The memory smaller than the threshold or the memory which does not compress is sent without compression.
+ * @return false if no memory is compressed, the command is not changed.
  */
-static nns_edge_conn_data_s *
-_nns_edge_add_connection (nns_edge_handle_s * eh, int64_t client_id)
+static bool
+_nns_edge_compress_fill_cmd (nns_edge_conn_s * conn, nns_edge_cmd_s * cmd)
 {
-  nns_edge_conn_data_s *cdata;
+  nns_edge_compress_desc_s desc;
+  nns_size_t total = 0, hlen, pos, len;
+  nns_size_t orig[NNS_EDGE_DATA_LIMIT];
+  char *buf;
+  unsigned int i, compressed = 0;
+
+  if (NNS_EDGE_COMPRESS_NONE == conn->compress ||
+      !(conn->features & nns_edge_compress_get_feature (conn->compress)) ||
+      cmd->info.num == 0 || cmd->info.num >= NNS_EDGE_DATA_LIMIT)
+    return false;
 
-  cdata = _nns_edge_get_connection (eh, client_id);
+  for (i = 0; i < cmd->info.num; i++) {
+    if (cmd->info.mem_size[i] > 1U &&
+        cmd->info.mem_size[i] >= conn->compress_threshold)
+      total += cmd->info.mem_size[i];
+  }
 
-  if (NULL == cdata) {
-    cdata = (nns_edge_conn_data_s *) calloc (1, sizeof (nns_edge_conn_data_s));
-    if (NULL == cdata) {
-      nns_edge_loge ("Failed to allocate memory for connection data.");
-      return NULL;
+  if (total == 0)
+    return false;
+
+  hlen = sizeof (nns_edge_compress_desc_s) +
+      cmd->info.num * sizeof (nns_size_t);
+  if (conn->compress_buf_size < hlen + total) {
+    SAFE_FREE (conn->compress_buf);
+    conn->compress_buf_size = 0;
+
+    conn->compress_buf = nns_edge_malloc (hlen + total);
+    if (!conn->compress_buf) {
+      nns_edge_logw ("Failed to allocate the buffer to compress data.");
+      return false;
     }
 
-    /* prepend connection data */
-    cdata->id = client_id;
-    cdata->next = eh->connections;
-    eh->connections = cdata;
+    conn->compress_buf_size = hlen + total;
   }
 
-  return cdata;
+  buf = (char *) conn->compress_buf;
+  pos = hlen;
+
+  for (i = 0; i < cmd->info.num; i++) {
+    orig[i] = 0;
+
+    if (cmd->info.mem_size[i] <= 1U ||
+        cmd->info.mem_size[i] < conn->compress_threshold)
+      continue;
+
+    /* The buffer is smaller than the memory, compressing fails if the memory does not compress. */
+    len = cmd->info.mem_size[i] - 1U;
+    if (NNS_EDGE_ERROR_NONE == nns_edge_compress (conn->compress, cmd->mem[i],
+            cmd->info.mem_size[i], buf + pos, &len)) {
+      orig[i] = cmd->info.mem_size[i];
+      cmd->mem[i] = buf + pos;
+      cmd->info.mem_size[i] = len;
+      pos += len;
+      compressed++;
+    }
+  }
+
+  if (compressed == 0)
+    return false;
+
+  desc.compress = (uint32_t) conn->compress;
+  desc.num = cmd->info.num;
+  memcpy (buf, &desc, sizeof (nns_edge_compress_desc_s));
+  memcpy (buf + sizeof (nns_edge_compress_desc_s), orig,
+      cmd->info.num * sizeof (nns_size_t));
+
+  /* The first memory is the header, the memories follow it. */
+  for (i = cmd->info.num; i > 0; i--) {
+    cmd->mem[i] = cmd->mem[i - 1];
+    cmd->info.mem_size[i] = cmd->info.mem_size[i - 1];
+  }
+
+  cmd->info.cmd = _NNS_EDGE_CMD_TRANSFER_COMPRESSED;
+  cmd->info.num++;
+  cmd->info.mem_size[0] = hlen;
+  cmd->mem[0] = buf;
+
+  return true;
 }
 
 /**
- * @brief Remove nnstreamer-edge connection data.
- * @note This function should be called with handle lock.
+ * @brief Update the statistics after sending the data to the connection.
  */
-static void
-_nns_edge_remove_connection (nns_edge_handle_s * eh, int64_t client_id)
+void
+nns_edge_conn_stats_sent (nns_edge_conn_s * conn, int64_t start,
+    unsigned int frames, nns_size_t bytes, int ret)
 {
-  nns_edge_conn_data_s *cdata, *prev;
-
-  cdata = (nns_edge_conn_data_s *) eh->connections;
-  prev = NULL;
+  if (!conn->stats)
+    return;
 
-  while (cdata) {
-    if (cdata->id == client_id) {
-      if (prev)
-        prev->next = cdata->next;
-      else
-        eh->connections = cdata->next;
+  nns_edge_stats_done (&conn->stats->send, start);
 
-      _nns_edge_release_connection_data (cdata);
-      return;
-    }
-    prev = cdata;
-    cdata = cdata->next;
+  if (NNS_EDGE_ERROR_NONE == ret) {
+    nns_edge_stats_count (conn->stats->sent, frames, bytes);
+    nns_edge_stats_count (conn->sent, frames, bytes);
+  } else {
+    nns_edge_stats_add (conn->stats->send_errors, 1U);
   }
 }
 
 /**
- * @brief Remove all connection data.
- * @note This function should be called with handle lock.
+ * @brief Update the statistics after receiving the data from the connection.
  */
 static void
-_nns_edge_remove_all_connection (nns_edge_handle_s * eh)
+_nns_edge_stats_received (nns_edge_conn_s * conn, nns_edge_data_h data_h)
 {
-  nns_edge_conn_data_s *cdata, *next;
+  nns_size_t bytes;
 
-  cdata = (nns_edge_conn_data_s *) eh->connections;
-  eh->connections = NULL;
+  if (!conn->stats)
+    return;
 
-  while (cdata) {
-    next = cdata->next;
-
-    _nns_edge_release_connection_data (cdata);
-
-    cdata = next;
-  }
-}
+  bytes = nns_edge_stats_get_data_size (data_h);
+  nns_edge_stats_count (conn->stats->received, 1U, bytes);
+  nns_edge_stats_count (conn->received, 1U, bytes);
+}
 
 /**
- * @brief Connect to requested socket.
+ * @brief Internal function to send edge data.
  */
-static bool
-_nns_edge_connect_socket (nns_edge_conn_s * conn)
+int
+nns_edge_transfer_data (nns_edge_conn_s * conn, nns_edge_data_h data_h,
+    int64_t client_id)
 {
-  struct sockaddr_in saddr = { 0 };
-  socklen_t saddr_len = sizeof (struct sockaddr_in);
+  nns_edge_cmd_s cmd;
+  nns_edge_shm_desc_s desc;
+  nns_size_t bytes;
+  int64_t start;
+  unsigned int i;
+  int ret;
 
-  if (!_fill_socket_addr (&saddr, conn->host, conn->port)) {
-    nns_edge_loge ("Failed to connect socket, invalid host %s.", conn->host);
-    return false;
+  start = nns_edge_stats_start (conn->stats);
+  nns_edge_cmd_init (&cmd, _NNS_EDGE_CMD_TRANSFER_DATA, client_id);
+
+  ret = nns_edge_data_get_count (data_h, &cmd.info.num);
+  if (ret != NNS_EDGE_ERROR_NONE) {
+    nns_edge_loge ("Failed to get data count");
+    return ret;
   }
 
-  conn->sockfd = socket (AF_INET, SOCK_STREAM, IPPROTO_TCP);
-  if (conn->sockfd < 0) {
-    nns_edge_loge ("Failed to create new socket.");
-    return false;
+  for (i = 0; i < cmd.info.num; i++) {
+    ret = nns_edge_data_get (data_h, i, &cmd.mem[i], &cmd.info.mem_size[i]);
+    if (ret != NNS_EDGE_ERROR_NONE) {
+      nns_edge_loge ("Failed to get data");
+      return ret;
+    }
+  }
+
+  /* The serialized metadata is cached in edge data, do not release it. */
+  ret = nns_edge_data_get_serialized_meta (data_h, (const void **) &cmd.meta,
+      &cmd.info.meta_size);
+  if (ret != NNS_EDGE_ERROR_NONE) {
+    nns_edge_loge ("Failed to serialize meta");
+    return ret;
   }
 
-  _set_socket_option (conn->sockfd);
+  /* The response of the request has same request ID. */
+  if (nns_edge_data_get_request_id (data_h, &cmd.request_id) !=
+      NNS_EDGE_ERROR_NONE)
+    cmd.request_id = 0;
 
-  if (connect (conn->sockfd, (struct sockaddr *) &saddr, saddr_len) < 0) {
-    nns_edge_loge ("Failed to connect host %s:%d.", conn->host, conn->port);
-    return false;
+  /* Count the original sizes, the memories may be sent with shared memory or compressed. */
+  for (i = 0, bytes = 0; i < cmd.info.num; i++)
+    bytes += cmd.info.mem_size[i];
+
+  /**
+   * The node on same host gets the memories from the ring. If the ring is full, send the memories with socket.
+   * The memories are compressed only when sending them with socket.
+   */
+  if (!_nns_edge_shm_prepare (conn, client_id) ||
+      !_nns_edge_shm_fill_cmd (conn, &cmd, &desc))
+    _nns_edge_compress_fill_cmd (conn, &cmd);
+
+  if (conn->stats) {
+    nns_edge_stats_done (&conn->stats->serialize, start);
+    start = nns_edge_stats_start (conn->stats);
   }
 
-  return true;
+  ret = nns_edge_cmd_send (conn, &cmd);
+
+  nns_edge_conn_stats_sent (conn, start, 1U, bytes, ret);
+  if (ret != NNS_EDGE_ERROR_NONE) {
+    nns_edge_loge ("Failed to send edge data to destination (%s:%d).",
+        conn->host, conn->port);
+  }
+
+  return ret;
 }
 
 /**
- * @brief Message thread, receive buffer from the client.
+ * @brief Release the pending data in the batch of the connection.
  */
-static void *
-_nns_edge_message_handler (void *thread_data)
+static void
+_nns_edge_batch_clear (nns_edge_conn_s * conn)
 {
-  nns_edge_thread_data_s *_tdata = (nns_edge_thread_data_s *) thread_data;
-  nns_edge_handle_s *eh;
-  nns_edge_conn_s *conn;
-  bool remove_connection = false;
-  int64_t client_id;
-  int ret;
+  unsigned int i;
 
-  if (!_tdata) {
-    nns_edge_loge ("Internal error, thread data is null.");
-    return NULL;
+  for (i = 0; i < conn->batch_len; i++) {
+    nns_edge_data_destroy (conn->batch[i]);
+    conn->batch[i] = NULL;
   }
 
-  eh = (nns_edge_handle_s *) _tdata->eh;
-  conn = _tdata->conn;
-  client_id = _tdata->client_id;
-  SAFE_FREE (_tdata);
+  conn->batch_len = 0U;
+  conn->batch_size = 0U;
+}
 
-  conn->running = true;
-  while (conn->running) {
-    struct pollfd poll_fd;
+/**
+ * @brief Append the part of the batch to the io vector, with the padding to align the part.
+ * @return The size of the part including the padding.
+ */
+static nns_size_t
+_nns_edge_batch_add_iov (struct iovec *iov, int *iovcnt, void *data,
+    nns_size_t size)
+{
+  static const char padding[8] = { 0 };
+  nns_size_t aligned = NNS_EDGE_BATCH_ALIGN_SIZE (size);
 
-    /* Validate edge handle */
-    if (!nns_edge_handle_is_valid (eh)) {
-      nns_edge_loge ("The edge handle is invalid, it would be expired.");
-      break;
-    }
+  iov[*iovcnt].iov_base = data;
+  iov[(*iovcnt)++].iov_len = size;
 
-    poll_fd.fd = conn->sockfd;
-    poll_fd.events = POLLIN | POLLHUP | POLLERR;
-    poll_fd.revents = 0;
+  if (aligned > size) {
+    iov[*iovcnt].iov_base = (void *) padding;
+    iov[(*iovcnt)++].iov_len = aligned - size;
+  }
 
-    /* 10 milliseconds */
-    if (poll (&poll_fd, 1, 10) > 0) {
-      nns_edge_cmd_s cmd;
-      nns_edge_data_h data_h;
-      char *val;
-      unsigned int i;
+  return aligned;
+}
 
-      /* Receive data from the client */
-      _nns_edge_cmd_init (&cmd, _NNS_EDGE_CMD_ERROR, client_id);
-      ret = _nns_edge_cmd_receive (conn, &cmd);
-      if (ret != NNS_EDGE_ERROR_NONE) {
-        nns_edge_loge ("Failed to receive data from the connected node.");
-        remove_connection = true;
-        break;
-      }
+/**
+ * @brief Send the pending data in the batch of the connection, with one command.
+ * @note The memories of edge data are sent without copying. If the batch has one data, send it with normal command.
+ */
+static int
+_nns_edge_batch_flush (nns_edge_conn_s * conn)
+{
+  nns_edge_cmd_s cmd;
+  nns_edge_cmd_header_s header;
+  nns_edge_cmd_header_ext_s ext;
+  nns_edge_batch_header_s batch_header;
+  nns_edge_batch_item_s *item;
+  nns_size_t *mem_size, total, item_len;
+  struct iovec *iov = NULL, cmd_iov[2];
+  const size_t item_stride = sizeof (nns_edge_batch_item_s) +
+      NNS_EDGE_DATA_LIMIT * sizeof (nns_size_t);
+  char *items = NULL;
+  void *mem, *meta;
+  nns_size_t bytes = 0;
+  int64_t start;
+  unsigned int i, n;
+  int iovcnt, hcnt;
+  int ret = NNS_EDGE_ERROR_NONE;
 
-      if (cmd.info.cmd == _NNS_EDGE_CMD_ERROR) {
-        nns_edge_loge ("Received error, stop msg thread.");
-        _nns_edge_cmd_clear (&cmd);
-        remove_connection = true;
-        break;
-      }
+  if (conn->batch_len == 0U)
+    return NNS_EDGE_ERROR_NONE;
 
-      if (cmd.info.cmd != _NNS_EDGE_CMD_TRANSFER_DATA) {
-        /** @todo handle other cmd later */
-        _nns_edge_cmd_clear (&cmd);
-        continue;
-      }
+  if (conn->batch_len == 1U) {
+    ret = nns_edge_transfer_data (conn, conn->batch[0], conn->batch_client_id);
+    goto done;
+  }
 
-      ret = nns_edge_data_create (&data_h);
-      if (ret != NNS_EDGE_ERROR_NONE) {
-        nns_edge_loge ("Failed to create data handle in msg thread.");
-        _nns_edge_cmd_clear (&cmd);
-        continue;
-      }
+  start = nns_edge_stats_start (conn->stats);
 
-      for (i = 0; i < cmd.info.num; i++)
-        nns_edge_data_add (data_h, cmd.mem[i], cmd.info.mem_size[i], NULL);
+  /* First 3 vectors are reserved for the command header and batch header. */
+  iov = (struct iovec *) nns_edge_malloc (sizeof (struct iovec) *
+      (3U + conn->batch_len * (2U * NNS_EDGE_DATA_LIMIT + 3U)));
+  items = (char *) nns_edge_malloc (item_stride * conn->batch_len);
+  if (!iov || !items) {
+    nns_edge_loge ("Failed to allocate memory to send the batch.");
+    ret = NNS_EDGE_ERROR_OUT_OF_MEMORY;
+    goto done;
+  }
 
-      if (cmd.info.meta_size > 0)
-        nns_edge_data_deserialize_meta (data_h, cmd.meta, cmd.info.meta_size);
+  iovcnt = 3;
+  batch_header.count = conn->batch_len;
+  batch_header.reserved = 0U;
+  total = sizeof (nns_edge_batch_header_s);
 
-      /* Set client ID in edge data */
-      val = nns_edge_strdup_printf ("%lld", (long long) client_id);
-      nns_edge_data_set_info (data_h, "client_id", val);
-      SAFE_FREE (val);
+  for (i = 0; i < conn->batch_len; i++) {
+    item = (nns_edge_batch_item_s *) (items + item_stride * i);
+    mem_size = (nns_size_t *) (item + 1);
+    item->reserved = 0U;
+    if (nns_edge_data_get_request_id (conn->batch[i], &item->request_id) !=
+        NNS_EDGE_ERROR_NONE)
+      item->request_id = 0U;
 
-      ret = nns_edge_event_invoke_callback (eh->event_cb, eh->user_data,
-          NNS_EDGE_EVENT_NEW_DATA_RECEIVED, data_h, sizeof (nns_edge_data_h),
-          NULL);
-      if (ret != NNS_EDGE_ERROR_NONE) {
-        /* Try to get next request if server does not accept data from client. */
-        nns_edge_logw ("The server does not accept data from client.");
-      }
+    ret = nns_edge_data_get_count (conn->batch[i], &item->num);
+    if (ret == NNS_EDGE_ERROR_NONE)
+      ret = nns_edge_data_get_serialized_meta (conn->batch[i],
+          (const void **) &meta, &item->meta_size);
+    if (ret != NNS_EDGE_ERROR_NONE) {
+      nns_edge_loge ("Failed to get the memories and metadata in the batch.");
+      goto done;
+    }
 
-      nns_edge_data_destroy (data_h);
-      _nns_edge_cmd_clear (&cmd);
+    item_len = sizeof (nns_edge_batch_item_s) + item->num * sizeof (nns_size_t);
+    total += _nns_edge_batch_add_iov (iov, &iovcnt, item, item_len);
+
+    for (n = 0; n < item->num; n++) {
+      nns_edge_data_get (conn->batch[i], n, &mem, &mem_size[n]);
+      total += _nns_edge_batch_add_iov (iov, &iovcnt, mem, mem_size[n]);
+      bytes += mem_size[n];
     }
+
+    if (item->meta_size > 0)
+      total += _nns_edge_batch_add_iov (iov, &iovcnt, meta, item->meta_size);
   }
-  conn->running = false;
 
-  /* Received error message from client, remove connection from table. */
-  if (remove_connection) {
-    nns_edge_loge
-        ("Received error from client, remove connection of client (ID: %lld).",
-        (long long) client_id);
-    _nns_edge_remove_connection (eh, client_id);
-    ret = NNS_EDGE_ERROR_CONNECTION_FAILURE;
+  if (!_nns_edge_check_connection (conn)) {
+    nns_edge_loge ("Failed to send the batch, socket has error.");
+    ret = NNS_EDGE_ERROR_IO;
+    goto done;
+  }
 
-    if (NNS_EDGE_CONNECT_TYPE_HYBRID == eh->connect_type) {
-      nns_edge_logi ("Connection lost! Reconnect to available node.");
-      ret = _mqtt_hybrid_direct_connection (eh);
-    }
+  /* The command has one memory, which is the whole batch. It does not have the request ID, each item has it. */
+  nns_edge_cmd_init (&cmd, _NNS_EDGE_CMD_TRANSFER_BATCH,
+      conn->batch_client_id);
+  cmd.info.num = 1;
+  cmd.info.mem_size[0] = total;
 
-    if (ret != NNS_EDGE_ERROR_NONE) {
-      nns_edge_event_invoke_callback (eh->event_cb, eh->user_data,
-          NNS_EDGE_EVENT_CONNECTION_CLOSED, NULL, 0, NULL);
-    }
+  hcnt = _nns_edge_cmd_fill_header (conn, &cmd, &header, &ext, cmd_iov);
+  memcpy (&iov[2 - hcnt], cmd_iov, sizeof (struct iovec) * hcnt);
+  iov[2].iov_base = &batch_header;
+  iov[2].iov_len = sizeof (nns_edge_batch_header_s);
+
+  if (conn->stats) {
+    nns_edge_stats_done (&conn->stats->serialize, start);
+    start = nns_edge_stats_start (conn->stats);
   }
 
-  return NULL;
+  if (!_send_raw_iov (conn, &iov[2 - hcnt], iovcnt - (2 - hcnt))) {
+    nns_edge_loge ("Failed to send the batch to destination (%s:%d).",
+        conn->host, conn->port);
+    ret = NNS_EDGE_ERROR_IO;
+  }
+
+  nns_edge_conn_stats_sent (conn, start, conn->batch_len, bytes, ret);
+
+done:
+  SAFE_FREE (iov);
+  SAFE_FREE (items);
+  _nns_edge_batch_clear (conn);
+  return ret;
 }
 
 /**
- * @brief Create message handle thread.
+ * @brief Push the data into the batch of the connection. The batch is sent when it reaches max count or max bytes.
  */
 static int
-_nns_edge_create_message_thread (nns_edge_handle_s * eh, nns_edge_conn_s * conn,
-    int64_t client_id)
+_nns_edge_batch_push (nns_edge_handle_s * eh, nns_edge_conn_s * conn,
+    nns_edge_data_h data_h, int64_t client_id)
 {
-  int status;
-  nns_edge_thread_data_s *thread_data = NULL;
+  unsigned int i, num = 0;
+  nns_size_t size;
+  void *mem;
+  int ret;
 
-  thread_data =
-      (nns_edge_thread_data_s *) calloc (1, sizeof (nns_edge_thread_data_s));
-  if (!thread_data) {
-    nns_edge_loge ("Failed to allocate edge thread data.");
-    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+  if (conn->batch_len > 0U && conn->batch_client_id != client_id) {
+    ret = _nns_edge_batch_flush (conn);
+    if (ret != NNS_EDGE_ERROR_NONE)
+      return ret;
   }
 
-   /** Create message receiving thread */
-  thread_data->eh = eh;
-  thread_data->conn = conn;
-  thread_data->client_id = client_id;
-
-  status = pthread_create (&conn->msg_thread, NULL, _nns_edge_message_handler,
-      thread_data);
+  nns_edge_data_get_count (data_h, &num);
+  for (i = 0; i < num; i++) {
+    if (nns_edge_data_get (data_h, i, &mem, &size) == NNS_EDGE_ERROR_NONE)
+      conn->batch_size += size;
+  }
 
-  if (status != 0) {
-    nns_edge_loge ("Failed to create message handler thread.");
-    conn->running = false;
-    conn->msg_thread = 0;
-    SAFE_FREE (thread_data);
-    return NNS_EDGE_ERROR_IO;
+  if (conn->batch_len == 0U) {
+    conn->batch_time = nns_edge_get_monotonic_time ();
+    conn->batch_client_id = client_id;
   }
 
+  /* The batch holds the reference of the data until sending it. */
+  conn->batch[conn->batch_len++] = nns_edge_data_ref (data_h);
+
+  if (conn->batch_len >= eh->batch_count ||
+      conn->batch_len >= NNS_EDGE_BATCH_LIMIT ||
+      (eh->batch_bytes > 0U && conn->batch_size >= eh->batch_bytes))
+    return _nns_edge_batch_flush (conn);
+
   return NNS_EDGE_ERROR_NONE;
 }
 
 /**
- * @brief Thread to send data.
+ * @brief Create the fds to wake up the thread waiting for the socket. The thread polls wake_fd[0], and wake_fd[1] is written to wake it up.
+ * @note It is the eventfd (same fd) if available, otherwise the pipe. The pipe is also tried when the eventfd fails at runtime, e.g., running out of fds. If both failed, both are -1 and the thread polls the socket periodically.
  */
-static void *
-_nns_edge_send_thread (void *thread_data)
+static void
+_nns_edge_wake_fd_create (int *wake_fd)
 {
-  nns_edge_handle_s *eh = (nns_edge_handle_s *) thread_data;
-  nns_edge_conn_data_s *conn_data;
-  nns_edge_conn_s *conn;
-  nns_edge_data_h data_h;
-  nns_size_t data_size;
-  int64_t client_id;
-  char *val;
-  int ret;
+  wake_fd[0] = wake_fd[1] = -1;
 
-  nns_edge_lock (eh);
-  eh->sending = true;
-  nns_edge_cond_signal (eh);
-  nns_edge_unlock (eh);
+#if defined(NNS_EDGE_HAVE_EVENTFD)
+  wake_fd[0] = wake_fd[1] = eventfd (0, EFD_CLOEXEC | EFD_NONBLOCK);
+  if (wake_fd[0] >= 0)
+    return;
+#endif
 
-  while (eh->sending &&
-      NNS_EDGE_ERROR_NONE == nns_edge_queue_wait_pop (eh->send_queue, 0U,
-          &data_h, &data_size)) {
-    if (!eh->sending) {
-      nns_edge_data_destroy (data_h);
-      break;
+  if (pipe (wake_fd) == 0) {
+    unsigned int i;
+
+    for (i = 0; i < 2U; i++) {
+      fcntl (wake_fd[i], F_SETFL, fcntl (wake_fd[i], F_GETFL, 0) | O_NONBLOCK);
+      fcntl (wake_fd[i], F_SETFD, FD_CLOEXEC);
     }
+    return;
+  }
 
-    /* Send data to destination */
-    switch (eh->connect_type) {
-      case NNS_EDGE_CONNECT_TYPE_TCP:
-      case NNS_EDGE_CONNECT_TYPE_HYBRID:
-        ret = nns_edge_data_get_info (data_h, "client_id", &val);
-        if (ret != NNS_EDGE_ERROR_NONE) {
-          nns_edge_logd
-              ("Cannot find client ID in edge data. Send to all connected nodes.");
+  wake_fd[0] = wake_fd[1] = -1;
 
-          conn_data = (nns_edge_conn_data_s *) eh->connections;
-          while (conn_data) {
-            client_id = conn_data->id;
-            conn = conn_data->sink_conn;
-            ret = _nns_edge_transfer_data (conn, data_h, client_id);
-            conn_data = conn_data->next;
+  nns_edge_logw ("Failed to create the fd to wake up (%d), poll the socket periodically.",
+      errno);
+}
 
-            if (NNS_EDGE_ERROR_NONE != ret) {
-              nns_edge_loge ("Failed to transfer data. Close the connection.");
-              _nns_edge_remove_connection (eh, client_id);
-            }
-          }
-        } else {
-          client_id = (int64_t) strtoll (val, NULL, 10);
-          SAFE_FREE (val);
+/**
+ * @brief Close the fds to wake up the thread.
+ */
+static void
+_nns_edge_wake_fd_close (int *wake_fd)
+{
+  if (wake_fd[1] >= 0 && wake_fd[1] != wake_fd[0])
+    close (wake_fd[1]);
+  if (wake_fd[0] >= 0)
+    close (wake_fd[0]);
 
-          conn_data = _nns_edge_get_connection (eh, client_id);
-          if (conn_data) {
-            conn = conn_data->sink_conn;
-            _nns_edge_transfer_data (conn, data_h, client_id);
-          } else {
-            nns_edge_loge
-                ("Cannot find connection, invalid client ID or connection closed.");
-          }
-        }
-        break;
-      case NNS_EDGE_CONNECT_TYPE_MQTT:
-        ret = nns_edge_mqtt_publish_data (eh->broker_h, data_h);
-        if (NNS_EDGE_ERROR_NONE != ret)
-          nns_edge_loge ("Failed to send data via MQTT connection.");
-        break;
-      case NNS_EDGE_CONNECT_TYPE_CUSTOM:
-        ret = nns_edge_custom_send_data (eh->custom_connection_h, data_h);
-        if (NNS_EDGE_ERROR_NONE != ret)
-          nns_edge_loge ("Failed to send data via custom connection.");
-        break;
-      default:
-        break;
-    }
-    nns_edge_data_destroy (data_h);
-  }
-  eh->sending = false;
+  wake_fd[0] = wake_fd[1] = -1;
+}
 
-  return NULL;
+/**
+ * @brief Wake up the thread polling given fds. The fd is not read, the thread should stop.
+ */
+static void
+_nns_edge_wake_up (int *wake_fd)
+{
+  uint64_t val = 1U;
+
+  /* The eventfd requires 8 bytes, 1 byte is enough for the pipe. */
+  if (wake_fd[1] >= 0 && write (wake_fd[1], &val,
+          (wake_fd[1] == wake_fd[0]) ? sizeof (val) : 1U) < 0)
+    nns_edge_logw ("Failed to wake up the thread (%d).", errno);
 }
 
 /**
- * @brief Create thread to send data.
- * @note This should be called with lock.
+ * @brief Poll the socket and the fd to wake up. Without the fd, poll the socket for 10 milliseconds.
+ * @return The number of ready descriptors, 0 if the socket has no event.
  */
 static int
-_nns_edge_create_send_thread (nns_edge_handle_s * eh)
+_nns_edge_poll_socket (int sockfd, int wake_fd, struct pollfd *poll_fd)
 {
-  int status;
+  struct pollfd fds[2];
+  nfds_t nfds = 1;
+  int n;
 
-  status = pthread_create (&eh->send_thread, NULL, _nns_edge_send_thread, eh);
+  fds[0].fd = sockfd;
+  fds[0].events = POLLIN | POLLHUP | POLLERR;
+  fds[0].revents = 0;
 
-  if (status != 0) {
-    nns_edge_loge ("Failed to create sender thread.");
-    eh->send_thread = 0;
-    eh->sending = false;
-    return NNS_EDGE_ERROR_IO;
+  if (wake_fd >= 0) {
+    fds[1].fd = wake_fd;
+    fds[1].events = POLLIN;
+    fds[1].revents = 0;
+    nfds = 2;
   }
 
-  /* Wait for starting thread. */
-  nns_edge_cond_wait (eh);
+  n = poll (fds, nfds, (wake_fd >= 0) ? -1 : 10);
+  *poll_fd = fds[0];
 
-  return NNS_EDGE_ERROR_NONE;
+  return (n > 0 && fds[0].revents) ? 1 : 0;
 }
 
 /**
- * @brief Connect to the destination node. (host:sender(sink) - dest:receiver(listener, src))
+ * @brief Close connection
  */
-static int
-_nns_edge_connect_to (nns_edge_handle_s * eh, int64_t client_id,
-    const char *host, int port)
+static bool
+_nns_edge_close_connection (nns_edge_conn_s * conn)
+{
+  if (!conn)
+    return false;
+
+  /* Stop and clear the message thread. The message thread closes its connection when the connection is lost. */
+  conn->running = false;
+  if (conn->msg_thread) {
+    if (pthread_equal (conn->msg_thread, pthread_self ())) {
+      pthread_detach (conn->msg_thread);
+    } else {
+      _nns_edge_wake_up (conn->wake_fd);
+      pthread_join (conn->msg_thread, NULL);
+    }
+    conn->msg_thread = 0;
+  }
+  _nns_edge_wake_fd_close (conn->wake_fd);
+
+  /* Stop the thread sending data to this connection. */
+  nns_edge_fanout_stop (conn);
+
+  if (conn->reactor) {
+    nns_edge_reactor_remove (conn->reactor, conn->sockfd);
+    conn->reactor = NULL;
+  }
+  SAFE_FREE (conn->reactor_data);
+
+  if (conn->sockfd >= 0) {
+    nns_edge_cmd_s cmd;
+
+    /* Send error before closing the socket. */
+    nns_edge_logd ("Send error cmd to close connection.");
+    nns_edge_cmd_init (&cmd, _NNS_EDGE_CMD_ERROR, 0);
+    nns_edge_cmd_send (conn, &cmd);
+
+    if (close (conn->sockfd) < 0)
+      nns_edge_logw ("Failed to close socket.");
+    conn->sockfd = -1;
+  }
+
+  if (conn->recv_data) {
+    nns_edge_data_destroy (conn->recv_data);
+    conn->recv_data = NULL;
+  }
+  if (conn->recv_event) {
+    nns_edge_event_destroy (conn->recv_event);
+    conn->recv_event = NULL;
+  }
+
+  _nns_edge_batch_clear (conn);
+  nns_edge_chunk_clear (conn);
+
+  if (conn->credit.pending) {
+    nns_edge_data_destroy (conn->credit.pending);
+    conn->credit.pending = NULL;
+  }
+  nns_edge_lock_destroy (&conn->credit);
+  pthread_mutex_destroy (&conn->send_lock);
+
+  if (conn->shm_send) {
+    nns_edge_shm_close (conn->shm_send);
+    conn->shm_send = NULL;
+  }
+  if (conn->shm_recv) {
+    nns_edge_shm_close (conn->shm_recv);
+    conn->shm_recv = NULL;
+  }
+
+  SAFE_FREE (conn->compress_buf);
+  SAFE_FREE (conn->host);
+  SAFE_FREE (conn);
+  return true;
+}
+
+/**
+ * @brief Release connection data and its resources.
+ */
+static void
+_nns_edge_release_connection_data (nns_edge_conn_data_s * cdata)
+{
+  if (cdata) {
+    _nns_edge_close_connection (cdata->src_conn);
+    _nns_edge_close_connection (cdata->sink_conn);
+    SAFE_FREE (cdata);
+  }
+}
+
+/**
+ * @brief Get the hash value of client ID, to find the slot in connection table.
+ */
+static unsigned int
+_nns_edge_conn_table_hash (int64_t client_id)
+{
+  uint64_t h = (uint64_t) client_id;
+
+  /* Mix all bits, client ID may be sequential or random. */
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+
+  return (unsigned int) h;
+}
+
+/**
+ * @brief Find the slot of given client ID in connection table. Returns empty slot if not found.
+ * @note The caller should hold the lock of the connections, and the table should not be null.
+ */
+static unsigned int
+_nns_edge_conn_table_find (nns_edge_handle_s * eh, int64_t client_id)
+{
+  unsigned int mask = eh->conn_table_size - 1U;
+  unsigned int i = _nns_edge_conn_table_hash (client_id) & mask;
+  nns_edge_conn_data_s *cdata;
+
+  while ((cdata = (nns_edge_conn_data_s *) eh->conn_table[i]) != NULL) {
+    if (cdata->id == client_id)
+      break;
+
+    i = (i + 1U) & mask;
+  }
+
+  return i;
+}
+
+/**
+ * @brief Rebuild connection table with given size (power of 2) from the list of connection data.
+ * @note The caller should hold the write lock of the connections.
+ */
+static int
+_nns_edge_conn_table_resize (nns_edge_handle_s * eh, unsigned int size)
+{
+  nns_edge_conn_data_s *cdata;
+  void **table;
+
+  nns_edge_conn_check_wrlock (eh);
+
+  table = (void **) calloc (size, sizeof (void *));
+  if (!table) {
+    nns_edge_loge ("Failed to allocate memory for connection table.");
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+  }
+
+  SAFE_FREE (eh->conn_table);
+  eh->conn_table = table;
+  eh->conn_table_size = size;
+
+  cdata = (nns_edge_conn_data_s *) eh->connections;
+  while (cdata) {
+    eh->conn_table[_nns_edge_conn_table_find (eh, cdata->id)] = cdata;
+    cdata = cdata->next;
+  }
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Remove the slot from connection table, and move following entries to keep the probe sequence without tombstone.
+ * @note The caller should hold the write lock of the connections.
+ */
+static void
+_nns_edge_conn_table_remove (nns_edge_handle_s * eh, unsigned int i)
+{
+  unsigned int mask = eh->conn_table_size - 1U;
+  unsigned int j = i;
+  unsigned int k;
+  nns_edge_conn_data_s *cdata;
+
+  nns_edge_conn_check_wrlock (eh);
+
+  while (1) {
+    j = (j + 1U) & mask;
+    cdata = (nns_edge_conn_data_s *) eh->conn_table[j];
+    if (!cdata)
+      break;
+
+    /* Move the entry if its home slot is not in the range (i, j]. */
+    k = _nns_edge_conn_table_hash (cdata->id) & mask;
+    if ((i < j) ? (k <= i || k > j) : (k <= i && k > j)) {
+      eh->conn_table[i] = cdata;
+      i = j;
+    }
+  }
+
+  eh->conn_table[i] = NULL;
+  __atomic_sub_fetch (&eh->conn_count, 1U, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Get the number of connection data. It can be called without the lock, the number may be changed after returning.
+ */
+static unsigned int
+_nns_edge_get_connection_count (nns_edge_handle_s * eh)
+{
+  return __atomic_load_n (&eh->conn_count, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Get nnstreamer-edge connection data.
+ * @note The caller should hold the lock of the connections while using returned connection data.
+ */
+nns_edge_conn_data_s *
+nns_edge_get_connection (nns_edge_handle_s * eh, int64_t client_id)
+{
+  nns_edge_conn_check_rdlock (eh);
+
+  if (!eh->conn_table)
+    return NULL;
+
+  return (nns_edge_conn_data_s *)
+      eh->conn_table[_nns_edge_conn_table_find (eh, client_id)];
+}
+
+/**
+ * @brief Get nnstreamer-edge connection data. New connection data is added if it does not exist.
+ * @note The caller should hold the write lock of the connections.
+ */
+static nns_edge_conn_data_s *
+_nns_edge_add_connection (nns_edge_handle_s * eh, int64_t client_id)
+{
+  nns_edge_conn_data_s *cdata;
+
+  nns_edge_conn_check_wrlock (eh);
+
+  cdata = nns_edge_get_connection (eh, client_id);
+
+  if (NULL == cdata) {
+    cdata = (nns_edge_conn_data_s *) calloc (1, sizeof (nns_edge_conn_data_s));
+    if (NULL == cdata) {
+      nns_edge_loge ("Failed to allocate memory for connection data.");
+      return NULL;
+    }
+
+    /* Keep the load factor under 3/4. */
+    if ((eh->conn_count + 1U) * 4U > eh->conn_table_size * 3U) {
+      if (_nns_edge_conn_table_resize (eh, (eh->conn_table_size > 0U) ?
+              (eh->conn_table_size << 1) : NNS_EDGE_CONN_TABLE_MIN_SIZE)
+          != NNS_EDGE_ERROR_NONE) {
+        SAFE_FREE (cdata);
+        return NULL;
+      }
+    }
+
+    /* prepend connection data */
+    cdata->id = client_id;
+    cdata->next = eh->connections;
+    if (cdata->next)
+      cdata->next->prev = cdata;
+    eh->connections = cdata;
+
+    eh->conn_table[_nns_edge_conn_table_find (eh, client_id)] = cdata;
+    __atomic_add_fetch (&eh->conn_count, 1U, __ATOMIC_RELAXED);
+  }
+
+  return cdata;
+}
+
+/**
+ * @brief Remove the connection data from the table and list. The caller should release returned connection data after unlocking.
+ * @note The caller should hold the write lock of the connections.
+ */
+static void
+_nns_edge_unlink_connection (nns_edge_handle_s * eh,
+    nns_edge_conn_data_s * cdata)
+{
+  nns_edge_conn_check_wrlock (eh);
+
+  _nns_edge_conn_table_remove (eh, _nns_edge_conn_table_find (eh, cdata->id));
+  nns_edge_request_drop (eh, cdata->id);
+
+  if (cdata->prev)
+    cdata->prev->next = cdata->next;
+  else
+    eh->connections = cdata->next;
+  if (cdata->next)
+    cdata->next->prev = cdata->prev;
+
+  cdata->prev = cdata->next = NULL;
+}
+
+/**
+ * @brief Remove nnstreamer-edge connection data.
+ * @note This function locks the connections, the caller should not hold the lock.
+ */
+static void
+_nns_edge_remove_connection (nns_edge_handle_s * eh, int64_t client_id)
+{
+  nns_edge_conn_data_s *cdata;
+
+  nns_edge_conn_wrlock (eh);
+  cdata = nns_edge_get_connection (eh, client_id);
+  if (cdata)
+    _nns_edge_unlink_connection (eh, cdata);
+  nns_edge_conn_unlock (eh);
+
+  _nns_edge_release_connection_data (cdata);
+}
+
+/**
+ * @brief Remove the connection data failed to send data.
+ * @note This function locks the connections, the caller should not hold the lock.
+ */
+static void
+_nns_edge_remove_failed_connection (nns_edge_handle_s * eh)
+{
+  nns_edge_conn_data_s *cdata, *next, *failed = NULL;
+
+  nns_edge_conn_wrlock (eh);
+  cdata = (nns_edge_conn_data_s *) eh->connections;
+  while (cdata) {
+    next = cdata->next;
+
+    if (cdata->sink_conn && cdata->sink_conn->send_failed) {
+      nns_edge_loge ("Failed to transfer data. Close the connection (ID: %lld).",
+          (long long) cdata->id);
+      _nns_edge_unlink_connection (eh, cdata);
+      cdata->next = failed;
+      failed = cdata;
+    }
+
+    cdata = next;
+  }
+  nns_edge_conn_unlock (eh);
+
+  while (failed) {
+    next = failed->next;
+    _nns_edge_release_connection_data (failed);
+    failed = next;
+  }
+}
+
+/**
+ * @brief Remove all connection data.
+ * @note This function locks the connections, the caller should not hold the lock.
+ */
+static void
+_nns_edge_remove_all_connection (nns_edge_handle_s * eh)
+{
+  nns_edge_conn_data_s *cdata, *next;
+  nns_edge_conn_s *standby_conn;
+  void **table;
+
+  nns_edge_conn_wrlock (eh);
+  standby_conn = (nns_edge_conn_s *) eh->standby_conn;
+  eh->standby_conn = NULL;
+
+  cdata = (nns_edge_conn_data_s *) eh->connections;
+  eh->connections = NULL;
+
+  table = eh->conn_table;
+  eh->conn_table = NULL;
+  eh->conn_table_size = 0U;
+  __atomic_store_n (&eh->conn_count, 0U, __ATOMIC_RELAXED);
+  nns_edge_conn_unlock (eh);
+
+  SAFE_FREE (table);
+  _nns_edge_close_connection (standby_conn);
+
+  while (cdata) {
+    next = cdata->next;
+
+    nns_edge_request_drop (eh, cdata->id);
+    _nns_edge_release_connection_data (cdata);
+
+    cdata = next;
+  }
+}
+
+/**
+ * @brief Connect to requested socket.
+ */
+static bool
+_nns_edge_connect_socket (nns_edge_handle_s * eh, nns_edge_conn_s * conn)
+{
+  struct sockaddr_storage saddr;
+  socklen_t saddr_len = 0;
+
+  if (!nns_edge_socket_fill_addr (eh->connect_type, &saddr, &saddr_len,
+          conn->host, conn->port)) {
+    nns_edge_loge ("Failed to connect socket, invalid host %s.", conn->host);
+    return false;
+  }
+
+  conn->sockfd = socket (saddr.ss_family, SOCK_STREAM,
+      (saddr.ss_family == AF_UNIX) ? 0 : IPPROTO_TCP);
+  if (conn->sockfd < 0) {
+    nns_edge_loge ("Failed to create new socket.");
+    return false;
+  }
+
+  nns_edge_socket_set_option (eh->connect_type, conn->sockfd);
+
+  if (connect (conn->sockfd, (struct sockaddr *) &saddr, saddr_len) < 0) {
+    nns_edge_loge ("Failed to connect host %s:%d.", conn->host, conn->port);
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Get the features to communicate with the connected node, from the version key in the handshake command.
+ */
+static uint32_t
+_nns_edge_get_peer_features (nns_edge_handle_s * eh, uint64_t version)
+{
+  uint32_t features;
+
+  features = nns_edge_parse_version_features (version) & NNS_EDGE_FEATURE_ALL;
+  if (NNS_EDGE_HEADER_MODE_LEGACY == eh->header_mode)
+    features &= ~NNS_EDGE_FEATURE_COMPACT_HEADER;
+
+  return features;
+}
+
+/**
+ * @brief Open the shared memory ring created by the connected node.
+ */
+static int
+_nns_edge_shm_attach (nns_edge_conn_s * conn, nns_edge_cmd_s * cmd)
+{
+  int ret;
+
+  if (cmd->info.num != 1 || cmd->info.mem_size[0] == 0 ||
+      !memchr (cmd->mem[0], '\0', cmd->info.mem_size[0])) {
+    nns_edge_loge ("Invalid shared memory info from the connected node.");
+    return NNS_EDGE_ERROR_IO;
+  }
+
+  if (conn->shm_recv) {
+    nns_edge_shm_close (conn->shm_recv);
+    conn->shm_recv = NULL;
+  }
+
+  ret = nns_edge_shm_open ((const char *) cmd->mem[0], &conn->shm_recv);
+  if (ret != NNS_EDGE_ERROR_NONE) {
+    nns_edge_loge ("Failed to open shared memory of the connected node.");
+    conn->shm_recv = NULL;
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Add the memories in the shared memory ring to edge data, without copying the memories.
+ * @param[out] meta The metadata in the record, or NULL if the metadata is sent with the command.
+ */
+static int
+_nns_edge_shm_add_memories (nns_edge_conn_s * conn, nns_edge_cmd_s * cmd,
+    nns_edge_data_h data_h, nns_size_t * offset, const void **meta,
+    nns_size_t * meta_size)
+{
+  nns_edge_shm_desc_s desc;
+  nns_size_t total = 0, pos = 0, aligned;
+  char *addr;
+  unsigned int i;
+
+  if (!conn->shm_recv || cmd->info.num != 1 ||
+      cmd->info.mem_size[0] != sizeof (nns_edge_shm_desc_s)) {
+    nns_edge_loge ("Invalid data in shared memory, the ring is not opened.");
+    return NNS_EDGE_ERROR_IO;
+  }
+
+  memcpy (&desc, cmd->mem[0], sizeof (nns_edge_shm_desc_s));
+  if (desc.num > NNS_EDGE_DATA_LIMIT) {
+    nns_edge_loge ("Invalid data in shared memory, too many memories.");
+    return NNS_EDGE_ERROR_IO;
+  }
+
+  for (i = 0; i < desc.num; i++) {
+    aligned = NNS_EDGE_SHM_ALIGN_SIZE (desc.mem_size[i]);
+    if (aligned < desc.mem_size[i] || total + aligned < total) {
+      nns_edge_loge ("Invalid data in shared memory, invalid memory size.");
+      return NNS_EDGE_ERROR_IO;
+    }
+    total += aligned;
+  }
+
+  if (total + desc.meta_size < total) {
+    nns_edge_loge ("Invalid data in shared memory, invalid metadata size.");
+    return NNS_EDGE_ERROR_IO;
+  }
+  total += desc.meta_size;
+
+  addr = (char *) nns_edge_shm_get (conn->shm_recv, desc.offset, total);
+  if (!addr) {
+    nns_edge_loge ("Invalid data in shared memory, failed to get the record.");
+    return NNS_EDGE_ERROR_IO;
+  }
+
+  for (i = 0; i < desc.num; i++) {
+    nns_edge_data_add (data_h, addr + pos, desc.mem_size[i], NULL);
+    pos += NNS_EDGE_SHM_ALIGN_SIZE (desc.mem_size[i]);
+  }
+
+  *meta = (desc.meta_size > 0U) ? addr + pos : NULL;
+  *meta_size = desc.meta_size;
+  *offset = desc.offset;
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Decompress the memories in the command and add them to edge data.
+ * @note The decompressed memory is released when clearing edge data, other memories are released with the command.
+ */
+static int
+_nns_edge_compress_add_memories (nns_edge_cmd_s * cmd, nns_edge_data_h data_h)
+{
+  nns_edge_compress_desc_s desc;
+  nns_size_t orig;
+  void *mem;
+  unsigned int i;
+  int ret;
+
+  if (cmd->info.num < 2U ||
+      cmd->info.mem_size[0] < sizeof (nns_edge_compress_desc_s)) {
+    nns_edge_loge ("Invalid compressed data, the header is invalid.");
+    return NNS_EDGE_ERROR_IO;
+  }
+
+  memcpy (&desc, cmd->mem[0], sizeof (nns_edge_compress_desc_s));
+  if (desc.num != cmd->info.num - 1U ||
+      cmd->info.mem_size[0] != sizeof (nns_edge_compress_desc_s) +
+      desc.num * sizeof (nns_size_t)) {
+    nns_edge_loge ("Invalid compressed data, the number of memories is invalid.");
+    return NNS_EDGE_ERROR_IO;
+  }
+
+  for (i = 0; i < desc.num; i++) {
+    memcpy (&orig, (char *) cmd->mem[0] + sizeof (nns_edge_compress_desc_s) +
+        i * sizeof (nns_size_t), sizeof (nns_size_t));
+
+    if (orig == 0) {
+      nns_edge_data_add (data_h, cmd->mem[i + 1], cmd->info.mem_size[i + 1],
+          NULL);
+      continue;
+    }
+
+    mem = nns_edge_data_alloc_mem (orig);
+    if (!mem) {
+      nns_edge_loge ("Failed to allocate memory to decompress data.");
+      return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+    }
+
+    ret = nns_edge_decompress ((nns_edge_compress_e) desc.compress,
+        cmd->mem[i + 1], cmd->info.mem_size[i + 1], mem, orig);
+    if (NNS_EDGE_ERROR_NONE != ret) {
+      nns_edge_data_free_mem (mem);
+      return ret;
+    }
+
+    ret = nns_edge_data_add (data_h, mem, orig, nns_edge_data_free_mem);
+    if (NNS_EDGE_ERROR_NONE != ret) {
+      nns_edge_data_free_mem (mem);
+      return ret;
+    }
+  }
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Get the number of in-flight requests of the server.
+ */
+static unsigned int
+_nns_edge_balance_get_pending (nns_edge_conn_s * conn)
+{
+  return conn->lb_tail - __atomic_load_n (&conn->lb_head, __ATOMIC_ACQUIRE);
+}
+
+/**
+ * @brief Push the time of the request sent to the server. This is called by the send thread only.
+ * @note If the server does not respond to many requests, the time of new request is not kept.
+ */
+static void
+_nns_edge_balance_sent (nns_edge_conn_s * conn)
+{
+  unsigned int tail = conn->lb_tail;
+
+  if (_nns_edge_balance_get_pending (conn) >= NNS_EDGE_BALANCE_PENDING)
+    return;
+
+  conn->lb_sent[tail % NNS_EDGE_BALANCE_PENDING] = nns_edge_get_monotonic_time ();
+  __atomic_store_n (&conn->lb_tail, tail + 1U, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Pop the time of the request when receiving the response, and update the round-trip time of the server.
+ * @note This is called by the message thread of the connection only. The server responds to the requests in order.
+ */
+void
+nns_edge_balance_done (nns_edge_handle_s * eh, nns_edge_conn_s * conn)
+{
+  unsigned int head = conn->lb_head;
+  int64_t rtt, latency;
+
+  if (NNS_EDGE_BALANCE_NONE == eh->balance ||
+      head == __atomic_load_n (&conn->lb_tail, __ATOMIC_ACQUIRE))
+    return;
+
+  rtt = nns_edge_get_monotonic_time () -
+      conn->lb_sent[head % NNS_EDGE_BALANCE_PENDING];
+  __atomic_store_n (&conn->lb_head, head + 1U, __ATOMIC_RELEASE);
+
+  /* Exponential moving average with weight 1/8 for new sample. */
+  latency = __atomic_load_n (&conn->lb_latency, __ATOMIC_RELAXED);
+  latency = (latency > 0) ? (latency * 7 + rtt) / 8 : rtt;
+  __atomic_store_n (&conn->lb_latency, (latency > 0) ? latency : 1,
+      __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Select the connection of the server to send data, according to the policy of load balancing.
+ * @note The caller should hold the lock of the connections while using returned connection data.
+ */
+static nns_edge_conn_data_s *
+_nns_edge_balance_select (nns_edge_handle_s * eh)
+{
+  nns_edge_conn_data_s *conn_data, *selected = NULL;
+  nns_edge_conn_s *conn;
+  unsigned int count = 0U, index = 0U, turn, rank, best_rank = 0U;
+  unsigned int score, best = 0U;
+  int64_t latency, best_latency = 0;
+
+  nns_edge_conn_check_rdlock (eh);
+
+  for (conn_data = (nns_edge_conn_data_s *) eh->connections; conn_data;
+      conn_data = conn_data->next) {
+    if (conn_data->sink_conn)
+      count++;
+  }
+
+  if (count == 0U)
+    return NULL;
+
+  turn = eh->balance_turn++ % count;
+
+  for (conn_data = (nns_edge_conn_data_s *) eh->connections; conn_data;
+      conn_data = conn_data->next) {
+    conn = conn_data->sink_conn;
+    if (!conn)
+      continue;
+
+    /* The servers with same score are selected in turn. */
+    rank = (index++ + count - turn) % count;
+
+    switch (eh->balance) {
+      case NNS_EDGE_BALANCE_ROUND_ROBIN:
+        if (rank == 0U)
+          return conn_data;
+        break;
+      case NNS_EDGE_BALANCE_LEAST_OUTSTANDING:
+        score = _nns_edge_balance_get_pending (conn) + conn->lb_load;
+        if (!selected || score < best ||
+            (score == best && rank < best_rank)) {
+          selected = conn_data;
+          best = score;
+          best_rank = rank;
+        }
+        break;
+      case NNS_EDGE_BALANCE_LOWEST_LATENCY:
+        /* Send data to the server which is not measured yet. */
+        latency = __atomic_load_n (&conn->lb_latency, __ATOMIC_RELAXED);
+        if (latency == 0)
+          return conn_data;
+
+        if (!selected || latency < best_latency) {
+          selected = conn_data;
+          best_latency = latency;
+        }
+        break;
+      default:
+        return conn_data;
+    }
+  }
+
+  return selected;
+}
+
+/**
+ * @brief Parse the edge data in the batch, the memories in the batch are added to edge data without copying.
+ * @return false if the batch is invalid.
+ */
+static bool
+_nns_edge_batch_parse_item (char *batch, nns_size_t len, nns_size_t * pos,
+    nns_edge_data_h data_h, uint64_t * request_id)
+{
+  nns_edge_batch_item_s item;
+  nns_size_t mem_size[NNS_EDGE_DATA_LIMIT];
+  nns_size_t aligned;
+  unsigned int i;
+
+  if (len - *pos < sizeof (nns_edge_batch_item_s))
+    return false;
+
+  memcpy (&item, batch + *pos, sizeof (nns_edge_batch_item_s));
+  *pos += sizeof (nns_edge_batch_item_s);
+  *request_id = item.request_id;
+
+  if (item.num > NNS_EDGE_DATA_LIMIT ||
+      len - *pos < item.num * sizeof (nns_size_t))
+    return false;
+
+  memcpy (mem_size, batch + *pos, item.num * sizeof (nns_size_t));
+  *pos += item.num * sizeof (nns_size_t);
+
+  for (i = 0; i < item.num; i++) {
+    aligned = NNS_EDGE_BATCH_ALIGN_SIZE (mem_size[i]);
+    if (aligned < mem_size[i] || len - *pos < aligned)
+      return false;
+
+    nns_edge_data_add (data_h, batch + *pos, mem_size[i], NULL);
+    *pos += aligned;
+  }
+
+  if (item.meta_size > 0) {
+    aligned = NNS_EDGE_BATCH_ALIGN_SIZE (item.meta_size);
+    if (aligned < item.meta_size || len - *pos < aligned)
+      return false;
+
+    nns_edge_data_deserialize_meta (data_h, batch + *pos, item.meta_size);
+    *pos += aligned;
+  } else {
+    nns_edge_data_clear_info (data_h);
+  }
+
+  return true;
+}
+
+/**
+ * @brief Invoke the event callback for new data with given event handle. The event handle is created if it is null or has other event type, and reused for next data.
+ */
+static int
+_nns_edge_invoke_data_event (nns_edge_handle_s * eh, nns_edge_event_h * event_h,
+    nns_edge_event_e event, void *data, nns_size_t data_len)
+{
+  nns_edge_event_cb event_cb = eh->event_cb;
+  nns_edge_event_e type;
+  int ret;
+
+  /* If event callback is null, return ok. */
+  if (!event_cb) {
+    nns_edge_logw ("The event callback is null, do nothing!");
+    return NNS_EDGE_ERROR_NONE;
+  }
+
+  if (*event_h && (nns_edge_event_get_type (*event_h, &type) !=
+          NNS_EDGE_ERROR_NONE || type != event)) {
+    nns_edge_event_destroy (*event_h);
+    *event_h = NULL;
+  }
+
+  if (!*event_h) {
+    ret = nns_edge_event_create (event, event_h);
+    if (ret != NNS_EDGE_ERROR_NONE) {
+      nns_edge_loge ("Failed to create new edge event.");
+      *event_h = NULL;
+      return ret;
+    }
+  }
+
+  /* The data is released by the caller, the event does not own it. */
+  ret = nns_edge_event_set_data (*event_h, data, data_len, NULL);
+  if (ret != NNS_EDGE_ERROR_NONE) {
+    nns_edge_loge ("Failed to handle edge event due to invalid event data.");
+    return ret;
+  }
+
+  ret = event_cb (*event_h, eh->user_data);
+  if (ret != NNS_EDGE_ERROR_NONE)
+    nns_edge_logw ("The event callback returns error (%d).", ret);
+
+  return ret;
+}
+
+/**
+ * @brief Release the data and the received buffers in the event, and keep the event in the pool to be reused.
+ */
+static void
+_nns_edge_dispatch_release_item (void *data)
+{
+  nns_edge_dispatch_item_s *item = (nns_edge_dispatch_item_s *) data;
+  nns_edge_dispatch_s *dispatch;
+  unsigned int i, max_len;
+
+  if (!item)
+    return;
+
+  for (i = 0; i < item->count; i++) {
+    nns_edge_data_destroy (item->data[i]);
+    item->data[i] = NULL;
+  }
+  item->count = 0U;
+
+  for (i = 0; i < item->num; i++) {
+    if (item->pool)
+      nns_edge_pool_release (item->pool, item->mem[i], item->mem_size[i]);
+    else
+      nns_edge_data_free_mem (item->mem[i]);
+    item->mem[i] = NULL;
+  }
+  item->num = 0U;
+
+  /* The data is consumed or dropped, grant the credits to the peer. */
+  if (item->credits > 0U) {
+    nns_edge_credit_grant (item->eh, item->client_id, item->credits);
+    item->credits = 0U;
+  }
+
+  dispatch = &item->eh->dispatch;
+  max_len = (dispatch->limit > 0U) ?
+      dispatch->limit * dispatch->threads : NNS_EDGE_DISPATCH_POOL_LIMIT;
+
+  nns_edge_lock (dispatch);
+  if (dispatch->pool_len < max_len) {
+    item->next = dispatch->pool;
+    dispatch->pool = item;
+    dispatch->pool_len++;
+    item = NULL;
+  }
+  nns_edge_unlock (dispatch);
+
+  if (item) {
+    if (item->event_h)
+      nns_edge_event_destroy (item->event_h);
+    SAFE_FREE (item);
+  }
+}
+
+/**
+ * @brief Get the event from the pool, or allocate new one.
+ */
+static nns_edge_dispatch_item_s *
+_nns_edge_dispatch_get_item (nns_edge_handle_s * eh, nns_edge_event_e event)
+{
+  nns_edge_dispatch_s *dispatch = &eh->dispatch;
+  nns_edge_dispatch_item_s *item;
+
+  nns_edge_lock (dispatch);
+  item = dispatch->pool;
+  if (item) {
+    dispatch->pool = item->next;
+    dispatch->pool_len--;
+  }
+  nns_edge_unlock (dispatch);
+
+  if (!item) {
+    item = (nns_edge_dispatch_item_s *) calloc (1,
+        sizeof (nns_edge_dispatch_item_s));
+    if (!item) {
+      nns_edge_loge ("Failed to allocate memory for the dispatched event.");
+      return NULL;
+    }
+
+    item->eh = eh;
+  }
+
+  item->event = event;
+  item->next = NULL;
+  return item;
+}
+
+/**
+ * @brief Release all events in the pool.
+ */
+static void
+_nns_edge_dispatch_clear_pool (nns_edge_handle_s * eh)
+{
+  nns_edge_dispatch_s *dispatch = &eh->dispatch;
+  nns_edge_dispatch_item_s *item;
+
+  nns_edge_lock (dispatch);
+  while ((item = dispatch->pool) != NULL) {
+    dispatch->pool = item->next;
+
+    if (item->event_h)
+      nns_edge_event_destroy (item->event_h);
+    SAFE_FREE (item);
+  }
+  dispatch->pool_len = 0U;
+  nns_edge_unlock (dispatch);
+}
+
+/**
+ * @brief Dispatch worker thread, invoke the event callback for the events in the queue.
+ */
+static void *
+_nns_edge_dispatch_thread (void *thread_data)
+{
+  nns_edge_dispatch_worker_s *worker =
+      (nns_edge_dispatch_worker_s *) thread_data;
+  nns_edge_handle_s *eh = worker->eh;
+  nns_edge_dispatch_item_s *item;
+  nns_size_t size;
+  int64_t start;
+  unsigned int i;
+  int ret;
+
+  while (eh->dispatch.running) {
+    /* Wait for new event without timeout, the queue is stopped when stopping the workers. */
+    if (NNS_EDGE_ERROR_NONE != nns_edge_queue_wait_pop (worker->queue,
+            0U, (void **) &item, &size))
+      continue;
+
+    if (eh->dispatch.running) {
+      start = nns_edge_stats_start (&eh->stats);
+      if (NNS_EDGE_EVENT_NEW_DATA_RECEIVED == item->event ||
+          NNS_EDGE_EVENT_NEW_CHUNK_RECEIVED == item->event) {
+        /* The data in a batch are dispatched at once, invoke the callback for each data. */
+        for (i = 0; i < item->count; i++) {
+          ret = _nns_edge_invoke_data_event (eh, &item->event_h, item->event,
+              item->data[i], sizeof (nns_edge_data_h));
+          if (ret != NNS_EDGE_ERROR_NONE)
+            nns_edge_logw ("The server does not accept data from client.");
+        }
+      } else {
+        ret = _nns_edge_invoke_data_event (eh, &item->event_h, item->event,
+            item->data, item->count * sizeof (nns_edge_data_h));
+        if (ret != NNS_EDGE_ERROR_NONE)
+          nns_edge_logw ("The server does not accept data from client.");
+      }
+      nns_edge_stats_done (&eh->stats.callback, start);
+    }
+
+    _nns_edge_dispatch_release_item (item);
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief Stop the dispatch workers and release the events in the queues.
+ * @note Do not call this function with handle lock, the worker may invoke the event callback.
+ * The message thread may push new event after stopping the workers, the queues are destroyed after closing the connections.
+ */
+static void
+_nns_edge_stop_dispatch_workers (nns_edge_handle_s * eh)
+{
+  unsigned int i;
+
+  if (!eh->dispatch.workers)
+    return;
+
+  eh->dispatch.running = false;
+  for (i = 0; i < eh->dispatch.threads; i++) {
+    if (eh->dispatch.workers[i].queue)
+      nns_edge_queue_stop (eh->dispatch.workers[i].queue);
+  }
+
+  for (i = 0; i < eh->dispatch.threads; i++) {
+    if (eh->dispatch.workers[i].thread) {
+      pthread_join (eh->dispatch.workers[i].thread, NULL);
+      eh->dispatch.workers[i].thread = 0;
+    }
+  }
+}
+
+/**
+ * @brief Destroy the queues of the dispatch workers and release the events.
+ * @note This function should be called after stopping the workers and closing the connections.
+ */
+static void
+_nns_edge_release_dispatch_workers (nns_edge_handle_s * eh)
+{
+  unsigned int i;
+
+  if (eh->dispatch.workers) {
+    for (i = 0; i < eh->dispatch.threads; i++) {
+      if (eh->dispatch.workers[i].queue)
+        nns_edge_queue_destroy (eh->dispatch.workers[i].queue);
+    }
+
+    SAFE_FREE (eh->dispatch.workers);
+  }
+
+  _nns_edge_dispatch_clear_pool (eh);
+}
+
+/**
+ * @brief Create the dispatch workers.
+ * @note This function should be called with handle lock.
+ */
+static bool
+_nns_edge_create_dispatch_workers (nns_edge_handle_s * eh)
+{
+  nns_edge_dispatch_worker_s *worker;
+  unsigned int i;
+
+  if (eh->dispatch.threads == 0U || eh->dispatch.workers)
+    return true;
+
+  eh->dispatch.workers = (nns_edge_dispatch_worker_s *)
+      calloc (eh->dispatch.threads, sizeof (nns_edge_dispatch_worker_s));
+  if (!eh->dispatch.workers) {
+    nns_edge_loge ("Failed to allocate dispatch workers.");
+    return false;
+  }
+
+  for (i = 0; i < eh->dispatch.threads; i++) {
+    worker = &eh->dispatch.workers[i];
+    worker->eh = eh;
+
+    if (nns_edge_queue_create_full (&worker->queue,
+            eh->dispatch.limit) != NNS_EDGE_ERROR_NONE) {
+      nns_edge_loge ("Failed to create the queue of dispatch worker.");
+      worker->queue = NULL;
+      goto error;
+    }
+
+    nns_edge_queue_set_limit (worker->queue, eh->dispatch.limit,
+        eh->dispatch.leaky);
+  }
+
+  eh->dispatch.running = true;
+  for (i = 0; i < eh->dispatch.threads; i++) {
+    worker = &eh->dispatch.workers[i];
+
+    if (pthread_create (&worker->thread, NULL, _nns_edge_dispatch_thread,
+            worker) != 0) {
+      nns_edge_loge ("Failed to create dispatch thread.");
+      worker->thread = 0;
+      goto error;
+    }
+  }
+
+  return true;
+
+error:
+  _nns_edge_stop_dispatch_workers (eh);
+  _nns_edge_release_dispatch_workers (eh);
+  return false;
+}
+
+/**
+ * @brief Invoke the event callback for new data. With the dispatch workers, hand over the data to the worker for the client and return without waiting for the callback.
+ * @param[in,out] data The array of edge data, the callback is invoked for each data with NNS_EDGE_EVENT_NEW_DATA_RECEIVED and NNS_EDGE_EVENT_NEW_CHUNK_RECEIVED. The data should have its memories or point to the buffers of given command. If the worker takes the data, it is set to NULL.
+ * @param[in] credits The number of credits granted to the peer after invoking the callback.
+ * @param[in,out] cmd The received command which the data points to, the worker takes its buffers with the data. NULL if the data has its memories.
+ */
+int
+nns_edge_dispatch_data (nns_edge_handle_s * eh, nns_edge_conn_s * conn,
+    nns_edge_event_e event, nns_edge_data_h * data, unsigned int count,
+    unsigned int credits, int64_t client_id, nns_edge_cmd_s * cmd)
+{
+  nns_edge_dispatch_item_s *item;
+  nns_edge_dispatch_worker_s *worker;
+  int64_t start;
+  unsigned int i;
+  int ret = NNS_EDGE_ERROR_NONE;
+
+  if (!eh->dispatch.running) {
+    start = nns_edge_stats_start (&eh->stats);
+    if (NNS_EDGE_EVENT_NEW_DATA_RECEIVED == event ||
+        NNS_EDGE_EVENT_NEW_CHUNK_RECEIVED == event) {
+      for (i = 0; i < count; i++) {
+        ret = _nns_edge_invoke_data_event (eh, &conn->recv_event, event,
+            data[i], sizeof (nns_edge_data_h));
+      }
+    } else {
+      ret = nns_edge_event_invoke_callback (eh->event_cb, eh->user_data,
+          event, data, count * sizeof (nns_edge_data_h), NULL);
+    }
+    nns_edge_stats_done (&eh->stats.callback, start);
+
+    if (credits > 0U)
+      nns_edge_credit_grant (eh, client_id, credits);
+    return ret;
+  }
+
+  item = _nns_edge_dispatch_get_item (eh, event);
+  if (!item) {
+    if (credits > 0U)
+      nns_edge_credit_grant (eh, client_id, credits);
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+  }
+
+  item->client_id = client_id;
+  item->credits = credits;
+
+  /* The worker takes the data and the received buffers, instead of copying the data. */
+  for (i = 0; i < count; i++) {
+    item->data[i] = data[i];
+    data[i] = NULL;
+  }
+  item->count = count;
+
+  if (cmd) {
+    for (i = 0; i < cmd->info.num; i++) {
+      item->mem[i] = cmd->mem[i];
+      item->mem_size[i] = cmd->info.mem_size[i];
+      cmd->mem[i] = NULL;
+    }
+    item->num = cmd->info.num;
+    item->pool = cmd->pool;
+  }
+
+  worker = &eh->dispatch.workers[_nns_edge_conn_table_hash (client_id) %
+      eh->dispatch.threads];
+  ret = nns_edge_queue_push (worker->queue, item,
+      sizeof (nns_edge_dispatch_item_s), _nns_edge_dispatch_release_item);
+  if (ret != NNS_EDGE_ERROR_NONE)
+    _nns_edge_dispatch_release_item (item);
+
+  return ret;
+}
+
+/**
+ * @brief Invoke the callback for each edge data in the batch, or once for whole batch.
+ */
+static int
+_nns_edge_process_batch (nns_edge_handle_s * eh, nns_edge_conn_s * conn,
+    nns_edge_cmd_s * cmd, int64_t client_id)
+{
+  nns_edge_batch_header_s header;
+  nns_edge_data_h batch[NNS_EDGE_BATCH_LIMIT] = { NULL };
+  nns_edge_data_h data_h;
+  nns_size_t len, pos;
+  uint64_t request_id = 0;
+  char *mem;
+  unsigned int i, n = 0U;
+  bool separate;
+  int ret = NNS_EDGE_ERROR_NONE;
+
+  if (cmd->info.num != 1 ||
+      cmd->info.mem_size[0] < sizeof (nns_edge_batch_header_s)) {
+    nns_edge_loge ("Invalid batch from the connected node.");
+    return NNS_EDGE_ERROR_IO;
+  }
+
+  mem = (char *) cmd->mem[0];
+  len = cmd->info.mem_size[0];
+  memcpy (&header, mem, sizeof (nns_edge_batch_header_s));
+  pos = sizeof (nns_edge_batch_header_s);
+
+  if (header.count == 0U || header.count > NNS_EDGE_BATCH_LIMIT) {
+    nns_edge_loge ("Invalid batch, the number of data is %u.", header.count);
+    return NNS_EDGE_ERROR_IO;
+  }
+
+  /**
+   * The dispatch worker takes the data in the batch with the buffer at once, then each data needs its handle.
+   * Otherwise the message thread reuses the data of the connection to invoke the callback for each data.
+   */
+  separate = (eh->batch_event || eh->dispatch.running);
+
+  if (!separate && !conn->recv_data) {
+    ret = nns_edge_data_create (&conn->recv_data);
+    if (ret != NNS_EDGE_ERROR_NONE) {
+      nns_edge_loge ("Failed to create data handle in msg thread.");
+      conn->recv_data = NULL;
+      return NNS_EDGE_ERROR_NONE;
+    }
+  }
+
+  for (i = 0; i < header.count; i++) {
+    if (separate) {
+      ret = nns_edge_data_create (&batch[n]);
+      if (ret != NNS_EDGE_ERROR_NONE) {
+        nns_edge_loge ("Failed to create data handle in msg thread.");
+        batch[n] = NULL;
+        ret = NNS_EDGE_ERROR_NONE;
+        goto done;
+      }
+      data_h = batch[n];
+    } else {
+      data_h = conn->recv_data;
+    }
+
+    if (!_nns_edge_batch_parse_item (mem, len, &pos, data_h, &request_id)) {
+      nns_edge_loge ("Invalid batch from the connected node.");
+      nns_edge_data_clear (data_h);
+      ret = NNS_EDGE_ERROR_IO;
+      goto done;
+    }
+
+    nns_edge_data_set_client_id (data_h, client_id);
+    nns_edge_request_set_data (eh, data_h, request_id);
+    nns_edge_balance_done (eh, conn);
+    _nns_edge_stats_received (conn, data_h);
+
+    if (!eh->batch_event && eh->conflate && (i + 1U < header.count ||
+            nns_edge_conflate_has_newer (eh, conn))) {
+      /* Skip the old data and grant its credit. */
+      nns_edge_stats_add (eh->stats.conflated, 1U);
+      nns_edge_credit_grant (eh, client_id, 1U);
+
+      if (separate) {
+        nns_edge_data_destroy (batch[n]);
+        batch[n] = NULL;
+      } else {
+        nns_edge_data_clear (data_h);
+      }
+      continue;
+    }
+
+    if (separate) {
+      n++;
+      continue;
+    }
+
+    if (nns_edge_dispatch_data (eh, conn, NNS_EDGE_EVENT_NEW_DATA_RECEIVED,
+            &data_h, 1U, 1U, client_id, NULL) != NNS_EDGE_ERROR_NONE)
+      nns_edge_logw ("The server does not accept data from client.");
+
+    nns_edge_data_clear (data_h);
+  }
+
+  if (n == 0U)
+    goto done;
+
+  if (eh->batch_event && nns_edge_conflate_has_newer (eh, conn)) {
+    nns_edge_stats_add (eh->stats.conflated, n);
+    nns_edge_credit_grant (eh, client_id, n);
+  } else if (nns_edge_dispatch_data (eh, conn, eh->batch_event ?
+          NNS_EDGE_EVENT_NEW_BATCH_RECEIVED : NNS_EDGE_EVENT_NEW_DATA_RECEIVED,
+          batch, n, n, client_id, cmd) != NNS_EDGE_ERROR_NONE) {
+    nns_edge_logw ("The server does not accept data from client.");
+  }
+
+done:
+  for (i = 0; i < header.count; i++) {
+    if (batch[i])
+      nns_edge_data_destroy (batch[i]);
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Invoke the callback for received edge data, or skip it if the connection has newer data in conflation mode.
+ * @param[in,out] data_h The received edge data. If the dispatch worker takes the data, it is set to NULL.
+ * @param[in,out] cmd The received command which the data points to, or NULL if the data has its memories. See nns_edge_dispatch_data().
+ */
+void
+nns_edge_deliver_data (nns_edge_handle_s * eh, nns_edge_conn_s * conn,
+    nns_edge_data_h * data_h, uint64_t request_id, int64_t client_id,
+    nns_edge_cmd_s * cmd)
+{
+  /* Set client ID in edge data */
+  nns_edge_data_set_client_id (*data_h, client_id);
+  nns_edge_request_set_data (eh, *data_h, request_id);
+  nns_edge_balance_done (eh, conn);
+  _nns_edge_stats_received (conn, *data_h);
+
+  if (nns_edge_conflate_has_newer (eh, conn)) {
+    /* The connection has newer data, skip the old data and grant its credit. */
+    nns_edge_stats_add (eh->stats.conflated, 1U);
+    nns_edge_credit_grant (eh, client_id, 1U);
+  } else if (nns_edge_dispatch_data (eh, conn,
+          NNS_EDGE_EVENT_NEW_DATA_RECEIVED, data_h, 1U, 1U,
+          client_id, cmd) != NNS_EDGE_ERROR_NONE) {
+    /* Try to get next request if server does not accept data from client. */
+    nns_edge_logw ("The server does not accept data from client.");
+  }
+}
+
+/**
+ * @brief Receive the command from the connected node and invoke the event callback.
+ * @return NNS_EDGE_ERROR_NONE if the connection is available. Otherwise the connection should be removed.
+ */
+static int
+_nns_edge_process_message (nns_edge_handle_s * eh, nns_edge_conn_s * conn,
+    int64_t client_id)
+{
+  nns_edge_cmd_s cmd;
+  nns_edge_data_h data_h, shm_data = NULL;
+  const void *shm_meta = NULL;
+  nns_size_t shm_offset = 0, shm_meta_size = 0;
+  bool shm_used = false;
+  unsigned int i;
+  int ret;
+
+  /* Receive data from the client */
+  nns_edge_cmd_init (&cmd, _NNS_EDGE_CMD_ERROR, client_id);
+  ret = _nns_edge_cmd_receive (conn, &cmd);
+  if (ret != NNS_EDGE_ERROR_NONE) {
+    nns_edge_loge ("Failed to receive data from the connected node.");
+    return ret;
+  }
+
+  if (cmd.info.cmd == _NNS_EDGE_CMD_ERROR) {
+    nns_edge_loge ("Received error, stop msg thread.");
+    _nns_edge_cmd_clear (&cmd);
+    return NNS_EDGE_ERROR_CONNECTION_FAILURE;
+  }
+
+  if (cmd.info.cmd == _NNS_EDGE_CMD_SHM_INFO) {
+    ret = _nns_edge_shm_attach (conn, &cmd);
+    _nns_edge_cmd_clear (&cmd);
+    return ret;
+  }
+
+  if (cmd.info.cmd == _NNS_EDGE_CMD_TRANSFER_BATCH) {
+    ret = _nns_edge_process_batch (eh, conn, &cmd, client_id);
+    _nns_edge_cmd_clear (&cmd);
+    return ret;
+  }
+
+  if (cmd.info.cmd == _NNS_EDGE_CMD_CREDIT) {
+    ret = nns_edge_credit_received (eh, conn, &cmd, client_id);
+    _nns_edge_cmd_clear (&cmd);
+    return ret;
+  }
+
+  if (cmd.info.cmd == _NNS_EDGE_CMD_TRANSFER_CHUNK) {
+    ret = nns_edge_chunk_process (eh, conn, &cmd, client_id);
+    _nns_edge_cmd_clear (&cmd);
+    return ret;
+  }
+
+  if (cmd.info.cmd != _NNS_EDGE_CMD_TRANSFER_DATA &&
+      cmd.info.cmd != _NNS_EDGE_CMD_TRANSFER_SHM &&
+      cmd.info.cmd != _NNS_EDGE_CMD_TRANSFER_COMPRESSED) {
+    /** @todo handle other cmd later */
+    _nns_edge_cmd_clear (&cmd);
+    return NNS_EDGE_ERROR_NONE;
+  }
+
+  /* Reuse edge data of the connection, the data is cleared after invoking the callback. */
+  if (!conn->recv_data) {
+    ret = nns_edge_data_create (&conn->recv_data);
+    if (ret != NNS_EDGE_ERROR_NONE) {
+      nns_edge_loge ("Failed to create data handle in msg thread.");
+      conn->recv_data = NULL;
+      _nns_edge_cmd_clear (&cmd);
+      return NNS_EDGE_ERROR_NONE;
+    }
+  }
+  data_h = conn->recv_data;
+
+  if (cmd.info.cmd == _NNS_EDGE_CMD_TRANSFER_SHM) {
+    /* The memories point to the ring, the record is released after invoking the callback. */
+    ret = _nns_edge_shm_add_memories (conn, &cmd, data_h, &shm_offset,
+        &shm_meta, &shm_meta_size);
+    if (ret != NNS_EDGE_ERROR_NONE) {
+      nns_edge_data_clear (data_h);
+      _nns_edge_cmd_clear (&cmd);
+      return ret;
+    }
+    shm_used = true;
+  } else if (cmd.info.cmd == _NNS_EDGE_CMD_TRANSFER_COMPRESSED) {
+    ret = _nns_edge_compress_add_memories (&cmd, data_h);
+    if (ret != NNS_EDGE_ERROR_NONE) {
+      nns_edge_data_clear (data_h);
+      _nns_edge_cmd_clear (&cmd);
+      return ret;
+    }
+  } else {
+    for (i = 0; i < cmd.info.num; i++)
+      nns_edge_data_add (data_h, cmd.mem[i], cmd.info.mem_size[i], NULL);
+  }
+
+  /**
+   * The information of edge data is kept after invoking the callback.
+   * If the metadata is not changed, it is not parsed again.
+   */
+  if (cmd.info.meta_size > 0)
+    nns_edge_data_deserialize_meta (data_h, cmd.meta, cmd.info.meta_size);
+  else if (shm_meta_size > 0)
+    nns_edge_data_deserialize_meta (data_h, shm_meta, shm_meta_size);
+  else
+    nns_edge_data_clear_info (data_h);
+
+  if (shm_used && eh->dispatch.running) {
+    /* The record in the ring is released after this, the dispatch worker takes the copy of the data. */
+    if (nns_edge_data_copy (data_h, &shm_data) == NNS_EDGE_ERROR_NONE) {
+      nns_edge_deliver_data (eh, conn, &shm_data, cmd.request_id, client_id,
+          NULL);
+      if (shm_data)
+        nns_edge_data_destroy (shm_data);
+    } else {
+      nns_edge_loge ("Failed to copy edge data from the shared memory.");
+    }
+  } else {
+    /* The dispatch worker may take the data and the buffers of the command, new data is created with next message. */
+    nns_edge_deliver_data (eh, conn, &conn->recv_data, cmd.request_id,
+        client_id, shm_used ? NULL : &cmd);
+  }
+
+  if (conn->recv_data)
+    nns_edge_data_clear (conn->recv_data);
+  if (shm_used)
+    nns_edge_shm_release (conn->shm_recv, shm_offset);
+  _nns_edge_cmd_clear (&cmd);
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Remove the connection which is closed or has an error. In case of hybrid connection, try to connect to other node.
+ * @note If the query client is connected to other servers, the connection closed event is not invoked. The publisher does not invoke it either.
+ */
+static void
+_nns_edge_handle_connection_lost (nns_edge_handle_s * eh, int64_t client_id)
+{
+  int ret;
+
+  nns_edge_loge
+      ("Received error from client, remove connection of client (ID: %lld).",
+      (long long) client_id);
+  _nns_edge_remove_connection (eh, client_id);
+
+  /* The publisher keeps sending data to other subscribers, same as failing to send data. */
+  if (NNS_EDGE_NODE_TYPE_PUB == eh->node_type)
+    return;
+
+  ret = NNS_EDGE_ERROR_CONNECTION_FAILURE;
+
+  if (NNS_EDGE_ERROR_NONE == _nns_edge_standby_promote (eh)) {
+    /* The standby server is used without new handshake, then find new standby server. */
+    _nns_edge_connect_known_servers (eh);
+    ret = NNS_EDGE_ERROR_NONE;
+  } else if (NNS_EDGE_CONNECT_TYPE_HYBRID == eh->connect_type) {
+    nns_edge_logi ("Connection lost! Reconnect to available node.");
+    ret = _mqtt_hybrid_direct_connection (eh);
+  } else if (_nns_edge_get_connection_count (eh) > 0U &&
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT == eh->node_type &&
+      NNS_EDGE_CONN_MODE_DUPLEX == eh->conn_mode) {
+    ret = NNS_EDGE_ERROR_NONE;
+  }
+
+  if (ret != NNS_EDGE_ERROR_NONE) {
+    nns_edge_event_invoke_callback (eh->event_cb, eh->user_data,
+        NNS_EDGE_EVENT_CONNECTION_CLOSED, NULL, 0, NULL);
+  }
+}
+
+/**
+ * @brief Message thread, receive buffer from the client.
+ */
+static void *
+_nns_edge_message_handler (void *thread_data)
+{
+  nns_edge_thread_data_s *_tdata = (nns_edge_thread_data_s *) thread_data;
+  nns_edge_handle_s *eh;
+  nns_edge_conn_s *conn;
+  bool remove_connection = false;
+  int64_t client_id;
+
+  if (!_tdata) {
+    nns_edge_loge ("Internal error, thread data is null.");
+    return NULL;
+  }
+
+  eh = (nns_edge_handle_s *) _tdata->eh;
+  conn = _tdata->conn;
+  client_id = _tdata->client_id;
+  SAFE_FREE (_tdata);
+
+  while (conn->running) {
+    struct pollfd poll_fd;
+
+    /* Validate edge handle */
+    if (!nns_edge_handle_is_valid (eh)) {
+      nns_edge_loge ("The edge handle is invalid, it would be expired.");
+      break;
+    }
+
+    /* Wait for new message, closing the connection wakes up the thread. */
+    if (_nns_edge_poll_socket (conn->sockfd, conn->wake_fd[0], &poll_fd) > 0) {
+      if (!conn->running)
+        break;
+
+      if (_nns_edge_process_message (eh, conn, client_id) !=
+          NNS_EDGE_ERROR_NONE) {
+        remove_connection = true;
+        break;
+      }
+    }
+  }
+  conn->running = false;
+
+  /**
+   * Received error message from client, remove connection from table.
+   * The thread is detached when closing its own connection, count it so that releasing the handle waits for it.
+   */
+  if (remove_connection) {
+    __atomic_add_fetch (&eh->lost_count, 1U, __ATOMIC_SEQ_CST);
+    _nns_edge_handle_connection_lost (eh, client_id);
+    __atomic_sub_fetch (&eh->lost_count, 1U, __ATOMIC_SEQ_CST);
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief Callback of the reactor, handle the message from readable socket.
+ */
+static bool
+_nns_edge_reactor_message_cb (int fd, void *user_data)
+{
+  nns_edge_thread_data_s *_tdata = (nns_edge_thread_data_s *) user_data;
+  nns_edge_handle_s *eh;
+  nns_edge_conn_s *conn;
+  int64_t client_id;
+
+  UNUSED (fd);
+
+  /* Thread data is released when closing the connection, do not access it after handling the message. */
+  eh = _tdata->eh;
+  conn = _tdata->conn;
+  client_id = _tdata->client_id;
+
+  if (!nns_edge_handle_is_valid (eh)) {
+    nns_edge_loge ("The edge handle is invalid, it would be expired.");
+    return false;
+  }
+
+  if (_nns_edge_process_message (eh, conn, client_id) == NNS_EDGE_ERROR_NONE)
+    return true;
+
+  conn->running = false;
+  _nns_edge_handle_connection_lost (eh, client_id);
+  return false;
+}
+
+/**
+ * @brief Create message handle thread.
+ */
+static int
+_nns_edge_create_message_thread (nns_edge_handle_s * eh, nns_edge_conn_s * conn,
+    int64_t client_id)
+{
+  int status;
+  nns_edge_thread_data_s *thread_data = NULL;
+
+  thread_data =
+      (nns_edge_thread_data_s *) calloc (1, sizeof (nns_edge_thread_data_s));
+  if (!thread_data) {
+    nns_edge_loge ("Failed to allocate edge thread data.");
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+  }
+
+   /** Create message receiving thread */
+  thread_data->eh = eh;
+  thread_data->conn = conn;
+  thread_data->client_id = client_id;
+
+  if (eh->reactor) {
+    /* Watch the socket in the reactor instead of creating new thread. */
+    conn->running = true;
+    conn->reactor_data = thread_data;
+
+    status = nns_edge_reactor_add (eh->reactor, conn->sockfd,
+        _nns_edge_reactor_message_cb, thread_data);
+    if (status != NNS_EDGE_ERROR_NONE) {
+      nns_edge_loge ("Failed to add the socket to the reactor.");
+      conn->running = false;
+      conn->reactor_data = NULL;
+      SAFE_FREE (thread_data);
+      return status;
+    }
+
+    conn->reactor = eh->reactor;
+    return NNS_EDGE_ERROR_NONE;
+  }
+
+  if (conn->wake_fd[0] < 0)
+    _nns_edge_wake_fd_create (conn->wake_fd);
+
+  /* Set the flag before creating the thread, the connection may be closed before the thread runs. */
+  conn->running = true;
+  status = pthread_create (&conn->msg_thread, NULL, _nns_edge_message_handler,
+      thread_data);
+
+  if (status != 0) {
+    nns_edge_loge ("Failed to create message handler thread.");
+    conn->running = false;
+    conn->msg_thread = 0;
+    SAFE_FREE (thread_data);
+    return NNS_EDGE_ERROR_IO;
+  }
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to send data to the connection. In fan-out mode, conflation mode or chunked transfer, push the data into the queue of the connection.
+ */
+static int
+_nns_edge_send_to_connection (nns_edge_handle_s * eh, nns_edge_conn_s * conn,
+    nns_edge_data_h data_h, int64_t client_id)
+{
+  if (eh->fanout_limit > 0U || eh->conflate || eh->chunk_size > 0U)
+    return nns_edge_fanout_push (eh, conn, data_h, client_id);
+
+  if (eh->batch_count > 1U && (conn->features & NNS_EDGE_FEATURE_BATCH))
+    return _nns_edge_batch_push (eh, conn, data_h, client_id);
+
+  return nns_edge_transfer_data (conn, data_h, client_id);
+}
+
+/**
+ * @brief Send the pending batches of the connections.
+ * @param[in] expired_only Send the batch if the first data in the batch waits for max delay.
+ * @return The time in milliseconds to wait for next batch, or 0 if there is no pending batch.
+ */
+static unsigned int
+_nns_edge_batch_flush_pending (nns_edge_handle_s * eh, bool expired_only)
+{
+  nns_edge_conn_data_s *conn_data;
+  nns_edge_conn_s *conn;
+  int64_t now, remain, timeout = 0;
+  bool failed = false;
+
+  now = nns_edge_get_monotonic_time ();
+
+  nns_edge_conn_rdlock (eh);
+  for (conn_data = (nns_edge_conn_data_s *) eh->connections; conn_data;
+      conn_data = conn_data->next) {
+    conn = conn_data->sink_conn;
+
+    if (conn && conn->batch_len > 0U) {
+      remain = (int64_t) eh->batch_delay - (now - conn->batch_time);
+
+      if (!expired_only || remain <= 0) {
+        if (NNS_EDGE_ERROR_NONE != _nns_edge_batch_flush (conn)) {
+          nns_edge_loge ("Failed to transfer the batch.");
+          conn->send_failed = true;
+          failed = true;
+        }
+      } else {
+        /* The queue waits in milliseconds, round up the remained time. */
+        remain = (remain + 999) / 1000;
+        if (timeout == 0 || remain < timeout)
+          timeout = remain;
+      }
+    }
+  }
+  nns_edge_conn_unlock (eh);
+
+  if (failed)
+    _nns_edge_remove_failed_connection (eh);
+
+  return (unsigned int) timeout;
+}
+
+/**
+ * @brief Send the data and the pending data in the send queue to the custom connection at once.
+ * @note The caller releases given data, this function releases the data popped from the queue.
+ */
+static void
+_nns_edge_send_custom_batch (nns_edge_handle_s * eh, nns_edge_data_h data_h)
+{
+  nns_edge_data_h batch[NNS_EDGE_BATCH_LIMIT];
+  nns_size_t data_size, total = 0;
+  unsigned int i, count = 1U;
+  int64_t start;
+  int ret;
+
+  batch[0] = data_h;
+
+  /* The conflation mode sends the latest data only. */
+  while (!eh->conflate && count < NNS_EDGE_BATCH_LIMIT &&
+      NNS_EDGE_ERROR_NONE == nns_edge_queue_pop (eh->send_queue,
+          &batch[count], &data_size))
+    count++;
+
+  start = nns_edge_stats_start (&eh->stats);
+  if (count == 1U)
+    ret = nns_edge_custom_send_data (eh->custom_connection_h, data_h);
+  else
+    ret = nns_edge_custom_send_batch (eh->custom_connection_h, batch, count);
+  nns_edge_stats_done (&eh->stats.send, start);
+
+  for (i = 0; i < count; i++)
+    total += nns_edge_stats_get_data_size (batch[i]);
+
+  if (NNS_EDGE_ERROR_NONE != ret) {
+    nns_edge_loge ("Failed to send data via custom connection.");
+    nns_edge_stats_add (eh->stats.send_errors, count);
+  } else {
+    nns_edge_stats_count (eh->stats.sent, count, total);
+  }
+
+  for (i = 1U; i < count; i++)
+    nns_edge_data_destroy (batch[i]);
+}
+
+/**
+ * @brief Thread to send data.
+ */
+static void *
+_nns_edge_send_thread (void *thread_data)
+{
+  nns_edge_handle_s *eh = (nns_edge_handle_s *) thread_data;
+  nns_edge_conn_data_s *conn_data;
+  nns_edge_conn_s *conn;
+  nns_edge_data_h data_h;
+  nns_size_t data_size;
+  int64_t client_id, sent_id;
+  unsigned int timeout = 0U, len;
+  bool failed;
+  int ret;
+
+  nns_edge_lock (eh);
+  eh->sending = true;
+  nns_edge_cond_signal (eh);
+  nns_edge_unlock (eh);
+
+  while (eh->sending) {
+    /* Wait for new data, or the time to send the pending batch. */
+    if (NNS_EDGE_ERROR_NONE != nns_edge_queue_wait_pop (eh->send_queue,
+            timeout, &data_h, &data_size)) {
+      if (timeout == 0U)
+        break;
+
+      timeout = _nns_edge_batch_flush_pending (eh, true);
+      continue;
+    }
+
+    if (!eh->sending) {
+      nns_edge_data_destroy (data_h);
+      break;
+    }
+
+    /* In conflation mode, the broker or custom connection receives the latest data only. */
+    if (eh->conflate && (NNS_EDGE_CONNECT_TYPE_MQTT == eh->connect_type ||
+            NNS_EDGE_CONNECT_TYPE_CUSTOM == eh->connect_type)) {
+      len = 0U;
+      nns_edge_queue_get_length (eh->send_queue, &len);
+      if (len > 0U) {
+        nns_edge_stats_add (eh->stats.conflated, 1U);
+        nns_edge_data_destroy (data_h);
+        continue;
+      }
+    }
+
+    /* Send data to destination */
+    switch (eh->connect_type) {
+      case NNS_EDGE_CONNECT_TYPE_TCP:
+      case NNS_EDGE_CONNECT_TYPE_UDS:
+      case NNS_EDGE_CONNECT_TYPE_HYBRID:
+        /**
+         * Hold the read lock of the connections while sending data.
+         * The connection failed to send data is removed after unlocking.
+         */
+        failed = false;
+        sent_id = 0;
+        nns_edge_conn_rdlock (eh);
+
+        if (NNS_EDGE_NODE_TYPE_QUERY_CLIENT == eh->node_type &&
+            NNS_EDGE_BALANCE_NONE != eh->balance) {
+          /* Select the server regardless of the client ID in data. */
+          conn_data = _nns_edge_balance_select (eh);
+          if (!conn_data) {
+            nns_edge_loge ("Cannot find connection to send data.");
+          } else if (nns_edge_credit_take (eh, conn_data->sink_conn, data_h)) {
+            client_id = conn_data->id;
+            conn = conn_data->sink_conn;
+
+            ret = _nns_edge_send_to_connection (eh, conn, data_h, client_id);
+            if (NNS_EDGE_ERROR_NONE == ret) {
+              _nns_edge_balance_sent (conn);
+              sent_id = client_id;
+            } else {
+              conn->send_failed = true;
+              failed = true;
+            }
+          }
+        } else if (nns_edge_data_get_client_id (data_h, &client_id) !=
+            NNS_EDGE_ERROR_NONE) {
+          nns_edge_logd
+              ("Cannot find client ID in edge data. Send to all connected nodes.");
+
+          for (conn_data = (nns_edge_conn_data_s *) eh->connections; conn_data;
+              conn_data = conn_data->next) {
+            conn = conn_data->sink_conn;
+            if (!conn || !nns_edge_credit_take (eh, conn, data_h))
+              continue;
+
+            if (NNS_EDGE_ERROR_NONE == _nns_edge_send_to_connection (eh, conn,
+                    data_h, conn_data->id)) {
+              sent_id = conn_data->id;
+            } else {
+              conn->send_failed = true;
+              failed = true;
+            }
+          }
+        } else {
+          conn_data = nns_edge_get_connection (eh, client_id);
+          if (conn_data) {
+            conn = conn_data->sink_conn;
+            if (conn && nns_edge_credit_take (eh, conn, data_h) &&
+                NNS_EDGE_ERROR_NONE == _nns_edge_send_to_connection (eh, conn,
+                    data_h, client_id))
+              sent_id = client_id;
+          } else {
+            nns_edge_loge
+                ("Cannot find connection, invalid client ID or connection closed.");
+          }
+        }
+
+        nns_edge_conn_unlock (eh);
+
+        /* Keep the connection of the request, to remove it if the connection is closed. */
+        nns_edge_request_sent (eh, data_h, sent_id);
+
+        if (failed)
+          _nns_edge_remove_failed_connection (eh);
+        break;
+      case NNS_EDGE_CONNECT_TYPE_MQTT:
+        ret = nns_edge_mqtt_publish_data (eh->broker_h, data_h,
+            (NNS_EDGE_HEADER_MODE_COMPACT == eh->header_mode) ?
+            NNS_EDGE_DATA_HEADER_COMPACT : NNS_EDGE_DATA_HEADER_LEGACY,
+            eh->compress, eh->compress_threshold, eh->mqtt_qos,
+            eh->mqtt_retain);
+        if (NNS_EDGE_ERROR_NONE != ret) {
+          nns_edge_loge ("Failed to send data via MQTT connection.");
+          nns_edge_stats_add (eh->stats.send_errors, 1U);
+        }
+        break;
+      case NNS_EDGE_CONNECT_TYPE_CUSTOM:
+        _nns_edge_send_custom_batch (eh, data_h);
+        break;
+      default:
+        break;
+    }
+    nns_edge_data_destroy (data_h);
+
+    if (eh->batch_count > 1U) {
+      /* Without max delay, send the pending batches when the queue is empty. */
+      if (eh->batch_delay == 0U) {
+        len = 0U;
+        nns_edge_queue_get_length (eh->send_queue, &len);
+        timeout = (len == 0U) ? _nns_edge_batch_flush_pending (eh, false) : 1U;
+      } else {
+        timeout = _nns_edge_batch_flush_pending (eh, true);
+      }
+    }
+  }
+  eh->sending = false;
+
+  return NULL;
+}
+
+/**
+ * @brief Create thread to send data.
+ * @note This should be called with lock.
+ */
+static int
+_nns_edge_create_send_thread (nns_edge_handle_s * eh)
+{
+  int status;
+
+  status = pthread_create (&eh->send_thread, NULL, _nns_edge_send_thread, eh);
+
+  if (status != 0) {
+    nns_edge_loge ("Failed to create sender thread.");
+    eh->send_thread = 0;
+    eh->sending = false;
+    return NNS_EDGE_ERROR_IO;
+  }
+
+  /* Wait for starting thread. */
+  nns_edge_cond_wait (eh);
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Create new connection data to connect to the destination node.
+ */
+static nns_edge_conn_s *
+_nns_edge_conn_new (nns_edge_handle_s * eh, const char *host, int port)
+{
+  nns_edge_conn_s *conn;
+
+  conn = (nns_edge_conn_s *) calloc (1, sizeof (nns_edge_conn_s));
+  if (!conn) {
+    nns_edge_loge ("Failed to allocate client data.");
+    return NULL;
+  }
+
+  conn->host = nns_edge_strdup (host);
+  conn->port = port;
+  conn->sockfd = -1;
+  conn->wake_fd[0] = conn->wake_fd[1] = -1;
+  pthread_mutex_init (&conn->send_lock, NULL);
+  nns_edge_lock_init (&conn->credit);
+  conn->pool = eh->pool;
+  conn->shm_size = eh->shm_size;
+  conn->compress = eh->compress;
+  conn->compress_threshold = eh->compress_threshold;
+  conn->chunk_size = eh->chunk_size;
+  conn->stats = &eh->stats;
+
+  return conn;
+}
+
+/**
+ * @brief Connect the sockets to the servers in parallel, and get the first connected socket.
+ * @param[out] failed The servers refusing the connection or not connected in time.
+ * @return The index of connected socket, or -1 if failed. The other sockets are closed.
+ */
+static int
+_nns_edge_connect_socket_race (nns_edge_handle_s * eh, nns_edge_conn_s ** conns,
+    unsigned int num, bool *failed)
+{
+  struct pollfd poll_fd[NNS_EDGE_CONNECT_PARALLEL_LIMIT];
+  struct sockaddr_storage saddr;
+  socklen_t saddr_len, len;
+  unsigned int i, pending = 0U;
+  int64_t end_time;
+  int winner = -1, err, n, wait, flags;
+
+  for (i = 0; i < num; i++) {
+    poll_fd[i].fd = -1;
+    poll_fd[i].events = POLLOUT;
+    poll_fd[i].revents = 0;
+    failed[i] = true;
+
+    saddr_len = 0;
+    if (!nns_edge_socket_fill_addr (eh->connect_type, &saddr, &saddr_len,
+            conns[i]->host, conns[i]->port))
+      continue;
+
+    conns[i]->sockfd = socket (saddr.ss_family, SOCK_STREAM,
+        (saddr.ss_family == AF_UNIX) ? 0 : IPPROTO_TCP);
+    if (conns[i]->sockfd < 0)
+      continue;
+
+    nns_edge_socket_set_option (eh->connect_type, conns[i]->sockfd);
+
+    flags = fcntl (conns[i]->sockfd, F_GETFL, 0);
+    fcntl (conns[i]->sockfd, F_SETFL, flags | O_NONBLOCK);
+
+    if (connect (conns[i]->sockfd, (struct sockaddr *) &saddr, saddr_len) == 0) {
+      failed[i] = false;
+      winner = (int) i;
+      break;
+    }
+
+    if (errno == EINPROGRESS) {
+      poll_fd[i].fd = conns[i]->sockfd;
+      failed[i] = false;
+      pending++;
+    }
+  }
+
+  end_time = nns_edge_get_monotonic_time () +
+      (int64_t) NNS_EDGE_HANDSHAKE_TIMEOUT * 1000;
+
+  while (winner < 0 && pending > 0U) {
+    wait = (int) ((end_time - nns_edge_get_monotonic_time ()) / 1000);
+    if (wait <= 0)
+      break;
+
+    n = poll (poll_fd, num, wait);
+    if (n < 0 && errno != EINTR)
+      break;
+
+    for (i = 0; n > 0 && i < num; i++) {
+      if (poll_fd[i].fd < 0 || poll_fd[i].revents == 0)
+        continue;
+
+      err = 0;
+      len = sizeof (err);
+      if (getsockopt (poll_fd[i].fd, SOL_SOCKET, SO_ERROR, &err, &len) == 0 &&
+          err == 0) {
+        winner = (int) i;
+        break;
+      }
+
+      /* The server refuses the connection, wait for other servers. */
+      poll_fd[i].fd = -1;
+      failed[i] = true;
+      pending--;
+    }
+  }
+
+  for (i = 0; i < num; i++) {
+    if ((int) i == winner)
+      continue;
+
+    /* The servers not connected in time are failed too. */
+    if (winner < 0)
+      failed[i] = true;
+
+    if (conns[i]->sockfd >= 0) {
+      close (conns[i]->sockfd);
+      conns[i]->sockfd = -1;
+    }
+  }
+
+  if (winner >= 0) {
+    flags = fcntl (conns[winner]->sockfd, F_GETFL, 0);
+    fcntl (conns[winner]->sockfd, F_SETFL, flags & ~O_NONBLOCK);
+  } else {
+    nns_edge_loge ("Failed to connect to %u servers.", num);
+  }
+
+  return winner;
+}
+
+/**
+ * @brief Do the handshake with the server or publisher. (receive capability and send host info)
+ * @param[in,out] client_id The client ID, the query client and subscriber get it from the server.
+ */
+static int
+_nns_edge_connect_handshake (nns_edge_handle_s * eh, nns_edge_conn_s * conn,
+    int64_t * client_id)
+{
+  nns_edge_cmd_s cmd;
+  char *host_str = NULL;
+  bool duplex;
+  int ret;
+
+  if ((NNS_EDGE_NODE_TYPE_QUERY_CLIENT != eh->node_type)
+      && (NNS_EDGE_NODE_TYPE_SUB != eh->node_type))
+    return NNS_EDGE_ERROR_NONE;
+
+  duplex = (NNS_EDGE_NODE_TYPE_QUERY_CLIENT == eh->node_type &&
+      NNS_EDGE_CONN_MODE_DUPLEX == eh->conn_mode);
+
+  /* Receive capability and client ID from server. */
+  nns_edge_cmd_init (&cmd, _NNS_EDGE_CMD_ERROR, *client_id);
+  ret = _nns_edge_cmd_receive (conn, &cmd);
+  if (ret != NNS_EDGE_ERROR_NONE) {
+    nns_edge_loge ("Failed to receive capability.");
+    return ret;
+  }
+
+  if (cmd.info.cmd != _NNS_EDGE_CMD_CAPABILITY) {
+    nns_edge_loge ("Failed to get capability.");
+    _nns_edge_cmd_clear (&cmd);
+    return NNS_EDGE_ERROR_CONNECTION_FAILURE;
+  }
+
+  *client_id = cmd.info.client_id;
+  conn->features = _nns_edge_get_peer_features (eh, cmd.info.version);
+
+  if (duplex && !(conn->features & NNS_EDGE_FEATURE_DUPLEX)) {
+    nns_edge_loge ("Failed to connect, the server does not support duplex connection.");
+    _nns_edge_cmd_clear (&cmd);
+    return NNS_EDGE_ERROR_CONNECTION_FAILURE;
+  }
+
+  /* Check compatibility, the capability accepted before is not checked again. */
+  if (nns_edge_server_has_caps (eh, conn, &cmd)) {
+    nns_edge_logd ("The capability of %s:%d is cached.", conn->host,
+        conn->port);
+    ret = NNS_EDGE_ERROR_NONE;
+  } else {
+    ret = nns_edge_event_invoke_callback (eh->event_cb, eh->user_data,
+        NNS_EDGE_EVENT_CAPABILITY, cmd.mem[0], cmd.info.mem_size[0], NULL);
+    if (ret == NNS_EDGE_ERROR_NONE)
+      nns_edge_server_set_caps (eh, conn, &cmd);
+  }
+  _nns_edge_cmd_clear (&cmd);
+
+  if (ret != NNS_EDGE_ERROR_NONE) {
+    nns_edge_loge ("The event returns error, capability is not acceptable.");
+    nns_edge_cmd_init (&cmd, _NNS_EDGE_CMD_ERROR, *client_id);
+  } else if (duplex) {
+    /* Send host info without host string, then the server sends the result with this connection. */
+    nns_edge_cmd_init (&cmd, _NNS_EDGE_CMD_HOST_INFO, *client_id);
+  } else {
+    /* Send host and port to destination. */
+    nns_edge_cmd_init (&cmd, _NNS_EDGE_CMD_HOST_INFO, *client_id);
+
+    host_str = nns_edge_get_host_string (eh->host, eh->port);
+    cmd.info.num = 1;
+    cmd.info.mem_size[0] = strlen (host_str) + 1;
+    cmd.mem[0] = host_str;
+  }
+
+  /* The host string is not allocated with the allocator of edge data, release it here. */
+  if (nns_edge_cmd_send (conn, &cmd) != NNS_EDGE_ERROR_NONE) {
+    nns_edge_loge ("Failed to send host info.");
+    ret = NNS_EDGE_ERROR_CONNECTION_FAILURE;
+  }
+  SAFE_FREE (host_str);
+
+  /* Keep the server to connect again without the broker. */
+  if (ret == NNS_EDGE_ERROR_NONE) {
+    nns_edge_lock (&eh->servers);
+    nns_edge_server_add (eh, conn->host, conn->port);
+    nns_edge_unlock (&eh->servers);
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Add the connection which has finished the handshake, and create the message thread if the connection receives data.
+ * @note The connection is released if failed.
+ */
+static int
+_nns_edge_connect_register (nns_edge_handle_s * eh, nns_edge_conn_s * conn,
+    int64_t client_id)
 {
-  nns_edge_conn_s *conn = NULL;
   nns_edge_conn_data_s *conn_data;
-  nns_edge_cmd_s cmd;
-  char *host_str;
+  nns_edge_conn_s *old_conn = NULL;
   bool done = false;
+  bool duplex;
   int ret;
 
-  conn = (nns_edge_conn_s *) calloc (1, sizeof (nns_edge_conn_s));
-  if (!conn) {
-    nns_edge_loge ("Failed to allocate client data.");
-    goto error;
+  duplex = (NNS_EDGE_NODE_TYPE_QUERY_CLIENT == eh->node_type &&
+      NNS_EDGE_CONN_MODE_DUPLEX == eh->conn_mode);
+
+  if (NNS_EDGE_NODE_TYPE_SUB == eh->node_type || duplex) {
+    ret = _nns_edge_create_message_thread (eh, conn, client_id);
+    if (ret != NNS_EDGE_ERROR_NONE) {
+      nns_edge_loge ("Failed to create message handle thread.");
+      goto error;
+    }
   }
 
-  conn->host = nns_edge_strdup (host);
-  conn->port = port;
-  conn->sockfd = -1;
+  nns_edge_conn_wrlock (eh);
+  conn_data = _nns_edge_add_connection (eh, client_id);
+  if (conn_data) {
+    /* Set new connection, and close old one after unlocking. */
+    old_conn = conn_data->sink_conn;
+    conn_data->sink_conn = conn;
+    done = true;
+  }
+  nns_edge_conn_unlock (eh);
 
-  if (!_nns_edge_connect_socket (conn)) {
-    goto error;
+  _nns_edge_close_connection (old_conn);
+
+  /* Grant the initial credits if this connection receives data. */
+  if (done && (NNS_EDGE_NODE_TYPE_SUB == eh->node_type || duplex))
+    nns_edge_credit_grant (eh, client_id, 0U);
+
+error:
+  if (!done) {
+    _nns_edge_close_connection (conn);
+    return NNS_EDGE_ERROR_CONNECTION_FAILURE;
   }
 
-  if ((NNS_EDGE_NODE_TYPE_QUERY_CLIENT == eh->node_type)
-      || (NNS_EDGE_NODE_TYPE_SUB == eh->node_type)) {
-    /* Receive capability and client ID from server. */
-    _nns_edge_cmd_init (&cmd, _NNS_EDGE_CMD_ERROR, client_id);
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Connect to the destination node. (host:sender(sink) - dest:receiver(listener, src))
+ */
+static int
+_nns_edge_connect_to (nns_edge_handle_s * eh, int64_t client_id,
+    const char *host, int port)
+{
+  nns_edge_conn_s *conn;
+
+  conn = _nns_edge_conn_new (eh, host, port);
+  if (!conn)
+    return NNS_EDGE_ERROR_CONNECTION_FAILURE;
+
+  if (!_nns_edge_connect_socket (eh, conn) ||
+      _nns_edge_connect_handshake (eh, conn, &client_id) !=
+      NNS_EDGE_ERROR_NONE) {
+    _nns_edge_close_connection (conn);
+    return NNS_EDGE_ERROR_CONNECTION_FAILURE;
+  }
+
+  if (NNS_EDGE_NODE_TYPE_QUERY_CLIENT == eh->node_type ||
+      NNS_EDGE_NODE_TYPE_SUB == eh->node_type)
+    eh->client_id = client_id;
+
+  return _nns_edge_connect_register (eh, conn, client_id);
+}
+
+/**
+ * @brief Check the query client needs new standby connection.
+ */
+static bool
+_nns_edge_standby_is_needed (nns_edge_handle_s * eh)
+{
+  return (eh->standby && !__atomic_load_n (&eh->standby_conn, __ATOMIC_RELAXED) &&
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT == eh->node_type &&
+      NNS_EDGE_CONN_MODE_DUPLEX == eh->conn_mode);
+}
+
+/**
+ * @brief Register the standby connection when other connection is lost, the query client sends data to the standby server without new handshake.
+ */
+static int
+_nns_edge_standby_promote (nns_edge_handle_s * eh)
+{
+  nns_edge_conn_s *conn;
+  int64_t client_id;
+  char peek;
+
+  nns_edge_conn_wrlock (eh);
+  conn = (nns_edge_conn_s *) eh->standby_conn;
+  client_id = eh->standby_id;
+  eh->standby_conn = NULL;
+  nns_edge_conn_unlock (eh);
+
+  if (!conn)
+    return NNS_EDGE_ERROR_CONNECTION_FAILURE;
+
+  /* The server may close the connection while the standby connection is idle. */
+  if (!_nns_edge_check_connection (conn) ||
+      recv (conn->sockfd, &peek, 1, MSG_PEEK | MSG_DONTWAIT) == 0) {
+    nns_edge_logw ("The standby connection to %s:%d is closed.", conn->host,
+        conn->port);
+    nns_edge_server_set_result (eh, conn->host, conn->port, false);
+    _nns_edge_close_connection (conn);
+    return NNS_EDGE_ERROR_CONNECTION_FAILURE;
+  }
+
+  nns_edge_logi ("Switch to the standby server %s:%d.", conn->host,
+      conn->port);
+  eh->client_id = client_id;
+
+  return _nns_edge_connect_register (eh, conn, client_id);
+}
+
+/**
+ * @brief Connect to one of given servers. The sockets connect to the servers in parallel, and the first connected server is used.
+ * @param[in] standby Keep the connection as the standby connection, it is registered when other connection is lost.
+ */
+static int
+_nns_edge_connect_any (nns_edge_handle_s * eh, nns_edge_server_s * servers,
+    unsigned int num, bool standby)
+{
+  nns_edge_conn_s *conns[NNS_EDGE_CONNECT_PARALLEL_LIMIT] = { NULL };
+  bool failed[NNS_EDGE_CONNECT_PARALLEL_LIMIT] = { false };
+  nns_edge_conn_s *conn = NULL;
+  int64_t client_id = eh->client_id;
+  unsigned int i;
+  int winner = -1, ret = NNS_EDGE_ERROR_CONNECTION_FAILURE;
+
+  for (i = 0; i < num; i++) {
+    conns[i] = _nns_edge_conn_new (eh, servers[i].host, servers[i].port);
+    if (!conns[i])
+      goto done;
+  }
+
+  if (num == 1U) {
+    winner = _nns_edge_connect_socket (eh, conns[0]) ? 0 : -1;
+    failed[0] = (winner < 0);
+  } else {
+    winner = _nns_edge_connect_socket_race (eh, conns, num, failed);
+  }
+
+  if (winner < 0)
+    goto done;
+
+  conn = conns[winner];
+  conns[winner] = NULL;
+
+  if (_nns_edge_connect_handshake (eh, conn, &client_id) !=
+      NNS_EDGE_ERROR_NONE) {
+    failed[winner] = true;
+    _nns_edge_close_connection (conn);
+    goto done;
+  }
+
+  nns_edge_server_set_result (eh, conn->host, conn->port, true);
+  conn->lb_load = servers[winner].load;
+  failed[winner] = false;
+
+  if (standby) {
+    nns_edge_conn_wrlock (eh);
+    if (!eh->standby_conn) {
+      eh->standby_conn = conn;
+      eh->standby_id = client_id;
+      conn = NULL;
+    }
+    nns_edge_conn_unlock (eh);
+
+    _nns_edge_close_connection (conn);
+    ret = NNS_EDGE_ERROR_NONE;
+  } else {
+    eh->client_id = client_id;
+    ret = _nns_edge_connect_register (eh, conn, client_id);
+    failed[winner] = (ret != NNS_EDGE_ERROR_NONE);
+  }
+
+done:
+  for (i = 0; i < num; i++) {
+    if (failed[i])
+      nns_edge_server_set_result (eh, servers[i].host, servers[i].port, false);
+    _nns_edge_close_connection (conns[i]);
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Do the handshake with the peer of accepted socket and create message thread in the handshake worker.
+ * @note The socket has the handshake timeout, slow or dead peer does not block the listener and other handshakes.
+ */
+static void
+_nns_edge_handshake_socket (nns_edge_handle_s * eh, nns_edge_conn_s * conn)
+{
+  bool done = false;
+  nns_edge_conn_data_s *conn_data;
+  nns_edge_conn_s *old_src = NULL, *old_sink = NULL;
+  nns_edge_cmd_s cmd;
+  int64_t client_id;
+  char *dest_host = NULL;
+  int dest_port, ret;
+  bool duplex = false;
+
+  if ((NNS_EDGE_NODE_TYPE_QUERY_SERVER == eh->node_type)
+      || (NNS_EDGE_NODE_TYPE_PUB == eh->node_type)) {
+    client_id = nns_edge_generate_id ();
+  } else {
+    client_id = eh->client_id;
+  }
+
+  /* Send capability and info to check compatibility. */
+  if ((NNS_EDGE_NODE_TYPE_QUERY_SERVER == eh->node_type)
+      || (NNS_EDGE_NODE_TYPE_PUB == eh->node_type)) {
+    nns_edge_cmd_init (&cmd, _NNS_EDGE_CMD_CAPABILITY, client_id);
+    cmd.info.num = 1;
+    cmd.info.mem_size[0] = strlen (eh->caps_str) + 1;
+    cmd.mem[0] = eh->caps_str;
+
+    ret = nns_edge_cmd_send (conn, &cmd);
+    if (ret != NNS_EDGE_ERROR_NONE) {
+      nns_edge_loge ("Failed to send capability.");
+      goto error;
+    }
+  }
+
+  if ((NNS_EDGE_NODE_TYPE_QUERY_SERVER == eh->node_type)
+      || (NNS_EDGE_NODE_TYPE_PUB == eh->node_type)) {
+    /* Receive host info and supported features from destination. */
+    nns_edge_cmd_init (&cmd, _NNS_EDGE_CMD_ERROR, client_id);
     ret = _nns_edge_cmd_receive (conn, &cmd);
     if (ret != NNS_EDGE_ERROR_NONE) {
-      nns_edge_loge ("Failed to receive capability.");
+      nns_edge_loge ("Failed to receive node info.");
       goto error;
     }
 
-    if (cmd.info.cmd != _NNS_EDGE_CMD_CAPABILITY) {
-      nns_edge_loge ("Failed to get capability.");
+    if (cmd.info.cmd != _NNS_EDGE_CMD_HOST_INFO) {
+      nns_edge_loge ("Failed to get host info.");
       _nns_edge_cmd_clear (&cmd);
       goto error;
     }
 
-    client_id = eh->client_id = cmd.info.client_id;
+    conn->features = _nns_edge_get_peer_features (eh, cmd.info.version);
 
-    /* Check compatibility. */
-    ret = nns_edge_event_invoke_callback (eh->event_cb, eh->user_data,
-        NNS_EDGE_EVENT_CAPABILITY, cmd.mem[0], cmd.info.mem_size[0], NULL);
+    if (NNS_EDGE_NODE_TYPE_QUERY_SERVER == eh->node_type) {
+      if (cmd.info.num > 0) {
+        nns_edge_parse_host_string (cmd.mem[0], &dest_host, &dest_port);
+      } else if (conn->features & NNS_EDGE_FEATURE_DUPLEX) {
+        /* The client does not have the listener, send the result with accepted socket. */
+        duplex = true;
+      } else {
+        nns_edge_loge ("Failed to get host info, the client does not send its host.");
+        _nns_edge_cmd_clear (&cmd);
+        goto error;
+      }
+    }
     _nns_edge_cmd_clear (&cmd);
+  }
 
-    if (ret != NNS_EDGE_ERROR_NONE) {
-      nns_edge_loge ("The event returns error, capability is not acceptable.");
-      _nns_edge_cmd_init (&cmd, _NNS_EDGE_CMD_ERROR, client_id);
-    } else {
-      /* Send host and port to destination. */
-      _nns_edge_cmd_init (&cmd, _NNS_EDGE_CMD_HOST_INFO, client_id);
+  /* The handshake messages are done, the message thread waits for new data without timeout. */
+  nns_edge_socket_set_timeout (conn->sockfd, 0U);
 
-      host_str = nns_edge_get_host_string (eh->host, eh->port);
-      cmd.info.num = 1;
-      cmd.info.mem_size[0] = strlen (host_str) + 1;
-      cmd.mem[0] = host_str;
+  if (NNS_EDGE_NODE_TYPE_QUERY_SERVER == eh->node_type && !duplex) {
+    /* Connect to client listener. */
+    ret = _nns_edge_connect_to (eh, client_id, dest_host, dest_port);
+    if (ret != NNS_EDGE_ERROR_NONE) {
+      nns_edge_loge ("Failed to connect host %s:%d.", dest_host, dest_port);
+      goto error;
     }
+  }
 
-    ret = _nns_edge_cmd_send (conn, &cmd);
-    _nns_edge_cmd_clear (&cmd);
+  nns_edge_conn_wrlock (eh);
+  conn_data = _nns_edge_add_connection (eh, client_id);
+  if (!conn_data) {
+    nns_edge_loge ("Failed to add client connection.");
+    nns_edge_conn_unlock (eh);
+    goto error;
+  }
+
+  /* Both connections of query node have the features negotiated in handshake. */
+  if (conn_data->sink_conn && !duplex) {
+    if (NNS_EDGE_NODE_TYPE_QUERY_SERVER == eh->node_type)
+      conn_data->sink_conn->features = conn->features;
+    else if (NNS_EDGE_NODE_TYPE_QUERY_CLIENT == eh->node_type)
+      conn->features = conn_data->sink_conn->features;
+  }
 
+  /* Set new connection for each node type, and close old one after unlocking. */
+  if (duplex) {
+    /* The accepted socket receives the requests and sends the results. */
+    ret = _nns_edge_create_message_thread (eh, conn, client_id);
     if (ret != NNS_EDGE_ERROR_NONE) {
-      nns_edge_loge ("Failed to send host info.");
+      nns_edge_loge ("Failed to create message handle thread.");
+      nns_edge_conn_unlock (eh);
       goto error;
     }
-  }
-
-  if (NNS_EDGE_NODE_TYPE_SUB == eh->node_type) {
+    old_src = conn_data->src_conn;
+    conn_data->src_conn = NULL;
+    old_sink = conn_data->sink_conn;
+    conn_data->sink_conn = conn;
+  } else if (eh->node_type == NNS_EDGE_NODE_TYPE_QUERY_CLIENT ||
+      eh->node_type == NNS_EDGE_NODE_TYPE_QUERY_SERVER) {
     ret = _nns_edge_create_message_thread (eh, conn, client_id);
     if (ret != NNS_EDGE_ERROR_NONE) {
       nns_edge_loge ("Failed to create message handle thread.");
+      nns_edge_conn_unlock (eh);
       goto error;
     }
+    old_src = conn_data->src_conn;
+    conn_data->src_conn = conn;
+  } else {
+    /* The publisher receives the credits from the subscriber. */
+    if (conn->features & NNS_EDGE_FEATURE_CREDIT) {
+      ret = _nns_edge_create_message_thread (eh, conn, client_id);
+      if (ret != NNS_EDGE_ERROR_NONE) {
+        nns_edge_loge ("Failed to create message handle thread.");
+        nns_edge_conn_unlock (eh);
+        goto error;
+      }
+    }
+    old_sink = conn_data->sink_conn;
+    conn_data->sink_conn = conn;
   }
+  nns_edge_conn_unlock (eh);
 
-  conn_data = _nns_edge_add_connection (eh, client_id);
-  if (conn_data) {
-    /* Close old connection and set new one. */
-    _nns_edge_close_connection (conn_data->sink_conn);
-    conn_data->sink_conn = conn;
-    done = true;
+  _nns_edge_close_connection (old_src);
+  _nns_edge_close_connection (old_sink);
+
+  /* Grant the initial credits, the peer sends data within the credits. */
+  if (NNS_EDGE_NODE_TYPE_PUB != eh->node_type)
+    nns_edge_credit_grant (eh, client_id, 0U);
+
+  ret = nns_edge_event_invoke_callback (eh->event_cb, eh->user_data,
+      NNS_EDGE_EVENT_CONNECTION_COMPLETED, NULL, 0, NULL);
+  if (ret != NNS_EDGE_ERROR_NONE) {
+    nns_edge_loge ("Failed to send an event for new connection.");
+    goto error;
+  }
+  done = true;
+
+error:
+  if (!done)
+    _nns_edge_close_connection (conn);
+
+  SAFE_FREE (dest_host);
+}
+
+/**
+ * @brief Callback to release the accepted socket remained in the handshake queue.
+ */
+static void
+_nns_edge_release_accepted_socket (void *data)
+{
+  _nns_edge_close_connection ((nns_edge_conn_s *) data);
+}
+
+/**
+ * @brief Handshake worker thread, handle the accepted sockets in the handshake queue.
+ */
+static void *
+_nns_edge_handshake_thread (void *thread_data)
+{
+  nns_edge_handle_s *eh = (nns_edge_handle_s *) thread_data;
+  nns_edge_conn_s *conn;
+  nns_size_t size;
+
+  while (eh->handshaking) {
+    /* Wake up periodically to check the state, the queue is cleared when stopping the workers. */
+    if (NNS_EDGE_ERROR_NONE != nns_edge_queue_wait_pop (eh->handshake_queue,
+            100U, (void **) &conn, &size))
+      continue;
+
+    if (eh->handshaking)
+      _nns_edge_handshake_socket (eh, conn);
+    else
+      _nns_edge_close_connection (conn);
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief Stop the handshake workers and close the accepted sockets in the queue.
+ * @note Do not call this function with handle lock, the worker may invoke the event callback.
+ */
+static void
+_nns_edge_stop_handshake_workers (nns_edge_handle_s * eh)
+{
+  unsigned int i;
+
+  eh->handshaking = false;
+  nns_edge_queue_clear (eh->handshake_queue);
+
+  if (eh->handshake_threads) {
+    for (i = 0; i < eh->handshake_workers; i++) {
+      if (eh->handshake_threads[i])
+        pthread_join (eh->handshake_threads[i], NULL);
+    }
+
+    SAFE_FREE (eh->handshake_threads);
+  }
+}
+
+/**
+ * @brief Create the handshake workers.
+ * @note This function should be called with handle lock.
+ */
+static bool
+_nns_edge_create_handshake_workers (nns_edge_handle_s * eh)
+{
+  unsigned int i;
+
+  if (eh->handshake_threads)
+    return true;
+
+  eh->handshake_threads =
+      (pthread_t *) calloc (eh->handshake_workers, sizeof (pthread_t));
+  if (!eh->handshake_threads) {
+    nns_edge_loge ("Failed to allocate handshake workers.");
+    return false;
   }
 
-error:
-  if (!done) {
-    _nns_edge_close_connection (conn);
-    return NNS_EDGE_ERROR_CONNECTION_FAILURE;
+  eh->handshaking = true;
+  for (i = 0; i < eh->handshake_workers; i++) {
+    if (pthread_create (&eh->handshake_threads[i], NULL,
+            _nns_edge_handshake_thread, eh) != 0) {
+      nns_edge_loge ("Failed to create handshake thread.");
+      eh->handshake_threads[i] = 0;
+      _nns_edge_stop_handshake_workers (eh);
+      return false;
+    }
   }
 
-  return NNS_EDGE_ERROR_NONE;
+  return true;
 }
 
 /**
- * @brief Accept socket and create message thread in socket listener thread.
+ * @brief Accept socket and pass it to the handshake worker. The listener is not blocked by the handshake of each peer.
  */
 static void
 _nns_edge_accept_socket (nns_edge_handle_s * eh)
 {
-  bool done = false;
   nns_edge_conn_s *conn;
-  nns_edge_conn_data_s *conn_data;
-  nns_edge_cmd_s cmd;
-  int64_t client_id;
-  char *dest_host = NULL;
-  int dest_port, ret;
 
   conn = (nns_edge_conn_s *) calloc (1, sizeof (nns_edge_conn_s));
   if (!conn) {
     nns_edge_loge ("Failed to allocate edge connection.");
-    goto error;
+    return;
   }
 
+  conn->pool = eh->pool;
+  conn->shm_size = eh->shm_size;
+  conn->compress = eh->compress;
+  conn->compress_threshold = eh->compress_threshold;
+  conn->chunk_size = eh->chunk_size;
+  conn->stats = &eh->stats;
+  conn->wake_fd[0] = conn->wake_fd[1] = -1;
+  pthread_mutex_init (&conn->send_lock, NULL);
+  nns_edge_lock_init (&conn->credit);
   conn->sockfd = accept (eh->listener_fd, NULL, NULL);
   if (conn->sockfd < 0) {
     nns_edge_loge ("Failed to accept socket.");
     goto error;
   }
 
-  _set_socket_option (conn->sockfd);
-
-  if ((NNS_EDGE_NODE_TYPE_QUERY_SERVER == eh->node_type)
-      || (NNS_EDGE_NODE_TYPE_PUB == eh->node_type)) {
-    client_id = nns_edge_generate_id ();
-  } else {
-    client_id = eh->client_id;
-  }
-
-  /* Send capability and info to check compatibility. */
-  if ((NNS_EDGE_NODE_TYPE_QUERY_SERVER == eh->node_type)
-      || (NNS_EDGE_NODE_TYPE_PUB == eh->node_type)) {
-    _nns_edge_cmd_init (&cmd, _NNS_EDGE_CMD_CAPABILITY, client_id);
-    cmd.info.num = 1;
-    cmd.info.mem_size[0] = strlen (eh->caps_str) + 1;
-    cmd.mem[0] = eh->caps_str;
-
-    ret = _nns_edge_cmd_send (conn, &cmd);
-    if (ret != NNS_EDGE_ERROR_NONE) {
-      nns_edge_loge ("Failed to send capability.");
-      goto error;
-    }
-  }
-
-  if (NNS_EDGE_NODE_TYPE_QUERY_SERVER == eh->node_type) {
-    /* Receive host info from destination. */
-    _nns_edge_cmd_init (&cmd, _NNS_EDGE_CMD_ERROR, client_id);
-    ret = _nns_edge_cmd_receive (conn, &cmd);
-    if (ret != NNS_EDGE_ERROR_NONE) {
-      nns_edge_loge ("Failed to receive node info.");
-      goto error;
-    }
-
-    if (cmd.info.cmd != _NNS_EDGE_CMD_HOST_INFO) {
-      nns_edge_loge ("Failed to get host info.");
-      _nns_edge_cmd_clear (&cmd);
-      goto error;
-    }
-
-    nns_edge_parse_host_string (cmd.mem[0], &dest_host, &dest_port);
-    _nns_edge_cmd_clear (&cmd);
-
-    /* Connect to client listener. */
-    ret = _nns_edge_connect_to (eh, client_id, dest_host, dest_port);
-    if (ret != NNS_EDGE_ERROR_NONE) {
-      nns_edge_loge ("Failed to connect host %s:%d.", dest_host, dest_port);
-      goto error;
-    }
-  }
+  nns_edge_socket_set_option (eh->connect_type, conn->sockfd);
+  nns_edge_socket_set_timeout (conn->sockfd, eh->handshake_timeout);
 
-  conn_data = _nns_edge_add_connection (eh, client_id);
-  if (!conn_data) {
-    nns_edge_loge ("Failed to add client connection.");
+  if (nns_edge_queue_push (eh->handshake_queue, conn, sizeof (nns_edge_conn_s),
+          _nns_edge_release_accepted_socket) != NNS_EDGE_ERROR_NONE) {
+    nns_edge_loge ("Failed to pass accepted socket to the handshake worker.");
     goto error;
   }
 
-  /* Close old connection and set new one for each node type. */
-  if (eh->node_type == NNS_EDGE_NODE_TYPE_QUERY_CLIENT ||
-      eh->node_type == NNS_EDGE_NODE_TYPE_QUERY_SERVER) {
-    ret = _nns_edge_create_message_thread (eh, conn, client_id);
-    if (ret != NNS_EDGE_ERROR_NONE) {
-      nns_edge_loge ("Failed to create message handle thread.");
-      goto error;
-    }
-    _nns_edge_close_connection (conn_data->src_conn);
-    conn_data->src_conn = conn;
-  } else {
-    _nns_edge_close_connection (conn_data->sink_conn);
-    conn_data->sink_conn = conn;
-  }
-
-  ret = nns_edge_event_invoke_callback (eh->event_cb, eh->user_data,
-      NNS_EDGE_EVENT_CONNECTION_COMPLETED, NULL, 0, NULL);
-  if (ret != NNS_EDGE_ERROR_NONE) {
-    nns_edge_loge ("Failed to send an event for new connection.");
-    goto error;
-  }
-  done = true;
+  return;
 
 error:
-  if (!done)
-    _nns_edge_close_connection (conn);
-
-  SAFE_FREE (dest_host);
+  _nns_edge_close_connection (conn);
 }
 
 /**
@@ -1183,12 +3766,8 @@ _nns_edge_socket_listener_thread (void *thread_data)
   while (eh->listening) {
     struct pollfd poll_fd;
 
-    poll_fd.fd = eh->listener_fd;
-    poll_fd.events = POLLIN | POLLHUP | POLLERR;
-    poll_fd.revents = 0;
-
-    /* 10 milliseconds */
-    if (poll (&poll_fd, 1, 10) > 0) {
+    /* Wait for new connection, releasing the handle wakes up the thread. */
+    if (_nns_edge_poll_socket (eh->listener_fd, eh->wake_fd[0], &poll_fd) > 0) {
       if (!eh->listening)
         break;
 
@@ -1206,6 +3785,46 @@ _nns_edge_socket_listener_thread (void *thread_data)
   return NULL;
 }
 
+/**
+ * @brief Callback of the reactor, accept new socket.
+ */
+static bool
+_nns_edge_reactor_accept_cb (int fd, void *user_data)
+{
+  nns_edge_handle_s *eh = (nns_edge_handle_s *) user_data;
+
+  UNUSED (fd);
+
+  if (!eh->listening)
+    return false;
+
+  _nns_edge_accept_socket (eh);
+  return true;
+}
+
+/**
+ * @brief Check the listener is bound to the file of unix domain socket.
+ */
+static bool
+_nns_edge_is_socket_file (nns_edge_handle_s * eh)
+{
+  return (NNS_EDGE_CONNECT_TYPE_UDS == eh->connect_type &&
+      STR_IS_VALID (eh->host) && eh->host[0] == '/');
+}
+
+/**
+ * @brief Close the listener socket, and remove the file of unix domain socket.
+ */
+static void
+_nns_edge_close_listener (nns_edge_handle_s * eh)
+{
+  close (eh->listener_fd);
+  eh->listener_fd = -1;
+
+  if (_nns_edge_is_socket_file (eh))
+    unlink (eh->host);
+}
+
 /**
  * @brief Create socket listener.
  * @note This function should be called with handle lock.
@@ -1213,17 +3832,22 @@ _nns_edge_socket_listener_thread (void *thread_data)
 static bool
 _nns_edge_create_socket_listener (nns_edge_handle_s * eh)
 {
-  bool done = false;
-  struct sockaddr_in saddr = { 0 };
-  socklen_t saddr_len = sizeof (struct sockaddr_in);
+  bool done = false, bound = false;
+  struct sockaddr_storage saddr;
+  socklen_t saddr_len = 0;
   int status;
 
-  if (!_fill_socket_addr (&saddr, eh->host, eh->port)) {
+  if (!nns_edge_socket_fill_addr (eh->connect_type, &saddr, &saddr_len,
+          eh->host, eh->port)) {
     nns_edge_loge ("Failed to create listener, invalid host: %s.", eh->host);
     return false;
   }
 
-  eh->listener_fd = socket (AF_INET, SOCK_STREAM, IPPROTO_TCP);
+  if (_nns_edge_is_socket_file (eh))
+    nns_edge_socket_remove_stale_file (eh->host);
+
+  eh->listener_fd = socket (saddr.ss_family, SOCK_STREAM,
+      (saddr.ss_family == AF_UNIX) ? 0 : IPPROTO_TCP);
   if (eh->listener_fd < 0) {
     nns_edge_loge ("Failed to create listener socket.");
     return false;
@@ -1233,12 +3857,32 @@ _nns_edge_create_socket_listener (nns_edge_handle_s * eh)
     nns_edge_loge ("Failed to create listener, cannot bind socket.");
     goto error;
   }
+  bound = true;
 
   if (listen (eh->listener_fd, N_BACKLOG) < 0) {
     nns_edge_loge ("Failed to create listener, cannot listen socket.");
     goto error;
   }
 
+  if (!_nns_edge_create_handshake_workers (eh)) {
+    nns_edge_loge ("Failed to create listener, cannot start handshake workers.");
+    goto error;
+  }
+
+  if (eh->reactor) {
+    /* The reactor accepts new socket in the worker thread. */
+    eh->listening = true;
+    if (nns_edge_reactor_add (eh->reactor, eh->listener_fd,
+            _nns_edge_reactor_accept_cb, eh) != NNS_EDGE_ERROR_NONE) {
+      nns_edge_loge ("Failed to add the listener to the reactor.");
+      eh->listening = false;
+      goto error;
+    }
+
+    done = true;
+    goto error;
+  }
+
   status = pthread_create (&eh->listener_thread, NULL,
       _nns_edge_socket_listener_thread, eh);
 
@@ -1256,8 +3900,12 @@ _nns_edge_create_socket_listener (nns_edge_handle_s * eh)
 
 error:
   if (!done) {
-    close (eh->listener_fd);
-    eh->listener_fd = -1;
+    if (bound) {
+      _nns_edge_close_listener (eh);
+    } else {
+      close (eh->listener_fd);
+      eh->listener_fd = -1;
+    }
   }
 
   return done;
@@ -1291,12 +3939,66 @@ _nns_edge_create_handle (const char *id, nns_edge_node_type_e node_type,
   eh->node_type = node_type;
   eh->is_started = false;
   eh->broker_h = NULL;
+  eh->mqtt_qos = 1;
+  eh->mqtt_retain = true;
+  eh->mqtt_host_qos = 1;
+  eh->mqtt_host_retain = true;
   eh->connections = NULL;
+  eh->conn_table = NULL;
+  eh->conn_table_size = 0U;
+  eh->conn_count = 0U;
   eh->listening = false;
   eh->sending = false;
   eh->listener_fd = -1;
+  _nns_edge_wake_fd_create (eh->wake_fd);
   eh->caps_str = nns_edge_strdup ("");
   eh->custom_connection_h = NULL;
+  eh->io_mode = NNS_EDGE_IO_MODE_THREAD;
+  eh->header_mode = NNS_EDGE_HEADER_MODE_AUTO;
+  eh->conn_mode = NNS_EDGE_CONN_MODE_PAIR;
+  eh->shm_size = 0;
+  eh->batch_count = 0U;
+  eh->batch_bytes = 0U;
+  eh->batch_delay = 0U;
+  eh->batch_event = false;
+  eh->requests.window = NNS_EDGE_REQUEST_WINDOW;
+  eh->requests.timeout = NNS_EDGE_REQUEST_TIMEOUT;
+  eh->requests.count = 0U;
+  eh->requests.waiting = 0U;
+  eh->requests.stopped = false;
+  eh->requests.last_id = 0U;
+  eh->requests.slots = NULL;
+  eh->balance = NNS_EDGE_BALANCE_NONE;
+  eh->server_count = 1U;
+  eh->balance_turn = 0U;
+  eh->load = 0U;
+  eh->flow_credits = 0U;
+  eh->flow_policy = NNS_EDGE_FLOW_DROP;
+  eh->conflate = false;
+  eh->compress = NNS_EDGE_COMPRESS_NONE;
+  eh->compress_threshold = NNS_EDGE_COMPRESS_THRESHOLD;
+  eh->fanout_limit = 0U;
+  eh->fanout_leaky = NNS_EDGE_QUEUE_LEAK_OLD;
+  eh->io_workers = N_REACTOR_WORKERS;
+  eh->reactor = NULL;
+  eh->handshaking = false;
+  eh->handshake_workers = N_HANDSHAKE_WORKERS;
+  eh->handshake_timeout = NNS_EDGE_HANDSHAKE_TIMEOUT;
+  eh->handshake_threads = NULL;
+  pthread_rwlock_init (&eh->conn_lock, NULL);
+  nns_edge_lock_init (&eh->requests);
+  nns_edge_cond_init (&eh->requests);
+  nns_edge_lock_init (&eh->stats_timer);
+  nns_edge_cond_init (&eh->stats_timer);
+  eh->stats_timer.interval = 0U;
+  eh->stats.timing = false;
+  nns_edge_lock_init (&eh->servers);
+  eh->connect_parallel = 1U;
+  nns_edge_lock_init (&eh->dispatch);
+  eh->dispatch.running = false;
+  eh->dispatch.threads = 0U;
+  eh->dispatch.limit = NNS_EDGE_DISPATCH_QUEUE_SIZE;
+  eh->dispatch.leaky = NNS_EDGE_QUEUE_LEAK_OLD;
 
   ret = nns_edge_metadata_create (&eh->metadata);
   if (ret != NNS_EDGE_ERROR_NONE) {
@@ -1310,6 +4012,18 @@ _nns_edge_create_handle (const char *id, nns_edge_node_type_e node_type,
     goto error;
   }
 
+  ret = nns_edge_queue_create (&eh->handshake_queue);
+  if (NNS_EDGE_ERROR_NONE != ret) {
+    nns_edge_loge ("Failed to create handshake queue.");
+    goto error;
+  }
+
+  ret = nns_edge_pool_create (&eh->pool);
+  if (NNS_EDGE_ERROR_NONE != ret) {
+    nns_edge_loge ("Failed to create buffer pool.");
+    goto error;
+  }
+
 error:
   if (ret == NNS_EDGE_ERROR_NONE)
     *edge_h = eh;
@@ -1361,43 +4075,285 @@ nns_edge_custom_create_handle (const char *id, const char *lib_path,
 }
 
 /**
- * @brief Create edge handle.
+ * @brief Create edge handle.
+ */
+int
+nns_edge_create_handle (const char *id, nns_edge_connect_type_e connect_type,
+    nns_edge_node_type_e node_type, nns_edge_h * edge_h)
+{
+  int ret = NNS_EDGE_ERROR_NONE;
+  nns_edge_handle_s *eh;
+
+  if (connect_type < 0 || connect_type >= NNS_EDGE_CONNECT_TYPE_UNKNOWN ||
+      connect_type == NNS_EDGE_CONNECT_TYPE_CUSTOM) {
+    nns_edge_loge ("Invalid param, set valid connect type.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  /**
+   * @todo handle flag (receive | send)
+   * e.g., send only case: listener is unnecessary.
+   */
+  if (node_type < 0 || node_type >= NNS_EDGE_NODE_TYPE_UNKNOWN) {
+    nns_edge_loge ("Invalid param, set exact node type.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!edge_h) {
+    nns_edge_loge ("Invalid param, edge_h should not be null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  ret = _nns_edge_create_handle (id, node_type, edge_h);
+  if (ret != NNS_EDGE_ERROR_NONE) {
+    nns_edge_loge ("Failed to create edge handle.");
+    return ret;
+  }
+
+  eh = (nns_edge_handle_s *) (*edge_h);
+  eh->connect_type = connect_type;
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Publish the host and port of the server to the broker. (host:port or host:port;load=N)
+ * @note The node which does not support the load parses the host string only.
+ */
+static int
+_nns_edge_hybrid_publish_host (nns_edge_handle_s * eh)
+{
+  char *host, *msg;
+  int ret;
+
+  host = nns_edge_get_host_string (eh->host, eh->port);
+  if (eh->load > 0U) {
+    msg = nns_edge_strdup_printf ("%s;load=%u", host, eh->load);
+    SAFE_FREE (host);
+  } else {
+    msg = host;
+  }
+
+  ret = nns_edge_mqtt_publish (eh->broker_h, msg, strlen (msg) + 1,
+      eh->mqtt_host_qos, eh->mqtt_host_retain);
+  SAFE_FREE (msg);
+
+  return ret;
+}
+
+/**
+ * @brief Get the statistics string of edge handle.
+ * @note This function should be called with handle lock.
+ */
+static char *
+_nns_edge_stats_get_string (nns_edge_handle_s * eh)
+{
+  nns_edge_conn_data_s *conn_data;
+  nns_edge_conn_s *conn;
+  uint64_t queue_dropped = 0, conn_dropped = 0, dropped;
+  unsigned int queue_depth = 0;
+
+  nns_edge_queue_get_length (eh->send_queue, &queue_depth);
+  nns_edge_queue_get_dropped (eh->send_queue, &queue_dropped);
+
+  /* The data dropped in the queue of each connection in fan-out mode. */
+  nns_edge_conn_rdlock (eh);
+  conn_data = (nns_edge_conn_data_s *) eh->connections;
+  while (conn_data) {
+    conn = conn_data->sink_conn;
+    if (conn && conn->send_queue &&
+        nns_edge_queue_get_dropped (conn->send_queue, &dropped) ==
+        NNS_EDGE_ERROR_NONE)
+      conn_dropped += dropped;
+
+    conn_data = conn_data->next;
+  }
+  nns_edge_conn_unlock (eh);
+
+  return nns_edge_stats_to_string (&eh->stats, queue_depth, queue_dropped,
+      conn_dropped);
+}
+
+/**
+ * @brief Get the statistics of each connection, separated by ';'.
+ * @note This function should be called with handle lock.
+ */
+static char *
+_nns_edge_stats_get_connections (nns_edge_handle_s * eh)
+{
+  nns_edge_conn_data_s *conn_data;
+  nns_edge_stats_count_s sent, received;
+  nns_edge_conn_s *conns[2];
+  uint64_t dropped;
+  unsigned int i, depth;
+  char *value, *str, *prev;
+
+  value = nns_edge_strdup ("");
+
+  nns_edge_conn_rdlock (eh);
+  conn_data = (nns_edge_conn_data_s *) eh->connections;
+  while (conn_data && value) {
+    memset (&sent, 0, sizeof (nns_edge_stats_count_s));
+    memset (&received, 0, sizeof (nns_edge_stats_count_s));
+    depth = 0U;
+    dropped = 0U;
+
+    /* In duplex mode, the connection sends and receives data. */
+    conns[0] = conn_data->sink_conn;
+    conns[1] = (conn_data->src_conn != conn_data->sink_conn) ?
+        conn_data->src_conn : NULL;
+
+    for (i = 0; i < 2U; i++) {
+      if (!conns[i])
+        continue;
+
+      sent.frames += nns_edge_stats_get (conns[i]->sent.frames);
+      sent.bytes += nns_edge_stats_get (conns[i]->sent.bytes);
+      received.frames += nns_edge_stats_get (conns[i]->received.frames);
+      received.bytes += nns_edge_stats_get (conns[i]->received.bytes);
+    }
+
+    if (conn_data->sink_conn && conn_data->sink_conn->send_queue) {
+      nns_edge_queue_get_length (conn_data->sink_conn->send_queue, &depth);
+      nns_edge_queue_get_dropped (conn_data->sink_conn->send_queue, &dropped);
+    }
+
+    str = nns_edge_strdup_printf
+        ("client_id=%lld,frames_sent=%llu,bytes_sent=%llu,frames_received=%llu,"
+        "bytes_received=%llu,queue_depth=%u,queue_dropped=%llu",
+        (long long) conn_data->id, (unsigned long long) sent.frames,
+        (unsigned long long) sent.bytes, (unsigned long long) received.frames,
+        (unsigned long long) received.bytes, depth,
+        (unsigned long long) dropped);
+
+    prev = value;
+    value = (prev[0] == '\0') ? nns_edge_strdup (str) :
+        nns_edge_strdup_printf ("%s;%s", prev, str);
+    SAFE_FREE (prev);
+    SAFE_FREE (str);
+
+    conn_data = conn_data->next;
+  }
+  nns_edge_conn_unlock (eh);
+
+  return value;
+}
+
+/**
+ * @brief Thread to invoke the statistics event periodically.
+ */
+static void *
+_nns_edge_stats_thread (void *thread_data)
+{
+  nns_edge_handle_s *eh = (nns_edge_handle_s *) thread_data;
+  nns_edge_stats_timer_s *timer = &eh->stats_timer;
+  nns_edge_event_cb event_cb;
+  void *user_data;
+  char *stats;
+  bool changed;
+
+  nns_edge_lock (timer);
+  while (timer->running) {
+    /* Wait until the interval is set if it is 0. */
+    changed = timer->changed;
+    timer->changed = false;
+    if (!changed)
+      nns_edge_cond_wait_until (timer, timer->interval);
+
+    if (!timer->running)
+      break;
+
+    if (changed || timer->changed || timer->interval == 0U)
+      continue;
+
+    nns_edge_unlock (timer);
+
+    nns_edge_lock (eh);
+    event_cb = eh->event_cb;
+    user_data = eh->user_data;
+    stats = (eh->is_started && event_cb) ? _nns_edge_stats_get_string (eh) :
+        NULL;
+    nns_edge_unlock (eh);
+
+    /* Invoke the callback without lock, it may get the information of edge handle. */
+    if (stats) {
+      nns_edge_event_invoke_callback (event_cb, user_data,
+          NNS_EDGE_EVENT_STATISTICS, stats, strlen (stats) + 1, nns_edge_free);
+    }
+
+    nns_edge_lock (timer);
+  }
+  nns_edge_unlock (timer);
+
+  return NULL;
+}
+
+/**
+ * @brief Start the thread to invoke the statistics event, if the interval is set.
+ * @note This function should be called with handle lock.
+ */
+static int
+_nns_edge_stats_start_timer (nns_edge_handle_s * eh)
+{
+  nns_edge_stats_timer_s *timer = &eh->stats_timer;
+  int ret = NNS_EDGE_ERROR_NONE;
+
+  nns_edge_lock (timer);
+  if (timer->interval > 0U && !timer->thread) {
+    timer->running = true;
+    timer->changed = false;
+
+    if (pthread_create (&timer->thread, NULL, _nns_edge_stats_thread, eh) != 0) {
+      nns_edge_loge ("Failed to create the thread of statistics event.");
+      timer->running = false;
+      timer->thread = 0;
+      ret = NNS_EDGE_ERROR_IO;
+    }
+  }
+  nns_edge_unlock (timer);
+
+  return ret;
+}
+
+/**
+ * @brief Stop the thread invoking the statistics event.
+ * @note Call this without handle lock, the thread gets the statistics with handle lock.
  */
-int
-nns_edge_create_handle (const char *id, nns_edge_connect_type_e connect_type,
-    nns_edge_node_type_e node_type, nns_edge_h * edge_h)
+static void
+_nns_edge_stats_stop_timer (nns_edge_handle_s * eh)
 {
-  int ret = NNS_EDGE_ERROR_NONE;
-  nns_edge_handle_s *eh;
-
-  if (connect_type < 0 || connect_type >= NNS_EDGE_CONNECT_TYPE_UNKNOWN ||
-      connect_type == NNS_EDGE_CONNECT_TYPE_CUSTOM) {
-    nns_edge_loge ("Invalid param, set valid connect type.");
-    return NNS_EDGE_ERROR_INVALID_PARAMETER;
-  }
-
-  /**
-   * @todo handle flag (receive | send)
-   * e.g., send only case: listener is unnecessary.
-   */
-  if (node_type < 0 || node_type >= NNS_EDGE_NODE_TYPE_UNKNOWN) {
-    nns_edge_loge ("Invalid param, set exact node type.");
-    return NNS_EDGE_ERROR_INVALID_PARAMETER;
-  }
+  nns_edge_stats_timer_s *timer = &eh->stats_timer;
+  pthread_t thread;
+
+  nns_edge_lock (timer);
+  timer->running = false;
+  thread = timer->thread;
+  timer->thread = 0;
+  nns_edge_cond_signal (timer);
+  nns_edge_unlock (timer);
+
+  if (thread)
+    pthread_join (thread, NULL);
+}
 
-  if (!edge_h) {
-    nns_edge_loge ("Invalid param, edge_h should not be null.");
-    return NNS_EDGE_ERROR_INVALID_PARAMETER;
-  }
+/**
+ * @brief Set the interval of the statistics event. The thread is started when starting the edge handle.
+ * @note This function should be called with handle lock.
+ */
+static int
+_nns_edge_stats_set_interval (nns_edge_handle_s * eh, unsigned int interval)
+{
+  nns_edge_stats_timer_s *timer = &eh->stats_timer;
 
-  ret = _nns_edge_create_handle (id, node_type, edge_h);
-  if (ret != NNS_EDGE_ERROR_NONE) {
-    nns_edge_loge ("Failed to create edge handle.");
-    return ret;
-  }
+  /* The thread waits for new interval, do not join it here. The event callback may set the interval. */
+  nns_edge_lock (timer);
+  timer->interval = interval;
+  timer->changed = true;
+  nns_edge_cond_signal (timer);
+  nns_edge_unlock (timer);
 
-  eh = (nns_edge_handle_s *) (*edge_h);
-  eh->connect_type = connect_type;
+  if (eh->is_started)
+    return _nns_edge_stats_start_timer (eh);
 
   return NNS_EDGE_ERROR_NONE;
 }
@@ -1443,6 +4399,27 @@ nns_edge_start (nns_edge_h edge_h)
     }
   }
 
+  if (NNS_EDGE_IO_MODE_REACTOR == eh->io_mode && !eh->reactor &&
+      (NNS_EDGE_CONNECT_TYPE_TCP == eh->connect_type
+          || NNS_EDGE_CONNECT_TYPE_UDS == eh->connect_type
+          || NNS_EDGE_CONNECT_TYPE_HYBRID == eh->connect_type)) {
+    ret = nns_edge_reactor_create (eh->io_workers, &eh->reactor);
+    if (NNS_EDGE_ERROR_NONE != ret) {
+      nns_edge_loge ("Failed to start edge. Cannot create the reactor.");
+      eh->reactor = NULL;
+      goto done;
+    }
+  }
+
+  if ((NNS_EDGE_CONNECT_TYPE_TCP == eh->connect_type
+          || NNS_EDGE_CONNECT_TYPE_UDS == eh->connect_type
+          || NNS_EDGE_CONNECT_TYPE_HYBRID == eh->connect_type) &&
+      !_nns_edge_create_dispatch_workers (eh)) {
+    nns_edge_loge ("Failed to start edge. Cannot create the dispatch workers.");
+    ret = NNS_EDGE_ERROR_IO;
+    goto done;
+  }
+
   if ((NNS_EDGE_NODE_TYPE_QUERY_SERVER == eh->node_type)
       || (NNS_EDGE_NODE_TYPE_PUB == eh->node_type)) {
     if (NNS_EDGE_CONNECT_TYPE_HYBRID == eh->connect_type
@@ -1467,19 +4444,16 @@ nns_edge_start (nns_edge_h edge_h)
       }
 
       if (NNS_EDGE_CONNECT_TYPE_HYBRID == eh->connect_type) {
-        char *msg;
-        msg = nns_edge_get_host_string (eh->host, eh->port);
-
-        ret = nns_edge_mqtt_publish (eh->broker_h, msg, strlen (msg) + 1);
-        SAFE_FREE (msg);
-
+        ret = _nns_edge_hybrid_publish_host (eh);
         if (NNS_EDGE_ERROR_NONE != ret) {
           nns_edge_loge ("Failed to publish the message to broker.");
           goto done;
         }
       } else {
-        ret = nns_edge_mqtt_set_event_callback (eh->broker_h, eh->event_cb,
-            eh->user_data);
+        ret = nns_edge_mqtt_set_statistics (eh->broker_h, &eh->stats);
+        if (NNS_EDGE_ERROR_NONE == ret)
+          ret = nns_edge_mqtt_set_event_callback (eh->broker_h, eh->event_cb,
+              eh->user_data);
         if (NNS_EDGE_ERROR_NONE != ret) {
           nns_edge_loge ("Failed to set event callback to MQTT broker.");
           goto done;
@@ -1491,8 +4465,10 @@ nns_edge_start (nns_edge_h edge_h)
   if ((NNS_EDGE_NODE_TYPE_QUERY_CLIENT == eh->node_type)
       || (NNS_EDGE_NODE_TYPE_QUERY_SERVER == eh->node_type)
       || (NNS_EDGE_NODE_TYPE_PUB == eh->node_type)) {
-    /* Start listener thread to accept socket. */
-    if (!_nns_edge_create_socket_listener (eh)) {
+    /* Start listener thread to accept socket. Query client in duplex mode does not need the listener. */
+    if ((NNS_EDGE_NODE_TYPE_QUERY_CLIENT != eh->node_type ||
+            NNS_EDGE_CONN_MODE_DUPLEX != eh->conn_mode) &&
+        !_nns_edge_create_socket_listener (eh)) {
       nns_edge_loge ("Failed to create socket listener.");
       ret = NNS_EDGE_ERROR_IO;
       goto done;
@@ -1503,6 +4479,10 @@ nns_edge_start (nns_edge_h edge_h)
 
 done:
   eh->is_started = (ret == NNS_EDGE_ERROR_NONE);
+  if (eh->is_started) {
+    nns_edge_request_set_stopped (eh, false);
+    _nns_edge_stats_start_timer (eh);
+  }
   nns_edge_unlock (eh);
   return ret;
 }
@@ -1537,9 +4517,13 @@ nns_edge_stop (nns_edge_h edge_h)
     ret = nns_edge_custom_stop (eh->custom_connection_h);
   }
 
-  if (NNS_EDGE_ERROR_NONE == ret)
+  if (NNS_EDGE_ERROR_NONE == ret) {
     eh->is_started = FALSE;
 
+    /* Wake up the threads waiting for the window of the requests. */
+    nns_edge_request_set_stopped (eh, true);
+  }
+
 done:
   nns_edge_unlock (eh);
   return ret;
@@ -1566,6 +4550,21 @@ nns_edge_release_handle (nns_edge_h edge_h)
 
   nns_edge_stop (eh);
 
+  /* No thread waits for the window of the requests, before destroying its lock. */
+  nns_edge_request_set_stopped (eh, true);
+
+  /**
+   * Stop the reactor before locking the handle.
+   * The callback in progress may call the edge functions with handle lock.
+   */
+  if (eh->reactor)
+    nns_edge_reactor_stop (eh->reactor);
+
+  /* Same as the reactor, the handshake and dispatch workers may invoke the event callback. */
+  _nns_edge_stop_dispatch_workers (eh);
+  _nns_edge_stop_handshake_workers (eh);
+  _nns_edge_stats_stop_timer (eh);
+
   nns_edge_lock (eh);
 
   /* Clear message queue and stop thread first */
@@ -1579,17 +4578,32 @@ nns_edge_release_handle (nns_edge_h edge_h)
 
   eh->listening = false;
   if (eh->listener_thread) {
+    _nns_edge_wake_up (eh->wake_fd);
     pthread_join (eh->listener_thread, NULL);
     eh->listener_thread = 0;
   }
 
   if (eh->listener_fd >= 0) {
-    close (eh->listener_fd);
-    eh->listener_fd = -1;
+    if (eh->reactor)
+      nns_edge_reactor_remove (eh->reactor, eh->listener_fd);
+
+    _nns_edge_close_listener (eh);
   }
 
   _nns_edge_remove_all_connection (eh);
 
+  /* The message thread handling the lost connection does not access the handle after decreasing the count, poll it. */
+  while (__atomic_load_n (&eh->lost_count, __ATOMIC_SEQ_CST) > 0U)
+    nns_edge_cond_wait_until (eh, 10);
+
+  if (eh->reactor) {
+    nns_edge_reactor_destroy (eh->reactor);
+    eh->reactor = NULL;
+  }
+
+  /* The message threads are stopped, release the events not invoked yet. */
+  _nns_edge_release_dispatch_workers (eh);
+
   switch (eh->connect_type) {
     case NNS_EDGE_CONNECT_TYPE_HYBRID:
     case NNS_EDGE_CONNECT_TYPE_MQTT:
@@ -1614,8 +4628,16 @@ nns_edge_release_handle (nns_edge_h edge_h)
   eh->broker_h = NULL;
   eh->custom_connection_h = NULL;
 
+  _nns_edge_wake_fd_close (eh->wake_fd);
+
   nns_edge_queue_destroy (eh->send_queue);
   eh->send_queue = NULL;
+  nns_edge_queue_destroy (eh->handshake_queue);
+  eh->handshake_queue = NULL;
+  if (eh->pool) {
+    nns_edge_pool_destroy (eh->pool);
+    eh->pool = NULL;
+  }
   nns_edge_metadata_destroy (eh->metadata);
   eh->metadata = NULL;
   SAFE_FREE (eh->id);
@@ -1623,8 +4645,17 @@ nns_edge_release_handle (nns_edge_h edge_h)
   SAFE_FREE (eh->host);
   SAFE_FREE (eh->dest_host);
   SAFE_FREE (eh->caps_str);
+  SAFE_FREE (eh->requests.slots);
+  nns_edge_server_clear (eh);
 
   nns_edge_unlock (eh);
+  nns_edge_cond_destroy (&eh->requests);
+  nns_edge_lock_destroy (&eh->requests);
+  nns_edge_cond_destroy (&eh->stats_timer);
+  nns_edge_lock_destroy (&eh->stats_timer);
+  nns_edge_lock_destroy (&eh->dispatch);
+  nns_edge_lock_destroy (&eh->servers);
+  pthread_rwlock_destroy (&eh->conn_lock);
   nns_edge_cond_destroy (eh);
   nns_edge_lock_destroy (eh);
   SAFE_FREE (eh);
@@ -1678,39 +4709,202 @@ error:
   return ret;
 }
 
+/**
+ * @brief Check whether the query client should connect to more servers.
+ */
+static bool
+_nns_edge_balance_need_server (nns_edge_handle_s * eh)
+{
+  return (NNS_EDGE_NODE_TYPE_QUERY_CLIENT == eh->node_type &&
+      NNS_EDGE_CONN_MODE_DUPLEX == eh->conn_mode &&
+      _nns_edge_get_connection_count (eh) < eh->server_count);
+}
+
+/**
+ * @brief Check whether the query client is already connected to given server.
+ * @note Caller should hold the read lock of the connections.
+ */
+static bool
+_nns_edge_balance_find_server (nns_edge_handle_s * eh, const char *host,
+    int port)
+{
+  nns_edge_conn_data_s *conn_data;
+  nns_edge_conn_s *conn;
+
+  nns_edge_conn_check_rdlock (eh);
+
+  if (!host)
+    return false;
+
+  for (conn_data = (nns_edge_conn_data_s *) eh->connections; conn_data;
+      conn_data = conn_data->next) {
+    conn = conn_data->sink_conn;
+
+    if (conn && conn->port == port && conn->host &&
+        0 == strcmp (conn->host, host))
+      return true;
+  }
+
+  return false;
+}
+
+/**
+ * @brief Get the load from the message of the server. (host:port;load=N)
+ */
+static unsigned int
+_nns_edge_hybrid_parse_load (const char *msg)
+{
+  const char *p = strstr (msg, ";load=");
+  unsigned long load;
+
+  if (!p)
+    return 0U;
+
+  load = strtoul (p + strlen (";load="), NULL, 10);
+  return (load > UINT_MAX) ? UINT_MAX : (unsigned int) load;
+}
+
+/**
+ * @brief Get the known servers to connect, which are not connected and not waiting for the retry. The server with lower load comes first.
+ * @note Caller should release the host strings of returned servers.
+ */
+static unsigned int
+_nns_edge_server_get_candidates (nns_edge_handle_s * eh,
+    nns_edge_server_s * list, unsigned int max)
+{
+  nns_edge_conn_s *standby_conn;
+  nns_edge_server_s *server;
+  unsigned int i, j, num = 0U;
+  int64_t now;
+
+  now = nns_edge_get_monotonic_time ();
+
+  nns_edge_conn_rdlock (eh);
+  standby_conn = (nns_edge_conn_s *) eh->standby_conn;
+
+  nns_edge_lock (&eh->servers);
+  for (i = 0; i < eh->servers.len; i++) {
+    server = &eh->servers.list[i];
+
+    if (server->retry_time > now ||
+        _nns_edge_balance_find_server (eh, server->host, server->port))
+      continue;
+
+    if (standby_conn && standby_conn->port == server->port &&
+        0 == strcmp (standby_conn->host, server->host))
+      continue;
+
+    /* Insert the server in order of the load. */
+    for (j = num; j > 0U && list[j - 1U].load > server->load; j--) {
+      if (j < max)
+        list[j] = list[j - 1U];
+      else
+        SAFE_FREE (list[j - 1U].host);
+    }
+
+    if (j < max) {
+      memset (&list[j], 0, sizeof (nns_edge_server_s));
+      list[j].host = nns_edge_strdup (server->host);
+      list[j].port = server->port;
+      list[j].load = server->load;
+
+      if (num < max)
+        num++;
+    }
+  }
+  nns_edge_unlock (&eh->servers);
+  nns_edge_conn_unlock (eh);
+
+  return num;
+}
+
+/**
+ * @brief Connect to the known servers which are not connected, and make the standby connection.
+ */
+static int
+_nns_edge_connect_known_servers (nns_edge_handle_s * eh)
+{
+  nns_edge_server_s list[NNS_EDGE_CONNECT_PARALLEL_LIMIT];
+  unsigned int i, num;
+  int ret = NNS_EDGE_ERROR_CONNECTION_FAILURE;
+
+  while (_nns_edge_get_connection_count (eh) == 0U || _nns_edge_balance_need_server (eh)) {
+    num = _nns_edge_server_get_candidates (eh, list, eh->connect_parallel);
+    if (num == 0U)
+      break;
+
+    ret = _nns_edge_connect_any (eh, list, num, false);
+    for (i = 0; i < num; i++)
+      SAFE_FREE (list[i].host);
+  }
+
+  if (_nns_edge_get_connection_count (eh) > 0U &&
+      _nns_edge_standby_is_needed (eh)) {
+    num = _nns_edge_server_get_candidates (eh, list, eh->connect_parallel);
+    if (num > 0U) {
+      _nns_edge_connect_any (eh, list, num, true);
+      for (i = 0; i < num; i++)
+        SAFE_FREE (list[i].host);
+    }
+  }
+
+  return (_nns_edge_get_connection_count (eh) >
+      0U) ? NNS_EDGE_ERROR_NONE : ret;
+}
+
 /**
  * @brief Parse the message received from the MQTT broker and connect to the server directly.
+ * @note The query client in duplex mode connects to other servers until the number of connections reaches SERVER_COUNT.
+ * The servers are kept in the list of known servers, then the query client connects to the known servers first without the broker.
  */
 static int
 _mqtt_hybrid_direct_connection (nns_edge_handle_s * eh)
 {
+  nns_edge_server_s *server;
   int ret;
 
-  do {
+  ret = _nns_edge_connect_known_servers (eh);
+
+  while (_nns_edge_get_connection_count (eh) == 0U || _nns_edge_balance_need_server (eh) ||
+      _nns_edge_standby_is_needed (eh)) {
     char *msg = NULL;
     char *server_ip = NULL;
     int server_port = 0;
+    unsigned int load;
     nns_size_t msg_len = 0;
 
-    ret =
-        nns_edge_mqtt_get_message (eh->broker_h, (void **) &msg, &msg_len, 0U);
-    if (ret != NNS_EDGE_ERROR_NONE || !msg || msg_len == 0)
+    /* Wait for the first server, then find other servers for a while. */
+    ret = nns_edge_mqtt_get_message (eh->broker_h, (void **) &msg, &msg_len,
+        (_nns_edge_get_connection_count (eh) >
+            0U) ? NNS_EDGE_HYBRID_DISCOVERY_WAIT : 0U);
+    if (ret != NNS_EDGE_ERROR_NONE || !msg || msg_len == 0) {
+      SAFE_FREE (msg);
       break;
+    }
 
     nns_edge_parse_host_string (msg, &server_ip, &server_port);
+    load = _nns_edge_hybrid_parse_load (msg);
     SAFE_FREE (msg);
 
-    nns_edge_logd ("Parsed server info: Server [%s:%d] ", server_ip,
-        server_port);
+    nns_edge_logd ("Parsed server info: Server [%s:%d] (load %u)", server_ip,
+        server_port, load);
 
-    ret = _nns_edge_connect_to (eh, eh->client_id, server_ip, server_port);
+    /* The server announces itself again, connect to it without waiting for the retry. */
+    nns_edge_lock (&eh->servers);
+    server = nns_edge_server_add (eh, server_ip, server_port);
+    if (server) {
+      server->load = load;
+      server->failures = 0U;
+      server->retry_time = 0;
+    }
+    nns_edge_unlock (&eh->servers);
     SAFE_FREE (server_ip);
 
-    if (NNS_EDGE_ERROR_NONE == ret)
-      break;
-  } while (TRUE);
+    ret = _nns_edge_connect_known_servers (eh);
+  }
 
-  return ret;
+  return (_nns_edge_get_connection_count (eh) >
+      0U) ? NNS_EDGE_ERROR_NONE : ret;
 }
 
 /**
@@ -1750,6 +4944,7 @@ int
 nns_edge_connect (nns_edge_h edge_h, const char *dest_host, int dest_port)
 {
   nns_edge_handle_s *eh;
+  bool connected;
   int ret;
 
   eh = (nns_edge_handle_s *) edge_h;
@@ -1786,7 +4981,30 @@ nns_edge_connect (nns_edge_h edge_h, const char *dest_host, int dest_port)
     return NNS_EDGE_ERROR_CONNECTION_FAILURE;
   }
 
-  if (NNS_EDGE_ERROR_NONE == nns_edge_is_connected (eh)) {
+  nns_edge_conn_rdlock (eh);
+  connected = _nns_edge_balance_find_server (eh, dest_host, dest_port);
+  nns_edge_conn_unlock (eh);
+
+  if (NNS_EDGE_ERROR_NONE == nns_edge_is_connected (eh) &&
+      (!_nns_edge_balance_need_server (eh) || connected)) {
+    /* The query client keeps the connection to given server as the standby connection. */
+    if ((NNS_EDGE_CONNECT_TYPE_TCP == eh->connect_type
+            || NNS_EDGE_CONNECT_TYPE_UDS == eh->connect_type) &&
+        _nns_edge_standby_is_needed (eh) && !connected) {
+      nns_edge_server_s server = { 0 };
+
+      server.host = (char *) dest_host;
+      server.port = dest_port;
+
+      ret = _nns_edge_connect_any (eh, &server, 1U, true);
+      if (ret != NNS_EDGE_ERROR_NONE)
+        nns_edge_loge ("Failed to connect to standby server %s:%d",
+            dest_host, dest_port);
+
+      nns_edge_unlock (eh);
+      return ret;
+    }
+
     nns_edge_logi ("NNStreamer-edge is already connected.");
     nns_edge_unlock (eh);
     return NNS_EDGE_ERROR_NONE;
@@ -1805,8 +5023,10 @@ nns_edge_connect (nns_edge_h edge_h, const char *dest_host, int dest_port)
     if (NNS_EDGE_CONNECT_TYPE_HYBRID == eh->connect_type) {
       ret = _mqtt_hybrid_direct_connection (eh);
     } else {
-      ret = nns_edge_mqtt_set_event_callback (eh->broker_h, eh->event_cb,
-          eh->user_data);
+      ret = nns_edge_mqtt_set_statistics (eh->broker_h, &eh->stats);
+      if (NNS_EDGE_ERROR_NONE == ret)
+        ret = nns_edge_mqtt_set_event_callback (eh->broker_h, eh->event_cb,
+            eh->user_data);
       if (NNS_EDGE_ERROR_NONE != ret) {
         nns_edge_loge ("Failed to set event callback to MQTT broker.");
         goto done;
@@ -1848,62 +5068,199 @@ nns_edge_disconnect (nns_edge_h edge_h)
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
 
-  nns_edge_lock (eh);
-  _nns_edge_remove_all_connection (eh);
+  nns_edge_lock (eh);
+  _nns_edge_remove_all_connection (eh);
+  nns_edge_unlock (eh);
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Check whether edge is connected or not.
+ */
+int
+nns_edge_is_connected (nns_edge_h edge_h)
+{
+  nns_edge_handle_s *eh = (nns_edge_handle_s *) edge_h;
+  nns_edge_conn_data_s *conn_data;
+  nns_edge_conn_s *conn;
+
+  if (!eh) {
+    nns_edge_loge ("Invalid param, given edge handle is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!nns_edge_handle_is_valid (eh)) {
+    nns_edge_loge ("Invalid param, given edge handle is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (NNS_EDGE_CONNECT_TYPE_MQTT == eh->connect_type &&
+      nns_edge_mqtt_is_connected (eh->broker_h))
+    return NNS_EDGE_ERROR_NONE;
+
+  if (NNS_EDGE_CONNECT_TYPE_CUSTOM == eh->connect_type) {
+    return nns_edge_custom_is_connected (eh->custom_connection_h);
+  }
+
+  nns_edge_conn_rdlock (eh);
+  conn_data = (nns_edge_conn_data_s *) eh->connections;
+  while (conn_data) {
+    conn = conn_data->sink_conn;
+    if (_nns_edge_check_connection (conn)) {
+      nns_edge_conn_unlock (eh);
+      return NNS_EDGE_ERROR_NONE;
+    }
+    conn_data = conn_data->next;
+  }
+  nns_edge_conn_unlock (eh);
+
+  return NNS_EDGE_ERROR_CONNECTION_FAILURE;
+}
+
+/**
+ * @brief Send data to destination (broker or connected node), asynchronously.
+ */
+int
+nns_edge_send (nns_edge_h edge_h, nns_edge_data_h data_h)
+{
+  return nns_edge_send_full (edge_h, data_h, NNS_EDGE_SEND_FLAG_NONE);
+}
+
+/**
+ * @brief Send data to destination (broker or connected node) with the flags, asynchronously.
+ */
+int
+nns_edge_send_full (nns_edge_h edge_h, nns_edge_data_h data_h,
+    unsigned int flags)
+{
+  int ret = NNS_EDGE_ERROR_NONE;
+  nns_edge_handle_s *eh;
+  nns_edge_data_h new_data_h;
+
+  eh = (nns_edge_handle_s *) edge_h;
+  if (!eh) {
+    nns_edge_loge ("Invalid param, given edge handle is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (nns_edge_data_is_valid (data_h) != NNS_EDGE_ERROR_NONE) {
+    nns_edge_loge ("Invalid param, given edge data is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (flags & ~((unsigned int) NNS_EDGE_SEND_FLAG_TRANSFER)) {
+    nns_edge_loge ("Invalid param, given flags (0x%x) is invalid.", flags);
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!nns_edge_handle_is_valid (eh)) {
+    nns_edge_loge ("Invalid param, given edge handle is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (eh);
+
+  if (NNS_EDGE_ERROR_NONE != nns_edge_is_connected (eh)) {
+    nns_edge_loge ("There is no available connection.");
+    nns_edge_unlock (eh);
+    return NNS_EDGE_ERROR_IO;
+  }
+
+  if (!eh->send_thread) {
+    nns_edge_loge ("Invalid state, start edge before sending a data.");
+    nns_edge_unlock (eh);
+    return NNS_EDGE_ERROR_IO;
+  }
+
+  if (flags & NNS_EDGE_SEND_FLAG_TRANSFER) {
+    /* The edge handle owns the data, push it into send-queue without copying memories. */
+    new_data_h = data_h;
+  } else {
+    /* Create new data handle and push it into send-queue. */
+    ret = nns_edge_data_copy (data_h, &new_data_h);
+    if (NNS_EDGE_ERROR_NONE != ret) {
+      nns_edge_loge ("Failed to send data, cannot copy data.");
+      nns_edge_unlock (eh);
+      return ret;
+    }
+  }
+
+  ret = nns_edge_queue_push (eh->send_queue, new_data_h,
+      sizeof (nns_edge_data_h), nns_edge_data_release_handle);
+  if (NNS_EDGE_ERROR_NONE != ret) {
+    nns_edge_loge ("Failed to send data, cannot push data into queue.");
+
+    /* Caller still owns the data if failed to transfer it. */
+    if (new_data_h != data_h)
+      nns_edge_data_destroy (new_data_h);
+  }
+
   nns_edge_unlock (eh);
-
-  return NNS_EDGE_ERROR_NONE;
+  return ret;
 }
 
 /**
- * @brief Check whether edge is connected or not.
+ * @brief Allocate the buffer to fill the memory of edge data to be sent.
  */
 int
-nns_edge_is_connected (nns_edge_h edge_h)
+nns_edge_alloc_buffer (nns_edge_h edge_h, nns_size_t size, void **data,
+    nns_edge_data_destroy_cb * destroy_cb)
 {
-  nns_edge_handle_s *eh = (nns_edge_handle_s *) edge_h;
-  nns_edge_conn_data_s *conn_data;
-  nns_edge_conn_s *conn;
+  nns_edge_handle_s *eh;
+  int ret = NNS_EDGE_ERROR_NOT_SUPPORTED;
 
+  eh = (nns_edge_handle_s *) edge_h;
   if (!eh) {
     nns_edge_loge ("Invalid param, given edge handle is null.");
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
 
+  if (size == 0 || !data || !destroy_cb) {
+    nns_edge_loge ("Invalid param, size, data and destroy_cb should be valid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
   if (!nns_edge_handle_is_valid (eh)) {
     nns_edge_loge ("Invalid param, given edge handle is invalid.");
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
 
-  if (NNS_EDGE_CONNECT_TYPE_MQTT == eh->connect_type &&
-      nns_edge_mqtt_is_connected (eh->broker_h))
-    return NNS_EDGE_ERROR_NONE;
+  nns_edge_lock (eh);
 
   if (NNS_EDGE_CONNECT_TYPE_CUSTOM == eh->connect_type) {
-    return nns_edge_custom_is_connected (eh->custom_connection_h);
+    ret = nns_edge_custom_alloc_buffer (eh->custom_connection_h, size, data,
+        destroy_cb);
   }
 
-  conn_data = (nns_edge_conn_data_s *) eh->connections;
-  while (conn_data) {
-    conn = conn_data->sink_conn;
-    if (_nns_edge_check_connection (conn)) {
-      return NNS_EDGE_ERROR_NONE;
+  nns_edge_unlock (eh);
+
+  /* Fallback to the memory of the edge library. */
+  if (NNS_EDGE_ERROR_NOT_SUPPORTED == ret) {
+    *data = nns_edge_malloc (size);
+    if (!*data) {
+      nns_edge_loge ("Failed to allocate memory for the buffer.");
+      return NNS_EDGE_ERROR_OUT_OF_MEMORY;
     }
-    conn_data = conn_data->next;
+
+    *destroy_cb = nns_edge_free;
+    ret = NNS_EDGE_ERROR_NONE;
   }
 
-  return NNS_EDGE_ERROR_CONNECTION_FAILURE;
+  return ret;
 }
 
 /**
- * @brief Send data to destination (broker or connected node), asynchronously.
+ * @brief Send the request with new request ID. This function waits until the number of in-flight requests is less than the window.
  */
 int
-nns_edge_send (nns_edge_h edge_h, nns_edge_data_h data_h)
+nns_edge_send_request (nns_edge_h edge_h, nns_edge_data_h data_h,
+    uint64_t * request_id)
 {
-  int ret = NNS_EDGE_ERROR_NONE;
   nns_edge_handle_s *eh;
   nns_edge_data_h new_data_h;
+  uint64_t id;
+  int ret;
 
   eh = (nns_edge_handle_s *) edge_h;
   if (!eh) {
@@ -1921,37 +5278,78 @@ nns_edge_send (nns_edge_h edge_h, nns_edge_data_h data_h)
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
 
-  nns_edge_lock (eh);
-
-  if (NNS_EDGE_ERROR_NONE != nns_edge_is_connected (eh)) {
-    nns_edge_loge ("There is no available connection.");
-    nns_edge_unlock (eh);
-    return NNS_EDGE_ERROR_IO;
+  if (NNS_EDGE_NODE_TYPE_QUERY_CLIENT != eh->node_type) {
+    nns_edge_loge ("Only query client can send the request.");
+    return NNS_EDGE_ERROR_NOT_SUPPORTED;
   }
 
-  if (!eh->send_thread) {
-    nns_edge_loge ("Invalid state, start edge before sending a data.");
-    nns_edge_unlock (eh);
+  if (!eh->is_started) {
+    nns_edge_loge ("Invalid state, start edge before sending a request.");
     return NNS_EDGE_ERROR_IO;
   }
 
-  /* Create new data handle and push it into send-queue. */
+  ret = nns_edge_request_add (eh, &id);
+  if (ret != NNS_EDGE_ERROR_NONE)
+    return ret;
+
   ret = nns_edge_data_copy (data_h, &new_data_h);
-  if (NNS_EDGE_ERROR_NONE != ret) {
-    nns_edge_loge ("Failed to send data, cannot copy data.");
-    nns_edge_unlock (eh);
+  if (ret == NNS_EDGE_ERROR_NONE) {
+    nns_edge_data_set_request (new_data_h, id, -1);
+
+    ret = nns_edge_send_full (eh, new_data_h, NNS_EDGE_SEND_FLAG_TRANSFER);
+    if (ret != NNS_EDGE_ERROR_NONE)
+      nns_edge_data_destroy (new_data_h);
+  }
+
+  if (ret != NNS_EDGE_ERROR_NONE) {
+    nns_edge_loge ("Failed to send the request %llu.", (unsigned long long) id);
+    nns_edge_request_done (eh, id);
     return ret;
   }
 
-  ret = nns_edge_queue_push (eh->send_queue, new_data_h,
-      sizeof (nns_edge_data_h), nns_edge_data_release_handle);
-  if (NNS_EDGE_ERROR_NONE != ret) {
-    nns_edge_loge ("Failed to send data, cannot push data into queue.");
-    nns_edge_data_destroy (new_data_h);
+  if (request_id)
+    *request_id = id;
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Parse the QoS level of MQTT message.
+ */
+static bool
+_nns_edge_parse_mqtt_qos (const char *value, int *qos)
+{
+  char *end = NULL;
+  long level;
+
+  level = strtol (value, &end, 10);
+  if (end == value || *end != '\0' || level < 0L ||
+      level > NNS_EDGE_MQTT_QOS_MAX) {
+    nns_edge_loge ("Cannot set the QoS of MQTT message (%s), it should be 0 to %d.",
+        value, NNS_EDGE_MQTT_QOS_MAX);
+    return false;
   }
 
-  nns_edge_unlock (eh);
-  return ret;
+  *qos = (int) level;
+  return true;
+}
+
+/**
+ * @brief Parse the retain flag of MQTT message.
+ */
+static bool
+_nns_edge_parse_mqtt_retain (const char *value, bool *retain)
+{
+  if (strcasecmp (value, "TRUE") == 0) {
+    *retain = true;
+  } else if (strcasecmp (value, "FALSE") == 0) {
+    *retain = false;
+  } else {
+    nns_edge_loge ("Cannot set the retain flag of MQTT message (%s).", value);
+    return false;
+  }
+
+  return true;
 }
 
 /**
@@ -2015,22 +5413,172 @@ nns_edge_set_info (nns_edge_h edge_h, const char *key, const char *value)
   } else if (0 == strcasecmp (key, "TOPIC")) {
     SAFE_FREE (eh->topic);
     eh->topic = nns_edge_strdup (value);
-  } else if (0 == strcasecmp (key, "ID") || 0 == strcasecmp (key, "CLIENT_ID")) {
+  } else if (0 == strcasecmp (key, "ID") || 0 == strcasecmp (key, "CLIENT_ID") ||
+      0 == strcasecmp (key, "REQUEST_COUNT") ||
+      0 == strcasecmp (key, "STATISTICS") ||
+      0 == strcasecmp (key, "STATISTICS_CONNECTIONS")) {
     /* Not allowed key */
     nns_edge_loge ("Cannot update %s.", key);
     ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
   } else if (0 == strcasecmp (key, "QUEUE_SIZE")) {
     char *s;
-    unsigned int limit;
+    char *v;
+    char *end = NULL;
+    unsigned long limit;
     nns_edge_queue_leak_e leaky = NNS_EDGE_QUEUE_LEAK_NEW;
 
+    s = strstr (value, ":");
+    v = s ? nns_edge_strndup (value, s - value) : nns_edge_strdup (value);
+    limit = strtoul (v, &end, 10);
+
+    if (end == v || *end != '\0' || limit > NNS_EDGE_QUEUE_SIZE_LIMIT) {
+      nns_edge_loge ("Cannot set queue size (%s), max is %u.", value,
+          NNS_EDGE_QUEUE_SIZE_LIMIT);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else if (s) {
+      if (strcasecmp (s + 1, "NEW") == 0) {
+        leaky = NNS_EDGE_QUEUE_LEAK_NEW;
+      } else if (strcasecmp (s + 1, "OLD") == 0) {
+        leaky = NNS_EDGE_QUEUE_LEAK_OLD;
+      } else {
+        nns_edge_loge ("Cannot set queue leaky option (%s).", s + 1);
+        ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+      }
+    }
+    SAFE_FREE (v);
+
+    if (ret == NNS_EDGE_ERROR_NONE) {
+      unsigned int len = 0U, capacity = 0U;
+      nns_edge_queue_h queue_h;
+
+      /**
+       * Replace the send queue with the ring buffer of given size if the send thread is not started yet.
+       * Then the queue does not allocate memory when pushing data.
+       */
+      nns_edge_queue_get_length (eh->send_queue, &len);
+      if (!eh->send_thread && len == 0U) {
+        ret = nns_edge_queue_create_full (&queue_h, (unsigned int) limit);
+        if (ret == NNS_EDGE_ERROR_NONE) {
+          nns_edge_queue_destroy (eh->send_queue);
+          eh->send_queue = queue_h;
+        }
+      } else {
+        /* The ring buffer is not reallocated while sending data, new size cannot exceed its capacity. */
+        nns_edge_queue_get_capacity (eh->send_queue, &capacity);
+        if (capacity > 0U && (limit == 0U || limit > capacity)) {
+          nns_edge_loge ("Cannot set queue size (%s) after starting the edge handle, max is %u.",
+              value, capacity);
+          ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+        }
+      }
+
+      if (ret == NNS_EDGE_ERROR_NONE)
+        ret = nns_edge_queue_set_limit (eh->send_queue, (unsigned int) limit,
+            leaky);
+    }
+  } else if (0 == strcasecmp (key, "IO_MODE")) {
+    char *s;
+    char *mode;
+    unsigned int workers = N_REACTOR_WORKERS;
+
     s = strstr (value, ":");
     if (s) {
-      char *v = nns_edge_strndup (value, s - value);
+      mode = nns_edge_strndup (value, s - value);
+      workers = (unsigned int) strtoul (s + 1, NULL, 10);
+    } else {
+      mode = nns_edge_strdup (value);
+    }
+
+    if (eh->is_started) {
+      nns_edge_loge ("Cannot change I/O mode, the edge handle is started.");
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else if (strcasecmp (mode, "THREAD") == 0) {
+      eh->io_mode = NNS_EDGE_IO_MODE_THREAD;
+    } else if (strcasecmp (mode, "REACTOR") == 0 && workers > 0U) {
+      eh->io_mode = NNS_EDGE_IO_MODE_REACTOR;
+      eh->io_workers = workers;
+    } else {
+      nns_edge_loge ("Cannot set I/O mode (%s).", value);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    }
+
+    SAFE_FREE (mode);
+  } else if (0 == strcasecmp (key, "POOL_SIZE")) {
+    char *end = NULL;
+    unsigned long limit;
+
+    limit = strtoul (value, &end, 10);
+    if (end == value || *end != '\0' || limit > UINT_MAX) {
+      nns_edge_loge ("Cannot set buffer pool size (%s).", value);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else {
+      ret = nns_edge_pool_set_limit (eh->pool, (unsigned int) limit);
+    }
+  } else if (0 == strcasecmp (key, "CONN_QUEUE_SIZE")) {
+    char *s;
+    char *v;
+    char *end = NULL;
+    unsigned long limit;
+    nns_edge_queue_leak_e leaky = NNS_EDGE_QUEUE_LEAK_OLD;
+
+    s = strstr (value, ":");
+    v = s ? nns_edge_strndup (value, s - value) : nns_edge_strdup (value);
+    limit = strtoul (v, &end, 10);
+
+    if (end == v || *end != '\0' || limit > UINT_MAX) {
+      nns_edge_loge ("Cannot set queue size of the connection (%s).", value);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else if (s) {
+      if (strcasecmp (s + 1, "NEW") == 0) {
+        leaky = NNS_EDGE_QUEUE_LEAK_NEW;
+      } else if (strcasecmp (s + 1, "OLD") == 0) {
+        leaky = NNS_EDGE_QUEUE_LEAK_OLD;
+      } else {
+        nns_edge_loge ("Cannot set queue leaky option (%s).", s + 1);
+        ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+      }
+    }
+    SAFE_FREE (v);
+
+    if (ret == NNS_EDGE_ERROR_NONE) {
+      eh->fanout_limit = (unsigned int) limit;
+      eh->fanout_leaky = leaky;
+    }
+  } else if (0 == strcasecmp (key, "DISPATCH_THREADS")) {
+    char *end = NULL;
+    unsigned long threads;
+
+    threads = strtoul (value, &end, 10);
+    if (eh->is_started) {
+      nns_edge_loge ("Cannot change the number of dispatch workers, the edge handle is started.");
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else if (end == value || *end != '\0' ||
+        threads > NNS_EDGE_DISPATCH_THREADS_LIMIT) {
+      nns_edge_loge ("Cannot set the number of dispatch workers (%s), max is %u.",
+          value, NNS_EDGE_DISPATCH_THREADS_LIMIT);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else {
+      eh->dispatch.threads = (unsigned int) threads;
+    }
+  } else if (0 == strcasecmp (key, "DISPATCH_QUEUE_SIZE")) {
+    char *s;
+    char *v;
+    char *end = NULL;
+    unsigned long limit;
+    nns_edge_queue_leak_e leaky = NNS_EDGE_QUEUE_LEAK_OLD;
 
-      limit = (unsigned int) strtoull (v, NULL, 10);
-      SAFE_FREE (v);
+    s = strstr (value, ":");
+    v = s ? nns_edge_strndup (value, s - value) : nns_edge_strdup (value);
+    limit = strtoul (v, &end, 10);
 
+    if (eh->is_started) {
+      nns_edge_loge ("Cannot change the queue size of dispatch workers, the edge handle is started.");
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else if (end == v || *end != '\0' || limit > UINT_MAX) {
+      nns_edge_loge ("Cannot set the queue size of dispatch workers (%s).",
+          value);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else if (s) {
       if (strcasecmp (s + 1, "NEW") == 0) {
         leaky = NNS_EDGE_QUEUE_LEAK_NEW;
       } else if (strcasecmp (s + 1, "OLD") == 0) {
@@ -2039,12 +5587,366 @@ nns_edge_set_info (nns_edge_h edge_h, const char *key, const char *value)
         nns_edge_loge ("Cannot set queue leaky option (%s).", s + 1);
         ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
       }
+    }
+    SAFE_FREE (v);
+
+    if (ret == NNS_EDGE_ERROR_NONE) {
+      eh->dispatch.limit = (unsigned int) limit;
+      eh->dispatch.leaky = leaky;
+    }
+  } else if (0 == strcasecmp (key, "BATCH_COUNT")) {
+    char *end = NULL;
+    unsigned long count;
+
+    count = strtoul (value, &end, 10);
+    if (eh->is_started) {
+      nns_edge_loge ("Cannot change max count of the batch, the edge handle is started.");
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else if (end == value || *end != '\0' || count > NNS_EDGE_BATCH_LIMIT) {
+      nns_edge_loge ("Cannot set max count of the batch (%s), max is %u.",
+          value, NNS_EDGE_BATCH_LIMIT);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
     } else {
-      limit = (unsigned int) strtoull (value, NULL, 10);
+      eh->batch_count = (unsigned int) count;
     }
+  } else if (0 == strcasecmp (key, "BATCH_BYTES")) {
+    char *end = NULL;
+    unsigned long long bytes;
 
-    if (ret == NNS_EDGE_ERROR_NONE)
-      nns_edge_queue_set_limit (eh->send_queue, limit, leaky);
+    bytes = strtoull (value, &end, 10);
+    if (end == value || *end != '\0' || value[0] == '-') {
+      nns_edge_loge ("Cannot set max bytes of the batch (%s).", value);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else {
+      eh->batch_bytes = (nns_size_t) bytes;
+    }
+  } else if (0 == strcasecmp (key, "BATCH_DELAY")) {
+    char *end = NULL;
+    unsigned long delay;
+
+    delay = strtoul (value, &end, 10);
+    if (end == value || *end != '\0' || value[0] == '-' || delay > UINT_MAX) {
+      nns_edge_loge ("Cannot set max delay of the batch (%s).", value);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else {
+      eh->batch_delay = (unsigned int) delay;
+    }
+  } else if (0 == strcasecmp (key, "BATCH_EVENT")) {
+    if (strcasecmp (value, "SPLIT") == 0) {
+      eh->batch_event = false;
+    } else if (strcasecmp (value, "BATCH") == 0) {
+      eh->batch_event = true;
+    } else {
+      nns_edge_loge ("Cannot set the event of the batch (%s).", value);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    }
+  } else if (0 == strcasecmp (key, "REQUEST_WINDOW")) {
+    char *end = NULL;
+    unsigned long window;
+
+    window = strtoul (value, &end, 10);
+    if (eh->is_started) {
+      nns_edge_loge ("Cannot change the window of requests, the edge handle is started.");
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else if (end == value || *end != '\0' || window == 0UL ||
+        window > NNS_EDGE_REQUEST_WINDOW_LIMIT) {
+      nns_edge_loge ("Cannot set the window of requests (%s), max is %u.",
+          value, NNS_EDGE_REQUEST_WINDOW_LIMIT);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else {
+      /* The requests are allocated with new window when sending next request. */
+      nns_edge_lock (&eh->requests);
+      SAFE_FREE (eh->requests.slots);
+      eh->requests.window = (unsigned int) window;
+      eh->requests.count = 0U;
+      nns_edge_unlock (&eh->requests);
+    }
+  } else if (0 == strcasecmp (key, "FLOW_CREDITS")) {
+    char *end = NULL;
+    unsigned long credits;
+
+    credits = strtoul (value, &end, 10);
+    if (eh->is_started) {
+      nns_edge_loge ("Cannot change the credits of flow control, the edge handle is started.");
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else if (end == value || *end != '\0' ||
+        credits > NNS_EDGE_FLOW_CREDITS_LIMIT) {
+      nns_edge_loge ("Cannot set the credits of flow control (%s), max is %u.",
+          value, NNS_EDGE_FLOW_CREDITS_LIMIT);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else {
+      eh->flow_credits = (unsigned int) credits;
+    }
+  } else if (0 == strcasecmp (key, "FLOW_CONTROL")) {
+    if (strcasecmp (value, "DROP") == 0) {
+      eh->flow_policy = NNS_EDGE_FLOW_DROP;
+    } else if (strcasecmp (value, "COALESCE") == 0) {
+      eh->flow_policy = NNS_EDGE_FLOW_COALESCE;
+    } else {
+      nns_edge_loge ("Cannot set the policy of flow control (%s).", value);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    }
+  } else if (0 == strcasecmp (key, "CONFLATE")) {
+    if (eh->is_started) {
+      nns_edge_loge ("Cannot change the conflation mode, the edge handle is started.");
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else if (strcasecmp (value, "TRUE") == 0) {
+      eh->conflate = true;
+    } else if (strcasecmp (value, "FALSE") == 0) {
+      eh->conflate = false;
+    } else {
+      nns_edge_loge ("Cannot set the conflation mode (%s).", value);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    }
+  } else if (0 == strcasecmp (key, "LOAD_BALANCE")) {
+    if (eh->is_started) {
+      nns_edge_loge ("Cannot change the policy of load balancing, the edge handle is started.");
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else if (strcasecmp (value, "NONE") == 0) {
+      eh->balance = NNS_EDGE_BALANCE_NONE;
+    } else if (strcasecmp (value, "ROUND_ROBIN") == 0) {
+      eh->balance = NNS_EDGE_BALANCE_ROUND_ROBIN;
+    } else if (strcasecmp (value, "LEAST_OUTSTANDING") == 0) {
+      eh->balance = NNS_EDGE_BALANCE_LEAST_OUTSTANDING;
+    } else if (strcasecmp (value, "LOWEST_LATENCY") == 0) {
+      eh->balance = NNS_EDGE_BALANCE_LOWEST_LATENCY;
+    } else {
+      nns_edge_loge ("Cannot set the policy of load balancing (%s).", value);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    }
+  } else if (0 == strcasecmp (key, "SERVER_COUNT")) {
+    char *end = NULL;
+    unsigned long count;
+
+    count = strtoul (value, &end, 10);
+    if (end == value || *end != '\0' || count == 0UL ||
+        count > NNS_EDGE_SERVER_COUNT_LIMIT) {
+      nns_edge_loge ("Cannot set the number of servers (%s), max is %u.",
+          value, NNS_EDGE_SERVER_COUNT_LIMIT);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else {
+      eh->server_count = (unsigned int) count;
+    }
+  } else if (0 == strcasecmp (key, "LOAD")) {
+    char *end = NULL;
+    unsigned long load;
+
+    load = strtoul (value, &end, 10);
+    if (end == value || *end != '\0' || value[0] == '-' || load > UINT_MAX) {
+      nns_edge_loge ("Cannot set the load of the server (%s).", value);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else {
+      eh->load = (unsigned int) load;
+
+      /* Update the message of the server, new client gets the load. */
+      if (eh->is_started && eh->broker_h &&
+          NNS_EDGE_CONNECT_TYPE_HYBRID == eh->connect_type &&
+          NNS_EDGE_NODE_TYPE_QUERY_SERVER == eh->node_type) {
+        ret = _nns_edge_hybrid_publish_host (eh);
+        if (NNS_EDGE_ERROR_NONE != ret)
+          nns_edge_loge ("Failed to publish the load to broker.");
+      }
+    }
+  } else if (0 == strcasecmp (key, "REQUEST_TIMEOUT")) {
+    char *end = NULL;
+    unsigned long timeout;
+
+    timeout = strtoul (value, &end, 10);
+    if (end == value || *end != '\0' || value[0] == '-' ||
+        timeout > UINT_MAX) {
+      nns_edge_loge ("Cannot set the timeout of requests (%s).", value);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else {
+      nns_edge_lock (&eh->requests);
+      eh->requests.timeout = (unsigned int) timeout;
+      nns_edge_unlock (&eh->requests);
+    }
+  } else if (0 == strcasecmp (key, "SHM_SIZE")) {
+    char *end = NULL;
+    unsigned long long size;
+
+    size = strtoull (value, &end, 10);
+    if (end == value || *end != '\0' || size > UINT32_MAX) {
+      nns_edge_loge ("Cannot set the size of shared memory (%s).", value);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else if (size > 0 && !(NNS_EDGE_FEATURE_ALL & NNS_EDGE_FEATURE_SHM)) {
+      nns_edge_loge ("Shared memory transport is not supported.");
+      ret = NNS_EDGE_ERROR_NOT_SUPPORTED;
+    } else {
+      eh->shm_size = (nns_size_t) size;
+    }
+  } else if (0 == strcasecmp (key, "CONNECTION_MODE")) {
+    if (eh->is_started) {
+      nns_edge_loge ("Cannot change connection mode, the edge handle is started.");
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else if (strcasecmp (value, "PAIR") == 0) {
+      eh->conn_mode = NNS_EDGE_CONN_MODE_PAIR;
+    } else if (strcasecmp (value, "DUPLEX") == 0) {
+      eh->conn_mode = NNS_EDGE_CONN_MODE_DUPLEX;
+    } else {
+      nns_edge_loge ("Cannot set connection mode (%s).", value);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    }
+  } else if (0 == strcasecmp (key, "HANDSHAKE_WORKERS")) {
+    char *end = NULL;
+    unsigned long workers;
+
+    workers = strtoul (value, &end, 10);
+    if (eh->is_started || eh->handshake_threads) {
+      nns_edge_loge ("Cannot change handshake workers, the edge handle is started.");
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else if (end == value || *end != '\0' || workers == 0UL ||
+        workers > UINT_MAX) {
+      nns_edge_loge ("Cannot set the number of handshake workers (%s).", value);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else {
+      eh->handshake_workers = (unsigned int) workers;
+    }
+  } else if (0 == strcasecmp (key, "HANDSHAKE_TIMEOUT")) {
+    char *end = NULL;
+    unsigned long timeout;
+
+    timeout = strtoul (value, &end, 10);
+    if (end == value || *end != '\0' || timeout > UINT_MAX) {
+      nns_edge_loge ("Cannot set handshake timeout (%s).", value);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else {
+      eh->handshake_timeout = (unsigned int) timeout;
+    }
+  } else if (0 == strcasecmp (key, "DATA_HEADER")) {
+    if (strcasecmp (value, "AUTO") == 0) {
+      eh->header_mode = NNS_EDGE_HEADER_MODE_AUTO;
+    } else if (strcasecmp (value, "COMPACT") == 0) {
+      eh->header_mode = NNS_EDGE_HEADER_MODE_COMPACT;
+    } else if (strcasecmp (value, "LEGACY") == 0) {
+      eh->header_mode = NNS_EDGE_HEADER_MODE_LEGACY;
+    } else {
+      nns_edge_loge ("Cannot set data header format (%s).", value);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    }
+  } else if (0 == strcasecmp (key, "MQTT_QOS")) {
+    if (!_nns_edge_parse_mqtt_qos (value, &eh->mqtt_qos))
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+  } else if (0 == strcasecmp (key, "MQTT_RETAIN")) {
+    if (!_nns_edge_parse_mqtt_retain (value, &eh->mqtt_retain))
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+  } else if (0 == strcasecmp (key, "MQTT_HOST_QOS")) {
+    if (!_nns_edge_parse_mqtt_qos (value, &eh->mqtt_host_qos))
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+  } else if (0 == strcasecmp (key, "MQTT_HOST_RETAIN")) {
+    if (!_nns_edge_parse_mqtt_retain (value, &eh->mqtt_host_retain))
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+  } else if (0 == strcasecmp (key, "COMPRESSION")) {
+    nns_edge_compress_e compress = nns_edge_compress_parse (value);
+
+    if (NNS_EDGE_COMPRESS_UNKNOWN == compress) {
+      nns_edge_loge ("Cannot set the compression (%s).", value);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else if (NNS_EDGE_COMPRESS_NONE != compress &&
+        !nns_edge_compress_is_supported (compress)) {
+      nns_edge_loge ("The compression (%s) is not supported.", value);
+      ret = NNS_EDGE_ERROR_NOT_SUPPORTED;
+    } else {
+      eh->compress = compress;
+    }
+  } else if (0 == strcasecmp (key, "COMPRESSION_THRESHOLD")) {
+    char *end = NULL;
+    unsigned long long size;
+
+    size = strtoull (value, &end, 10);
+    if (end == value || *end != '\0' || value[0] == '-' ||
+        size > UINT32_MAX) {
+      nns_edge_loge ("Cannot set the threshold of compression (%s).", value);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else {
+      eh->compress_threshold = (nns_size_t) size;
+    }
+  } else if (0 == strcasecmp (key, "CHUNK_SIZE")) {
+    char *end = NULL;
+    unsigned long long size;
+
+    size = strtoull (value, &end, 10);
+    if (eh->is_started) {
+      nns_edge_loge ("Cannot change the chunk size, the edge handle is started.");
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else if (end == value || *end != '\0' || value[0] == '-' ||
+        size > UINT32_MAX || (size > 0U && size < NNS_EDGE_CHUNK_SIZE_MIN)) {
+      nns_edge_loge ("Cannot set the chunk size (%s), it should be 0 or %u bytes or more.",
+          value, NNS_EDGE_CHUNK_SIZE_MIN);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else {
+      eh->chunk_size = (nns_size_t) size;
+    }
+  } else if (0 == strcasecmp (key, "CHUNK_EVENT")) {
+    if (eh->is_started) {
+      nns_edge_loge ("Cannot change the chunk event, the edge handle is started.");
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else if (strcasecmp (value, "TRUE") == 0) {
+      eh->chunk_event = true;
+    } else if (strcasecmp (value, "FALSE") == 0) {
+      eh->chunk_event = false;
+    } else {
+      nns_edge_loge ("Cannot set the chunk event (%s).", value);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    }
+  } else if (0 == strcasecmp (key, "CAPABILITY_CACHE")) {
+    nns_edge_lock (&eh->servers);
+    if (strcasecmp (value, "TRUE") == 0) {
+      eh->servers.caps_cache = true;
+    } else if (strcasecmp (value, "FALSE") == 0) {
+      eh->servers.caps_cache = false;
+    } else {
+      nns_edge_loge ("Cannot set the capability cache (%s).", value);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    }
+    nns_edge_unlock (&eh->servers);
+  } else if (0 == strcasecmp (key, "CONNECT_PARALLEL")) {
+    char *end = NULL;
+    unsigned long num;
+
+    num = strtoul (value, &end, 10);
+    if (end == value || *end != '\0' || value[0] == '-' || num == 0U ||
+        num > NNS_EDGE_CONNECT_PARALLEL_LIMIT) {
+      nns_edge_loge ("Cannot set the number of parallel connections (%s), it should be 1 ~ %u.",
+          value, NNS_EDGE_CONNECT_PARALLEL_LIMIT);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else {
+      eh->connect_parallel = (unsigned int) num;
+    }
+  } else if (0 == strcasecmp (key, "STANDBY")) {
+    if (eh->is_started) {
+      nns_edge_loge ("Cannot change the standby connection, the edge handle is started.");
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else if (strcasecmp (value, "TRUE") == 0) {
+      eh->standby = true;
+    } else if (strcasecmp (value, "FALSE") == 0) {
+      eh->standby = false;
+    } else {
+      nns_edge_loge ("Cannot set the standby connection (%s).", value);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    }
+  } else if (0 == strcasecmp (key, "STATISTICS_TIMING")) {
+    if (strcasecmp (value, "TRUE") == 0) {
+      __atomic_store_n (&eh->stats.timing, true, __ATOMIC_RELAXED);
+    } else if (strcasecmp (value, "FALSE") == 0) {
+      __atomic_store_n (&eh->stats.timing, false, __ATOMIC_RELAXED);
+    } else {
+      nns_edge_loge ("Cannot set the timing of statistics (%s).", value);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    }
+  } else if (0 == strcasecmp (key, "STATISTICS_INTERVAL")) {
+    char *end = NULL;
+    unsigned long interval;
+
+    interval = strtoul (value, &end, 10);
+    if (end == value || *end != '\0' || value[0] == '-' ||
+        interval > UINT_MAX) {
+      nns_edge_loge ("Cannot set the interval of statistics event (%s).",
+          value);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else {
+      ret = _nns_edge_stats_set_interval (eh, (unsigned int) interval);
+    }
   } else {
     ret = nns_edge_metadata_set (eh->metadata, key, value);
   }
@@ -2120,6 +6022,115 @@ nns_edge_get_info (nns_edge_h edge_h, const char *key, char **value)
     } else {
       *value = nns_edge_strdup_printf ("%lld", (long long) eh->client_id);
     }
+  } else if (0 == strcasecmp (key, "IO_MODE")) {
+    if (NNS_EDGE_IO_MODE_REACTOR == eh->io_mode)
+      *value = nns_edge_strdup_printf ("REACTOR:%u", eh->io_workers);
+    else
+      *value = nns_edge_strdup ("THREAD");
+  } else if (0 == strcasecmp (key, "POOL_SIZE")) {
+    *value = nns_edge_strdup_printf ("%u", nns_edge_pool_get_limit (eh->pool));
+  } else if (0 == strcasecmp (key, "CONN_QUEUE_SIZE")) {
+    *value = nns_edge_strdup_printf ("%u:%s", eh->fanout_limit,
+        (NNS_EDGE_QUEUE_LEAK_NEW == eh->fanout_leaky) ? "NEW" : "OLD");
+  } else if (0 == strcasecmp (key, "DISPATCH_THREADS")) {
+    *value = nns_edge_strdup_printf ("%u", eh->dispatch.threads);
+  } else if (0 == strcasecmp (key, "DISPATCH_QUEUE_SIZE")) {
+    *value = nns_edge_strdup_printf ("%u:%s", eh->dispatch.limit,
+        (NNS_EDGE_QUEUE_LEAK_NEW == eh->dispatch.leaky) ? "NEW" : "OLD");
+  } else if (0 == strcasecmp (key, "BATCH_COUNT")) {
+    *value = nns_edge_strdup_printf ("%u", eh->batch_count);
+  } else if (0 == strcasecmp (key, "BATCH_BYTES")) {
+    *value = nns_edge_strdup_printf ("%llu",
+        (unsigned long long) eh->batch_bytes);
+  } else if (0 == strcasecmp (key, "BATCH_DELAY")) {
+    *value = nns_edge_strdup_printf ("%u", eh->batch_delay);
+  } else if (0 == strcasecmp (key, "BATCH_EVENT")) {
+    *value = nns_edge_strdup (eh->batch_event ? "BATCH" : "SPLIT");
+  } else if (0 == strcasecmp (key, "REQUEST_WINDOW")) {
+    *value = nns_edge_strdup_printf ("%u", eh->requests.window);
+  } else if (0 == strcasecmp (key, "REQUEST_TIMEOUT")) {
+    *value = nns_edge_strdup_printf ("%u", eh->requests.timeout);
+  } else if (0 == strcasecmp (key, "FLOW_CREDITS")) {
+    *value = nns_edge_strdup_printf ("%u", eh->flow_credits);
+  } else if (0 == strcasecmp (key, "FLOW_CONTROL")) {
+    *value = nns_edge_strdup ((NNS_EDGE_FLOW_COALESCE == eh->flow_policy) ?
+        "COALESCE" : "DROP");
+  } else if (0 == strcasecmp (key, "CONFLATE")) {
+    *value = nns_edge_strdup (eh->conflate ? "TRUE" : "FALSE");
+  } else if (0 == strcasecmp (key, "LOAD_BALANCE")) {
+    switch (eh->balance) {
+      case NNS_EDGE_BALANCE_ROUND_ROBIN:
+        *value = nns_edge_strdup ("ROUND_ROBIN");
+        break;
+      case NNS_EDGE_BALANCE_LEAST_OUTSTANDING:
+        *value = nns_edge_strdup ("LEAST_OUTSTANDING");
+        break;
+      case NNS_EDGE_BALANCE_LOWEST_LATENCY:
+        *value = nns_edge_strdup ("LOWEST_LATENCY");
+        break;
+      default:
+        *value = nns_edge_strdup ("NONE");
+        break;
+    }
+  } else if (0 == strcasecmp (key, "SERVER_COUNT")) {
+    *value = nns_edge_strdup_printf ("%u", eh->server_count);
+  } else if (0 == strcasecmp (key, "LOAD")) {
+    *value = nns_edge_strdup_printf ("%u", eh->load);
+  } else if (0 == strcasecmp (key, "REQUEST_COUNT")) {
+    nns_edge_lock (&eh->requests);
+    *value = nns_edge_strdup_printf ("%u", eh->requests.count);
+    nns_edge_unlock (&eh->requests);
+  } else if (0 == strcasecmp (key, "SHM_SIZE")) {
+    *value = nns_edge_strdup_printf ("%llu", (unsigned long long) eh->shm_size);
+  } else if (0 == strcasecmp (key, "CONNECTION_MODE")) {
+    if (NNS_EDGE_CONN_MODE_DUPLEX == eh->conn_mode)
+      *value = nns_edge_strdup ("DUPLEX");
+    else
+      *value = nns_edge_strdup ("PAIR");
+  } else if (0 == strcasecmp (key, "HANDSHAKE_WORKERS")) {
+    *value = nns_edge_strdup_printf ("%u", eh->handshake_workers);
+  } else if (0 == strcasecmp (key, "HANDSHAKE_TIMEOUT")) {
+    *value = nns_edge_strdup_printf ("%u", eh->handshake_timeout);
+  } else if (0 == strcasecmp (key, "DATA_HEADER")) {
+    if (NNS_EDGE_HEADER_MODE_COMPACT == eh->header_mode)
+      *value = nns_edge_strdup ("COMPACT");
+    else if (NNS_EDGE_HEADER_MODE_LEGACY == eh->header_mode)
+      *value = nns_edge_strdup ("LEGACY");
+    else
+      *value = nns_edge_strdup ("AUTO");
+  } else if (0 == strcasecmp (key, "MQTT_QOS")) {
+    *value = nns_edge_strdup_printf ("%d", eh->mqtt_qos);
+  } else if (0 == strcasecmp (key, "MQTT_RETAIN")) {
+    *value = nns_edge_strdup (eh->mqtt_retain ? "TRUE" : "FALSE");
+  } else if (0 == strcasecmp (key, "MQTT_HOST_QOS")) {
+    *value = nns_edge_strdup_printf ("%d", eh->mqtt_host_qos);
+  } else if (0 == strcasecmp (key, "MQTT_HOST_RETAIN")) {
+    *value = nns_edge_strdup (eh->mqtt_host_retain ? "TRUE" : "FALSE");
+  } else if (0 == strcasecmp (key, "COMPRESSION")) {
+    *value = nns_edge_strdup (nns_edge_compress_get_name (eh->compress));
+  } else if (0 == strcasecmp (key, "COMPRESSION_THRESHOLD")) {
+    *value = nns_edge_strdup_printf ("%llu",
+        (unsigned long long) eh->compress_threshold);
+  } else if (0 == strcasecmp (key, "CHUNK_SIZE")) {
+    *value = nns_edge_strdup_printf ("%llu", (unsigned long long) eh->chunk_size);
+  } else if (0 == strcasecmp (key, "CHUNK_EVENT")) {
+    *value = nns_edge_strdup (eh->chunk_event ? "TRUE" : "FALSE");
+  } else if (0 == strcasecmp (key, "CAPABILITY_CACHE")) {
+    *value = nns_edge_strdup (eh->servers.caps_cache ? "TRUE" : "FALSE");
+  } else if (0 == strcasecmp (key, "CONNECT_PARALLEL")) {
+    *value = nns_edge_strdup_printf ("%u", eh->connect_parallel);
+  } else if (0 == strcasecmp (key, "STANDBY")) {
+    *value = nns_edge_strdup (eh->standby ? "TRUE" : "FALSE");
+  } else if (0 == strcasecmp (key, "STATISTICS")) {
+    *value = _nns_edge_stats_get_string (eh);
+  } else if (0 == strcasecmp (key, "STATISTICS_CONNECTIONS")) {
+    *value = _nns_edge_stats_get_connections (eh);
+  } else if (0 == strcasecmp (key, "STATISTICS_TIMING")) {
+    *value = nns_edge_strdup (eh->stats.timing ? "TRUE" : "FALSE");
+  } else if (0 == strcasecmp (key, "STATISTICS_INTERVAL")) {
+    nns_edge_lock (&eh->stats_timer);
+    *value = nns_edge_strdup_printf ("%u", eh->stats_timer.interval);
+    nns_edge_unlock (&eh->stats_timer);
   } else {
     ret = nns_edge_metadata_get (eh->metadata, key, value);
   }
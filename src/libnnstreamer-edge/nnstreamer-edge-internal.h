@@ -0,0 +1,751 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   nnstreamer-edge-internal.h
+ * @date   14 October 2026
+ * @brief  Internal data structures of edge handle and connections, shared with the modules of each feature.
+ * @see    https://github.com/nnstreamer/nnstreamer-edge
+ * @author agent <agent@local>
+ * @note   This file is internal header for nnstreamer-edge. DO NOT export this file.
+ * @bug    No known bugs except for NYI items
+ */
+
+#ifndef __NNSTREAMER_EDGE_INTERNAL_H__
+#define __NNSTREAMER_EDGE_INTERNAL_H__
+
+#include <assert.h>
+#include "nnstreamer-edge.h"
+#include "nnstreamer-edge-event.h"
+#include "nnstreamer-edge-util.h"
+#include "nnstreamer-edge-queue.h"
+#include "nnstreamer-edge-metadata.h"
+#include "nnstreamer-edge-pool.h"
+#include "nnstreamer-edge-custom-impl.h"
+#include "nnstreamer-edge-reactor.h"
+#include "nnstreamer-edge-shm.h"
+#include "nnstreamer-edge-compress.h"
+#include "nnstreamer-edge-stats.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @brief Lock the connections of edge handle.
+ * The threads sending data, the message threads and the dispatch workers hold the read lock while using the connection data and its connections.
+ * The threads adding or removing the connection data (handshake workers, connection lost and release) hold the write lock.
+ * @note Do not close the connection with the lock. Closing the connection joins its threads, which may wait for the lock. Remove the connection data from the table, then release it after unlocking.
+ */
+#define nns_edge_conn_rdlock(eh) do { pthread_rwlock_rdlock (&(eh)->conn_lock); } while (0)
+#define nns_edge_conn_wrlock(eh) do { \
+    pthread_rwlock_wrlock (&(eh)->conn_lock); \
+    (eh)->conn_writer = pthread_self (); \
+  } while (0)
+#define nns_edge_conn_unlock(eh) do { \
+    if (pthread_equal ((eh)->conn_writer, pthread_self ())) \
+      (eh)->conn_writer = (pthread_t) 0; \
+    pthread_rwlock_unlock (&(eh)->conn_lock); \
+  } while (0)
+
+/**
+ * @brief Check the lock of the connections in debug mode. The functions accessing the connection table should be called with the lock.
+ */
+#if DEBUG
+#define nns_edge_conn_check_rdlock(eh) assert (pthread_rwlock_trywrlock (&(eh)->conn_lock) != 0)
+#define nns_edge_conn_check_wrlock(eh) assert (pthread_equal ((eh)->conn_writer, pthread_self ()))
+#else
+#define nns_edge_conn_check_rdlock(eh) do { } while (0)
+#define nns_edge_conn_check_wrlock(eh) do { } while (0)
+#endif
+
+/**
+ * @brief The max number of edge data in one batch.
+ */
+#define NNS_EDGE_BATCH_LIMIT 64U
+
+/**
+ * @brief Align the size of each part in the batch with 8 bytes.
+ */
+#define NNS_EDGE_BATCH_ALIGN_SIZE(s) (((s) + 7U) & ~((nns_size_t) 7U))
+
+/**
+ * @brief The default and max number of in-flight requests of query client.
+ */
+#define NNS_EDGE_REQUEST_WINDOW 64U
+#define NNS_EDGE_REQUEST_WINDOW_LIMIT 4096U
+
+/**
+ * @brief The default timeout in milliseconds to wait for the response of the request.
+ */
+#define NNS_EDGE_REQUEST_TIMEOUT 10000U
+
+/**
+ * @brief The max number of servers which query client connects to for load balancing.
+ */
+#define NNS_EDGE_SERVER_COUNT_LIMIT 64U
+
+/**
+ * @brief The number of in-flight requests of each server, to estimate the round-trip time.
+ */
+#define NNS_EDGE_BALANCE_PENDING 64U
+
+/**
+ * @brief The max number of credits which the receiver grants to the sender.
+ */
+#define NNS_EDGE_FLOW_CREDITS_LIMIT 65535U
+
+/**
+ * @brief The time in milliseconds to wait for the announcement of other servers in hybrid connection.
+ */
+#define NNS_EDGE_HYBRID_DISCOVERY_WAIT 200U
+
+/**
+ * @brief The min size of the chunk, and the max number of edge data sent in chunks concurrently to a connection.
+ */
+#define NNS_EDGE_CHUNK_SIZE_MIN 1024U
+#define NNS_EDGE_CHUNK_TRANSFERS 8U
+
+/**
+ * @brief The max number of servers known to the query client, and the max number of servers to connect in parallel.
+ */
+#define NNS_EDGE_SERVER_CACHE_LIMIT 16U
+#define NNS_EDGE_CONNECT_PARALLEL_LIMIT 8U
+
+/**
+ * @brief The min and max time in milliseconds to wait before connecting to the server again after the connection failures.
+ */
+#define NNS_EDGE_SERVER_BACKOFF_MIN 100U
+#define NNS_EDGE_SERVER_BACKOFF_MAX 5000U
+
+/**
+ * @brief enum for I/O mode to handle the connections.
+ */
+typedef enum
+{
+  NNS_EDGE_IO_MODE_THREAD = 0, /**< Each connection has its own message thread. */
+  NNS_EDGE_IO_MODE_REACTOR /**< One event thread watches all sockets and dispatches ready sockets to the worker pool. */
+} nns_edge_io_mode_e;
+
+/**
+ * @brief enum for the header format of the command and serialized data.
+ */
+typedef enum
+{
+  NNS_EDGE_HEADER_MODE_AUTO = 0, /**< Compact header if the connected node supports it. MQTT uses legacy header for old subscribers. */
+  NNS_EDGE_HEADER_MODE_COMPACT, /**< Same as AUTO in TCP connection, MQTT also uses compact header. */
+  NNS_EDGE_HEADER_MODE_LEGACY /**< Always use legacy header with fixed size. */
+} nns_edge_header_mode_e;
+
+/**
+ * @brief enum for the connection mode of query client.
+ */
+typedef enum
+{
+  NNS_EDGE_CONN_MODE_PAIR = 0, /**< The server connects to the listener of query client, requests and results are transferred with two sockets. */
+  NNS_EDGE_CONN_MODE_DUPLEX /**< Requests and results share one socket, query client does not need the listener. */
+} nns_edge_conn_mode_e;
+
+/**
+ * @brief enum for the policy of query client to select the server.
+ */
+typedef enum
+{
+  NNS_EDGE_BALANCE_NONE = 0, /**< Send data to the connection of the client ID in data, or all connections. */
+  NNS_EDGE_BALANCE_ROUND_ROBIN, /**< Send data to each server in turn. */
+  NNS_EDGE_BALANCE_LEAST_OUTSTANDING, /**< Send data to the server which has the least in-flight requests and advertised load. */
+  NNS_EDGE_BALANCE_LOWEST_LATENCY /**< Send data to the server which has the lowest round-trip time. */
+} nns_edge_balance_e;
+
+/**
+ * @brief enum for the policy of the sender when the receiver does not grant the credits.
+ */
+typedef enum
+{
+  NNS_EDGE_FLOW_DROP = 0, /**< Drop new data until the receiver grants new credits. */
+  NNS_EDGE_FLOW_COALESCE /**< Keep the latest data and send it when the receiver grants new credits. */
+} nns_edge_flow_e;
+
+/**
+ * @brief Structure for the request of query client, waiting for the response.
+ */
+typedef struct
+{
+  uint64_t id; /**< request ID, 0 means the slot is empty */
+  int64_t time; /**< monotonic time in microseconds when sending the request */
+  int64_t client_id; /**< client ID of the connection which the request is sent to, 0 if it is not sent yet */
+} nns_edge_request_s;
+
+/**
+ * @brief Structure for the in-flight requests of query client.
+ */
+typedef struct
+{
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
+  unsigned int window; /**< max number of in-flight requests */
+  unsigned int timeout; /**< timeout in milliseconds to wait for the response (0 means no timeout) */
+  unsigned int count;
+  unsigned int waiting; /**< the number of threads waiting for the window */
+  bool stopped; /**< the edge handle is stopped, the threads do not wait for the window */
+  uint64_t last_id;
+  nns_edge_request_s *slots; /**< array of the requests, allocated with window size when sending first request */
+} nns_edge_request_window_s;
+
+/**
+ * @brief Data structure for the server known to the query client, found from the broker or connected before.
+ */
+typedef struct
+{
+  char *host;
+  int port;
+  unsigned int load; /**< load advertised by the server */
+  void *caps; /**< capability accepted by the event callback, null if not cached */
+  nns_size_t caps_len;
+  uint64_t version; /**< version key of the server which sends the cached capability */
+  unsigned int failures; /**< the number of connection failures in a row */
+  int64_t retry_time; /**< monotonic time in microseconds to connect again after the failures */
+} nns_edge_server_s;
+
+/**
+ * @brief Data structure for the servers known to the query client, to reconnect without waiting for the broker.
+ */
+typedef struct
+{
+  pthread_mutex_t lock;
+  bool caps_cache; /**< cache the capability accepted by the event callback */
+  unsigned int len;
+  nns_edge_server_s list[NNS_EDGE_SERVER_CACHE_LIMIT];
+} nns_edge_server_cache_s;
+
+/**
+ * @brief Data structure for the thread invoking the statistics event periodically.
+ */
+typedef struct
+{
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
+  bool running;
+  bool changed; /**< the interval is changed, restart the waiting */
+  unsigned int interval; /**< interval in milliseconds, 0 means disabled */
+  pthread_t thread;
+} nns_edge_stats_timer_s;
+
+/**
+ * @brief Data structure for the event dispatched to the worker.
+ */
+typedef struct _nns_edge_dispatch_item_s nns_edge_dispatch_item_s;
+
+/**
+ * @brief Data structure for the worker invoking the event callback.
+ */
+typedef struct _nns_edge_dispatch_worker_s nns_edge_dispatch_worker_s;
+
+/**
+ * @brief Data structure for the workers invoking the event callback for new data, the message thread does not wait for the callback.
+ */
+typedef struct
+{
+  pthread_mutex_t lock; /**< lock for the pool of released events */
+  bool running;
+  unsigned int threads; /**< number of workers, 0 means the message thread invokes the callback */
+  unsigned int limit; /**< max number of events in the queue of each worker (0 means unlimited) */
+  nns_edge_queue_leak_e leaky;
+  nns_edge_dispatch_worker_s *workers;
+  nns_edge_dispatch_item_s *pool; /**< released events to be reused */
+  unsigned int pool_len;
+} nns_edge_dispatch_s;
+
+/**
+ * @brief Data structure for edge handle.
+ */
+typedef struct
+{
+  uint32_t magic;
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
+  char *id;
+  char *topic;
+  nns_edge_connect_type_e connect_type;
+  char *host; /**< host name or IP address */
+  int port; /**< port number (0~65535, default 0 to get available port.) */
+  char *dest_host; /**< destination IP address (broker or target device) */
+  int dest_port; /**< destination port number (broker or target device) */
+  nns_edge_node_type_e node_type;
+  nns_edge_metadata_h metadata;
+  bool is_started;
+
+  /* Edge event callback and user data */
+  nns_edge_event_cb event_cb;
+  void *user_data;
+
+  int64_t client_id;
+  char *caps_str;
+
+  /**
+   * list of connection data, and hash table (open addressing) to find the connection with client ID.
+   * The connection data and its connections are protected with conn_lock, see nns_edge_conn_rdlock().
+   */
+  pthread_rwlock_t conn_lock;
+  pthread_t conn_writer; /**< thread holding the write lock of the connections */
+  void *connections;
+  void **conn_table;
+  unsigned int conn_table_size;
+  unsigned int conn_count;
+  unsigned int lost_count; /**< number of the message threads removing its own connection, releasing the handle waits for them */
+
+  /* socket listener, and the fds to wake up the listener thread when releasing the handle */
+  bool listening;
+  int listener_fd;
+  int wake_fd[2];
+  pthread_t listener_thread;
+
+  /* workers and queue to handle the handshake of accepted sockets, the listener does not wait for the peer */
+  bool handshaking;
+  unsigned int handshake_workers;
+  unsigned int handshake_timeout; /**< timeout in milliseconds to send and receive the handshake messages (0 means no timeout) */
+  nns_edge_queue_h handshake_queue;
+  pthread_t *handshake_threads;
+
+  /* thread and queue to send data */
+  bool sending;
+  nns_edge_queue_h send_queue;
+  pthread_t send_thread;
+
+  /* queue size and leaky option of each connection in fan-out mode (default 0 to send data in the send thread) */
+  unsigned int fanout_limit;
+  nns_edge_queue_leak_e fanout_leaky;
+
+  /* I/O mode and reactor to handle the sockets */
+  nns_edge_io_mode_e io_mode;
+  unsigned int io_workers;
+  nns_edge_reactor_h reactor;
+
+  /* header format to send data */
+  nns_edge_header_mode_e header_mode;
+
+  /* connection mode of query client */
+  nns_edge_conn_mode_e conn_mode;
+
+  /* buffer pool to receive data */
+  nns_edge_pool_h pool;
+
+  /* size of shared memory ring to send data to the node on same host (default 0 means disabled) */
+  nns_size_t shm_size;
+
+  /* batch policy, the batch is sent when it has max count (0 or 1 means disabled) or max bytes, or the first data waits max delay (microseconds) */
+  unsigned int batch_count;
+  nns_size_t batch_bytes;
+  unsigned int batch_delay;
+  bool batch_event; /**< invoke the callback once for each received batch */
+
+  /* in-flight requests sent with nns_edge_send_request() */
+  nns_edge_request_window_s requests;
+
+  /* load balancing of query client, it keeps the connections to max server_count servers and selects one of them to send data */
+  nns_edge_balance_e balance;
+  unsigned int server_count;
+  unsigned int balance_turn;
+
+  /* load of query server, advertised in the announcement of hybrid connection */
+  unsigned int load;
+
+  /* servers known to query client, the client connects to max connect_parallel servers at once and keeps the standby connection if standby is set */
+  nns_edge_server_cache_s servers;
+  unsigned int connect_parallel;
+  bool standby;
+  void *standby_conn; /**< connection to the server which has finished the handshake, it is registered when other connection is lost */
+  int64_t standby_id;
+
+  /* flow control, the receiver grants flow_credits to the sender (0 means disabled) and the sender applies flow_policy without the credits */
+  unsigned int flow_credits;
+  nns_edge_flow_e flow_policy;
+
+  /* conflation mode, send and deliver the latest data only */
+  bool conflate;
+
+  /* compression of the memories, the memory smaller than compress_threshold (bytes) is sent without compression */
+  nns_edge_compress_e compress;
+  nns_size_t compress_threshold;
+
+  /* chunked transfer, the edge data larger than chunk_size (bytes) is sent in chunks (0 means disabled) and the receiver invokes the event for each chunk if chunk_event is set */
+  nns_size_t chunk_size;
+  bool chunk_event;
+
+  /* MQTT handle */
+  void *broker_h;
+
+  /* QoS and retain flag of MQTT message, for edge data and host info of hybrid connection */
+  int mqtt_qos;
+  bool mqtt_retain;
+  int mqtt_host_qos;
+  bool mqtt_host_retain;
+
+  /* Data for custom connection */
+  nns_edge_custom_connection_h custom_connection_h;
+
+  /* statistics of data transfer, and the thread invoking the statistics event */
+  nns_edge_stats_s stats;
+  nns_edge_stats_timer_s stats_timer;
+
+  /* workers to invoke the event callback for new data */
+  nns_edge_dispatch_s dispatch;
+} nns_edge_handle_s;
+
+/**
+ * @brief Data structure for the event dispatched to the worker. The event handle is reused for next data.
+ */
+struct _nns_edge_dispatch_item_s
+{
+  nns_edge_handle_s *eh;
+  nns_edge_event_e event;
+  nns_edge_event_h event_h;
+  nns_edge_data_h data[NNS_EDGE_BATCH_LIMIT]; /**< edge data handed over by the message thread */
+  unsigned int count;
+  void *mem[NNS_EDGE_DATA_LIMIT]; /**< received buffers which the edge data points to, released with the event */
+  nns_size_t mem_size[NNS_EDGE_DATA_LIMIT];
+  unsigned int num;
+  nns_edge_pool_h pool; /**< buffer pool, if the buffers are allocated from the pool. */
+  int64_t client_id;
+  unsigned int credits; /**< the number of credits granted to the peer when the event is released */
+  nns_edge_dispatch_item_s *next;
+};
+
+/**
+ * @brief Data structure for the worker invoking the event callback.
+ * @note The event of each client is pushed into the queue of same worker, to invoke the callback in order.
+ */
+struct _nns_edge_dispatch_worker_s
+{
+  nns_edge_handle_s *eh;
+  nns_edge_queue_h queue;
+  pthread_t thread;
+};
+
+/**
+ * @brief enum for nnstreamer edge query commands.
+ */
+typedef enum
+{
+  _NNS_EDGE_CMD_ERROR = 0,
+  _NNS_EDGE_CMD_TRANSFER_DATA,
+  _NNS_EDGE_CMD_HOST_INFO,
+  _NNS_EDGE_CMD_CAPABILITY,
+  _NNS_EDGE_CMD_SHM_INFO,
+  _NNS_EDGE_CMD_TRANSFER_SHM,
+  _NNS_EDGE_CMD_TRANSFER_BATCH,
+  _NNS_EDGE_CMD_TRANSFER_COMPRESSED,
+  _NNS_EDGE_CMD_CREDIT,
+  _NNS_EDGE_CMD_TRANSFER_CHUNK,
+  _NNS_EDGE_CMD_END
+} nns_edge_cmd_e;
+
+/**
+ * @brief Structure for edge command info. It should be fixed size.
+ * @note This is legacy header, which is sent to the node not supporting compact header.
+ */
+typedef struct
+{
+  uint32_t magic;
+  uint32_t cmd; /**< enum for query commands, see nns_edge_cmd_e. */
+  uint64_t version;
+  int64_t client_id;
+
+  /* memory info */
+  uint32_t num;
+  nns_size_t mem_size[NNS_EDGE_DATA_LIMIT];
+  nns_size_t meta_size;
+} nns_edge_cmd_info_s;
+
+/**
+ * @brief Structure for compact header of edge command, followed by the memory sizes of given number.
+ * @note The header starts with same fields of legacy header, the receiver checks the magic to get the format.
+ */
+typedef struct
+{
+  uint32_t magic; /**< NNS_EDGE_MAGIC_COMPACT */
+  uint32_t cmd;
+  uint64_t version;
+  int64_t client_id;
+  uint32_t num;
+  uint32_t header_len; /**< total length of header and memory sizes. */
+  nns_size_t meta_size;
+} nns_edge_cmd_header_s;
+
+/**
+ * @brief Structure for the extension of compact header, appended after the memory sizes if the command has the request ID.
+ * @note Old version skips it as unknown fields. New fields should be appended at the end.
+ */
+typedef struct
+{
+  uint64_t request_id;
+} nns_edge_cmd_header_ext_s;
+
+/**
+ * @brief The max length of the unknown fields in compact header, appended by newer version.
+ */
+#define NNS_EDGE_CMD_HEADER_EXT_MAX 256
+
+/**
+ * @brief Structure for edge command and buffers.
+ */
+typedef struct
+{
+  nns_edge_cmd_info_s info;
+  void *mem[NNS_EDGE_DATA_LIMIT];
+  void *meta;
+  nns_edge_pool_h pool; /**< buffer pool, if the buffers are allocated from the pool. */
+  uint64_t request_id; /**< request ID in compact header (0 means none), legacy header cannot deliver it. */
+} nns_edge_cmd_s;
+
+/**
+ * @brief Structure for the memories of edge data in the shared memory ring, it is sent with _NNS_EDGE_CMD_TRANSFER_SHM.
+ * @note The memories are in one record of the ring, each memory is aligned with NNS_EDGE_SHM_ALIGN. The serialized metadata follows the memories.
+ */
+typedef struct
+{
+  nns_size_t offset; /**< offset of the record in the ring */
+  uint32_t num;
+  uint32_t meta_size; /**< size of the metadata in the record, 0 if the metadata is sent with the command. */
+  nns_size_t mem_size[NNS_EDGE_DATA_LIMIT];
+} nns_edge_shm_desc_s;
+
+/**
+ * @brief Header of the compressed memories, it is the first memory sent with _NNS_EDGE_CMD_TRANSFER_COMPRESSED.
+ * @note The header is followed by the original sizes of the memories, 0 if the memory is sent without compression.
+ */
+typedef struct
+{
+  uint32_t compress; /**< compression algorithm, see nns_edge_compress_e. */
+  uint32_t num;
+} nns_edge_compress_desc_s;
+
+/**
+ * @brief Header of the batch, it is the first part of the memory sent with _NNS_EDGE_CMD_TRANSFER_BATCH.
+ * @note Each edge data in the batch starts with nns_edge_batch_item_s and the memory sizes, then the memories and metadata follow.
+ * Every part is padded to 8 bytes.
+ */
+typedef struct
+{
+  uint32_t count;
+  uint32_t reserved;
+} nns_edge_batch_header_s;
+
+/**
+ * @brief Header of the edge data in the batch.
+ */
+typedef struct
+{
+  uint32_t num;
+  uint32_t reserved;
+  nns_size_t meta_size;
+  uint64_t request_id;
+} nns_edge_batch_item_s;
+
+/**
+ * @brief Header of the chunk, it is the first memory sent with _NNS_EDGE_CMD_TRANSFER_CHUNK and the part of one memory follows.
+ * @note The memories of edge data are sent in order. The metadata and request ID are sent with the first chunk.
+ */
+typedef struct
+{
+  uint32_t transfer_id; /**< ID of the edge data in the connection */
+  uint32_t index; /**< index of the memory */
+  uint32_t num; /**< the number of memories */
+  uint32_t last; /**< 1 if the chunk is the last part of edge data */
+  nns_size_t mem_size; /**< total size of the memory */
+  nns_size_t offset; /**< offset of the chunk in the memory */
+} nns_edge_chunk_desc_s;
+
+/**
+ * @brief Structure for the edge data sent in chunks.
+ */
+typedef struct
+{
+  nns_edge_data_h data_h;
+  uint32_t transfer_id;
+  unsigned int index; /**< index of the memory to send next chunk */
+  nns_size_t offset; /**< offset of next chunk in the memory */
+  nns_size_t bytes; /**< total size of the memories */
+  int64_t start;
+} nns_edge_chunk_tx_s;
+
+/**
+ * @brief Structure for the edge data received in chunks.
+ */
+typedef struct
+{
+  nns_edge_data_h data_h;
+  uint32_t transfer_id;
+  uint64_t request_id;
+  void *mem; /**< the memory being received, it is added into edge data when all chunks are received */
+  nns_size_t mem_size;
+  nns_size_t received;
+} nns_edge_chunk_rx_s;
+
+/**
+ * @brief Data structure for connection data.
+ */
+typedef struct _nns_edge_conn_data_s nns_edge_conn_data_s;
+
+/**
+ * @brief Structure for the credits of the connection, the credits are sent with _NNS_EDGE_CMD_CREDIT.
+ * @note The sender sends data without the credits until the receiver grants the first credits.
+ */
+typedef struct
+{
+  pthread_mutex_t lock;
+  bool enabled; /**< the receiver has granted the credits */
+  unsigned int credits; /**< the number of data to send */
+  nns_edge_data_h pending; /**< the latest data to send when new credits are granted (coalesce policy) */
+  unsigned int consumed; /**< the number of received data consumed and not granted yet */
+} nns_edge_credit_s;
+
+/**
+ * @brief Data structure for edge connection.
+ */
+typedef struct
+{
+  char *host;
+  int port;
+  bool running;
+  pthread_t msg_thread;
+  int sockfd;
+  int wake_fd[2]; /**< fds to poll and to write, to wake up the message thread when closing the connection */
+
+  /* lock to write the socket, the credits are sent in the message thread and dispatch workers */
+  pthread_mutex_t send_lock;
+
+  /* features supported by connected node, see NNS_EDGE_FEATURE_ALL. */
+  uint32_t features;
+
+  /* buffer pool, edge data and event reused to receive data */
+  nns_edge_pool_h pool;
+  nns_edge_data_h recv_data;
+  nns_edge_event_h recv_event;
+
+  /* reactor watching the socket and its callback data */
+  nns_edge_reactor_h reactor;
+  void *reactor_data;
+
+  /* queue and thread to send data to this connection in fan-out mode */
+  bool sending;
+  bool send_failed;
+  nns_edge_queue_h send_queue;
+  pthread_t send_thread;
+
+  /* shared memory rings to send and receive data with the node on same host (shm_size 0 means disabled) */
+  nns_size_t shm_size;
+  bool shm_checked;
+  nns_edge_shm_h shm_send;
+  nns_edge_shm_h shm_recv;
+
+  /* pending data to send in one batch, the first data is pushed at batch_time (microseconds) */
+  nns_edge_data_h batch[NNS_EDGE_BATCH_LIMIT];
+  unsigned int batch_len;
+  nns_size_t batch_size;
+  int64_t batch_time;
+  int64_t batch_client_id;
+
+  /* compression of the memories to send (NNS_EDGE_COMPRESS_NONE means disabled), the buffer is reused for next data */
+  nns_edge_compress_e compress;
+  nns_size_t compress_threshold;
+  void *compress_buf;
+  nns_size_t compress_buf_size;
+
+  /* size of the chunk to send large data (0 means disabled), and the edge data being received in chunks */
+  nns_size_t chunk_size;
+  nns_edge_chunk_rx_s chunk_rx[NNS_EDGE_CHUNK_TRANSFERS];
+  unsigned int chunk_rx_len;
+
+  /**
+   * Load of the server for load balancing. The send thread pushes the time of the request (lb_tail),
+   * and the message thread pops it when receiving the response (lb_head).
+   */
+  unsigned int lb_head;
+  unsigned int lb_tail;
+  int64_t lb_sent[NNS_EDGE_BALANCE_PENDING];
+  int64_t lb_latency; /**< smoothed round-trip time in microseconds, 0 if not measured */
+  unsigned int lb_load; /**< load advertised by the server */
+
+  /* statistics of edge handle, and the counters of this connection */
+  nns_edge_stats_s *stats;
+  nns_edge_stats_count_s sent;
+  nns_edge_stats_count_s received;
+
+  /* credits to send data to the peer, and the consumed data to grant the credits to the peer */
+  nns_edge_credit_s credit;
+} nns_edge_conn_s;
+
+/**
+ * @brief Data structure for connection data.
+ */
+struct _nns_edge_conn_data_s
+{
+  nns_edge_conn_s *src_conn;
+  nns_edge_conn_s *sink_conn;
+  int64_t id;
+  nns_edge_conn_data_s *prev;
+  nns_edge_conn_data_s *next;
+};
+
+/**
+ * @brief Structures for thread data of message handling.
+ */
+typedef struct
+{
+  nns_edge_handle_s *eh;
+  int64_t client_id;
+  nns_edge_conn_s *conn;
+} nns_edge_thread_data_s;
+
+/**
+ * @brief Initialize edge command.
+ */
+void nns_edge_cmd_init (nns_edge_cmd_s *cmd, nns_edge_cmd_e c, int64_t cid);
+
+/**
+ * @brief Send edge command to connected device.
+ */
+int nns_edge_cmd_send (nns_edge_conn_s *conn, nns_edge_cmd_s *cmd);
+
+/**
+ * @brief Get nnstreamer-edge connection data.
+ * @note The caller should hold the lock of the connections while using returned connection data.
+ */
+nns_edge_conn_data_s *nns_edge_get_connection (nns_edge_handle_s *eh, int64_t client_id);
+
+/**
+ * @brief Internal function to send edge data.
+ */
+int nns_edge_transfer_data (nns_edge_conn_s *conn, nns_edge_data_h data_h, int64_t client_id);
+
+/**
+ * @brief Update the statistics after sending the data to the connection.
+ */
+void nns_edge_conn_stats_sent (nns_edge_conn_s *conn, int64_t start, unsigned int frames, nns_size_t bytes, int ret);
+
+/**
+ * @brief Pop the time of the request when receiving the response, and update the round-trip time of the server.
+ * @note This is called by the message thread of the connection only. The server responds to the requests in order.
+ */
+void nns_edge_balance_done (nns_edge_handle_s *eh, nns_edge_conn_s *conn);
+
+/**
+ * @brief Invoke the event callback for new data. With the dispatch workers, hand over the data to the worker for the client and return without waiting for the callback.
+ * @param[in,out] data The array of edge data, the callback is invoked for each data with NNS_EDGE_EVENT_NEW_DATA_RECEIVED and NNS_EDGE_EVENT_NEW_CHUNK_RECEIVED. The data should have its memories or point to the buffers of given command. If the worker takes the data, it is set to NULL.
+ * @param[in] credits The number of credits granted to the peer after invoking the callback.
+ * @param[in,out] cmd The received command which the data points to, the worker takes its buffers with the data. NULL if the data has its memories.
+ */
+int nns_edge_dispatch_data (nns_edge_handle_s *eh, nns_edge_conn_s *conn, nns_edge_event_e event, nns_edge_data_h *data, unsigned int count, unsigned int credits, int64_t client_id, nns_edge_cmd_s *cmd);
+
+/**
+ * @brief Invoke the callback for received edge data, or skip it if the connection has newer data in conflation mode.
+ * @param[in,out] data_h The received edge data. If the dispatch worker takes the data, it is set to NULL.
+ * @param[in,out] cmd The received command which the data points to, or NULL if the data has its memories. See nns_edge_dispatch_data().
+ */
+void nns_edge_deliver_data (nns_edge_handle_s *eh, nns_edge_conn_s *conn, nns_edge_data_h *data_h, uint64_t request_id, int64_t client_id, nns_edge_cmd_s *cmd);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __NNSTREAMER_EDGE_INTERNAL_H__ */
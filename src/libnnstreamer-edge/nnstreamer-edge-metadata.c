@@ -10,96 +10,308 @@
  * @bug    No known bugs except for NYI items
  */
 
+#include <ctype.h>
 #include "nnstreamer-edge-metadata.h"
 #include "nnstreamer-edge-util.h"
 
 /**
- * @brief Internal data structure for metadata.
+ * @brief The initial number of key-value pairs in the store.
  */
-typedef struct _nns_edge_metadata_node_s nns_edge_metadata_node_s;
+#define NNS_EDGE_METADATA_MIN_SIZE (4U)
 
 /**
  * @brief Internal data structure for metadata.
  */
-struct _nns_edge_metadata_node_s
+typedef struct
 {
   char *key;
   char *value;
-  nns_edge_metadata_node_s *next;
-};
+  uint32_t hash; /**< case-insensitive hash of the key */
+} nns_edge_metadata_node_s;
 
 /**
- * @brief Internal data structure to handle metadata. This struct should be managed in the handle.
+ * @brief Internal data structure for the key-value store, shared by copied metadata until one of them is changed.
  */
 typedef struct
 {
+  pthread_mutex_t lock;
+  unsigned int refcount;
+
+  /* key-value pairs in the order of insertion */
   uint32_t list_len;
+  uint32_t list_size;
   nns_edge_metadata_node_s *list;
+
+  /* hash table (open addressing) of index + 1, 0 means empty slot. */
+  uint32_t table_size;
+  uint32_t *table;
+
+  /* serialized data, it is rebuilt when the store is changed. */
+  void *serialized;
+  nns_size_t serialized_len;
+} nns_edge_metadata_store_s;
+
+/**
+ * @brief Internal data structure to handle metadata. This struct should be managed in the handle.
+ * @note The store is null if there is no metadata.
+ */
+typedef struct
+{
+  nns_edge_metadata_store_s *store;
 } nns_edge_metadata_s;
 
 /**
- * @brief Internal function to find node in the list.
+ * @brief Internal function to get case-insensitive hash of the key.
+ */
+static uint32_t
+_nns_edge_metadata_hash (const char *key)
+{
+  uint32_t h = 2166136261U;
+
+  while (*key) {
+    h ^= (uint32_t) tolower ((unsigned char) *key++);
+    h *= 16777619U;
+  }
+
+  return h;
+}
+
+/**
+ * @brief Internal function to find the slot of the key in the hash table. Returns empty slot if not found.
+ */
+static uint32_t
+_nns_edge_metadata_find_slot (nns_edge_metadata_store_s * store,
+    const char *key, uint32_t hash)
+{
+  uint32_t mask = store->table_size - 1U;
+  uint32_t i = hash & mask;
+  nns_edge_metadata_node_s *node;
+
+  while (store->table[i] != 0U) {
+    node = &store->list[store->table[i] - 1U];
+    if (node->hash == hash && strcasecmp (key, node->key) == 0)
+      break;
+
+    i = (i + 1U) & mask;
+  }
+
+  return i;
+}
+
+/**
+ * @brief Internal function to find node in the store.
  */
 static nns_edge_metadata_node_s *
 nns_edge_metadata_find (nns_edge_metadata_s * meta, const char *key)
 {
-  nns_edge_metadata_node_s *node;
+  nns_edge_metadata_store_s *store;
+  uint32_t slot;
 
-  if (!meta)
+  if (!meta || !meta->store)
     return NULL;
 
   if (!STR_IS_VALID (key))
     return NULL;
 
-  node = meta->list;
-  while (node) {
-    if (strcasecmp (key, node->key) == 0)
-      return node;
+  store = meta->store;
+  slot = _nns_edge_metadata_find_slot (store, key,
+      _nns_edge_metadata_hash (key));
+
+  return (store->table[slot] != 0U) ? &store->list[store->table[slot] - 1U] :
+      NULL;
+}
+
+/**
+ * @brief Internal function to create new store.
+ */
+static nns_edge_metadata_store_s *
+_nns_edge_metadata_store_new (uint32_t size)
+{
+  nns_edge_metadata_store_s *store;
+
+  store = calloc (1, sizeof (nns_edge_metadata_store_s));
+  if (!store)
+    return NULL;
+
+  store->list = calloc (size, sizeof (nns_edge_metadata_node_s));
+  store->table = calloc (size * 2U, sizeof (uint32_t));
+  if (!store->list || !store->table) {
+    SAFE_FREE (store->list);
+    SAFE_FREE (store->table);
+    SAFE_FREE (store);
+    return NULL;
+  }
+
+  nns_edge_lock_init (store);
+  store->refcount = 1U;
+  store->list_size = size;
+  store->table_size = size * 2U;
+
+  return store;
+}
+
+/**
+ * @brief Internal function to release the reference of the store.
+ */
+static void
+_nns_edge_metadata_store_unref (nns_edge_metadata_store_s * store)
+{
+  unsigned int refcount;
+  uint32_t i;
+
+  if (!store)
+    return;
+
+  nns_edge_lock (store);
+  refcount = --store->refcount;
+  nns_edge_unlock (store);
+
+  if (refcount > 0U)
+    return;
 
-    node = node->next;
+  for (i = 0; i < store->list_len; i++) {
+    SAFE_FREE (store->list[i].key);
+    SAFE_FREE (store->list[i].value);
   }
 
-  return NULL;
+  SAFE_FREE (store->list);
+  SAFE_FREE (store->table);
+  SAFE_FREE (store->serialized);
+  nns_edge_lock_destroy (store);
+  SAFE_FREE (store);
 }
 
 /**
- * @brief Internal function to initialize metadata structure.
+ * @brief Internal function to increase the size of the store and rebuild the hash table.
  */
 static int
-nns_edge_metadata_init (nns_edge_metadata_s * meta)
+_nns_edge_metadata_store_grow (nns_edge_metadata_store_s * store)
 {
-  if (!meta)
-    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  nns_edge_metadata_node_s *list;
+  uint32_t *table;
+  uint32_t i, size;
+
+  size = store->list_size * 2U;
+
+  list = realloc (store->list, size * sizeof (nns_edge_metadata_node_s));
+  if (!list)
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+  store->list = list;
+
+  table = calloc (size * 2U, sizeof (uint32_t));
+  if (!table)
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+
+  SAFE_FREE (store->table);
+  store->table = table;
+  store->table_size = size * 2U;
+  store->list_size = size;
+
+  for (i = 0; i < store->list_len; i++) {
+    store->table[_nns_edge_metadata_find_slot (store, store->list[i].key,
+            store->list[i].hash)] = i + 1U;
+  }
 
-  memset (meta, 0, sizeof (nns_edge_metadata_s));
   return NNS_EDGE_ERROR_NONE;
 }
 
 /**
- * @brief Internal function to free the list and items in metadata structure.
+ * @brief Internal function to get the store to be changed. If the store is shared with other metadata, copy the store.
  */
-static int
-nns_edge_metadata_free (nns_edge_metadata_s * meta)
+static nns_edge_metadata_store_s *
+_nns_edge_metadata_get_writable (nns_edge_metadata_s * meta)
 {
-  nns_edge_metadata_node_s *node, *tmp;
+  nns_edge_metadata_store_s *store, *copied;
+  bool shared;
+  uint32_t i;
+
+  store = meta->store;
+  if (!store) {
+    meta->store = _nns_edge_metadata_store_new (NNS_EDGE_METADATA_MIN_SIZE);
+    return meta->store;
+  }
 
-  if (!meta)
-    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  nns_edge_lock (store);
+  shared = (store->refcount > 1U);
+  nns_edge_unlock (store);
+
+  if (shared) {
+    copied = _nns_edge_metadata_store_new (store->list_size);
+    if (!copied)
+      return NULL;
+
+    for (i = 0; i < store->list_len; i++) {
+      copied->list[i].key = nns_edge_strdup (store->list[i].key);
+      copied->list[i].value = nns_edge_strdup (store->list[i].value);
+      copied->list[i].hash = store->list[i].hash;
+      copied->list_len++;
+
+      if (!copied->list[i].key || !copied->list[i].value) {
+        _nns_edge_metadata_store_unref (copied);
+        return NULL;
+      }
+    }
 
-  node = meta->list;
-  meta->list_len = 0;
-  meta->list = NULL;
+    memcpy (copied->table, store->table, store->table_size * sizeof (uint32_t));
 
-  while (node) {
-    tmp = node->next;
+    _nns_edge_metadata_store_unref (store);
+    meta->store = store = copied;
+  }
+
+  /* The store will be changed, clear serialized data. */
+  SAFE_FREE (store->serialized);
+  store->serialized_len = 0U;
+
+  return store;
+}
+
+/**
+ * @brief Internal function to add new key-value pair into the store.
+ * @note The store should be writable and the key should not exist in the store.
+ */
+static int
+_nns_edge_metadata_store_add (nns_edge_metadata_store_s * store,
+    const char *key, const char *value, uint32_t hash)
+{
+  nns_edge_metadata_node_s *node;
+  uint32_t slot;
+  int ret;
+
+  if (store->list_len >= store->list_size) {
+    ret = _nns_edge_metadata_store_grow (store);
+    if (ret != NNS_EDGE_ERROR_NONE)
+      return ret;
+  }
 
+  node = &store->list[store->list_len];
+  node->key = nns_edge_strdup (key);
+  node->value = nns_edge_strdup (value);
+  node->hash = hash;
+
+  if (!node->key || !node->value) {
     SAFE_FREE (node->key);
     SAFE_FREE (node->value);
-    SAFE_FREE (node);
-
-    node = tmp;
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
   }
 
+  slot = _nns_edge_metadata_find_slot (store, key, hash);
+  store->table[slot] = ++store->list_len;
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to free the items in metadata structure.
+ */
+static int
+nns_edge_metadata_free (nns_edge_metadata_s * meta)
+{
+  if (!meta)
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  _nns_edge_metadata_store_unref (meta->store);
+  meta->store = NULL;
+
   return NNS_EDGE_ERROR_NONE;
 }
 
@@ -118,8 +330,6 @@ nns_edge_metadata_create (nns_edge_metadata_h * metadata_h)
   if (!meta)
     return NNS_EDGE_ERROR_OUT_OF_MEMORY;
 
-  nns_edge_metadata_init (meta);
-
   *metadata_h = meta;
   return NNS_EDGE_ERROR_NONE;
 }
@@ -143,6 +353,22 @@ nns_edge_metadata_destroy (nns_edge_metadata_h metadata_h)
   return NNS_EDGE_ERROR_NONE;
 }
 
+/**
+ * @brief Internal function to remove all metadata in the list.
+ */
+int
+nns_edge_metadata_clear (nns_edge_metadata_h metadata_h)
+{
+  nns_edge_metadata_s *meta;
+
+  meta = (nns_edge_metadata_s *) metadata_h;
+
+  if (!meta)
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  return nns_edge_metadata_free (meta);
+}
+
 /**
  * @brief Internal function to set the metadata.
  */
@@ -151,7 +377,9 @@ nns_edge_metadata_set (nns_edge_metadata_h metadata_h,
     const char *key, const char *value)
 {
   nns_edge_metadata_s *meta;
+  nns_edge_metadata_store_s *store;
   nns_edge_metadata_node_s *node;
+  char *val;
 
   meta = (nns_edge_metadata_s *) metadata_h;
 
@@ -164,11 +392,19 @@ nns_edge_metadata_set (nns_edge_metadata_h metadata_h,
   if (!STR_IS_VALID (value))
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
 
-  /* Replace old value if key exists in the list. */
+  /* Do nothing if same value exists, to keep the store and serialized data. */
   node = nns_edge_metadata_find (meta, key);
-  if (node) {
-    char *val = nns_edge_strdup (value);
+  if (node && strcmp (node->value, value) == 0)
+    return NNS_EDGE_ERROR_NONE;
+
+  store = _nns_edge_metadata_get_writable (meta);
+  if (!store)
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
 
+  /* Replace old value if key exists in the store. */
+  node = nns_edge_metadata_find (meta, key);
+  if (node) {
+    val = nns_edge_strdup (value);
     if (!val)
       return NNS_EDGE_ERROR_OUT_OF_MEMORY;
 
@@ -177,26 +413,8 @@ nns_edge_metadata_set (nns_edge_metadata_h metadata_h,
     return NNS_EDGE_ERROR_NONE;
   }
 
-  node = calloc (1, sizeof (nns_edge_metadata_node_s));
-  if (!node)
-    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
-
-  node->key = nns_edge_strdup (key);
-  node->value = nns_edge_strdup (value);
-
-  if (!node->key || !node->value) {
-    SAFE_FREE (node->key);
-    SAFE_FREE (node->value);
-    SAFE_FREE (node);
-    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
-  }
-
-  /* Prepend new node to the start of the list. */
-  meta->list_len++;
-  node->next = meta->list;
-  meta->list = node;
-
-  return NNS_EDGE_ERROR_NONE;
+  return _nns_edge_metadata_store_add (store, key, value,
+      _nns_edge_metadata_hash (key));
 }
 
 /**
@@ -230,9 +448,7 @@ int
 nns_edge_metadata_copy (nns_edge_metadata_h dest_h, nns_edge_metadata_h src_h)
 {
   nns_edge_metadata_s *dest, *src;
-  nns_edge_metadata_s tmp;
-  nns_edge_metadata_node_s *node;
-  int ret;
+  nns_edge_metadata_store_s *store;
 
   dest = (nns_edge_metadata_s *) dest_h;
   src = (nns_edge_metadata_s *) src_h;
@@ -240,87 +456,136 @@ nns_edge_metadata_copy (nns_edge_metadata_h dest_h, nns_edge_metadata_h src_h)
   if (!dest || !src)
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
 
-  nns_edge_metadata_init (&tmp);
-
-  node = src->list;
-  while (node) {
-    ret = nns_edge_metadata_set (&tmp, node->key, node->value);
-    if (ret != NNS_EDGE_ERROR_NONE) {
-      nns_edge_metadata_free (&tmp);
-      return ret;
-    }
+  if (dest == src)
+    return NNS_EDGE_ERROR_NONE;
 
-    node = node->next;
+  /* Share the store, it is copied when one of the metadata is changed. */
+  store = src->store;
+  if (store) {
+    nns_edge_lock (store);
+    store->refcount++;
+    nns_edge_unlock (store);
   }
 
-  /* Replace dest when new metadata is successfully copied. */
   nns_edge_metadata_free (dest);
-  *dest = tmp;
+  dest->store = store;
 
   return NNS_EDGE_ERROR_NONE;
 }
 
 /**
- * @brief Internal function to serialize the metadata. Caller should release the returned value using free().
+ * @brief Internal function to build serialized data of the store.
+ * @note This function should be called with the lock of the store.
  */
-int
-nns_edge_metadata_serialize (nns_edge_metadata_h metadata_h,
-    void **data, nns_size_t * data_len)
+static int
+_nns_edge_metadata_store_serialize (nns_edge_metadata_store_s * store)
 {
-  nns_edge_metadata_s *meta;
   nns_edge_metadata_node_s *node;
   char *serialized, *ptr;
   nns_size_t total, len;
+  uint32_t i;
 
-  meta = (nns_edge_metadata_s *) metadata_h;
-
-  if (!meta)
-    return NNS_EDGE_ERROR_INVALID_PARAMETER;
-
-  if (!data || !data_len)
-    return NNS_EDGE_ERROR_INVALID_PARAMETER;
-
-  *data = NULL;
-  *data_len = 0U;
-
-  if (meta->list_len == 0)
+  if (store->serialized)
     return NNS_EDGE_ERROR_NONE;
 
   /* length, # of metadata */
   total = len = sizeof (uint32_t);
 
-  node = meta->list;
-  while (node) {
+  for (i = 0; i < store->list_len; i++) {
+    node = &store->list[i];
     total += (strlen (node->key) + strlen (node->value) + 2);
-    node = node->next;
   }
 
   serialized = ptr = (char *) nns_edge_malloc (total);
   if (!serialized)
     return NNS_EDGE_ERROR_OUT_OF_MEMORY;
 
-  /* length + list of key-value pair */
-  ((uint32_t *) serialized)[0] = meta->list_len;
+  /* length + list of key-value pair, latest one first */
+  ((uint32_t *) serialized)[0] = store->list_len;
   ptr += len;
 
-  node = meta->list;
-  while (node) {
-    len = strlen (node->key);
+  for (i = store->list_len; i > 0U; i--) {
+    node = &store->list[i - 1U];
+
+    len = strlen (node->key) + 1;
     memcpy (ptr, node->key, len);
-    ptr[len] = '\0';
-    ptr += (len + 1);
+    ptr += len;
 
-    len = strlen (node->value);
+    len = strlen (node->value) + 1;
     memcpy (ptr, node->value, len);
-    ptr[len] = '\0';
-    ptr += (len + 1);
+    ptr += len;
+  }
+
+  store->serialized = serialized;
+  store->serialized_len = total;
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to get the serialized data of the metadata without copying it.
+ */
+int
+nns_edge_metadata_get_serialized (nns_edge_metadata_h metadata_h,
+    const void **data, nns_size_t * data_len)
+{
+  nns_edge_metadata_s *meta;
+  nns_edge_metadata_store_s *store;
+  int ret;
+
+  meta = (nns_edge_metadata_s *) metadata_h;
+
+  if (!meta)
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  if (!data || !data_len)
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
 
-    node = node->next;
+  *data = NULL;
+  *data_len = 0U;
+
+  store = meta->store;
+  if (!store || store->list_len == 0)
+    return NNS_EDGE_ERROR_NONE;
+
+  /* Other metadata sharing the store may serialize it at the same time. */
+  nns_edge_lock (store);
+  ret = _nns_edge_metadata_store_serialize (store);
+  if (ret == NNS_EDGE_ERROR_NONE) {
+    *data = store->serialized;
+    *data_len = store->serialized_len;
   }
+  nns_edge_unlock (store);
 
-  *data = serialized;
-  *data_len = total;
+  return ret;
+}
 
+/**
+ * @brief Internal function to serialize the metadata. Caller should release the returned value using free().
+ */
+int
+nns_edge_metadata_serialize (nns_edge_metadata_h metadata_h,
+    void **data, nns_size_t * data_len)
+{
+  const void *serialized;
+  nns_size_t len;
+  int ret;
+
+  if (!data || !data_len)
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  *data = NULL;
+  *data_len = 0U;
+
+  ret = nns_edge_metadata_get_serialized (metadata_h, &serialized, &len);
+  if (ret != NNS_EDGE_ERROR_NONE || len == 0U)
+    return ret;
+
+  *data = nns_edge_memdup (serialized, len);
+  if (!*data)
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+
+  *data_len = len;
   return NNS_EDGE_ERROR_NONE;
 }
 
@@ -332,8 +597,10 @@ nns_edge_metadata_deserialize (nns_edge_metadata_h metadata_h,
     const void *data, const nns_size_t data_len)
 {
   nns_edge_metadata_s *meta;
-  char *key, *value;
-  nns_size_t cur, total;
+  nns_edge_metadata_store_s *store;
+  const char *key, *value, *ptr;
+  nns_size_t cur, len;
+  uint32_t n, total, slot, hash;
   int ret;
 
   meta = (nns_edge_metadata_s *) metadata_h;
@@ -344,25 +611,90 @@ nns_edge_metadata_deserialize (nns_edge_metadata_h metadata_h,
   if (!data || data_len <= 0)
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
 
+  /* Do nothing if the metadata is not changed. */
+  store = meta->store;
+  if (store) {
+    bool same;
+
+    nns_edge_lock (store);
+    same = (store->serialized && store->serialized_len == data_len &&
+        memcmp (store->serialized, data, data_len) == 0);
+    nns_edge_unlock (store);
+
+    if (same)
+      return NNS_EDGE_ERROR_NONE;
+  }
+
   nns_edge_metadata_free (meta);
 
-  /* length + list of key-value pair */
-  total = ((uint32_t *) data)[0];
+  if (data_len < sizeof (uint32_t))
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  /* length + list of key-value pair, the serialized data may not be aligned. */
+  ptr = (const char *) data;
+  memcpy (&total, data, sizeof (uint32_t));
+  if (total == 0U)
+    return NNS_EDGE_ERROR_NONE;
 
+  store = _nns_edge_metadata_store_new (NNS_EDGE_METADATA_MIN_SIZE);
+  if (!store)
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+
+  ret = NNS_EDGE_ERROR_NONE;
   cur = sizeof (uint32_t);
-  while (cur < data_len || meta->list_len < total) {
-    key = (char *) data + cur;
-    cur += (strlen (key) + 1);
+  for (n = 0; n < total && cur < data_len; n++) {
+    key = ptr + cur;
+    len = strnlen (key, data_len - cur);
+    if (cur + len >= data_len) {
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+      break;
+    }
+    cur += (len + 1);
 
-    value = (char *) data + cur;
-    cur += (strlen (value) + 1);
+    value = ptr + cur;
+    len = strnlen (value, data_len - cur);
+    if (cur + len >= data_len) {
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+      break;
+    }
+    cur += (len + 1);
 
-    ret = nns_edge_metadata_set (meta, key, value);
-    if (ret != NNS_EDGE_ERROR_NONE) {
-      nns_edge_metadata_free (meta);
-      return ret;
+    if (!STR_IS_VALID (key) || !STR_IS_VALID (value)) {
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+      break;
+    }
+
+    hash = _nns_edge_metadata_hash (key);
+    slot = _nns_edge_metadata_find_slot (store, key, hash);
+    if (store->table[slot] != 0U) {
+      /* Replace old value if key exists in the store. */
+      char *val = nns_edge_strdup (value);
+
+      if (!val) {
+        ret = NNS_EDGE_ERROR_OUT_OF_MEMORY;
+        break;
+      }
+
+      SAFE_FREE (store->list[store->table[slot] - 1U].value);
+      store->list[store->table[slot] - 1U].value = val;
+    } else {
+      ret = _nns_edge_metadata_store_add (store, key, value, hash);
+      if (ret != NNS_EDGE_ERROR_NONE)
+        break;
     }
   }
 
+  if (ret != NNS_EDGE_ERROR_NONE) {
+    _nns_edge_metadata_store_unref (store);
+    return ret;
+  }
+
+  /* Keep given data as serialized data, if it has no duplicated key and trailing bytes. */
+  if (cur == data_len && store->list_len == total)
+    store->serialized = nns_edge_memdup (data, data_len);
+  if (store->serialized)
+    store->serialized_len = data_len;
+
+  meta->store = store;
   return NNS_EDGE_ERROR_NONE;
 }
@@ -32,6 +32,11 @@ int nns_edge_metadata_create (nns_edge_metadata_h *metadata_h);
  */
 int nns_edge_metadata_destroy (nns_edge_metadata_h metadata_h);
 
+/**
+ * @brief Internal function to remove all metadata in the list.
+ */
+int nns_edge_metadata_clear (nns_edge_metadata_h metadata_h);
+
 /**
  * @brief Internal function to set the metadata.
  */
@@ -43,7 +48,7 @@ int nns_edge_metadata_set (nns_edge_metadata_h metadata_h, const char *key, cons
 int nns_edge_metadata_get (nns_edge_metadata_h metadata_h, const char *key, char **value);
 
 /**
- * @brief Internal function to copy the metadata.
+ * @brief Internal function to copy the metadata. The key-value pairs are shared until one of the metadata is changed.
  */
 int nns_edge_metadata_copy (nns_edge_metadata_h dest_h, nns_edge_metadata_h src_h);
 
@@ -52,6 +57,12 @@ int nns_edge_metadata_copy (nns_edge_metadata_h dest_h, nns_edge_metadata_h src_
  */
 int nns_edge_metadata_serialize (nns_edge_metadata_h metadata_h, void **data, nns_size_t *data_len);
 
+/**
+ * @brief Internal function to get the serialized data of the metadata without copying it. The serialized data is kept until the metadata is changed.
+ * @note DO NOT release returned data, and do not change the metadata while using it.
+ */
+int nns_edge_metadata_get_serialized (nns_edge_metadata_h metadata_h, const void **data, nns_size_t *data_len);
+
 /**
  * @brief Internal function to deserialize memory into metadata.
  */
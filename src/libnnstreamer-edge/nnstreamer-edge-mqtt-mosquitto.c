@@ -20,6 +20,7 @@
 #include "nnstreamer-edge-util.h"
 #include "nnstreamer-edge-queue.h"
 #include "nnstreamer-edge-data.h"
+#include "nnstreamer-edge-data-internal.h"
 #include "nnstreamer-edge-event.h"
 
 /**
@@ -39,9 +40,17 @@ typedef struct
   nns_edge_event_cb event_cb;
   void *user_data;
 
+  /* statistics of edge handle, updated when sending and receiving the message */
+  nns_edge_stats_s *stats;
+
   pthread_mutex_t lock;
   pthread_cond_t cond;
   bool cleared;
+  bool retained;
+
+  /* buffer to serialize edge data */
+  void *buffer;
+  nns_size_t buffer_size;
 } nns_edge_broker_s;
 
 /**
@@ -70,32 +79,53 @@ on_message_callback (struct mosquitto *client, void *data,
       message->mid, message->topic);
 
   msg_len = (nns_size_t) message->payloadlen;
-  msg = nns_edge_memdup (message->payload, msg_len);
 
-  if (msg) {
-    if (bh->event_cb) {
-      nns_edge_data_h data_h;
+  if (bh->stats)
+    nns_edge_stats_count (bh->stats->received, 1U, msg_len);
 
-      if (nns_edge_data_create (&data_h) != NNS_EDGE_ERROR_NONE) {
-        nns_edge_loge ("Failed to create data handle in msg thread.");
-        SAFE_FREE (msg);
-        return;
-      }
+  if (bh->event_cb) {
+    nns_edge_data_h data_h;
+    int64_t start;
 
-      nns_edge_data_deserialize (data_h, (void *) msg, (nns_size_t) msg_len);
+    /* The memories of edge data refer to the message, allocate it with the allocator of edge data. */
+    msg = (char *) nns_edge_data_alloc_mem (msg_len);
+    if (!msg) {
+      nns_edge_loge ("Failed to allocate memory for the received message.");
+      return;
+    }
+    memcpy (msg, message->payload, msg_len);
 
-      ret = nns_edge_event_invoke_callback (bh->event_cb, bh->user_data,
-          NNS_EDGE_EVENT_NEW_DATA_RECEIVED, data_h, sizeof (nns_edge_data_h),
-          NULL);
-      if (ret != NNS_EDGE_ERROR_NONE)
-        nns_edge_loge ("Failed to send an event for received message.");
+    if (nns_edge_data_create (&data_h) != NNS_EDGE_ERROR_NONE) {
+      nns_edge_loge ("Failed to create data handle in msg thread.");
+      nns_edge_data_free_mem (msg);
+      return;
+    }
 
+    ret = nns_edge_data_deserialize_nocopy (data_h, msg, msg_len,
+        nns_edge_data_free_mem);
+    if (ret != NNS_EDGE_ERROR_NONE) {
+      nns_edge_loge ("Failed to deserialize the received message.");
       nns_edge_data_destroy (data_h);
-      SAFE_FREE (msg);
-    } else {
-      /* Push received message into msg queue. DO NOT free msg here. */
-      nns_edge_queue_push (bh->message_queue, msg, msg_len, nns_edge_free);
+      nns_edge_data_free_mem (msg);
+      return;
     }
+
+    start = nns_edge_stats_start (bh->stats);
+    ret = nns_edge_event_invoke_callback (bh->event_cb, bh->user_data,
+        NNS_EDGE_EVENT_NEW_DATA_RECEIVED, data_h, sizeof (nns_edge_data_h),
+        NULL);
+    if (bh->stats)
+      nns_edge_stats_done (&bh->stats->callback, start);
+    if (ret != NNS_EDGE_ERROR_NONE)
+      nns_edge_loge ("Failed to send an event for received message.");
+
+    nns_edge_data_destroy (data_h);
+  } else {
+    msg = nns_edge_memdup (message->payload, msg_len);
+
+    /* Push received message into msg queue. DO NOT free msg here. */
+    if (msg)
+      nns_edge_queue_push (bh->message_queue, msg, msg_len, nns_edge_free);
   }
 
   return;
@@ -169,6 +199,7 @@ _nns_edge_mqtt_init_client (const char *id, const char *topic, const char *host,
   bh->event_cb = NULL;
   bh->user_data = NULL;
   bh->cleared = false;
+  bh->retained = false;
   nns_edge_lock_init (bh);
   nns_edge_cond_init (bh);
 
@@ -297,7 +328,9 @@ nns_edge_mqtt_close (nns_edge_broker_h broker_h)
     nns_edge_logd ("Trying to disconnect MQTT (ID:%s, URL:%s:%d).",
         bh->id, bh->host, bh->port);
 
-    _nns_edge_clear_retained (bh);
+    /* Clear retained message only if it was published. */
+    if (bh->retained)
+      _nns_edge_clear_retained (bh);
 
     mosquitto_disconnect (handle);
     mosquitto_destroy (handle);
@@ -314,32 +347,89 @@ nns_edge_mqtt_close (nns_edge_broker_h broker_h)
   SAFE_FREE (bh->id);
   SAFE_FREE (bh->topic);
   SAFE_FREE (bh->host);
+  SAFE_FREE (bh->buffer);
   SAFE_FREE (bh);
 
   return NNS_EDGE_ERROR_NONE;
 }
 
+/**
+ * @brief Internal function to serialize edge data with given header format or compression.
+ */
+static int
+_nns_edge_mqtt_serialize_data (nns_edge_data_h data_h,
+    nns_edge_data_header_e header, nns_edge_compress_e compress,
+    nns_size_t threshold, void *data, nns_size_t data_len, nns_size_t * len)
+{
+  if (NNS_EDGE_COMPRESS_NONE != compress)
+    return nns_edge_data_serialize_compressed_into (data_h, compress,
+        threshold, data, data_len, len);
+
+  return nns_edge_data_serialize_into_full (data_h, header, data, data_len,
+      len);
+}
+
 /**
  * @brief Internal util function to send edge-data via MQTT connection.
+ * @note This is called by the send thread of edge handle only.
  */
 int
-nns_edge_mqtt_publish_data (nns_edge_broker_h broker_h, nns_edge_data_h data_h)
+nns_edge_mqtt_publish_data (nns_edge_broker_h broker_h, nns_edge_data_h data_h,
+    nns_edge_data_header_e header, nns_edge_compress_e compress,
+    nns_size_t threshold, const int qos, const bool retain)
 {
+  nns_edge_broker_s *bh;
+  nns_size_t size = 0;
+  int64_t start;
   int ret;
-  void *data = NULL;
-  nns_size_t size;
 
-  ret = nns_edge_data_serialize (data_h, &data, &size);
+  bh = (nns_edge_broker_s *) broker_h;
+  if (!bh) {
+    nns_edge_loge ("Invalid param, given broker handle is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  start = nns_edge_stats_start (bh->stats);
+
+  /* Serialize edge data into the buffer of broker handle, the buffer is reused for next data. */
+  ret = _nns_edge_mqtt_serialize_data (data_h, header, compress, threshold,
+      bh->buffer, bh->buffer_size, &size);
+  if (NNS_EDGE_ERROR_OUT_OF_MEMORY == ret && size > bh->buffer_size) {
+    SAFE_FREE (bh->buffer);
+    bh->buffer_size = 0;
+
+    bh->buffer = nns_edge_malloc (size);
+    if (!bh->buffer) {
+      nns_edge_loge ("Failed to allocate the buffer to serialize edge data.");
+      return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+    }
+
+    bh->buffer_size = size;
+    ret = _nns_edge_mqtt_serialize_data (data_h, header, compress, threshold,
+        bh->buffer, bh->buffer_size, &size);
+  }
+
   if (NNS_EDGE_ERROR_NONE != ret) {
     nns_edge_loge ("Failed to serialize the edge data.");
     return ret;
   }
 
-  ret = nns_edge_mqtt_publish (broker_h, data, size);
+  if (bh->stats) {
+    nns_edge_stats_done (&bh->stats->serialize, start);
+    start = nns_edge_stats_start (bh->stats);
+  }
+
+  /* MQTT library copies the payload, the buffer is available after publishing it. */
+  ret = nns_edge_mqtt_publish (broker_h, bh->buffer, size, qos, retain);
   if (NNS_EDGE_ERROR_NONE != ret)
     nns_edge_loge ("Failed to send data to destination.");
 
-  SAFE_FREE (data);
+  if (bh->stats) {
+    nns_edge_stats_done (&bh->stats->send, start);
+    if (NNS_EDGE_ERROR_NONE == ret)
+      nns_edge_stats_count (bh->stats->sent, 1U, size);
+  }
+
   return ret;
 }
 
@@ -349,7 +439,7 @@ nns_edge_mqtt_publish_data (nns_edge_broker_h broker_h, nns_edge_data_h data_h)
  */
 int
 nns_edge_mqtt_publish (nns_edge_broker_h broker_h, const void *data,
-    const int length)
+    const int length, const int qos, const bool retain)
 {
   nns_edge_broker_s *bh;
   struct mosquitto *handle;
@@ -365,6 +455,11 @@ nns_edge_mqtt_publish (nns_edge_broker_h broker_h, const void *data,
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
 
+  if (qos < 0 || qos > NNS_EDGE_MQTT_QOS_MAX) {
+    nns_edge_loge ("Invalid param, given QoS %d is invalid.", qos);
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
   bh = (nns_edge_broker_s *) broker_h;
   handle = bh->mqtt_h;
 
@@ -378,14 +473,16 @@ nns_edge_mqtt_publish (nns_edge_broker_h broker_h, const void *data,
     return NNS_EDGE_ERROR_IO;
   }
 
-  /* Publish a message (default QoS 1 - at least once and retained true). */
-  ret = mosquitto_publish (handle, NULL, bh->topic, length, data, 1, true);
+  ret = mosquitto_publish (handle, NULL, bh->topic, length, data, qos, retain);
   if (MOSQ_ERR_SUCCESS != ret) {
     nns_edge_loge ("Failed to publish a message (ID:%s, Topic:%s).",
         bh->id, bh->topic);
     return NNS_EDGE_ERROR_IO;
   }
 
+  if (retain)
+    bh->retained = true;
+
   return NNS_EDGE_ERROR_NONE;
 }
 
@@ -501,3 +598,23 @@ nns_edge_mqtt_set_event_callback (nns_edge_broker_h broker_h,
 
   return NNS_EDGE_ERROR_NONE;
 }
+
+/**
+ * @brief Set the statistics of edge handle, the broker updates it when sending and receiving the message.
+ */
+int
+nns_edge_mqtt_set_statistics (nns_edge_broker_h broker_h,
+    nns_edge_stats_s * stats)
+{
+  nns_edge_broker_s *bh;
+
+  if (!broker_h) {
+    nns_edge_loge ("Invalid param, given MQTT handle is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  bh = (nns_edge_broker_s *) broker_h;
+  bh->stats = stats;
+
+  return NNS_EDGE_ERROR_NONE;
+}
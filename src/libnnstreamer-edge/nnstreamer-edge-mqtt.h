@@ -15,6 +15,8 @@
 
 #include <stdbool.h>
 #include "nnstreamer-edge.h"
+#include "nnstreamer-edge-data-internal.h"
+#include "nnstreamer-edge-stats.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -22,6 +24,11 @@ extern "C" {
 
 typedef void *nns_edge_broker_h;
 
+/**
+ * @brief Max QoS level of MQTT message.
+ */
+#define NNS_EDGE_MQTT_QOS_MAX (2)
+
 #if defined(ENABLE_MQTT)
 /**
  * @brief Connect to MQTT.
@@ -38,8 +45,10 @@ int nns_edge_mqtt_close (nns_edge_broker_h broker_h);
 /**
  * @brief Publish raw data.
  * @note This is internal function for MQTT broker. You should call this with edge-handle lock.
+ * @param[in] qos The QoS level of the message (0: at most once, 1: at least once, 2: exactly once).
+ * @param[in] retain The broker keeps the message and delivers it to new subscriber if true.
  */
-int nns_edge_mqtt_publish (nns_edge_broker_h broker_h, const void *data, const int length);
+int nns_edge_mqtt_publish (nns_edge_broker_h broker_h, const void *data, const int length, const int qos, const bool retain);
 
 /**
  * @brief Subscribe a topic.
@@ -59,20 +68,31 @@ int nns_edge_mqtt_get_message (nns_edge_broker_h broker_h, void **msg, nns_size_
 
 /**
  * @brief Internal util function to send edge-data via MQTT connection.
+ * @param[in] header The header format to serialize edge-data.
+ * @param[in] compress The compression algorithm of the memories (NNS_EDGE_COMPRESS_NONE to send the memories without compression).
+ * @param[in] threshold The memory smaller than this size in bytes is not compressed.
+ * @param[in] qos The QoS level of the message.
+ * @param[in] retain The broker keeps the message if true.
  */
-int nns_edge_mqtt_publish_data (nns_edge_broker_h broker_h, nns_edge_data_h data_h);
+int nns_edge_mqtt_publish_data (nns_edge_broker_h broker_h, nns_edge_data_h data_h, nns_edge_data_header_e header, nns_edge_compress_e compress, nns_size_t threshold, const int qos, const bool retain);
 
 /**
  * @brief Set event callback for new message.
  */
 int nns_edge_mqtt_set_event_callback (nns_edge_broker_h broker_h, nns_edge_event_cb cb, void *user_data);
 
+/**
+ * @brief Set the statistics of edge handle, the broker updates it when sending and receiving the message.
+ * @note The bytes are the size of the serialized message.
+ */
+int nns_edge_mqtt_set_statistics (nns_edge_broker_h broker_h, nns_edge_stats_s *stats);
+
 #else
 /**
  * @todo consider to change code style later.
  * If MQTT is disabled, nnstreamer does not include nnstreamer_edge_mqtt.c, and changing code style will make error as it is not used function now.
  *
- * static int nns_edge_mqtt_publish (nns_edge_broker_h broker_h, const void *data, const int length)
+ * static int nns_edge_mqtt_publish (nns_edge_broker_h broker_h, const void *data, const int length, const int qos, const bool retain)
  * {
  *   return NNS_EDGE_ERROR_NOT_SUPPORTED;
  * }
@@ -85,6 +105,7 @@ int nns_edge_mqtt_set_event_callback (nns_edge_broker_h broker_h, nns_edge_event
 #define nns_edge_mqtt_get_message(...) (NNS_EDGE_ERROR_NOT_SUPPORTED)
 #define nns_edge_mqtt_publish_data(...) (NNS_EDGE_ERROR_NOT_SUPPORTED)
 #define nns_edge_mqtt_set_event_callback(...) (NNS_EDGE_ERROR_NOT_SUPPORTED)
+#define nns_edge_mqtt_set_statistics(...) (NNS_EDGE_ERROR_NOT_SUPPORTED)
 #endif /* ENABLE_MQTT */
 
 #ifdef __cplusplus
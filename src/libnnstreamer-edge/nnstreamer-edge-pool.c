@@ -0,0 +1,295 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   nnstreamer-edge-pool.c
+ * @date   14 October 2026
+ * @brief  Thread-safe buffer pool with size classes.
+ * @see    https://github.com/nnstreamer/nnstreamer-edge
+ * @author agent <agent@local>
+ * @bug    No known bugs except for NYI items
+ */
+
+#include <inttypes.h>
+#include "nnstreamer-edge-data-internal.h"
+#include "nnstreamer-edge-log.h"
+#include "nnstreamer-edge-pool.h"
+#include "nnstreamer-edge-util.h"
+
+/**
+ * @brief The size of smallest size class. Each class has buffers of (MIN_SIZE << index) bytes.
+ */
+#define NNS_EDGE_POOL_MIN_SIZE (64U)
+
+/**
+ * @brief The number of size classes, the largest class has 2GB buffers.
+ */
+#define NNS_EDGE_POOL_CLASSES (26U)
+
+/**
+ * @brief Internal structure for the hidden trailer of the buffer.
+ * @note The trailer is placed after the requested size, the buffer returned to the caller is the memory from the allocator and keeps its alignment.
+ */
+typedef struct
+{
+  uint32_t size_class; /**< index of size class, or NNS_EDGE_POOL_CLASSES if the buffer is not reusable. */
+  uint32_t magic;
+} nns_edge_pool_trailer_s;
+
+/**
+ * @brief Internal structure for the buffer released in the pool. The link to next buffer is kept in the released buffer.
+ */
+typedef struct _nns_edge_pool_buffer_s nns_edge_pool_buffer_s;
+
+/**
+ * @brief Internal structure for the buffer released in the pool. The link to next buffer is kept in the released buffer.
+ */
+struct _nns_edge_pool_buffer_s
+{
+  nns_edge_pool_buffer_s *next;
+};
+
+/**
+ * @brief Internal structure for buffer pool.
+ */
+typedef struct
+{
+  uint32_t magic;
+  pthread_mutex_t lock;
+
+  unsigned int limit; /**< Max buffers in each size class (default 0 means the pool is disabled) */
+  unsigned int length[NNS_EDGE_POOL_CLASSES];
+  nns_edge_pool_buffer_s *head[NNS_EDGE_POOL_CLASSES];
+} nns_edge_pool_s;
+
+/**
+ * @brief Get the index of size class for given size.
+ */
+static unsigned int
+_get_size_class (nns_size_t size)
+{
+  unsigned int c = 0U;
+  nns_size_t s = NNS_EDGE_POOL_MIN_SIZE;
+
+  while (s < size && c < NNS_EDGE_POOL_CLASSES) {
+    s <<= 1;
+    c++;
+  }
+
+  return c;
+}
+
+/**
+ * @brief Release all buffers in the pool.
+ * @note This function should be called with lock.
+ */
+static void
+_clear_buffers (nns_edge_pool_s * pool)
+{
+  nns_edge_pool_buffer_s *buf;
+  unsigned int c;
+
+  for (c = 0U; c < NNS_EDGE_POOL_CLASSES; c++) {
+    while ((buf = pool->head[c]) != NULL) {
+      pool->head[c] = buf->next;
+      nns_edge_data_free_mem (buf);
+    }
+
+    pool->length[c] = 0U;
+  }
+}
+
+/**
+ * @brief Create buffer pool.
+ */
+int
+nns_edge_pool_create (nns_edge_pool_h * handle)
+{
+  nns_edge_pool_s *pool;
+
+  if (!handle) {
+    nns_edge_loge ("[Pool] Invalid param, handle is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  pool = calloc (1, sizeof (nns_edge_pool_s));
+  if (!pool) {
+    nns_edge_loge ("[Pool] Failed to allocate new memory.");
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+  }
+
+  nns_edge_lock_init (pool);
+  nns_edge_handle_set_magic (pool, NNS_EDGE_MAGIC);
+
+  *handle = pool;
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Destroy buffer pool.
+ */
+int
+nns_edge_pool_destroy (nns_edge_pool_h handle)
+{
+  nns_edge_pool_s *pool = (nns_edge_pool_s *) handle;
+
+  if (!nns_edge_handle_is_valid (pool)) {
+    nns_edge_loge ("[Pool] Invalid param, pool is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (pool);
+  nns_edge_handle_set_magic (pool, NNS_EDGE_MAGIC_DEAD);
+  _clear_buffers (pool);
+  nns_edge_unlock (pool);
+
+  nns_edge_lock_destroy (pool);
+  SAFE_FREE (pool);
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Set the max number of released buffers kept in each size class.
+ */
+int
+nns_edge_pool_set_limit (nns_edge_pool_h handle, unsigned int limit)
+{
+  nns_edge_pool_s *pool = (nns_edge_pool_s *) handle;
+  nns_edge_pool_buffer_s *buf;
+  unsigned int c;
+
+  if (!nns_edge_handle_is_valid (pool)) {
+    nns_edge_loge ("[Pool] Invalid param, pool is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (pool);
+  pool->limit = limit;
+
+  /* Release the buffers exceeding new limit. */
+  for (c = 0U; c < NNS_EDGE_POOL_CLASSES; c++) {
+    while (pool->length[c] > limit) {
+      buf = pool->head[c];
+      pool->head[c] = buf->next;
+      pool->length[c]--;
+      nns_edge_data_free_mem (buf);
+    }
+  }
+  nns_edge_unlock (pool);
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Get the max number of released buffers kept in each size class.
+ */
+unsigned int
+nns_edge_pool_get_limit (nns_edge_pool_h handle)
+{
+  nns_edge_pool_s *pool = (nns_edge_pool_s *) handle;
+  unsigned int limit;
+
+  if (!nns_edge_handle_is_valid (pool)) {
+    nns_edge_loge ("[Pool] Invalid param, pool is invalid.");
+    return 0U;
+  }
+
+  nns_edge_lock (pool);
+  limit = pool->limit;
+  nns_edge_unlock (pool);
+
+  return limit;
+}
+
+/**
+ * @brief Get the buffer of given size from the pool.
+ */
+void *
+nns_edge_pool_alloc (nns_edge_pool_h handle, nns_size_t size)
+{
+  nns_edge_pool_s *pool = (nns_edge_pool_s *) handle;
+  nns_edge_pool_buffer_s *buf = NULL;
+  nns_edge_pool_trailer_s trailer;
+  nns_size_t alloc_size;
+  unsigned int c;
+
+  if (!nns_edge_handle_is_valid (pool)) {
+    nns_edge_loge ("[Pool] Invalid param, pool is invalid.");
+    return NULL;
+  }
+
+  if (size == 0 || size > SIZE_MAX - sizeof (nns_edge_pool_trailer_s)) {
+    nns_edge_loge ("[Pool] Invalid param, cannot allocate memory (%" PRIu64
+        ").", size);
+    return NULL;
+  }
+
+  c = _get_size_class (size);
+
+  nns_edge_lock (pool);
+  if (pool->limit == 0U) {
+    /* The pool is disabled, allocate exact size. */
+    c = NNS_EDGE_POOL_CLASSES;
+  } else if (c < NNS_EDGE_POOL_CLASSES && pool->head[c]) {
+    buf = pool->head[c];
+    pool->head[c] = buf->next;
+    pool->length[c]--;
+  }
+  nns_edge_unlock (pool);
+
+  if (!buf) {
+    alloc_size = (c < NNS_EDGE_POOL_CLASSES) ?
+        ((nns_size_t) NNS_EDGE_POOL_MIN_SIZE << c) : size;
+
+    buf = (nns_edge_pool_buffer_s *)
+        nns_edge_data_alloc_mem (alloc_size + sizeof (nns_edge_pool_trailer_s));
+    if (!buf) {
+      nns_edge_loge ("[Pool] Failed to allocate memory (%" PRIu64 ").", size);
+      return NULL;
+    }
+  }
+
+  /* The buffer in size class can be reused with other size, write the trailer after given size. */
+  trailer.size_class = c;
+  trailer.magic = NNS_EDGE_MAGIC;
+  memcpy ((char *) buf + size, &trailer, sizeof (nns_edge_pool_trailer_s));
+
+  return buf;
+}
+
+/**
+ * @brief Release the buffer allocated from the pool.
+ */
+void
+nns_edge_pool_release (nns_edge_pool_h handle, void *data, nns_size_t size)
+{
+  nns_edge_pool_s *pool = (nns_edge_pool_s *) handle;
+  nns_edge_pool_buffer_s *buf = (nns_edge_pool_buffer_s *) data;
+  nns_edge_pool_trailer_s trailer;
+  unsigned int c;
+
+  if (!data)
+    return;
+
+  memcpy (&trailer, (char *) data + size, sizeof (nns_edge_pool_trailer_s));
+  if (trailer.magic != NNS_EDGE_MAGIC) {
+    nns_edge_loge ("[Pool] Invalid param, the buffer is not allocated from the pool.");
+    return;
+  }
+
+  if (nns_edge_handle_is_valid (pool)) {
+    c = trailer.size_class;
+
+    nns_edge_lock (pool);
+    if (c < NNS_EDGE_POOL_CLASSES && pool->length[c] < pool->limit) {
+      buf->next = pool->head[c];
+      pool->head[c] = buf;
+      pool->length[c]++;
+      buf = NULL;
+    }
+    nns_edge_unlock (pool);
+  }
+
+  nns_edge_data_free_mem (buf);
+}
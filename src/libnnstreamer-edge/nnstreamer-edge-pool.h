@@ -0,0 +1,83 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   nnstreamer-edge-pool.h
+ * @date   14 October 2026
+ * @brief  Thread-safe buffer pool with size classes.
+ * @see    https://github.com/nnstreamer/nnstreamer-edge
+ * @author agent <agent@local>
+ * @note   This file is internal header for nnstreamer-edge. DO NOT export this file.
+ * @bug    No known bugs except for NYI items
+ */
+
+#ifndef __NNSTREAMER_EDGE_POOL_H__
+#define __NNSTREAMER_EDGE_POOL_H__
+
+#include "nnstreamer-edge-data.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+typedef void *nns_edge_pool_h;
+
+/**
+ * @brief Create buffer pool. Default limit is 0, the pool does not keep released buffers.
+ * @remarks If the function succeeds, @a handle should be released using nns_edge_pool_destroy().
+ * @param[out] handle Newly created handle.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int nns_edge_pool_create (nns_edge_pool_h *handle);
+
+/**
+ * @brief Destroy buffer pool and release all buffers in the pool.
+ * @note All buffers allocated from the pool should be released before destroying the pool.
+ * @param[in] handle The buffer pool handle.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int nns_edge_pool_destroy (nns_edge_pool_h handle);
+
+/**
+ * @brief Set the max number of released buffers kept in each size class. If the limit is 0, released buffer is freed immediately.
+ * @param[in] handle The buffer pool handle.
+ * @param[in] limit The max number of buffers in each size class.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int nns_edge_pool_set_limit (nns_edge_pool_h handle, unsigned int limit);
+
+/**
+ * @brief Get the max number of released buffers kept in each size class.
+ * @param[in] handle The buffer pool handle.
+ * @return The max number of buffers in each size class.
+ */
+unsigned int nns_edge_pool_get_limit (nns_edge_pool_h handle);
+
+/**
+ * @brief Get the buffer of given size from the pool. If the pool is empty, allocate new buffer.
+ * @note The buffer should be released using nns_edge_pool_release() with same size. The pool keeps its information after given size, and the buffer has the alignment of the allocator.
+ * @param[in] handle The buffer pool handle.
+ * @param[in] size The size of buffer.
+ * @return Newly allocated buffer, or NULL if failed to allocate or the size is 0.
+ */
+void *nns_edge_pool_alloc (nns_edge_pool_h handle, nns_size_t size);
+
+/**
+ * @brief Release the buffer allocated from the pool. The buffer is kept in the pool to be reused if the pool is not full.
+ * @param[in] handle The buffer pool handle which allocates the buffer.
+ * @param[in] data The buffer to be released.
+ * @param[in] size The size of buffer given when allocating the buffer.
+ */
+void nns_edge_pool_release (nns_edge_pool_h handle, void *data, nns_size_t size);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __NNSTREAMER_EDGE_POOL_H__ */
@@ -40,10 +40,61 @@ typedef struct
   nns_edge_queue_leak_e leaky;
   unsigned int max_data; /**< Max data in queue (default 0 means unlimited) */
   unsigned int length;
+  uint64_t dropped; /**< The number of data dropped by the leaky option */
+  bool stopped; /**< The threads do not wait for new data after stopping the queue */
   nns_edge_queue_data_s *head;
   nns_edge_queue_data_s *tail;
+
+  /* Preallocated ring buffer, used instead of the list if the capacity is set. */
+  unsigned int capacity;
+  unsigned int ring_head;
+  nns_edge_raw_data_s *ring;
 } nns_edge_queue_s;
 
+/**
+ * @brief Get the max number of data in the queue. Returns 0 if the queue is unlimited.
+ * @note This function should be called with lock.
+ */
+static unsigned int
+_get_max_data (nns_edge_queue_s * q)
+{
+  if (q->capacity > 0U && (q->max_data == 0U || q->max_data > q->capacity))
+    return q->capacity;
+
+  return q->max_data;
+}
+
+/**
+ * @brief Pop data from the ring buffer. If the param 'clear' is true, release old data and return null.
+ * @note This function should be called with lock.
+ */
+static bool
+_pop_ring_data (nns_edge_queue_s * q, bool clear, void **data,
+    nns_size_t * size)
+{
+  nns_edge_raw_data_s *rdata;
+
+  if (q->length == 0U)
+    return false;
+
+  rdata = &q->ring[q->ring_head];
+  q->ring_head = (q->ring_head + 1U) % q->capacity;
+  q->length--;
+
+  if (clear) {
+    if (rdata->destroy_cb)
+      rdata->destroy_cb (rdata->data);
+  } else {
+    if (data)
+      *data = rdata->data;
+    if (size)
+      *size = rdata->data_len;
+  }
+
+  memset (rdata, 0, sizeof (nns_edge_raw_data_s));
+  return !clear;
+}
+
 /**
  * @brief Pop data from queue. If the param 'clear' is true, release old data and return null.
  * @note This function should be called with lock.
@@ -54,6 +105,9 @@ _pop_data (nns_edge_queue_s * q, bool clear, void **data, nns_size_t * size)
   nns_edge_queue_data_s *qdata;
   bool popped = false;
 
+  if (q->ring)
+    return _pop_ring_data (q, clear, data, size);
+
   qdata = q->head;
   if (qdata) {
     q->head = qdata->next;
@@ -82,6 +136,15 @@ _pop_data (nns_edge_queue_s * q, bool clear, void **data, nns_size_t * size)
  */
 int
 nns_edge_queue_create (nns_edge_queue_h * handle)
+{
+  return nns_edge_queue_create_full (handle, 0U);
+}
+
+/**
+ * @brief Create queue with preallocated ring buffer.
+ */
+int
+nns_edge_queue_create_full (nns_edge_queue_h * handle, unsigned int capacity)
 {
   nns_edge_queue_s *q;
 
@@ -96,6 +159,17 @@ nns_edge_queue_create (nns_edge_queue_h * handle)
     return NNS_EDGE_ERROR_OUT_OF_MEMORY;
   }
 
+  if (capacity > 0U) {
+    q->ring = calloc (capacity, sizeof (nns_edge_raw_data_s));
+    if (!q->ring) {
+      nns_edge_loge ("[Queue] Failed to allocate new memory for ring buffer.");
+      SAFE_FREE (q);
+      return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+    }
+
+    q->capacity = capacity;
+  }
+
   nns_edge_lock_init (q);
   nns_edge_cond_init (q);
   nns_edge_handle_set_magic (q, NNS_EDGE_MAGIC);
@@ -124,6 +198,7 @@ nns_edge_queue_destroy (nns_edge_queue_h handle)
   nns_edge_handle_set_magic (q, NNS_EDGE_MAGIC_DEAD);
   nns_edge_cond_destroy (q);
   nns_edge_lock_destroy (q);
+  SAFE_FREE (q->ring);
   SAFE_FREE (q);
 
   return NNS_EDGE_ERROR_NONE;
@@ -154,6 +229,55 @@ nns_edge_queue_get_length (nns_edge_queue_h handle, unsigned int *length)
   return NNS_EDGE_ERROR_NONE;
 }
 
+/**
+ * @brief Get the number of data dropped by the leaky option of the queue.
+ */
+int
+nns_edge_queue_get_dropped (nns_edge_queue_h handle, uint64_t * dropped)
+{
+  nns_edge_queue_s *q = (nns_edge_queue_s *) handle;
+
+  if (!nns_edge_handle_is_valid (q)) {
+    nns_edge_loge ("[Queue] Invalid param, queue is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!dropped) {
+    nns_edge_loge ("[Queue] Invalid param, dropped is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (q);
+  *dropped = q->dropped;
+  nns_edge_unlock (q);
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Get the capacity of the preallocated ring buffer.
+ */
+int
+nns_edge_queue_get_capacity (nns_edge_queue_h handle, unsigned int *capacity)
+{
+  nns_edge_queue_s *q = (nns_edge_queue_s *) handle;
+
+  if (!nns_edge_handle_is_valid (q)) {
+    nns_edge_loge ("[Queue] Invalid param, queue is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!capacity) {
+    nns_edge_loge ("[Queue] Invalid param, capacity is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  /* The capacity is not changed after creating the queue. */
+  *capacity = q->capacity;
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
 /**
  * @brief Set the max length of the queue.
  */
@@ -168,6 +292,12 @@ nns_edge_queue_set_limit (nns_edge_queue_h handle, unsigned int limit,
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
 
+  if (q->ring && limit > q->capacity) {
+    nns_edge_loge ("[Queue] Invalid param, limit %u exceeds the capacity %u.",
+        limit, q->capacity);
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
   nns_edge_lock (q);
   q->max_data = limit;
   q->leaky = leaky;
@@ -186,6 +316,7 @@ nns_edge_queue_push (nns_edge_queue_h handle, void *data, nns_size_t size,
   int ret = NNS_EDGE_ERROR_NONE;
   nns_edge_queue_s *q = (nns_edge_queue_s *) handle;
   nns_edge_queue_data_s *qdata;
+  unsigned int max_data;
 
   if (!nns_edge_handle_is_valid (q)) {
     nns_edge_loge ("[Queue] Invalid param, queue is invalid.");
@@ -203,18 +334,32 @@ nns_edge_queue_push (nns_edge_queue_h handle, void *data, nns_size_t size,
   }
 
   nns_edge_lock (q);
-  if (q->max_data > 0U && q->length >= q->max_data) {
+  max_data = _get_max_data (q);
+  if (max_data > 0U && q->length >= max_data) {
     /* Clear old data in queue if leaky option is 'old'. */
+    q->dropped++;
     if (q->leaky == NNS_EDGE_QUEUE_LEAK_OLD) {
       _pop_data (q, true, NULL, NULL);
     } else {
       nns_edge_logw ("[Queue] Cannot push new data, max data in queue is %u.",
-          q->max_data);
+          max_data);
       ret = NNS_EDGE_ERROR_IO;
       goto done;
     }
   }
 
+  if (q->ring) {
+    nns_edge_raw_data_s *rdata;
+
+    /* Push data into the ring buffer without allocation. */
+    rdata = &q->ring[(q->ring_head + q->length) % q->capacity];
+    rdata->data = data;
+    rdata->data_len = size;
+    rdata->destroy_cb = destroy;
+    q->length++;
+    goto done;
+  }
+
   qdata = calloc (1, sizeof (nns_edge_queue_data_s));
   if (!qdata) {
     nns_edge_loge ("[Queue] Failed to allocate new memory for data.");
@@ -305,7 +450,7 @@ nns_edge_queue_wait_pop (nns_edge_queue_h handle, unsigned int timeout,
   *size = 0U;
 
   nns_edge_lock (q);
-  if (q->length == 0U)
+  if (q->length == 0U && !q->stopped)
     nns_edge_cond_wait_until (q, timeout);
 
   popped = _pop_data (q, false, data, size);
@@ -329,7 +474,8 @@ nns_edge_queue_clear (nns_edge_queue_h handle)
   }
 
   nns_edge_lock (q);
-  nns_edge_cond_signal (q);
+  /* Wake up all threads waiting for new data, several workers may wait for same queue. */
+  nns_edge_cond_broadcast (q);
 
   while (q->length > 0U)
     _pop_data (q, true, NULL, NULL);
@@ -337,3 +483,24 @@ nns_edge_queue_clear (nns_edge_queue_h handle)
   nns_edge_unlock (q);
   return NNS_EDGE_ERROR_NONE;
 }
+
+/**
+ * @brief Stop waiting for new data, and clear all data in the queue.
+ * @note After stopping the queue, nns_edge_queue_wait_pop does not wait for new data. The thread waiting without timeout can check its state and exit.
+ */
+int
+nns_edge_queue_stop (nns_edge_queue_h handle)
+{
+  nns_edge_queue_s *q = (nns_edge_queue_s *) handle;
+
+  if (!nns_edge_handle_is_valid (q)) {
+    nns_edge_loge ("[Queue] Invalid param, queue is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (q);
+  q->stopped = true;
+  nns_edge_unlock (q);
+
+  return nns_edge_queue_clear (handle);
+}
@@ -41,6 +41,19 @@ typedef enum {
  */
 int nns_edge_queue_create (nns_edge_queue_h *handle);
 
+/**
+ * @brief Create queue with preallocated ring buffer. The queue does not allocate memory when pushing new data.
+ * @remarks If the function succeeds, @a handle should be released using nns_edge_queue_destroy().
+ * @note The max length of the queue cannot exceed the capacity. If the capacity is 0, this function is same as nns_edge_queue_create().
+ * @param[out] handle Newly created handle.
+ * @param[in] capacity The number of data in the ring buffer.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int nns_edge_queue_create_full (nns_edge_queue_h *handle, unsigned int capacity);
+
 /**
  * @brief Destroy queue.
  * @param[in] handle The queue handle.
@@ -60,14 +73,35 @@ int nns_edge_queue_destroy (nns_edge_queue_h handle);
  */
 int nns_edge_queue_get_length (nns_edge_queue_h handle, unsigned int *length);
 
+/**
+ * @brief Get the number of data dropped by the leaky option of the queue.
+ * @details The data is dropped when pushing new data into the queue with max length. It counts both the new data which is not pushed and the old data which is removed.
+ * @param[in] handle The queue handle.
+ * @param[out] dropped The number of dropped data.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int nns_edge_queue_get_dropped (nns_edge_queue_h handle, uint64_t *dropped);
+
+/**
+ * @brief Get the capacity of the preallocated ring buffer.
+ * @param[in] handle The queue handle.
+ * @param[out] capacity The number of data in the ring buffer. 0 if the queue is not preallocated.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int nns_edge_queue_get_capacity (nns_edge_queue_h handle, unsigned int *capacity);
+
 /**
  * @brief Set the max length of the queue.
  * @param[in] handle The queue handle.
- * @param[in] limit The max data in queue. Default 0 means unlimited.
+ * @param[in] limit The max data in queue. Default 0 means unlimited, or the capacity of the preallocated ring buffer.
  * @param[in] leaky The queue leaky option.
  * @return 0 on success. Otherwise a negative error value.
  * @retval #NNS_EDGE_ERROR_NONE Successful.
- * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid, or the limit exceeds the capacity of the preallocated ring buffer.
  */
 int nns_edge_queue_set_limit (nns_edge_queue_h handle, unsigned int limit, nns_edge_queue_leak_e leaky);
 
@@ -119,6 +153,16 @@ int nns_edge_queue_wait_pop (nns_edge_queue_h handle, unsigned int timeout, void
  */
 int nns_edge_queue_clear (nns_edge_queue_h handle);
 
+/**
+ * @brief Stop the queue and clear all data in the queue.
+ * @details After stopping the queue, nns_edge_queue_wait_pop() returns without waiting for new data even if the timeout is infinite.
+ * @param[in] handle The queue handle.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int nns_edge_queue_stop (nns_edge_queue_h handle);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
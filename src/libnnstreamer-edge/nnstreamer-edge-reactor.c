@@ -0,0 +1,559 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   nnstreamer-edge-reactor.c
+ * @date   14 October 2026
+ * @brief  Event-driven socket reactor with a fixed worker pool.
+ * @see    https://github.com/nnstreamer/nnstreamer-edge
+ * @author agent <agent@local>
+ * @bug    No known bugs except for NYI items
+ */
+
+#include "nnstreamer-edge-reactor.h"
+
+/* The reactor uses epoll and eventfd, other platforms use the stubs in the header. */
+#if defined(__linux__)
+#include <errno.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+
+#include "nnstreamer-edge-log.h"
+#include "nnstreamer-edge-util.h"
+
+/**
+ * @brief The max number of events to be handled at once.
+ */
+#define N_EVENTS 64
+
+/**
+ * @brief Internal structure for the registered socket.
+ */
+typedef struct _nns_edge_reactor_entry_s nns_edge_reactor_entry_s;
+
+/**
+ * @brief Internal structure for the registered socket.
+ */
+struct _nns_edge_reactor_entry_s
+{
+  int fd;
+  nns_edge_reactor_cb cb;
+  void *user_data;
+
+  bool busy; /**< The socket is ready, callback is pending or in progress. */
+  bool in_cb; /**< The callback is in progress. */
+  bool removed; /**< Removed by other thread, waiting for the callback or the event thread releasing it. */
+  bool removed_in_cb; /**< Removed in the callback, release it after the callback returns. */
+  pthread_t worker;
+
+  nns_edge_reactor_entry_s *next;
+  nns_edge_reactor_entry_s *ready_next;
+};
+
+/**
+ * @brief Internal structure for the reactor.
+ */
+typedef struct
+{
+  uint32_t magic;
+  pthread_mutex_t lock;
+  pthread_cond_t cond; /**< Signal the worker threads when the socket is ready. */
+  pthread_cond_t idle_cond; /**< Signal when the callback returns. */
+
+  int epoll_fd;
+  int wake_fd;
+  bool running;
+
+  pthread_t event_thread;
+  pthread_t *workers;
+  unsigned int num_workers;
+
+  nns_edge_reactor_entry_s *entries;
+  nns_edge_reactor_entry_s *expired; /**< Removed entries, the event thread may still refer them. */
+  nns_edge_reactor_entry_s *ready_head;
+  nns_edge_reactor_entry_s *ready_tail;
+} nns_edge_reactor_s;
+
+/**
+ * @brief Watch the socket again. The socket is registered with one-shot option.
+ * @note This function should be called with lock.
+ */
+static void
+_nns_edge_reactor_rearm (nns_edge_reactor_s * r, nns_edge_reactor_entry_s * e)
+{
+  struct epoll_event ev;
+
+  memset (&ev, 0, sizeof (ev));
+  ev.events = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT;
+  ev.data.ptr = e;
+
+  if (epoll_ctl (r->epoll_fd, EPOLL_CTL_MOD, e->fd, &ev) < 0)
+    nns_edge_logw ("[Reactor] Failed to watch the socket %d again.", e->fd);
+}
+
+/**
+ * @brief Stop watching the socket of the entry.
+ * @note This function should be called with lock. The caller may close the socket and the fd can be reused for new socket, so the entry does not refer the fd any more.
+ */
+static void
+_nns_edge_reactor_unwatch (nns_edge_reactor_s * r, nns_edge_reactor_entry_s * e)
+{
+  if (e->fd < 0)
+    return;
+
+  epoll_ctl (r->epoll_fd, EPOLL_CTL_DEL, e->fd, NULL);
+  e->fd = -1;
+}
+
+/**
+ * @brief Unlink the entry from the list and release it.
+ * @note This function should be called with lock. If the socket is still watched, the event thread may refer the entry. Set the param 'deferred' to release it in the event thread.
+ */
+static void
+_nns_edge_reactor_release_entry (nns_edge_reactor_s * r,
+    nns_edge_reactor_entry_s * e, bool deferred)
+{
+  nns_edge_reactor_entry_s **cur;
+
+  cur = &r->entries;
+  while (*cur) {
+    if (*cur == e) {
+      *cur = e->next;
+      break;
+    }
+    cur = &(*cur)->next;
+  }
+
+  _nns_edge_reactor_unwatch (r, e);
+
+  if (deferred && r->event_thread) {
+    /* The event thread skips the removed entry, then releases it. */
+    e->removed = true;
+    e->next = r->expired;
+    r->expired = e;
+  } else {
+    SAFE_FREE (e);
+  }
+}
+
+/**
+ * @brief Release the expired entries.
+ * @note This function should be called with lock.
+ */
+static void
+_nns_edge_reactor_clear_expired (nns_edge_reactor_s * r)
+{
+  nns_edge_reactor_entry_s *e;
+
+  while ((e = r->expired) != NULL) {
+    r->expired = e->next;
+    SAFE_FREE (e);
+  }
+}
+
+/**
+ * @brief Remove the entry from the ready list.
+ * @note This function should be called with lock.
+ */
+static void
+_nns_edge_reactor_unlink_ready (nns_edge_reactor_s * r,
+    nns_edge_reactor_entry_s * e)
+{
+  nns_edge_reactor_entry_s *cur, *prev = NULL;
+
+  cur = r->ready_head;
+  while (cur) {
+    if (cur == e) {
+      if (prev)
+        prev->ready_next = e->ready_next;
+      else
+        r->ready_head = e->ready_next;
+
+      if (r->ready_tail == e)
+        r->ready_tail = prev;
+      break;
+    }
+
+    prev = cur;
+    cur = cur->ready_next;
+  }
+
+  e->ready_next = NULL;
+  e->busy = false;
+}
+
+/**
+ * @brief Event thread, wait for the sockets and push the ready sockets for the workers.
+ */
+static void *
+_nns_edge_reactor_event_thread (void *thread_data)
+{
+  nns_edge_reactor_s *r = (nns_edge_reactor_s *) thread_data;
+  struct epoll_event events[N_EVENTS];
+  int i, n;
+
+  while (r->running) {
+    n = epoll_wait (r->epoll_fd, events, N_EVENTS, -1);
+    if (n < 0) {
+      if (errno == EINTR)
+        continue;
+
+      nns_edge_loge ("[Reactor] Failed to wait for the socket events.");
+      break;
+    }
+
+    nns_edge_lock (r);
+    for (i = 0; i < n; i++) {
+      nns_edge_reactor_entry_s *e = events[i].data.ptr;
+
+      /* Wake fd is registered with null. */
+      if (!e || !r->running)
+        continue;
+
+      if (e->removed || e->removed_in_cb)
+        continue;
+
+      e->busy = true;
+      e->ready_next = NULL;
+      if (r->ready_tail)
+        r->ready_tail->ready_next = e;
+      else
+        r->ready_head = e;
+      r->ready_tail = e;
+    }
+
+    /* All events referring the expired entries are handled. */
+    _nns_edge_reactor_clear_expired (r);
+    pthread_cond_broadcast (&r->cond);
+    nns_edge_unlock (r);
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief Worker thread, invoke the callback of the ready socket.
+ */
+static void *
+_nns_edge_reactor_worker_thread (void *thread_data)
+{
+  nns_edge_reactor_s *r = (nns_edge_reactor_s *) thread_data;
+  nns_edge_reactor_entry_s *e;
+  bool keep;
+  int fd;
+
+  nns_edge_lock (r);
+  while (r->running) {
+    e = r->ready_head;
+    if (!e) {
+      nns_edge_cond_wait (r);
+      continue;
+    }
+
+    r->ready_head = e->ready_next;
+    if (!r->ready_head)
+      r->ready_tail = NULL;
+    e->ready_next = NULL;
+    e->in_cb = true;
+    e->worker = pthread_self ();
+    fd = e->fd;
+    nns_edge_unlock (r);
+
+    keep = e->cb (fd, e->user_data);
+
+    nns_edge_lock (r);
+    e->in_cb = false;
+    e->busy = false;
+    if (e->removed) {
+      /* Other thread is waiting, it will release the entry. */
+    } else if (e->removed_in_cb || !keep) {
+      _nns_edge_reactor_release_entry (r, e, false);
+    } else {
+      _nns_edge_reactor_rearm (r, e);
+    }
+    pthread_cond_broadcast (&r->idle_cond);
+  }
+  nns_edge_unlock (r);
+
+  return NULL;
+}
+
+/**
+ * @brief Create the reactor and start the event and worker threads.
+ */
+int
+nns_edge_reactor_create (unsigned int num_workers, nns_edge_reactor_h * handle)
+{
+  nns_edge_reactor_s *r;
+  struct epoll_event ev;
+  unsigned int i;
+  int ret = NNS_EDGE_ERROR_NONE;
+
+  if (num_workers == 0U) {
+    nns_edge_loge ("[Reactor] Invalid param, the number of workers is 0.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!handle) {
+    nns_edge_loge ("[Reactor] Invalid param, handle is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  r = calloc (1, sizeof (nns_edge_reactor_s));
+  if (!r) {
+    nns_edge_loge ("[Reactor] Failed to allocate new memory.");
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+  }
+
+  nns_edge_lock_init (r);
+  nns_edge_cond_init (r);
+  pthread_cond_init (&r->idle_cond, NULL);
+  nns_edge_handle_set_magic (r, NNS_EDGE_MAGIC);
+  r->epoll_fd = r->wake_fd = -1;
+
+  r->workers = calloc (num_workers, sizeof (pthread_t));
+  if (!r->workers) {
+    nns_edge_loge ("[Reactor] Failed to allocate new memory for workers.");
+    ret = NNS_EDGE_ERROR_OUT_OF_MEMORY;
+    goto error;
+  }
+
+  r->epoll_fd = epoll_create1 (EPOLL_CLOEXEC);
+  r->wake_fd = eventfd (0, EFD_CLOEXEC | EFD_NONBLOCK);
+  if (r->epoll_fd < 0 || r->wake_fd < 0) {
+    nns_edge_loge ("[Reactor] Failed to create epoll instance.");
+    ret = NNS_EDGE_ERROR_IO;
+    goto error;
+  }
+
+  memset (&ev, 0, sizeof (ev));
+  ev.events = EPOLLIN;
+  ev.data.ptr = NULL;
+  if (epoll_ctl (r->epoll_fd, EPOLL_CTL_ADD, r->wake_fd, &ev) < 0) {
+    nns_edge_loge ("[Reactor] Failed to watch the wake fd.");
+    ret = NNS_EDGE_ERROR_IO;
+    goto error;
+  }
+
+  r->running = true;
+  if (pthread_create (&r->event_thread, NULL, _nns_edge_reactor_event_thread,
+          r) != 0) {
+    nns_edge_loge ("[Reactor] Failed to create event thread.");
+    r->event_thread = 0;
+    ret = NNS_EDGE_ERROR_IO;
+    goto error;
+  }
+
+  for (i = 0; i < num_workers; i++) {
+    if (pthread_create (&r->workers[i], NULL, _nns_edge_reactor_worker_thread,
+            r) != 0) {
+      nns_edge_loge ("[Reactor] Failed to create worker thread.");
+      r->workers[i] = 0;
+      ret = NNS_EDGE_ERROR_IO;
+      goto error;
+    }
+    r->num_workers++;
+  }
+
+  *handle = r;
+  return NNS_EDGE_ERROR_NONE;
+
+error:
+  nns_edge_reactor_destroy (r);
+  return ret;
+}
+
+/**
+ * @brief Stop the event and worker threads.
+ */
+int
+nns_edge_reactor_stop (nns_edge_reactor_h handle)
+{
+  nns_edge_reactor_s *r = (nns_edge_reactor_s *) handle;
+  nns_edge_reactor_entry_s *e;
+  uint64_t val = 1;
+  unsigned int i;
+
+  if (!nns_edge_handle_is_valid (r)) {
+    nns_edge_loge ("[Reactor] Invalid param, reactor is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (r);
+  r->running = false;
+  pthread_cond_broadcast (&r->cond);
+  nns_edge_unlock (r);
+
+  if (r->wake_fd >= 0 && write (r->wake_fd, &val, sizeof (val)) < 0)
+    nns_edge_logw ("[Reactor] Failed to wake up the event thread.");
+
+  if (r->event_thread) {
+    pthread_join (r->event_thread, NULL);
+    r->event_thread = 0;
+  }
+
+  for (i = 0; i < r->num_workers; i++) {
+    pthread_join (r->workers[i], NULL);
+    r->workers[i] = 0;
+  }
+  r->num_workers = 0;
+
+  /* Nothing will be dispatched, clear pending sockets. */
+  nns_edge_lock (r);
+  while ((e = r->ready_head) != NULL) {
+    r->ready_head = e->ready_next;
+    e->ready_next = NULL;
+    e->busy = false;
+  }
+  r->ready_tail = NULL;
+  pthread_cond_broadcast (&r->idle_cond);
+  nns_edge_unlock (r);
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Stop the reactor and release all resources.
+ */
+int
+nns_edge_reactor_destroy (nns_edge_reactor_h handle)
+{
+  nns_edge_reactor_s *r = (nns_edge_reactor_s *) handle;
+
+  if (!nns_edge_handle_is_valid (r)) {
+    nns_edge_loge ("[Reactor] Invalid param, reactor is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_reactor_stop (r);
+
+  nns_edge_lock (r);
+  while (r->entries)
+    _nns_edge_reactor_release_entry (r, r->entries, false);
+  _nns_edge_reactor_clear_expired (r);
+  nns_edge_unlock (r);
+
+  if (r->wake_fd >= 0)
+    close (r->wake_fd);
+  if (r->epoll_fd >= 0)
+    close (r->epoll_fd);
+
+  nns_edge_handle_set_magic (r, NNS_EDGE_MAGIC_DEAD);
+  pthread_cond_destroy (&r->idle_cond);
+  nns_edge_cond_destroy (r);
+  nns_edge_lock_destroy (r);
+  SAFE_FREE (r->workers);
+  SAFE_FREE (r);
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Add the socket to the reactor.
+ */
+int
+nns_edge_reactor_add (nns_edge_reactor_h handle, int fd,
+    nns_edge_reactor_cb cb, void *user_data)
+{
+  nns_edge_reactor_s *r = (nns_edge_reactor_s *) handle;
+  nns_edge_reactor_entry_s *e;
+  struct epoll_event ev;
+  int ret = NNS_EDGE_ERROR_NONE;
+
+  if (!nns_edge_handle_is_valid (r)) {
+    nns_edge_loge ("[Reactor] Invalid param, reactor is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (fd < 0) {
+    nns_edge_loge ("[Reactor] Invalid param, fd is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!cb) {
+    nns_edge_loge ("[Reactor] Invalid param, callback is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  e = calloc (1, sizeof (nns_edge_reactor_entry_s));
+  if (!e) {
+    nns_edge_loge ("[Reactor] Failed to allocate new memory for socket.");
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+  }
+
+  e->fd = fd;
+  e->cb = cb;
+  e->user_data = user_data;
+
+  memset (&ev, 0, sizeof (ev));
+  ev.events = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT;
+  ev.data.ptr = e;
+
+  nns_edge_lock (r);
+  if (epoll_ctl (r->epoll_fd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+    nns_edge_loge ("[Reactor] Failed to watch the socket %d.", fd);
+    SAFE_FREE (e);
+    ret = NNS_EDGE_ERROR_IO;
+  } else {
+    e->next = r->entries;
+    r->entries = e;
+  }
+  nns_edge_unlock (r);
+
+  return ret;
+}
+
+/**
+ * @brief Remove the socket from the reactor.
+ */
+int
+nns_edge_reactor_remove (nns_edge_reactor_h handle, int fd)
+{
+  nns_edge_reactor_s *r = (nns_edge_reactor_s *) handle;
+  nns_edge_reactor_entry_s *e;
+  int ret = NNS_EDGE_ERROR_NONE;
+
+  if (!nns_edge_handle_is_valid (r)) {
+    nns_edge_loge ("[Reactor] Invalid param, reactor is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (r);
+  e = r->entries;
+  while (e && (e->fd != fd || e->removed || e->removed_in_cb))
+    e = e->next;
+
+  if (!e) {
+    ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    goto done;
+  }
+
+  if (e->in_cb && pthread_equal (e->worker, pthread_self ())) {
+    /* Called in the callback, the worker releases it after the callback. */
+    e->removed_in_cb = true;
+    _nns_edge_reactor_unwatch (r, e);
+    goto done;
+  }
+
+  if (!e->busy) {
+    /* The socket is still watched, the event thread may refer the entry. */
+    _nns_edge_reactor_release_entry (r, e, true);
+    goto done;
+  }
+
+  if (!e->in_cb)
+    _nns_edge_reactor_unlink_ready (r, e);
+
+  e->removed = true;
+  _nns_edge_reactor_unwatch (r, e);
+
+  while (e->busy)
+    pthread_cond_wait (&r->idle_cond, &r->lock);
+
+  _nns_edge_reactor_release_entry (r, e, false);
+
+done:
+  nns_edge_unlock (r);
+  return ret;
+}
+#endif /* __linux__ */
@@ -0,0 +1,100 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   nnstreamer-edge-reactor.h
+ * @date   14 October 2026
+ * @brief  Event-driven socket reactor with a fixed worker pool.
+ * @see    https://github.com/nnstreamer/nnstreamer-edge
+ * @author agent <agent@local>
+ * @note   This file is internal header for nnstreamer-edge. DO NOT export this file.
+ * @bug    No known bugs except for NYI items
+ */
+
+#ifndef __NNSTREAMER_EDGE_REACTOR_H__
+#define __NNSTREAMER_EDGE_REACTOR_H__
+
+#include <stdbool.h>
+#include "nnstreamer-edge.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+typedef void *nns_edge_reactor_h;
+
+/**
+ * @brief Callback to handle the readable socket.
+ * @note The callback is called in one of the worker threads, and the socket is not watched until the callback returns. Return false to stop watching the socket.
+ */
+typedef bool (*nns_edge_reactor_cb) (int fd, void *user_data);
+
+#if defined(__linux__)
+/**
+ * @brief Create the reactor and start the event and worker threads.
+ * @remarks If the function succeeds, @a handle should be released using nns_edge_reactor_destroy().
+ * @param[in] num_workers The number of worker threads to dispatch the ready sockets.
+ * @param[out] handle Newly created handle.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #NNS_EDGE_ERROR_IO Failed to create the event fd or threads.
+ */
+int nns_edge_reactor_create (unsigned int num_workers, nns_edge_reactor_h *handle);
+
+/**
+ * @brief Stop the event and worker threads. The callback in progress is completed before this function returns.
+ * @note After stopping the reactor, the registered callback is never called. The fd can be removed using nns_edge_reactor_remove().
+ * @param[in] handle The reactor handle.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int nns_edge_reactor_stop (nns_edge_reactor_h handle);
+
+/**
+ * @brief Stop the reactor and release all resources.
+ * @param[in] handle The reactor handle.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int nns_edge_reactor_destroy (nns_edge_reactor_h handle);
+
+/**
+ * @brief Add the socket to the reactor. The callback is called when the socket is readable.
+ * @param[in] handle The reactor handle.
+ * @param[in] fd The socket to be watched.
+ * @param[in] cb The callback to handle the readable socket.
+ * @param[in] user_data The user data passed to the callback.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #NNS_EDGE_ERROR_IO Failed to watch the socket.
+ */
+int nns_edge_reactor_add (nns_edge_reactor_h handle, int fd, nns_edge_reactor_cb cb, void *user_data);
+
+/**
+ * @brief Remove the socket from the reactor.
+ * @note The socket is not watched when this function returns, then the caller can close it. If the callback of the socket is in progress in other thread, this function waits until the callback returns. If this is called in the callback, the entry is released after the callback returns.
+ * @param[in] handle The reactor handle.
+ * @param[in] fd The socket to be removed.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid or the socket is not registered.
+ */
+int nns_edge_reactor_remove (nns_edge_reactor_h handle, int fd);
+#else
+#define nns_edge_reactor_create(...) (NNS_EDGE_ERROR_NOT_SUPPORTED)
+#define nns_edge_reactor_stop(...) (NNS_EDGE_ERROR_NOT_SUPPORTED)
+#define nns_edge_reactor_destroy(...) (NNS_EDGE_ERROR_NOT_SUPPORTED)
+#define nns_edge_reactor_add(...) (NNS_EDGE_ERROR_NOT_SUPPORTED)
+#define nns_edge_reactor_remove(...) (NNS_EDGE_ERROR_NOT_SUPPORTED)
+#endif /* __linux__ */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __NNSTREAMER_EDGE_REACTOR_H__ */
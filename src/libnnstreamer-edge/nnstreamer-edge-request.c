@@ -0,0 +1,229 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   nnstreamer-edge-request.c
+ * @date   14 October 2026
+ * @brief  In-flight requests of query client.
+ * @see    https://github.com/nnstreamer/nnstreamer-edge
+ * @author agent <agent@local>
+ * @bug    No known bugs except for NYI items
+ */
+
+#include "nnstreamer-edge-request.h"
+#include "nnstreamer-edge-data-internal.h"
+#include "nnstreamer-edge-log.h"
+
+/**
+ * @brief Remove the requests which do not receive the response until timeout.
+ * @note This function should be called with the lock of the requests.
+ * @return The time in milliseconds until the oldest request expires, or 0 if there is no timeout.
+ */
+static unsigned int
+_nns_edge_request_expire (nns_edge_request_window_s * rw, int64_t now)
+{
+  int64_t timeout, elapsed, remained = 0;
+  unsigned int i;
+
+  if (rw->timeout == 0U)
+    return 0U;
+
+  timeout = (int64_t) rw->timeout * 1000;
+  for (i = 0; i < rw->window && rw->count > 0; i++) {
+    if (rw->slots[i].id == 0)
+      continue;
+
+    elapsed = now - rw->slots[i].time;
+    if (elapsed >= timeout) {
+      nns_edge_logw ("Timeout, the response of request %llu is not received.",
+          (unsigned long long) rw->slots[i].id);
+      rw->slots[i].id = 0;
+      rw->count--;
+    } else if (remained == 0 || timeout - elapsed < remained) {
+      remained = timeout - elapsed;
+    }
+  }
+
+  return (unsigned int) ((remained + 999) / 1000);
+}
+
+/**
+ * @brief Add new request into the window. This function waits until the number of in-flight requests is less than the window.
+ */
+int
+nns_edge_request_add (nns_edge_handle_s * eh, uint64_t * request_id)
+{
+  nns_edge_request_window_s *rw;
+  unsigned int i, wait;
+
+  rw = &eh->requests;
+  nns_edge_lock (rw);
+
+  if (rw->stopped) {
+    nns_edge_loge ("Invalid state, the edge handle is stopped.");
+    nns_edge_unlock (rw);
+    return NNS_EDGE_ERROR_IO;
+  }
+
+  if (!rw->slots) {
+    rw->slots = (nns_edge_request_s *) calloc (rw->window,
+        sizeof (nns_edge_request_s));
+    if (!rw->slots) {
+      nns_edge_loge ("Failed to allocate memory for the requests.");
+      nns_edge_unlock (rw);
+      return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+    }
+  }
+
+  /* Wait for the response of in-flight request, or until the oldest request expires. */
+  rw->waiting++;
+  while (!rw->stopped) {
+    wait = _nns_edge_request_expire (rw, nns_edge_get_monotonic_time ());
+    if (rw->count < rw->window)
+      break;
+
+    nns_edge_cond_wait_until (rw, wait);
+  }
+  rw->waiting--;
+
+  if (rw->stopped) {
+    nns_edge_loge ("Invalid state, the edge handle is stopped while waiting for the window.");
+    nns_edge_cond_broadcast (rw);
+    nns_edge_unlock (rw);
+    return NNS_EDGE_ERROR_IO;
+  }
+
+  for (i = 0; i < rw->window; i++) {
+    if (rw->slots[i].id == 0)
+      break;
+  }
+
+  *request_id = ++rw->last_id;
+  rw->slots[i].id = *request_id;
+  rw->slots[i].time = nns_edge_get_monotonic_time ();
+  rw->slots[i].client_id = 0;
+  rw->count++;
+  nns_edge_unlock (rw);
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Remove the request which is waiting for the response, and wake up the thread waiting for the window.
+ * @return The round-trip time in microseconds, or -1 if the request is not found.
+ */
+int64_t
+nns_edge_request_done (nns_edge_handle_s * eh, uint64_t request_id)
+{
+  nns_edge_request_window_s *rw = &eh->requests;
+  int64_t rtt = -1;
+  unsigned int i;
+
+  if (request_id == 0 || NNS_EDGE_NODE_TYPE_QUERY_CLIENT != eh->node_type)
+    return -1;
+
+  nns_edge_lock (rw);
+  for (i = 0; rw->slots && rw->count > 0 && i < rw->window; i++) {
+    if (rw->slots[i].id == request_id) {
+      rtt = nns_edge_get_monotonic_time () - rw->slots[i].time;
+      rw->slots[i].id = 0;
+      rw->count--;
+      nns_edge_cond_signal (rw);
+      break;
+    }
+  }
+  nns_edge_unlock (rw);
+
+  return rtt;
+}
+
+/**
+ * @brief Set the request ID and round-trip time in received edge data.
+ */
+void
+nns_edge_request_set_data (nns_edge_handle_s * eh, nns_edge_data_h data_h,
+    uint64_t request_id)
+{
+  int64_t rtt = nns_edge_request_done (eh, request_id);
+
+  nns_edge_data_set_request (data_h, request_id, rtt);
+}
+
+/**
+ * @brief Keep the connection which the request is sent to. If the client ID is 0, the request is not sent to any connection and it is removed.
+ */
+void
+nns_edge_request_sent (nns_edge_handle_s * eh, nns_edge_data_h data_h,
+    int64_t client_id)
+{
+  nns_edge_request_window_s *rw = &eh->requests;
+  uint64_t request_id;
+  unsigned int i;
+
+  if (NNS_EDGE_NODE_TYPE_QUERY_CLIENT != eh->node_type ||
+      nns_edge_data_get_request_id (data_h, &request_id) != NNS_EDGE_ERROR_NONE
+      || request_id == 0)
+    return;
+
+  nns_edge_lock (rw);
+  for (i = 0; rw->slots && rw->count > 0 && i < rw->window; i++) {
+    if (rw->slots[i].id == request_id) {
+      if (client_id == 0) {
+        rw->slots[i].id = 0;
+        rw->count--;
+        nns_edge_cond_signal (rw);
+      } else {
+        rw->slots[i].client_id = client_id;
+      }
+      break;
+    }
+  }
+  nns_edge_unlock (rw);
+}
+
+/**
+ * @brief Remove the requests sent to the closed connection, the response is never received.
+ */
+void
+nns_edge_request_drop (nns_edge_handle_s * eh, int64_t client_id)
+{
+  nns_edge_request_window_s *rw = &eh->requests;
+  unsigned int i, dropped = 0U;
+
+  if (NNS_EDGE_NODE_TYPE_QUERY_CLIENT != eh->node_type)
+    return;
+
+  nns_edge_lock (rw);
+  for (i = 0; rw->slots && rw->count > 0 && i < rw->window; i++) {
+    if (rw->slots[i].id != 0 && rw->slots[i].client_id == client_id) {
+      rw->slots[i].id = 0;
+      rw->count--;
+      dropped++;
+    }
+  }
+
+  if (dropped > 0U) {
+    nns_edge_logw ("The connection is closed, remove %u in-flight requests.",
+        dropped);
+    nns_edge_cond_broadcast (rw);
+  }
+  nns_edge_unlock (rw);
+}
+
+/**
+ * @brief Start or stop the window of the requests. When stopping, wake up the threads waiting for the window and wait until they return.
+ */
+void
+nns_edge_request_set_stopped (nns_edge_handle_s * eh, bool stopped)
+{
+  nns_edge_request_window_s *rw = &eh->requests;
+
+  nns_edge_lock (rw);
+  rw->stopped = stopped;
+  if (stopped) {
+    nns_edge_cond_broadcast (rw);
+    while (rw->waiting > 0U)
+      nns_edge_cond_wait (rw);
+  }
+  nns_edge_unlock (rw);
+}
@@ -0,0 +1,63 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   nnstreamer-edge-request.h
+ * @date   14 October 2026
+ * @brief  In-flight requests of query client.
+ * @see    https://github.com/nnstreamer/nnstreamer-edge
+ * @author agent <agent@local>
+ * @note   This file is internal header for nnstreamer-edge. DO NOT export this file.
+ * @bug    No known bugs except for NYI items
+ */
+
+#ifndef __NNSTREAMER_EDGE_REQUEST_H__
+#define __NNSTREAMER_EDGE_REQUEST_H__
+
+#include "nnstreamer-edge-internal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @brief Add new request into the window. This function waits until the number of in-flight requests is less than the window.
+ * @param[in] eh The edge handle of query client.
+ * @param[out] request_id New request ID.
+ * @return 0 on success. Otherwise a negative error value. If the edge handle is stopped, this returns NNS_EDGE_ERROR_IO without waiting.
+ */
+int nns_edge_request_add (nns_edge_handle_s *eh, uint64_t *request_id);
+
+/**
+ * @brief Remove the request which is waiting for the response, and wake up the thread waiting for the window.
+ * @return The round-trip time in microseconds, or -1 if the request is not found.
+ */
+int64_t nns_edge_request_done (nns_edge_handle_s *eh, uint64_t request_id);
+
+/**
+ * @brief Set the request ID and round-trip time in received edge data.
+ */
+void nns_edge_request_set_data (nns_edge_handle_s *eh, nns_edge_data_h data_h, uint64_t request_id);
+
+/**
+ * @brief Keep the connection which the request is sent to.
+ * @param[in] data_h The edge data sent to the connection, which has the request ID.
+ * @param[in] client_id The client ID of the connection. If it is 0, the request is not sent to any connection and it is removed.
+ */
+void nns_edge_request_sent (nns_edge_handle_s *eh, nns_edge_data_h data_h, int64_t client_id);
+
+/**
+ * @brief Remove the requests sent to the closed connection, the response is never received.
+ */
+void nns_edge_request_drop (nns_edge_handle_s *eh, int64_t client_id);
+
+/**
+ * @brief Start or stop the window of the requests. When stopping, wake up the threads waiting for the window and wait until they return.
+ * @note The caller should not hold the lock of the requests.
+ */
+void nns_edge_request_set_stopped (nns_edge_handle_s *eh, bool stopped);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __NNSTREAMER_EDGE_REQUEST_H__ */
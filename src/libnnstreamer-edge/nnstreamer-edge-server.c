@@ -0,0 +1,180 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   nnstreamer-edge-server.c
+ * @date   14 October 2026
+ * @brief  Cache of the known servers of query client.
+ * @see    https://github.com/nnstreamer/nnstreamer-edge
+ * @author agent <agent@local>
+ * @bug    No known bugs except for NYI items
+ */
+
+#include "nnstreamer-edge-server.h"
+#include "nnstreamer-edge-log.h"
+
+/**
+ * @brief Find the server in the list of known servers.
+ * @note This function should be called with the lock of server list.
+ */
+static nns_edge_server_s *
+_nns_edge_server_find (nns_edge_handle_s * eh, const char *host, int port)
+{
+  nns_edge_server_s *server;
+  unsigned int i;
+
+  if (!host)
+    return NULL;
+
+  for (i = 0; i < eh->servers.len; i++) {
+    server = &eh->servers.list[i];
+
+    if (server->port == port && 0 == strcmp (server->host, host))
+      return server;
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief Add the server into the list of known servers. If the list is full, replace the server which has most failures.
+ * @note This function should be called with the lock of server list.
+ */
+nns_edge_server_s *
+nns_edge_server_add (nns_edge_handle_s * eh, const char *host, int port)
+{
+  nns_edge_server_s *server;
+  unsigned int i;
+  char *h;
+
+  server = _nns_edge_server_find (eh, host, port);
+  if (server || !host)
+    return server;
+
+  h = nns_edge_strdup (host);
+  if (!h) {
+    nns_edge_loge ("Failed to allocate memory for the server info.");
+    return NULL;
+  }
+
+  if (eh->servers.len < NNS_EDGE_SERVER_CACHE_LIMIT) {
+    server = &eh->servers.list[eh->servers.len++];
+  } else {
+    server = &eh->servers.list[0];
+    for (i = 1; i < eh->servers.len; i++) {
+      if (eh->servers.list[i].failures >= server->failures)
+        server = &eh->servers.list[i];
+    }
+
+    SAFE_FREE (server->host);
+    SAFE_FREE (server->caps);
+  }
+
+  memset (server, 0, sizeof (nns_edge_server_s));
+  server->host = h;
+  server->port = port;
+
+  return server;
+}
+
+/**
+ * @brief Update the list of known servers with the result of the connection. After the failures, the server is skipped for a while.
+ */
+void
+nns_edge_server_set_result (nns_edge_handle_s * eh, const char *host,
+    int port, bool connected)
+{
+  nns_edge_server_s *server;
+  unsigned int wait;
+
+  nns_edge_lock (&eh->servers);
+  server = _nns_edge_server_find (eh, host, port);
+  if (server) {
+    if (connected) {
+      server->failures = 0U;
+      server->retry_time = 0;
+    } else {
+      if (server->failures < 16U)
+        server->failures++;
+
+      wait = NNS_EDGE_SERVER_BACKOFF_MIN << (server->failures - 1U);
+      if (wait > NNS_EDGE_SERVER_BACKOFF_MAX)
+        wait = NNS_EDGE_SERVER_BACKOFF_MAX;
+
+      server->retry_time = nns_edge_get_monotonic_time () + wait * 1000;
+    }
+  }
+  nns_edge_unlock (&eh->servers);
+}
+
+/**
+ * @brief Check the server sends the capability accepted before, then the query client does not invoke the callback again.
+ */
+bool
+nns_edge_server_has_caps (nns_edge_handle_s * eh, nns_edge_conn_s * conn,
+    nns_edge_cmd_s * cmd)
+{
+  nns_edge_server_s *server;
+  bool cached = false;
+
+  if (!eh->servers.caps_cache || cmd->info.num == 0U)
+    return false;
+
+  nns_edge_lock (&eh->servers);
+  server = _nns_edge_server_find (eh, conn->host, conn->port);
+  if (server && server->caps && server->version == cmd->info.version &&
+      server->caps_len == cmd->info.mem_size[0] &&
+      0 == memcmp (server->caps, cmd->mem[0], server->caps_len))
+    cached = true;
+  nns_edge_unlock (&eh->servers);
+
+  return cached;
+}
+
+/**
+ * @brief Keep the capability accepted by the event callback, for the next connection to same server.
+ */
+void
+nns_edge_server_set_caps (nns_edge_handle_s * eh, nns_edge_conn_s * conn,
+    nns_edge_cmd_s * cmd)
+{
+  nns_edge_server_s *server;
+  void *caps;
+
+  if (!eh->servers.caps_cache || cmd->info.num == 0U)
+    return;
+
+  caps = nns_edge_memdup (cmd->mem[0], cmd->info.mem_size[0]);
+  if (!caps)
+    return;
+
+  nns_edge_lock (&eh->servers);
+  server = nns_edge_server_add (eh, conn->host, conn->port);
+  if (server) {
+    SAFE_FREE (server->caps);
+    server->caps = caps;
+    server->caps_len = cmd->info.mem_size[0];
+    server->version = cmd->info.version;
+    caps = NULL;
+  }
+  nns_edge_unlock (&eh->servers);
+
+  SAFE_FREE (caps);
+}
+
+/**
+ * @brief Release the list of known servers.
+ */
+void
+nns_edge_server_clear (nns_edge_handle_s * eh)
+{
+  unsigned int i;
+
+  nns_edge_lock (&eh->servers);
+  for (i = 0; i < eh->servers.len; i++) {
+    SAFE_FREE (eh->servers.list[i].host);
+    SAFE_FREE (eh->servers.list[i].caps);
+  }
+  eh->servers.len = 0U;
+  nns_edge_unlock (&eh->servers);
+}
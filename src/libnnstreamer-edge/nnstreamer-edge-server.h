@@ -0,0 +1,52 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   nnstreamer-edge-server.h
+ * @date   14 October 2026
+ * @brief  Cache of the known servers of query client.
+ * @see    https://github.com/nnstreamer/nnstreamer-edge
+ * @author agent <agent@local>
+ * @note   This file is internal header for nnstreamer-edge. DO NOT export this file.
+ * @bug    No known bugs except for NYI items
+ */
+
+#ifndef __NNSTREAMER_EDGE_SERVER_H__
+#define __NNSTREAMER_EDGE_SERVER_H__
+
+#include "nnstreamer-edge-internal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @brief Add the server into the list of known servers. If the list is full, replace the server which has most failures.
+ * @note This function should be called with the lock of server list.
+ */
+nns_edge_server_s *nns_edge_server_add (nns_edge_handle_s *eh, const char *host, int port);
+
+/**
+ * @brief Update the list of known servers with the result of the connection. After the failures, the server is skipped for a while.
+ */
+void nns_edge_server_set_result (nns_edge_handle_s *eh, const char *host, int port, bool connected);
+
+/**
+ * @brief Check the server sends the capability accepted before, then the query client does not invoke the callback again.
+ */
+bool nns_edge_server_has_caps (nns_edge_handle_s *eh, nns_edge_conn_s *conn, nns_edge_cmd_s *cmd);
+
+/**
+ * @brief Keep the capability accepted by the event callback, for the next connection to same server.
+ */
+void nns_edge_server_set_caps (nns_edge_handle_s *eh, nns_edge_conn_s *conn, nns_edge_cmd_s *cmd);
+
+/**
+ * @brief Release the list of known servers.
+ */
+void nns_edge_server_clear (nns_edge_handle_s *eh);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __NNSTREAMER_EDGE_SERVER_H__ */
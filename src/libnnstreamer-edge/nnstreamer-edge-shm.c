@@ -0,0 +1,454 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   nnstreamer-edge-shm.c
+ * @date   14 October 2026
+ * @brief  Shared memory ring to transfer data between the nodes running on same host.
+ * @see    https://github.com/nnstreamer/nnstreamer-edge
+ * @author agent <agent@local>
+ * @bug    No known bugs except for NYI items
+ */
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "nnstreamer-edge-log.h"
+#include "nnstreamer-edge-shm.h"
+#include "nnstreamer-edge-util.h"
+
+/**
+ * @brief The state of the record, the sender writes the record and the receiver releases it.
+ */
+#define NNS_EDGE_SHM_RECORD_BUSY (1U)
+#define NNS_EDGE_SHM_RECORD_RELEASED (2U)
+
+/**
+ * @brief Header at the start of the shared memory, the ring starts after NNS_EDGE_SHM_ALIGN bytes.
+ */
+typedef struct
+{
+  uint32_t magic;
+  uint32_t reserved;
+  uint64_t size; /**< The size of the ring. */
+} nns_edge_shm_header_s;
+
+/**
+ * @brief Header of the record in the ring, the data starts after NNS_EDGE_SHM_ALIGN bytes.
+ */
+typedef struct
+{
+  uint32_t magic;
+  uint32_t state; /**< The state of the record, only the receiver changes it to released. */
+  uint64_t len; /**< The length of the record including the header. */
+} nns_edge_shm_record_s;
+
+/**
+ * @brief Internal structure for the shared memory ring.
+ */
+typedef struct
+{
+  uint32_t magic;
+  pthread_mutex_t lock;
+
+  char *name;
+  bool owner; /**< The sender creates the shared memory and unlinks it when closing the ring. */
+  void *addr;
+  nns_size_t map_size;
+  char *ring;
+  nns_size_t size;
+
+  /* The position of next record, the oldest record and the used bytes in the ring. (sender only) */
+  nns_size_t head;
+  nns_size_t tail;
+  nns_size_t used;
+} nns_edge_shm_s;
+
+/**
+ * @brief Sequence number to generate the name of the shared memory.
+ */
+static uint32_t g_shm_seq = 0U;
+
+/**
+ * @brief Unmap the shared memory and release the handle.
+ */
+static void
+_release_shm (nns_edge_shm_s * shm)
+{
+  nns_edge_handle_set_magic (shm, NNS_EDGE_MAGIC_DEAD);
+
+  if (shm->addr)
+    munmap (shm->addr, shm->map_size);
+
+  /* The peer may not open the memory, unlink it. */
+  if (shm->owner)
+    shm_unlink (shm->name);
+
+  nns_edge_lock_destroy (shm);
+  SAFE_FREE (shm->name);
+  SAFE_FREE (shm);
+}
+
+/**
+ * @brief Create new shared memory ring to send data.
+ */
+int
+nns_edge_shm_create (nns_size_t size, nns_edge_shm_h * handle)
+{
+  nns_edge_shm_s *shm;
+  nns_edge_shm_header_s *header;
+  int fd = -1;
+  int ret = NNS_EDGE_ERROR_NONE;
+
+  if (size == 0 || size > SIZE_MAX - 2U * NNS_EDGE_SHM_ALIGN) {
+    nns_edge_loge ("[SHM] Invalid param, size is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!handle) {
+    nns_edge_loge ("[SHM] Invalid param, handle is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  shm = (nns_edge_shm_s *) calloc (1, sizeof (nns_edge_shm_s));
+  if (!shm) {
+    nns_edge_loge ("[SHM] Failed to allocate new memory.");
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+  }
+
+  nns_edge_lock_init (shm);
+  shm->owner = true;
+  shm->size = NNS_EDGE_SHM_ALIGN_SIZE (size);
+  shm->map_size = NNS_EDGE_SHM_ALIGN + shm->size;
+  shm->name = nns_edge_strdup_printf ("/nns-edge-%d-%lld-%u", (int) getpid (),
+      (long long) nns_edge_generate_id (),
+      __atomic_add_fetch (&g_shm_seq, 1U, __ATOMIC_RELAXED));
+
+  fd = shm_open (shm->name, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+  if (fd < 0) {
+    nns_edge_loge ("[SHM] Failed to create shared memory %s.", shm->name);
+    shm->owner = false;
+    ret = NNS_EDGE_ERROR_IO;
+    goto error;
+  }
+
+  if (ftruncate (fd, shm->map_size) < 0) {
+    nns_edge_loge ("[SHM] Failed to set the size of shared memory.");
+    ret = NNS_EDGE_ERROR_IO;
+    goto error;
+  }
+
+  shm->addr = mmap (NULL, shm->map_size, PROT_READ | PROT_WRITE, MAP_SHARED,
+      fd, 0);
+  if (shm->addr == MAP_FAILED) {
+    nns_edge_loge ("[SHM] Failed to map shared memory.");
+    shm->addr = NULL;
+    ret = NNS_EDGE_ERROR_IO;
+    goto error;
+  }
+
+  header = (nns_edge_shm_header_s *) shm->addr;
+  header->magic = NNS_EDGE_MAGIC;
+  header->size = shm->size;
+  shm->ring = (char *) shm->addr + NNS_EDGE_SHM_ALIGN;
+  nns_edge_handle_set_magic (shm, NNS_EDGE_MAGIC);
+
+error:
+  if (fd >= 0)
+    close (fd);
+
+  if (ret == NNS_EDGE_ERROR_NONE)
+    *handle = shm;
+  else
+    _release_shm (shm);
+
+  return ret;
+}
+
+/**
+ * @brief Open the shared memory ring created by other node, to receive data.
+ */
+int
+nns_edge_shm_open (const char *name, nns_edge_shm_h * handle)
+{
+  nns_edge_shm_s *shm;
+  nns_edge_shm_header_s *header;
+  struct stat st;
+  int fd = -1;
+  int ret = NNS_EDGE_ERROR_NONE;
+
+  if (!STR_IS_VALID (name)) {
+    nns_edge_loge ("[SHM] Invalid param, name is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!handle) {
+    nns_edge_loge ("[SHM] Invalid param, handle is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  shm = (nns_edge_shm_s *) calloc (1, sizeof (nns_edge_shm_s));
+  if (!shm) {
+    nns_edge_loge ("[SHM] Failed to allocate new memory.");
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+  }
+
+  nns_edge_lock_init (shm);
+  shm->owner = false;
+  shm->name = nns_edge_strdup (name);
+
+  fd = shm_open (shm->name, O_RDWR, 0);
+  if (fd < 0) {
+    nns_edge_loge ("[SHM] Failed to open shared memory %s.", shm->name);
+    ret = NNS_EDGE_ERROR_IO;
+    goto error;
+  }
+
+  /* Both nodes have the memory, unlink it not to remain the memory when the node is crashed. */
+  shm_unlink (shm->name);
+
+  if (fstat (fd, &st) < 0 || st.st_size <= (off_t) NNS_EDGE_SHM_ALIGN) {
+    nns_edge_loge ("[SHM] Invalid shared memory, failed to get the size.");
+    ret = NNS_EDGE_ERROR_IO;
+    goto error;
+  }
+
+  shm->map_size = (nns_size_t) st.st_size;
+  shm->addr = mmap (NULL, shm->map_size, PROT_READ | PROT_WRITE, MAP_SHARED,
+      fd, 0);
+  if (shm->addr == MAP_FAILED) {
+    nns_edge_loge ("[SHM] Failed to map shared memory.");
+    shm->addr = NULL;
+    ret = NNS_EDGE_ERROR_IO;
+    goto error;
+  }
+
+  header = (nns_edge_shm_header_s *) shm->addr;
+  if (header->magic != NNS_EDGE_MAGIC ||
+      header->size > shm->map_size - NNS_EDGE_SHM_ALIGN) {
+    nns_edge_loge ("[SHM] Invalid shared memory, the header is invalid.");
+    ret = NNS_EDGE_ERROR_IO;
+    goto error;
+  }
+
+  shm->size = header->size;
+  shm->ring = (char *) shm->addr + NNS_EDGE_SHM_ALIGN;
+  nns_edge_handle_set_magic (shm, NNS_EDGE_MAGIC);
+
+error:
+  if (fd >= 0)
+    close (fd);
+
+  if (ret == NNS_EDGE_ERROR_NONE)
+    *handle = shm;
+  else
+    _release_shm (shm);
+
+  return ret;
+}
+
+/**
+ * @brief Unmap the shared memory and release the handle.
+ */
+int
+nns_edge_shm_close (nns_edge_shm_h handle)
+{
+  nns_edge_shm_s *shm = (nns_edge_shm_s *) handle;
+
+  if (!nns_edge_handle_is_valid (shm)) {
+    nns_edge_loge ("[SHM] Invalid param, handle is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  _release_shm (shm);
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Get the name of the shared memory.
+ */
+const char *
+nns_edge_shm_get_name (nns_edge_shm_h handle)
+{
+  nns_edge_shm_s *shm = (nns_edge_shm_s *) handle;
+
+  if (!nns_edge_handle_is_valid (shm)) {
+    nns_edge_loge ("[SHM] Invalid param, handle is invalid.");
+    return NULL;
+  }
+
+  return shm->name;
+}
+
+/**
+ * @brief Reuse the space of the records released by the receiver, from the oldest record.
+ * @note This function should be called with lock.
+ */
+static void
+_reclaim_records (nns_edge_shm_s * shm)
+{
+  nns_edge_shm_record_s *rec;
+
+  while (shm->used > 0) {
+    rec = (nns_edge_shm_record_s *) (shm->ring + shm->tail);
+    if (__atomic_load_n (&rec->state, __ATOMIC_ACQUIRE) !=
+        NNS_EDGE_SHM_RECORD_RELEASED)
+      break;
+
+    shm->used -= rec->len;
+    shm->tail += rec->len;
+    if (shm->tail >= shm->size)
+      shm->tail = 0;
+  }
+
+  /* The ring is empty, start from the beginning to get the largest space. */
+  if (shm->used == 0)
+    shm->head = shm->tail = 0;
+}
+
+/**
+ * @brief Write the header of new record.
+ * @note This function should be called with lock.
+ */
+static void
+_write_record (nns_edge_shm_s * shm, nns_size_t pos, nns_size_t len,
+    uint32_t state)
+{
+  nns_edge_shm_record_s *rec;
+
+  rec = (nns_edge_shm_record_s *) (shm->ring + pos);
+  rec->magic = NNS_EDGE_MAGIC;
+  rec->len = len;
+  __atomic_store_n (&rec->state, state, __ATOMIC_RELEASE);
+
+  shm->used += len;
+  shm->head = pos + len;
+  if (shm->head >= shm->size)
+    shm->head = 0;
+}
+
+/**
+ * @brief Allocate a record of given size in the ring.
+ */
+void *
+nns_edge_shm_alloc (nns_edge_shm_h handle, nns_size_t size,
+    nns_size_t * offset)
+{
+  nns_edge_shm_s *shm = (nns_edge_shm_s *) handle;
+  nns_size_t len, pos;
+  bool found = false;
+
+  if (!nns_edge_handle_is_valid (shm) || !shm->owner) {
+    nns_edge_loge ("[SHM] Invalid param, handle is invalid.");
+    return NULL;
+  }
+
+  if (!offset) {
+    nns_edge_loge ("[SHM] Invalid param, offset is null.");
+    return NULL;
+  }
+
+  if (size > shm->size)
+    return NULL;
+
+  len = NNS_EDGE_SHM_ALIGN + NNS_EDGE_SHM_ALIGN_SIZE (size);
+
+  nns_edge_lock (shm);
+  _reclaim_records (shm);
+
+  pos = shm->head;
+  if (shm->used == 0 || shm->head > shm->tail) {
+    /* Free space is from head to the end, and from the beginning to tail. */
+    if (shm->size - shm->head >= len) {
+      found = true;
+    } else if (shm->tail >= len) {
+      /* Skip the space at the end of the ring and write new record from the beginning. */
+      _write_record (shm, shm->head, shm->size - shm->head,
+          NNS_EDGE_SHM_RECORD_RELEASED);
+      pos = 0;
+      found = true;
+    }
+  } else if (shm->tail - shm->head >= len) {
+    found = true;
+  }
+
+  if (found) {
+    _write_record (shm, pos, len, NNS_EDGE_SHM_RECORD_BUSY);
+    *offset = pos;
+  }
+  nns_edge_unlock (shm);
+
+  return found ? (shm->ring + pos + NNS_EDGE_SHM_ALIGN) : NULL;
+}
+
+/**
+ * @brief Get the record at given offset. Returns NULL if the record is invalid.
+ */
+static nns_edge_shm_record_s *
+_get_record (nns_edge_shm_s * shm, nns_size_t offset)
+{
+  nns_edge_shm_record_s *rec;
+
+  if ((offset % NNS_EDGE_SHM_ALIGN) != 0 ||
+      offset >= shm->size || shm->size - offset < NNS_EDGE_SHM_ALIGN)
+    return NULL;
+
+  rec = (nns_edge_shm_record_s *) (shm->ring + offset);
+  if (rec->magic != NNS_EDGE_MAGIC)
+    return NULL;
+
+  return rec;
+}
+
+/**
+ * @brief Get the address of the data in the record.
+ */
+void *
+nns_edge_shm_get (nns_edge_shm_h handle, nns_size_t offset, nns_size_t size)
+{
+  nns_edge_shm_s *shm = (nns_edge_shm_s *) handle;
+  nns_edge_shm_record_s *rec;
+
+  if (!nns_edge_handle_is_valid (shm)) {
+    nns_edge_loge ("[SHM] Invalid param, handle is invalid.");
+    return NULL;
+  }
+
+  rec = _get_record (shm, offset);
+  if (!rec || size > shm->size ||
+      rec->len < NNS_EDGE_SHM_ALIGN + NNS_EDGE_SHM_ALIGN_SIZE (size) ||
+      rec->len > shm->size - offset ||
+      __atomic_load_n (&rec->state, __ATOMIC_ACQUIRE) !=
+      NNS_EDGE_SHM_RECORD_BUSY) {
+    nns_edge_loge ("[SHM] Invalid param, the record is invalid.");
+    return NULL;
+  }
+
+  return (char *) rec + NNS_EDGE_SHM_ALIGN;
+}
+
+/**
+ * @brief Release the record, then the sender reuses the space of the record.
+ */
+int
+nns_edge_shm_release (nns_edge_shm_h handle, nns_size_t offset)
+{
+  nns_edge_shm_s *shm = (nns_edge_shm_s *) handle;
+  nns_edge_shm_record_s *rec;
+
+  if (!nns_edge_handle_is_valid (shm)) {
+    nns_edge_loge ("[SHM] Invalid param, handle is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  rec = _get_record (shm, offset);
+  if (!rec) {
+    nns_edge_loge ("[SHM] Invalid param, the record is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  __atomic_store_n (&rec->state, NNS_EDGE_SHM_RECORD_RELEASED,
+      __ATOMIC_RELEASE);
+  return NNS_EDGE_ERROR_NONE;
+}
@@ -0,0 +1,141 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   nnstreamer-edge-shm.h
+ * @date   14 October 2026
+ * @brief  Shared memory ring to transfer data between the nodes running on same host.
+ * @see    https://github.com/nnstreamer/nnstreamer-edge
+ * @author agent <agent@local>
+ * @note   This file is internal header for nnstreamer-edge. DO NOT export this file.
+ * @bug    No known bugs except for NYI items
+ */
+
+#ifndef __NNSTREAMER_EDGE_SHM_H__
+#define __NNSTREAMER_EDGE_SHM_H__
+
+#include "nnstreamer-edge.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+typedef void *nns_edge_shm_h;
+
+/**
+ * @brief The alignment of the records in the ring. The memory in the record is also aligned with this value.
+ */
+#define NNS_EDGE_SHM_ALIGN (64U)
+
+/**
+ * @brief Align the size with NNS_EDGE_SHM_ALIGN.
+ */
+#define NNS_EDGE_SHM_ALIGN_SIZE(s) \
+    (((s) + NNS_EDGE_SHM_ALIGN - 1U) & ~((nns_size_t) NNS_EDGE_SHM_ALIGN - 1U))
+
+#if defined(ENABLE_SHM)
+/**
+ * @brief Create new shared memory ring to send data. The ring is written by the sender only.
+ * @remarks If the function succeeds, @a handle should be released using nns_edge_shm_close().
+ * @param[in] size The size of the ring. It is aligned with NNS_EDGE_SHM_ALIGN.
+ * @param[out] handle Newly created handle.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #NNS_EDGE_ERROR_IO Failed to create or map the shared memory.
+ */
+int nns_edge_shm_create (nns_size_t size, nns_edge_shm_h *handle);
+
+/**
+ * @brief Open the shared memory ring created by other node, to receive data.
+ * @note The name of the shared memory is unlinked after opening it, the memory is released when both nodes close the ring.
+ * @remarks If the function succeeds, @a handle should be released using nns_edge_shm_close().
+ * @param[in] name The name of the shared memory, see nns_edge_shm_get_name().
+ * @param[out] handle Newly created handle.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #NNS_EDGE_ERROR_IO Failed to open or map the shared memory.
+ */
+int nns_edge_shm_open (const char *name, nns_edge_shm_h *handle);
+
+/**
+ * @brief Unmap the shared memory and release the handle.
+ * @param[in] handle The shared memory handle.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int nns_edge_shm_close (nns_edge_shm_h handle);
+
+/**
+ * @brief Get the name of the shared memory, the peer opens the ring with this name.
+ * @param[in] handle The shared memory handle.
+ * @return The name of the shared memory, or NULL if given handle is invalid. DO NOT release returned value.
+ */
+const char *nns_edge_shm_get_name (nns_edge_shm_h handle);
+
+/**
+ * @brief Allocate a record of given size in the ring. The space of the records released by the peer is reused.
+ * @note This function is called by the sender. It does not block if the ring is full.
+ * @param[in] handle The shared memory handle created by nns_edge_shm_create().
+ * @param[in] size The size of the data in the record.
+ * @param[out] offset The offset of the record, the peer gets the data with this value.
+ * @return The address of the data in the record, or NULL if the ring does not have enough space.
+ */
+void *nns_edge_shm_alloc (nns_edge_shm_h handle, nns_size_t size, nns_size_t *offset);
+
+/**
+ * @brief Get the address of the data in the record.
+ * @note This function is called by the receiver. The data is available until the record is released.
+ * @param[in] handle The shared memory handle opened by nns_edge_shm_open().
+ * @param[in] offset The offset of the record.
+ * @param[in] size The size of the data in the record.
+ * @return The address of the data, or NULL if the record is invalid.
+ */
+void *nns_edge_shm_get (nns_edge_shm_h handle, nns_size_t offset, nns_size_t size);
+
+/**
+ * @brief Release the record, then the sender reuses the space of the record.
+ * @param[in] handle The shared memory handle opened by nns_edge_shm_open().
+ * @param[in] offset The offset of the record.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int nns_edge_shm_release (nns_edge_shm_h handle, nns_size_t offset);
+#else
+#define nns_edge_shm_create(...) (NNS_EDGE_ERROR_NOT_SUPPORTED)
+#define nns_edge_shm_open(...) (NNS_EDGE_ERROR_NOT_SUPPORTED)
+#define nns_edge_shm_get_name(...) (NULL)
+#define nns_edge_shm_alloc(...) (NULL)
+#define nns_edge_shm_get(...) (NULL)
+
+/**
+ * @brief Shared memory is not supported. Inline function, the caller may ignore the return value.
+ */
+static inline int
+nns_edge_shm_close (nns_edge_shm_h handle)
+{
+  (void) handle;
+  return NNS_EDGE_ERROR_NOT_SUPPORTED;
+}
+
+/**
+ * @brief Shared memory is not supported. Inline function, the caller may ignore the return value.
+ */
+static inline int
+nns_edge_shm_release (nns_edge_shm_h handle, nns_size_t offset)
+{
+  (void) handle;
+  (void) offset;
+  return NNS_EDGE_ERROR_NOT_SUPPORTED;
+}
+#endif /* ENABLE_SHM */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __NNSTREAMER_EDGE_SHM_H__ */
@@ -0,0 +1,175 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   nnstreamer-edge-socket.c
+ * @date   14 October 2026
+ * @brief  Socket address and options of TCP and unix domain socket connections.
+ * @see    https://github.com/nnstreamer/nnstreamer-edge
+ * @author agent <agent@local>
+ * @bug    No known bugs except for NYI items
+ */
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netdb.h>
+#include <stddef.h>
+#include <sys/stat.h>
+
+#include "nnstreamer-edge-log.h"
+#include "nnstreamer-edge-socket.h"
+#include "nnstreamer-edge-util.h"
+
+/**
+ * @brief Set socket option. Unix domain socket does not need the option for TCP connection.
+ */
+void
+nns_edge_socket_set_option (nns_edge_connect_type_e connect_type, int fd)
+{
+  int nodelay = 1;
+
+  if (NNS_EDGE_CONNECT_TYPE_UDS == connect_type)
+    return;
+
+  /* setting TCP_NODELAY to true in order to avoid packet batching as known as Nagle's algorithm */
+  if (setsockopt (fd, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof (int)) < 0)
+    nns_edge_logw ("Failed to set TCP delay option.");
+}
+
+/**
+ * @brief Set the timeout (milliseconds) of blocking send and receive. If timeout is 0, the socket blocks without timeout.
+ */
+void
+nns_edge_socket_set_timeout (int fd, unsigned int timeout)
+{
+  struct timeval tv;
+
+  tv.tv_sec = timeout / 1000U;
+  tv.tv_usec = (timeout % 1000U) * 1000U;
+
+  if (setsockopt (fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof (tv)) < 0)
+    nns_edge_logw ("Failed to set receive timeout of the socket.");
+  if (setsockopt (fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof (tv)) < 0)
+    nns_edge_logw ("Failed to set send timeout of the socket.");
+}
+
+/**
+ * @brief Fill socket address struct from host name and port number.
+ */
+static bool
+_fill_inet_socket_addr (struct sockaddr_in *saddr, const char *host,
+    const int port)
+{
+  /** @todo handle protocol (ipv4 and ipv6) */
+  saddr->sin_family = AF_INET;
+  saddr->sin_port = htons (port);
+
+  if ((saddr->sin_addr.s_addr = inet_addr (host)) == INADDR_NONE) {
+    int ret;
+    char *port_str = NULL;
+    struct addrinfo hints;
+    struct addrinfo *addrs = NULL;
+
+    memset (&hints, 0, sizeof (hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+
+    if (port > 0)
+      port_str = nns_edge_strdup_printf ("%d", port);
+    ret = getaddrinfo (host, port_str, &hints, &addrs);
+    SAFE_FREE (port_str);
+
+    if (ret != 0 || addrs == NULL)
+      return false;
+
+    memcpy (saddr, addrs->ai_addr, addrs->ai_addrlen);
+    freeaddrinfo (addrs);
+  }
+
+  return true;
+}
+
+/**
+ * @brief Fill unix domain socket address struct from host name and port number.
+ * @note If the host is an absolute path, the socket is bound to the file and the port is ignored.
+ * Otherwise the socket is bound to the name "nnstreamer-edge-<host>-<port>" in the abstract namespace.
+ */
+static bool
+_fill_unix_socket_addr (struct sockaddr_un *saddr, socklen_t * saddr_len,
+    const char *host, const int port)
+{
+  size_t len;
+  int n;
+
+  memset (saddr, 0, sizeof (struct sockaddr_un));
+  saddr->sun_family = AF_UNIX;
+
+  if (host[0] == '/') {
+    len = strlen (host);
+    if (len >= sizeof (saddr->sun_path))
+      return false;
+
+    memcpy (saddr->sun_path, host, len);
+    *saddr_len = offsetof (struct sockaddr_un, sun_path) + len + 1;
+  } else {
+    n = snprintf (saddr->sun_path + 1, sizeof (saddr->sun_path) - 1,
+        "nnstreamer-edge-%s-%d", host, port);
+    if (n < 0 || (size_t) n >= sizeof (saddr->sun_path) - 1)
+      return false;
+
+    *saddr_len = offsetof (struct sockaddr_un, sun_path) + 1 + n;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Fill socket address struct according to the connection type.
+ */
+bool
+nns_edge_socket_fill_addr (nns_edge_connect_type_e connect_type,
+    struct sockaddr_storage *saddr, socklen_t * saddr_len, const char *host,
+    const int port)
+{
+  if (!STR_IS_VALID (host))
+    return false;
+
+  memset (saddr, 0, sizeof (struct sockaddr_storage));
+
+  if (NNS_EDGE_CONNECT_TYPE_UDS == connect_type)
+    return _fill_unix_socket_addr ((struct sockaddr_un *) saddr, saddr_len,
+        host, port);
+
+  *saddr_len = sizeof (struct sockaddr_in);
+  return _fill_inet_socket_addr ((struct sockaddr_in *) saddr, host, port);
+}
+
+/**
+ * @brief Remove the file of unix domain socket if no node is listening on it.
+ */
+void
+nns_edge_socket_remove_stale_file (const char *path)
+{
+  struct sockaddr_un saddr;
+  socklen_t saddr_len;
+  struct stat st;
+  int fd;
+
+  if (stat (path, &st) < 0 || !S_ISSOCK (st.st_mode))
+    return;
+
+  if (!_fill_unix_socket_addr (&saddr, &saddr_len, path, 0))
+    return;
+
+  fd = socket (AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0)
+    return;
+
+  if (connect (fd, (struct sockaddr *) &saddr, saddr_len) < 0 &&
+      errno == ECONNREFUSED) {
+    nns_edge_logw ("Remove stale socket file %s.", path);
+    unlink (path);
+  }
+
+  close (fd);
+}
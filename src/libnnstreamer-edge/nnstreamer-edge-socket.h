@@ -0,0 +1,57 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   nnstreamer-edge-socket.h
+ * @date   14 October 2026
+ * @brief  Socket address and options of TCP and unix domain socket connections.
+ * @see    https://github.com/nnstreamer/nnstreamer-edge
+ * @author agent <agent@local>
+ * @note   This file is internal header for nnstreamer-edge. DO NOT export this file.
+ * @bug    No known bugs except for NYI items
+ */
+
+#ifndef __NNSTREAMER_EDGE_SOCKET_H__
+#define __NNSTREAMER_EDGE_SOCKET_H__
+
+#include <stdbool.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "nnstreamer-edge.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @brief Set socket option. Unix domain socket does not need the option for TCP connection.
+ */
+void nns_edge_socket_set_option (nns_edge_connect_type_e connect_type, int fd);
+
+/**
+ * @brief Set the timeout (milliseconds) of blocking send and receive. If timeout is 0, the socket blocks without timeout.
+ */
+void nns_edge_socket_set_timeout (int fd, unsigned int timeout);
+
+/**
+ * @brief Fill socket address struct according to the connection type.
+ * @note In unix domain socket connection, if the host is an absolute path, the socket is bound to the file and the port is ignored.
+ * Otherwise the socket is bound to the name "nnstreamer-edge-<host>-<port>" in the abstract namespace.
+ * @param[in] connect_type The connection type, TCP (including hybrid) or UDS.
+ * @param[out] saddr The socket address.
+ * @param[out] saddr_len The length of the socket address.
+ * @param[in] host The host name, IP address or the path of unix domain socket.
+ * @param[in] port The port number.
+ * @return false if the host is invalid.
+ */
+bool nns_edge_socket_fill_addr (nns_edge_connect_type_e connect_type, struct sockaddr_storage *saddr, socklen_t *saddr_len, const char *host, const int port);
+
+/**
+ * @brief Remove the file of unix domain socket if no node is listening on it.
+ */
+void nns_edge_socket_remove_stale_file (const char *path);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __NNSTREAMER_EDGE_SOCKET_H__ */
@@ -0,0 +1,171 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   nnstreamer-edge-stats.c
+ * @date   14 October 2026
+ * @brief  Statistics of edge handle, the counters are updated in the threads sending and receiving data.
+ * @see    https://github.com/nnstreamer/nnstreamer-edge
+ * @author agent <agent@local>
+ * @bug    No known bugs except for NYI items
+ */
+
+#include "nnstreamer-edge-log.h"
+#include "nnstreamer-edge-stats.h"
+#include "nnstreamer-edge-util.h"
+
+/**
+ * @brief The max length of the statistics string.
+ */
+#define NNS_EDGE_STATS_STR_LEN 1024
+
+/**
+ * @brief Get the total size of the memories in edge data.
+ */
+nns_size_t
+nns_edge_stats_get_data_size (nns_edge_data_h data_h)
+{
+  nns_size_t total = 0, size;
+  unsigned int i, num = 0;
+  void *mem;
+
+  if (nns_edge_data_get_count (data_h, &num) != NNS_EDGE_ERROR_NONE)
+    return 0;
+
+  for (i = 0; i < num; i++) {
+    if (nns_edge_data_get (data_h, i, &mem, &size) == NNS_EDGE_ERROR_NONE)
+      total += size;
+  }
+
+  return total;
+}
+
+/**
+ * @brief Get the time to start the measurement.
+ */
+int64_t
+nns_edge_stats_start (nns_edge_stats_s * stats)
+{
+  if (!stats || !__atomic_load_n (&stats->timing, __ATOMIC_RELAXED))
+    return 0;
+
+  return nns_edge_get_monotonic_time ();
+}
+
+/**
+ * @brief Add the duration from given start time into the histogram.
+ */
+void
+nns_edge_stats_done (nns_edge_stats_hist_s * hist, int64_t start)
+{
+  uint64_t duration, max, v;
+  unsigned int bucket = 0U;
+
+  if (!hist || start <= 0)
+    return;
+
+  duration = (uint64_t) (nns_edge_get_monotonic_time () - start);
+
+  /* The bucket i has the durations in [2^(i-1), 2^i). */
+  for (v = duration; v > 0U && bucket < NNS_EDGE_STATS_BUCKETS - 1U; v >>= 1)
+    bucket++;
+
+  nns_edge_stats_add (hist->count, 1U);
+  nns_edge_stats_add (hist->sum, duration);
+  nns_edge_stats_add (hist->buckets[bucket], 1U);
+
+  max = nns_edge_stats_get (hist->max);
+  while (duration > max &&
+      !__atomic_compare_exchange_n (&hist->max, &max, duration, false,
+          __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+}
+
+/**
+ * @brief Get the percentile (0~100) of the durations, which is the upper bound of the bucket.
+ */
+static uint64_t
+_nns_edge_stats_percentile (nns_edge_stats_hist_s * hist, uint64_t count,
+    uint64_t max, unsigned int percent)
+{
+  uint64_t sum = 0U, bound;
+  unsigned int i;
+
+  if (count == 0U)
+    return 0U;
+
+  for (i = 0; i < NNS_EDGE_STATS_BUCKETS - 1U; i++) {
+    sum += nns_edge_stats_get (hist->buckets[i]);
+
+    if (sum * 100U >= count * percent) {
+      bound = (i == 0U) ? 0U : (1ULL << i) - 1U;
+      return (bound < max) ? bound : max;
+    }
+  }
+
+  return max;
+}
+
+/**
+ * @brief Append the summary of the histogram into the string.
+ */
+static int
+_nns_edge_stats_print_hist (char *str, size_t len, const char *name,
+    nns_edge_stats_hist_s * hist)
+{
+  uint64_t count, sum, max;
+
+  count = nns_edge_stats_get (hist->count);
+  sum = nns_edge_stats_get (hist->sum);
+  max = nns_edge_stats_get (hist->max);
+
+  return snprintf (str, len,
+      ",%s_count=%llu,%s_avg_us=%llu,%s_max_us=%llu,%s_p50_us=%llu,%s_p99_us=%llu",
+      name, (unsigned long long) count,
+      name, (unsigned long long) ((count > 0U) ? sum / count : 0U),
+      name, (unsigned long long) max,
+      name, (unsigned long long) _nns_edge_stats_percentile (hist, count, max,
+          50U), name,
+      (unsigned long long) _nns_edge_stats_percentile (hist, count, max, 99U));
+}
+
+/**
+ * @brief Get the statistics string, comma separated 'name=value' pairs.
+ */
+char *
+nns_edge_stats_to_string (nns_edge_stats_s * stats, unsigned int queue_depth,
+    uint64_t queue_dropped, uint64_t conn_dropped)
+{
+  char str[NNS_EDGE_STATS_STR_LEN];
+  int len;
+
+  if (!stats) {
+    nns_edge_loge ("Invalid param, given statistics is null.");
+    return NULL;
+  }
+
+  len = snprintf (str, sizeof (str),
+      "frames_sent=%llu,bytes_sent=%llu,frames_received=%llu,bytes_received=%llu,"
+      "send_errors=%llu,queue_depth=%u,queue_dropped=%llu,conn_dropped=%llu,"
+      "credit_dropped=%llu,conflated=%llu",
+      (unsigned long long) nns_edge_stats_get (stats->sent.frames),
+      (unsigned long long) nns_edge_stats_get (stats->sent.bytes),
+      (unsigned long long) nns_edge_stats_get (stats->received.frames),
+      (unsigned long long) nns_edge_stats_get (stats->received.bytes),
+      (unsigned long long) nns_edge_stats_get (stats->send_errors),
+      queue_depth, (unsigned long long) queue_dropped,
+      (unsigned long long) (nns_edge_stats_get (stats->conn_dropped) +
+          conn_dropped),
+      (unsigned long long) nns_edge_stats_get (stats->credit_dropped),
+      (unsigned long long) nns_edge_stats_get (stats->conflated));
+
+  if (stats->timing) {
+    len += _nns_edge_stats_print_hist (str + len, sizeof (str) - len,
+        "serialize", &stats->serialize);
+    len += _nns_edge_stats_print_hist (str + len, sizeof (str) - len,
+        "send", &stats->send);
+    _nns_edge_stats_print_hist (str + len, sizeof (str) - len,
+        "callback", &stats->callback);
+  }
+
+  return nns_edge_strdup (str);
+}
@@ -0,0 +1,107 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file   nnstreamer-edge-stats.h
+ * @date   14 October 2026
+ * @brief  Statistics of edge handle, the counters are updated in the threads sending and receiving data.
+ * @see    https://github.com/nnstreamer/nnstreamer-edge
+ * @author agent <agent@local>
+ * @note   This file is internal header for nnstreamer-edge. DO NOT export this file.
+ * @bug    No known bugs except for NYI items
+ */
+
+#ifndef __NNSTREAMER_EDGE_STATS_H__
+#define __NNSTREAMER_EDGE_STATS_H__
+
+#include <stdbool.h>
+#include "nnstreamer-edge.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @brief The number of buckets in the histogram. The bucket i has the durations less than 2^i microseconds, and the last bucket has the longer durations.
+ */
+#define NNS_EDGE_STATS_BUCKETS 24U
+
+/**
+ * @brief Update or get the counter without lock.
+ */
+#define nns_edge_stats_add(c,v) do { __atomic_fetch_add (&(c), (v), __ATOMIC_RELAXED); } while (0)
+#define nns_edge_stats_get(c) (__atomic_load_n (&(c), __ATOMIC_RELAXED))
+
+/**
+ * @brief Counter of the frames and bytes. The bytes are the total size of the memories in edge data, without the header and metadata.
+ */
+typedef struct {
+  uint64_t frames;
+  uint64_t bytes;
+} nns_edge_stats_count_s;
+
+/**
+ * @brief Histogram of the durations in microseconds.
+ */
+typedef struct {
+  uint64_t count;
+  uint64_t sum;
+  uint64_t max;
+  uint64_t buckets[NNS_EDGE_STATS_BUCKETS];
+} nns_edge_stats_hist_s;
+
+/**
+ * @brief Statistics of edge handle.
+ */
+typedef struct {
+  bool timing; /**< measure the durations, the counters are always updated */
+
+  nns_edge_stats_count_s sent;
+  nns_edge_stats_count_s received;
+  uint64_t send_errors;
+  uint64_t conn_dropped; /**< data dropped in the queues of the closed connections */
+  uint64_t credit_dropped; /**< data dropped or coalesced without the credits of flow control */
+  uint64_t conflated; /**< old data skipped in conflation mode */
+
+  nns_edge_stats_hist_s serialize; /**< time to prepare the memories of edge data (metadata, shared memory and compression) */
+  nns_edge_stats_hist_s send; /**< time to send edge data */
+  nns_edge_stats_hist_s callback; /**< time to invoke the event callback for new data */
+} nns_edge_stats_s;
+
+/**
+ * @brief Count the frames and bytes.
+ */
+#define nns_edge_stats_count(c,f,b) do { \
+    nns_edge_stats_add ((c).frames, (uint64_t) (f)); \
+    nns_edge_stats_add ((c).bytes, (uint64_t) (b)); \
+  } while (0)
+
+/**
+ * @brief Get the total size of the memories in edge data.
+ */
+nns_size_t nns_edge_stats_get_data_size (nns_edge_data_h data_h);
+
+/**
+ * @brief Get the time to start the measurement.
+ * @return The monotonic time in microseconds, or 0 if the timing is disabled.
+ */
+int64_t nns_edge_stats_start (nns_edge_stats_s *stats);
+
+/**
+ * @brief Add the duration from given start time into the histogram. Do nothing if the start time is 0.
+ */
+void nns_edge_stats_done (nns_edge_stats_hist_s *hist, int64_t start);
+
+/**
+ * @brief Get the statistics string, comma separated 'name=value' pairs. Caller should release returned string using free().
+ * @param[in] stats The statistics of edge handle.
+ * @param[in] queue_depth The number of data in the send queue.
+ * @param[in] queue_dropped The number of data dropped in the send queue.
+ * @param[in] conn_dropped The number of data dropped in the queues of the connections.
+ */
+char *nns_edge_stats_to_string (nns_edge_stats_s *stats, unsigned int queue_depth, uint64_t queue_dropped, uint64_t conn_dropped);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __NNSTREAMER_EDGE_STATS_H__ */
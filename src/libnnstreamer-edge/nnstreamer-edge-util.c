@@ -32,6 +32,18 @@ nns_edge_generate_id (void)
   return _id;
 }
 
+/**
+ * @brief Get the monotonic time in microseconds.
+ */
+int64_t
+nns_edge_get_monotonic_time (void)
+{
+  struct timespec ts;
+
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return ((int64_t) ts.tv_sec) * 1000000 + ts.tv_nsec / 1000;
+}
+
 /**
  * @brief Get the version of nnstreamer-edge.
  */
@@ -57,7 +69,9 @@ nns_edge_generate_version_key (void)
 
   nns_edge_get_version (&major, &minor, &micro);
 
-  return (0xefdd000000000000ULL | (micro << 24) | (major << 12) | minor);
+  return (0xefdd000000000000ULL |
+      ((uint64_t) NNS_EDGE_FEATURE_ALL << 36) |
+      ((uint64_t) micro << 24) | (major << 12) | minor);
 }
 
 /**
@@ -80,6 +94,18 @@ nns_edge_parse_version_key (const uint64_t version_key, unsigned int *major,
   return true;
 }
 
+/**
+ * @brief Get the feature bits from the version key.
+ */
+uint32_t
+nns_edge_parse_version_features (const uint64_t version_key)
+{
+  if (!nns_edge_parse_version_key (version_key, NULL, NULL, NULL))
+    return 0U;
+
+  return (uint32_t) ((version_key >> 36) & 0xfff);
+}
+
 /**
  * @brief Internal util function to get available port number.
  */
@@ -57,6 +57,7 @@ extern "C" {
 
 #define NNS_EDGE_MAGIC 0xfeedfeed
 #define NNS_EDGE_MAGIC_DEAD 0xdeaddead
+#define NNS_EDGE_MAGIC_COMPACT 0xfeedc0de
 #define nns_edge_handle_is_valid(h) ((h) && *((uint32_t *)(h)) == NNS_EDGE_MAGIC)
 #define nns_edge_handle_set_magic(h,m) do { if (h) *((uint32_t *)(h)) = (m); } while (0)
 
@@ -75,12 +76,17 @@ extern "C" {
       gettimeofday (&now, NULL); \
       ts.tv_sec = now.tv_sec + (ms) / 1000; \
       ts.tv_nsec = now.tv_usec * 1000 + ((ms) % 1000) * 1000000; \
+      if (ts.tv_nsec >= 1000000000) { \
+        ts.tv_sec++; \
+        ts.tv_nsec -= 1000000000; \
+      } \
       pthread_cond_timedwait (&(h)->cond, &(h)->lock, &ts); \
     } else { \
       pthread_cond_wait (&(h)->cond, &(h)->lock); \
     } \
   } while (0)
 #define nns_edge_cond_signal(h) do { pthread_cond_signal (&(h)->cond); } while (0)
+#define nns_edge_cond_broadcast(h) do { pthread_cond_broadcast (&(h)->cond); } while (0)
 
 /**
  * @brief Internal data structure for raw data.
@@ -96,6 +102,52 @@ typedef struct {
  */
 int64_t nns_edge_generate_id (void);
 
+/**
+ * @brief Get the monotonic time in microseconds.
+ */
+int64_t nns_edge_get_monotonic_time (void);
+
+/**
+ * @brief Feature bits in the version key, to negotiate optional features with other node.
+ * @note Old node sets zero in the bits, new feature should be added with fallback for old node.
+ */
+#define NNS_EDGE_FEATURE_COMPACT_HEADER (1U << 0) /**< Compact header which has the memory sizes of given number only. */
+#define NNS_EDGE_FEATURE_DUPLEX (1U << 1) /**< Query server sends the results with the socket accepted from the client. */
+#define NNS_EDGE_FEATURE_SHM (1U << 2) /**< The node on same host receives the memories from shared memory ring. */
+#define NNS_EDGE_FEATURE_BATCH (1U << 3) /**< The node receives several edge data in one command. */
+#define NNS_EDGE_FEATURE_COMPRESS_ZLIB (1U << 4) /**< The node decompresses the memories compressed with zlib. */
+#define NNS_EDGE_FEATURE_COMPRESS_LZ4 (1U << 5) /**< The node decompresses the memories compressed with lz4. */
+#define NNS_EDGE_FEATURE_COMPRESS_ZSTD (1U << 6) /**< The node decompresses the memories compressed with zstd. */
+#define NNS_EDGE_FEATURE_CREDIT (1U << 7) /**< The node sends data within the credits granted by the receiver. */
+#define NNS_EDGE_FEATURE_CHUNK (1U << 8) /**< The node receives large edge data in chunks. */
+
+/**
+ * @brief Optional features, available if the feature is enabled when building nnstreamer-edge.
+ */
+#if defined(ENABLE_SHM)
+#define _NNS_EDGE_FEATURE_SHM_ENABLED NNS_EDGE_FEATURE_SHM
+#else
+#define _NNS_EDGE_FEATURE_SHM_ENABLED (0U)
+#endif
+#if defined(ENABLE_ZLIB)
+#define _NNS_EDGE_FEATURE_ZLIB_ENABLED NNS_EDGE_FEATURE_COMPRESS_ZLIB
+#else
+#define _NNS_EDGE_FEATURE_ZLIB_ENABLED (0U)
+#endif
+#if defined(ENABLE_LZ4)
+#define _NNS_EDGE_FEATURE_LZ4_ENABLED NNS_EDGE_FEATURE_COMPRESS_LZ4
+#else
+#define _NNS_EDGE_FEATURE_LZ4_ENABLED (0U)
+#endif
+#if defined(ENABLE_ZSTD)
+#define _NNS_EDGE_FEATURE_ZSTD_ENABLED NNS_EDGE_FEATURE_COMPRESS_ZSTD
+#else
+#define _NNS_EDGE_FEATURE_ZSTD_ENABLED (0U)
+#endif
+
+#define NNS_EDGE_FEATURE_ALL (NNS_EDGE_FEATURE_COMPACT_HEADER | NNS_EDGE_FEATURE_DUPLEX | NNS_EDGE_FEATURE_BATCH | NNS_EDGE_FEATURE_CREDIT | NNS_EDGE_FEATURE_CHUNK | \
+    _NNS_EDGE_FEATURE_SHM_ENABLED | _NNS_EDGE_FEATURE_ZLIB_ENABLED | _NNS_EDGE_FEATURE_LZ4_ENABLED | _NNS_EDGE_FEATURE_ZSTD_ENABLED)
+
 /**
  * @brief Generate the version key.
  */
@@ -106,6 +158,11 @@ uint64_t nns_edge_generate_version_key (void);
  */
 bool nns_edge_parse_version_key (const uint64_t version_key, unsigned int *major, unsigned int *minor, unsigned int *micro);
 
+/**
+ * @brief Get the feature bits from the version key.
+ */
+uint32_t nns_edge_parse_version_features (const uint64_t version_key);
+
 /**
  * @brief Get available port number.
  */
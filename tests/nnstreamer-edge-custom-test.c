@@ -21,6 +21,8 @@ typedef struct
   char *peer_address;
   nns_edge_event_cb event_cb;
   void *user_data;
+  unsigned int sent_frames;
+  unsigned int sent_batches;
 } nns_edge_custom_test_s;
 
 static int
@@ -173,10 +175,46 @@ nns_edge_custom_send_data (void *priv, nns_edge_data_h data_h)
     nns_edge_loge ("Invalid param, handle or data should not be null.");
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
+  nns_edge_custom_test_s *custom_h = (nns_edge_custom_test_s *) priv;
+
+  __atomic_fetch_add (&custom_h->sent_frames, 1U, __ATOMIC_RELAXED);
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+static int
+nns_edge_custom_send_batch (void *priv, nns_edge_data_h *data_h, unsigned int count)
+{
+  if (!priv || !data_h || count == 0U) {
+    nns_edge_loge ("Invalid param, handle or data should not be null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+  nns_edge_custom_test_s *custom_h = (nns_edge_custom_test_s *) priv;
+
+  __atomic_fetch_add (&custom_h->sent_frames, count, __ATOMIC_RELAXED);
+  __atomic_fetch_add (&custom_h->sent_batches, 1U, __ATOMIC_RELAXED);
 
   return NNS_EDGE_ERROR_NONE;
 }
 
+static int
+nns_edge_custom_alloc_buffer (void *priv, nns_size_t size, void **data)
+{
+  if (!priv || size == 0 || !data) {
+    nns_edge_loge ("Invalid param, handle, size or data should be valid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  *data = malloc (size);
+  return (*data) ? NNS_EDGE_ERROR_NONE : NNS_EDGE_ERROR_OUT_OF_MEMORY;
+}
+
+static void
+nns_edge_custom_release_buffer (void *data)
+{
+  free (data);
+}
+
 static int
 nns_edge_custom_set_info (void *priv, const char *key, const char *value)
 {
@@ -210,6 +248,16 @@ nns_edge_custom_get_info (void *priv, const char *key, char **value)
     return NNS_EDGE_ERROR_NONE;
   }
 
+  if (strcasecmp (key, "SENT_FRAMES") == 0) {
+    *value = nns_edge_strdup_printf ("%u", __atomic_load_n (&custom_h->sent_frames, __ATOMIC_RELAXED));
+    return NNS_EDGE_ERROR_NONE;
+  }
+
+  if (strcasecmp (key, "SENT_BATCHES") == 0) {
+    *value = nns_edge_strdup_printf ("%u", __atomic_load_n (&custom_h->sent_batches, __ATOMIC_RELAXED));
+    return NNS_EDGE_ERROR_NONE;
+  }
+
   nns_edge_loge ("The key '%s' is not supported.", key);
   return NNS_EDGE_ERROR_INVALID_PARAMETER;
 }
@@ -228,7 +276,10 @@ nns_edge_custom_s edge_custom_h = {
   .nns_edge_custom_set_event_cb = nns_edge_custom_set_event_cb,
   .nns_edge_custom_send_data = nns_edge_custom_send_data,
   .nns_edge_custom_set_info = nns_edge_custom_set_info,
-  .nns_edge_custom_get_info = nns_edge_custom_get_info
+  .nns_edge_custom_get_info = nns_edge_custom_get_info,
+  .nns_edge_custom_send_batch = nns_edge_custom_send_batch,
+  .nns_edge_custom_alloc_buffer = nns_edge_custom_alloc_buffer,
+  .nns_edge_custom_release_buffer = nns_edge_custom_release_buffer
 };
 
 const nns_edge_custom_s *
@@ -236,3 +287,9 @@ nns_edge_custom_get_instance ()
 {
   return &edge_custom_h;
 }
+
+unsigned int
+nns_edge_custom_get_version ()
+{
+  return NNS_EDGE_CUSTOM_VERSION;
+}
@@ -411,6 +411,178 @@ TEST (edgeCustom, getInfoInvalidParam03_n)
   EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
 }
 
+/**
+ * @brief Send the batch of data using edge custom.
+ */
+TEST (edgeCustom, sendBatch)
+{
+  int ret;
+  unsigned int i;
+  nns_edge_custom_connection_h handle;
+  nns_edge_data_h data_h[3] = { NULL };
+  char *value = NULL;
+
+  ret = nns_edge_custom_load ("libnnstreamer-edge-custom-test.so", &handle);
+  ASSERT_EQ (NNS_EDGE_ERROR_NONE, ret);
+
+  for (i = 0; i < 3U; i++) {
+    ret = nns_edge_data_create (&data_h[i]);
+    EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+  }
+
+  ret = nns_edge_custom_send_batch (handle, data_h, 3U);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+
+  ret = nns_edge_custom_get_info (handle, "SENT_BATCHES", &value);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+  EXPECT_STREQ ("1", value);
+  SAFE_FREE (value);
+
+  ret = nns_edge_custom_get_info (handle, "SENT_FRAMES", &value);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+  EXPECT_STREQ ("3", value);
+  SAFE_FREE (value);
+
+  for (i = 0; i < 3U; i++) {
+    ret = nns_edge_data_destroy (data_h[i]);
+    EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+  }
+
+  ret = nns_edge_custom_release (handle);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+}
+
+/**
+ * @brief Send the batch of data using edge custom - invalid param.
+ */
+TEST (edgeCustom, sendBatchInvalidParam01_n)
+{
+  int ret;
+  nns_edge_data_h data_h;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+
+  ret = nns_edge_custom_send_batch (NULL, &data_h, 1U);
+  EXPECT_NE (NNS_EDGE_ERROR_NONE, ret);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+}
+
+/**
+ * @brief Send the batch of data using edge custom - invalid param.
+ */
+TEST (edgeCustom, sendBatchInvalidParam02_n)
+{
+  int ret;
+  nns_edge_custom_connection_h handle;
+  nns_edge_data_h data_h[2] = { NULL };
+
+  ret = nns_edge_custom_load ("libnnstreamer-edge-custom-test.so", &handle);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+
+  ret = nns_edge_data_create (&data_h[0]);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+
+  ret = nns_edge_custom_send_batch (handle, NULL, 1U);
+  EXPECT_NE (NNS_EDGE_ERROR_NONE, ret);
+  ret = nns_edge_custom_send_batch (handle, data_h, 0U);
+  EXPECT_NE (NNS_EDGE_ERROR_NONE, ret);
+  ret = nns_edge_custom_send_batch (handle, data_h, 2U);
+  EXPECT_NE (NNS_EDGE_ERROR_NONE, ret);
+
+  ret = nns_edge_data_destroy (data_h[0]);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+  ret = nns_edge_custom_release (handle);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+}
+
+/**
+ * @brief Send the data in the buffers allocated by edge custom.
+ */
+TEST (edgeCustom, sendAllocBuffer)
+{
+  int ret;
+  unsigned int i, retry = 0U;
+  nns_edge_h edge_h = NULL;
+  nns_edge_data_h data_h;
+  nns_edge_data_destroy_cb destroy_cb = NULL;
+  void *buffer = NULL;
+  char *value = NULL;
+  int device_found = 0;
+
+  ret = nns_edge_custom_create_handle ("temp_id", "libnnstreamer-edge-custom-test.so",
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  ASSERT_EQ (NNS_EDGE_ERROR_NONE, ret);
+
+  ret = nns_edge_set_event_callback (edge_h, _test_edge_event_cb, &device_found);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+  ret = nns_edge_start (edge_h);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+  ret = nns_edge_connect (edge_h, "temp", 3000);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+
+  for (i = 0; i < 20U; i++) {
+    ret = nns_edge_alloc_buffer (edge_h, 64U, &buffer, &destroy_cb);
+    EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+    EXPECT_TRUE (buffer != NULL);
+    EXPECT_TRUE (destroy_cb != NULL && destroy_cb != nns_edge_free);
+    memset (buffer, (int) i, 64U);
+
+    ret = nns_edge_data_create (&data_h);
+    EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+    ret = nns_edge_data_add (data_h, buffer, 64U, destroy_cb);
+    EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+
+    ret = nns_edge_send_full (edge_h, data_h, NNS_EDGE_SEND_FLAG_TRANSFER);
+    EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+  }
+
+  /* The send thread sends the data one by one or in the batch. */
+  do {
+    usleep (10000);
+    SAFE_FREE (value);
+    ret = nns_edge_get_info (edge_h, "STATISTICS", &value);
+    EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+  } while (value && !strstr (value, "frames_sent=20,") && ++retry < 200U);
+  EXPECT_TRUE (value && strstr (value, "frames_sent=20,bytes_sent=1280,") != NULL);
+  EXPECT_TRUE (value && strstr (value, "send_errors=0,") != NULL);
+  SAFE_FREE (value);
+
+  ret = nns_edge_stop (edge_h);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+}
+
+/**
+ * @brief Allocate the buffer using edge custom - invalid param.
+ */
+TEST (edgeCustom, allocBufferInvalidParam01_n)
+{
+  int ret;
+  nns_edge_custom_connection_h handle;
+  nns_edge_data_destroy_cb destroy_cb = NULL;
+  void *buffer = NULL;
+
+  ret = nns_edge_custom_alloc_buffer (NULL, 64U, &buffer, &destroy_cb);
+  EXPECT_NE (NNS_EDGE_ERROR_NONE, ret);
+
+  ret = nns_edge_custom_load ("libnnstreamer-edge-custom-test.so", &handle);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+
+  ret = nns_edge_custom_alloc_buffer (handle, 0U, &buffer, &destroy_cb);
+  EXPECT_NE (NNS_EDGE_ERROR_NONE, ret);
+  ret = nns_edge_custom_alloc_buffer (handle, 64U, NULL, &destroy_cb);
+  EXPECT_NE (NNS_EDGE_ERROR_NONE, ret);
+  ret = nns_edge_custom_alloc_buffer (handle, 64U, &buffer, NULL);
+  EXPECT_NE (NNS_EDGE_ERROR_NONE, ret);
+
+  ret = nns_edge_custom_release (handle);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+}
+
 /**
  * @brief Main gtest
  */
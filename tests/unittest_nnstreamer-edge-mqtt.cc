@@ -362,7 +362,7 @@ TEST(edgeMqttHybrid, publishInvalidParam_n)
   if (!_check_mqtt_broker ())
     return;
 
-  ret = nns_edge_mqtt_publish (NULL, msg, strlen (msg) + 1);
+  ret = nns_edge_mqtt_publish (NULL, msg, strlen (msg) + 1, 1, true);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 }
 
@@ -382,7 +382,7 @@ TEST(edgeMqttHybrid, publishInvalidParam2_n)
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
   /* data is null */
-  ret = nns_edge_mqtt_publish (broker_h, NULL, strlen (msg) + 1);
+  ret = nns_edge_mqtt_publish (broker_h, NULL, strlen (msg) + 1, 1, true);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
   ret = nns_edge_mqtt_close (broker_h);
@@ -405,7 +405,32 @@ TEST(edgeMqttHybrid, publishInvalidParam3_n)
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
   /* data length is 0 */
-  ret = nns_edge_mqtt_publish (broker_h, msg, 0);
+  ret = nns_edge_mqtt_publish (broker_h, msg, 0, 1, true);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_mqtt_close (broker_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Publish with invalid param.
+ */
+TEST(edgeMqttHybrid, publishInvalidParam4_n)
+{
+  int ret = -1;
+  nns_edge_broker_h broker_h;
+  const char *msg = "TEMP_MESSAGE";
+
+  if (!_check_mqtt_broker ())
+    return;
+
+  ret = nns_edge_mqtt_connect ("temp-mqtt-id", "temp-mqtt-topic", "127.0.0.1", 1883, &broker_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* invalid QoS */
+  ret = nns_edge_mqtt_publish (broker_h, msg, strlen (msg) + 1, -1, false);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_mqtt_publish (broker_h, msg, strlen (msg) + 1, 3, false);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
   ret = nns_edge_mqtt_close (broker_h);
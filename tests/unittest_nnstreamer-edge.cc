@@ -7,15 +7,20 @@
  * @bug         No known bugs
  */
 
+#include <arpa/inet.h>
 #include <gtest/gtest.h>
 #include "nnstreamer-edge.h"
 #include "nnstreamer-edge-data.h"
+#include "nnstreamer-edge-data-internal.h"
 #include "nnstreamer-edge-event.h"
 #include "nnstreamer-edge-metadata.h"
 #include "nnstreamer-edge-mqtt.h"
 #include "nnstreamer-edge-log.h"
 #include "nnstreamer-edge-util.h"
 #include "nnstreamer-edge-queue.h"
+#include "nnstreamer-edge-pool.h"
+#include "nnstreamer-edge-shm.h"
+#include "nnstreamer-edge-compress.h"
 
 /**
  * @brief Data struct for unittest.
@@ -27,6 +32,13 @@ typedef struct
   bool is_server;
   bool event_cb_released;
   unsigned int received;
+  unsigned int batches;
+  unsigned int responses;
+  unsigned int statistics;
+  unsigned int last_seq;
+  unsigned int chunks;
+  unsigned int capabilities;
+  bool closed;
 } ne_test_data_s;
 
 /**
@@ -123,6 +135,20 @@ _test_edge_event_cb (nns_edge_event_h event_h, void *user_data)
       ret = nns_edge_data_destroy (data_h);
       EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
       break;
+    case NNS_EDGE_EVENT_STATISTICS:
+      ret = nns_edge_event_parse_statistics (event_h, &val);
+      EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+      EXPECT_TRUE (val && strncmp (val, "frames_sent=", 12) == 0);
+      SAFE_FREE (val);
+
+      _td->statistics++;
+      break;
+    case NNS_EDGE_EVENT_CAPABILITY:
+      _td->capabilities++;
+      break;
+    case NNS_EDGE_EVENT_CONNECTION_CLOSED:
+      _td->closed = true;
+      break;
     default:
       break;
   }
@@ -265,791 +291,1285 @@ TEST(edge, connectLocal)
 }
 
 /**
- * @brief Create edge handle - invalid param.
+ * @brief Connect to local host in reactor mode.
  */
-TEST(edge, createHandleInvalidParam01_n)
+TEST(edge, connectLocalReactor)
 {
-  nns_edge_h edge_h;
-  int ret;
+  nns_edge_h server_h, client_h;
+  ne_test_data_s *_td_server, *_td_client;
+  nns_edge_data_h data_h;
+  nns_size_t data_len;
+  void *data;
+  unsigned int i, retry;
+  int ret, port;
+  char *val, *client_id;
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_UNKNOWN,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-}
+  _td_server = _get_test_data (true);
+  _td_client = _get_test_data (false);
+  ASSERT_TRUE (_td_server != NULL && _td_client != NULL);
+  port = nns_edge_get_available_port ();
 
-/**
- * @brief Create edge handle - invalid param.
- */
-TEST(edge, createHandleInvalidParam02_n)
-{
-  int ret;
+  /* Prepare server (127.0.0.1:port) */
+  val = nns_edge_strdup_printf ("%d", port);
+  nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &server_h);
+  nns_edge_set_event_callback (server_h, _test_edge_event_cb, _td_server);
+  nns_edge_set_info (server_h, "IP", "127.0.0.1");
+  nns_edge_set_info (server_h, "PORT", val);
+  nns_edge_set_info (server_h, "CAPS", "test server");
+  ret = nns_edge_set_info (server_h, "IO_MODE", "REACTOR:2");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _td_server->handle = server_h;
+  SAFE_FREE (val);
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-}
+  /* Prepare client */
+  nns_edge_create_handle ("temp-client", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h);
+  nns_edge_set_event_callback (client_h, _test_edge_event_cb, _td_client);
+  nns_edge_set_info (client_h, "CAPS", "test client");
+  ret = nns_edge_set_info (client_h, "IO_MODE", "REACTOR");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _td_client->handle = client_h;
 
-/**
- * @brief Create edge handle - invalid param.
- */
-TEST(edge, createHandleInvalidParam03_n)
-{
-  nns_edge_h edge_h;
-  int ret;
+  ret = nns_edge_start (server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_start (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_HYBRID,
-      NNS_EDGE_NODE_TYPE_UNKNOWN, &edge_h);
+  /* Cannot change I/O mode after starting the handle. */
+  ret = nns_edge_set_info (client_h, "IO_MODE", "THREAD");
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-}
 
-/**
- * @brief Start - invalid param.
- */
-TEST(edge, startInvalidParam01_n)
-{
-  int ret;
+  usleep (200000);
 
-  ret = nns_edge_start (NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-}
+  ret = nns_edge_connect (client_h, "127.0.0.1", port);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-/**
- * @brief Start - invalid param.
- */
-TEST(edge, startInvalidParam02_n)
-{
-  nns_edge_h edge_h;
-  int ret;
+  usleep (200000);
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  /* Send request to server */
+  data_len = 10U * sizeof (unsigned int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  for (i = 0; i < 10U; i++)
+    ((unsigned int *) data)[i] = i;
+
+  client_id = NULL;
+  ret = nns_edge_get_info (client_h, "client_id", &client_id);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC_DEAD);
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_add (data_h, data, data_len, nns_edge_free);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info (data_h, "test-key1", "test-value1");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info (data_h, "test-key2", "test-value2");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info (data_h, "client_id", client_id);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_start (edge_h);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  for (i = 0; i < 5U; i++) {
+    ret = nns_edge_send (client_h, data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    usleep (10000);
+  }
 
-  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC);
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_release_handle (edge_h);
+  /* Wait for responding data (20 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+    if (_td_client->received >= 5U)
+      break;
+  } while (retry++ < 200U);
+
+  ret = nns_edge_release_handle (server_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_release_handle (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  EXPECT_EQ (_td_server->received, 5U);
+  EXPECT_EQ (_td_client->received, 5U);
+
+  SAFE_FREE (client_id);
+  _free_test_data (_td_server);
+  _free_test_data (_td_client);
 }
 
 /**
- * @brief Release edge handle - invalid param.
+ * @brief Number of clients to test the connection table.
  */
-TEST(edge, releaseHandleInvalidParam01_n)
-{
-  int ret;
-
-  ret = nns_edge_release_handle (NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-}
+#define _TEST_N_CLIENTS (24U)
 
 /**
- * @brief Release edge handle - invalid param.
+ * @brief Send request from the client to the server.
  */
-TEST(edge, releaseHandleInvalidParam02_n)
+static void
+_test_send_request (nns_edge_h client_h)
 {
-  nns_edge_h edge_h;
+  nns_edge_data_h data_h;
+  nns_size_t data_len;
+  void *data;
+  char *client_id = NULL;
+  unsigned int i;
   int ret;
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  data_len = 10U * sizeof (unsigned int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
 
-  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC_DEAD);
+  for (i = 0; i < 10U; i++)
+    ((unsigned int *) data)[i] = i;
 
-  ret = nns_edge_release_handle (edge_h);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_get_info (client_h, "client_id", &client_id);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC);
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_add (data_h, data, data_len, nns_edge_free);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info (data_h, "test-key1", "test-value1");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info (data_h, "test-key2", "test-value2");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info (data_h, "client_id", client_id);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_release_handle (edge_h);
+  ret = nns_edge_send (client_h, data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  SAFE_FREE (client_id);
 }
 
 /**
- * @brief Set event callback - null param to clear event callback.
+ * @brief Connect to local host, server responds to many clients and some clients are disconnected.
  */
-TEST(edge, setEventCbSetNullCallback)
+TEST(edge, connectLocalManyClients)
 {
-  nns_edge_h edge_h;
-  ne_test_data_s *_td;
-  int ret;
+  nns_edge_h server_h, client_h[_TEST_N_CLIENTS];
+  ne_test_data_s *_td_server, *_td_client[_TEST_N_CLIENTS];
+  unsigned int i, done, retry;
+  int ret, port;
+  char *val;
 
-  _td = _get_test_data (false);
-  ASSERT_TRUE (_td != NULL);
+  _td_server = _get_test_data (true);
+  ASSERT_TRUE (_td_server != NULL);
+  port = nns_edge_get_available_port ();
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  /* Prepare server (127.0.0.1:port) */
+  val = nns_edge_strdup_printf ("%d", port);
+  nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &server_h);
+  nns_edge_set_event_callback (server_h, _test_edge_event_cb, _td_server);
+  nns_edge_set_info (server_h, "IP", "127.0.0.1");
+  nns_edge_set_info (server_h, "PORT", val);
+  nns_edge_set_info (server_h, "CAPS", "test server");
+  _td_server->handle = server_h;
+  SAFE_FREE (val);
 
-  ret = nns_edge_set_event_callback (edge_h, _test_edge_event_cb, _td);
+  ret = nns_edge_start (server_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  /* Set null param to clear event callback. */
-  ret = nns_edge_set_event_callback (edge_h, NULL, NULL);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  usleep (200000);
 
-  EXPECT_TRUE (_td->event_cb_released);
+  for (i = 0; i < _TEST_N_CLIENTS; i++) {
+    _td_client[i] = _get_test_data (false);
+    ASSERT_TRUE (_td_client[i] != NULL);
 
-  ret = nns_edge_release_handle (edge_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    nns_edge_create_handle ("temp-client", NNS_EDGE_CONNECT_TYPE_TCP,
+        NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h[i]);
+    nns_edge_set_event_callback (client_h[i], _test_edge_event_cb,
+        _td_client[i]);
+    nns_edge_set_info (client_h[i], "CAPS", "test client");
+    _td_client[i]->handle = client_h[i];
 
-  _free_test_data (_td);
-}
+    ret = nns_edge_start (client_h[i]);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    ret = nns_edge_connect (client_h[i], "127.0.0.1", port);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
 
-/**
- * @brief Set event callback - invalid param.
- */
-TEST(edge, setEventCbInvalidParam01_n)
-{
-  int ret;
+  usleep (500000);
 
-  ret = nns_edge_set_event_callback (NULL, _test_edge_event_cb, NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-}
+  for (i = 0; i < _TEST_N_CLIENTS; i++)
+    _test_send_request (client_h[i]);
 
-/**
- * @brief Set event callback - invalid param.
- */
-TEST(edge, setEventCbInvalidParam02_n)
-{
-  nns_edge_h edge_h;
-  ne_test_data_s *_td;
-  int ret;
+  /* Wait for responding data (20 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+    for (i = 0, done = 0; i < _TEST_N_CLIENTS; i++)
+      done += (_td_client[i]->received > 0U) ? 1U : 0U;
+  } while (done < _TEST_N_CLIENTS && retry++ < 200U);
 
-  _td = _get_test_data (false);
-  ASSERT_TRUE (_td != NULL);
+  EXPECT_EQ (done, _TEST_N_CLIENTS);
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  /* Release even clients, the server removes the connections. */
+  for (i = 0; i < _TEST_N_CLIENTS; i += 2U) {
+    ret = nns_edge_release_handle (client_h[i]);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    client_h[i] = NULL;
+  }
 
-  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC_DEAD);
+  usleep (500000);
 
-  ret = nns_edge_set_event_callback (edge_h, _test_edge_event_cb, _td);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  for (i = 1U; i < _TEST_N_CLIENTS; i += 2U)
+    _test_send_request (client_h[i]);
 
-  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC);
+  /* Wait for responding data (20 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+    for (i = 1U, done = 0; i < _TEST_N_CLIENTS; i += 2U)
+      done += (_td_client[i]->received > 1U) ? 1U : 0U;
+  } while (done < _TEST_N_CLIENTS / 2U && retry++ < 200U);
 
-  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (done, _TEST_N_CLIENTS / 2U);
+
+  ret = nns_edge_release_handle (server_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  _free_test_data (_td);
-}
+  for (i = 0; i < _TEST_N_CLIENTS; i++) {
+    if (client_h[i]) {
+      ret = nns_edge_release_handle (client_h[i]);
+      EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    }
 
-/**
- * @brief Connect - invalid param.
- */
-TEST(edge, connectInvalidParam01_n)
-{
-  int ret;
+    _free_test_data (_td_client[i]);
+  }
 
-  ret = nns_edge_connect (NULL, "127.0.0.1", 80);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  _free_test_data (_td_server);
 }
 
 /**
- * @brief Connect - invalid param.
+ * @brief Connect to local host in reactor mode, clients are released while sending the data and new clients are connected.
  */
-TEST(edge, connectInvalidParam02_n)
+TEST(edge, connectLocalReactorRemoveClients)
 {
-  nns_edge_h edge_h;
-  int ret;
+  nns_edge_h server_h, client_h[_TEST_N_CLIENTS];
+  ne_test_data_s *_td_server, *_td_client[_TEST_N_CLIENTS];
+  unsigned int i, j, round, retry;
+  int ret, port;
+  char *val;
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  _td_server = _get_test_data (true);
+  ASSERT_TRUE (_td_server != NULL);
+  port = nns_edge_get_available_port ();
+
+  /* Prepare server (127.0.0.1:port) */
+  val = nns_edge_strdup_printf ("%d", port);
+  nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &server_h);
+  nns_edge_set_event_callback (server_h, _test_edge_event_cb, _td_server);
+  nns_edge_set_info (server_h, "IP", "127.0.0.1");
+  nns_edge_set_info (server_h, "PORT", val);
+  nns_edge_set_info (server_h, "CAPS", "test server");
+  ret = nns_edge_set_info (server_h, "IO_MODE", "REACTOR:2");
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _td_server->handle = server_h;
+  SAFE_FREE (val);
 
-  ret = nns_edge_set_event_callback (edge_h, _test_edge_event_cb, NULL);
+  ret = nns_edge_start (server_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC_DEAD);
+  usleep (200000);
 
-  ret = nns_edge_connect (edge_h, "127.0.0.1", 80);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  for (round = 0; round < 4U; round++) {
+    for (i = 0; i < _TEST_N_CLIENTS; i++) {
+      _td_client[i] = _get_test_data (false);
+      ASSERT_TRUE (_td_client[i] != NULL);
+
+      nns_edge_create_handle ("temp-client", NNS_EDGE_CONNECT_TYPE_TCP,
+          NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h[i]);
+      nns_edge_set_event_callback (client_h[i], _test_edge_event_cb,
+          _td_client[i]);
+      nns_edge_set_info (client_h[i], "CAPS", "test client");
+      _td_client[i]->handle = client_h[i];
+
+      /* Odd clients remove the sockets from the reactor while receiving the responses. */
+      if (i % 2U) {
+        ret = nns_edge_set_info (client_h[i], "IO_MODE", "REACTOR");
+        EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+      }
 
-  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC);
+      ret = nns_edge_start (client_h[i]);
+      EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+      ret = nns_edge_connect (client_h[i], "127.0.0.1", port);
+      EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    }
 
-  ret = nns_edge_release_handle (edge_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-}
+    /* Release the clients without waiting for the response, the server removes the sockets with pending data. */
+    for (j = 0; j < 5U; j++) {
+      for (i = 0; i < _TEST_N_CLIENTS; i++)
+        _test_send_request (client_h[i]);
+    }
 
-/**
- * @brief Connect - invalid param.
- */
-TEST(edge, connectInvalidParam03_n)
-{
-  nns_edge_h edge_h;
-  int ret;
+    for (i = 0; i < _TEST_N_CLIENTS; i++) {
+      ret = nns_edge_release_handle (client_h[i]);
+      EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+      _free_test_data (_td_client[i]);
+    }
+  }
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  /* New client can receive the response, the reused fd is watched. */
+  _td_client[0] = _get_test_data (false);
+  ASSERT_TRUE (_td_client[0] != NULL);
 
-  ret = nns_edge_set_event_callback (edge_h, _test_edge_event_cb, NULL);
+  nns_edge_create_handle ("temp-client", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h[0]);
+  nns_edge_set_event_callback (client_h[0], _test_edge_event_cb, _td_client[0]);
+  nns_edge_set_info (client_h[0], "CAPS", "test client");
+  _td_client[0]->handle = client_h[0];
+
+  ret = nns_edge_start (client_h[0]);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_connect (client_h[0], "127.0.0.1", port);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_connect (edge_h, NULL, 80);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  _test_send_request (client_h[0]);
 
-  ret = nns_edge_release_handle (edge_h);
+  /* Wait for responding data (20 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+    if (_td_client[0]->received > 0U)
+      break;
+  } while (retry++ < 200U);
+
+  EXPECT_TRUE (_td_client[0]->received > 0U);
+
+  ret = nns_edge_release_handle (client_h[0]);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_release_handle (server_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  _free_test_data (_td_client[0]);
+  _free_test_data (_td_server);
 }
 
 /**
- * @brief Connect - invalid param.
+ * @brief Connect the socket to local host and do nothing, it simulates the peer which does not respond in the handshake.
  */
-TEST(edge, connectInvalidParam04_n)
+static int
+_test_connect_dead_peer (int port)
 {
-  nns_edge_h edge_h;
-  int ret;
+  struct sockaddr_in saddr;
+  int fd;
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  fd = socket (AF_INET, SOCK_STREAM, IPPROTO_TCP);
+  if (fd < 0)
+    return -1;
 
-  ret = nns_edge_set_event_callback (edge_h, _test_edge_event_cb, NULL);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  memset (&saddr, 0, sizeof (saddr));
+  saddr.sin_family = AF_INET;
+  saddr.sin_port = htons (port);
+  saddr.sin_addr.s_addr = inet_addr ("127.0.0.1");
 
-  ret = nns_edge_connect (edge_h, "", 80);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  if (connect (fd, (struct sockaddr *) &saddr, sizeof (saddr)) < 0) {
+    close (fd);
+    return -1;
+  }
 
-  ret = nns_edge_release_handle (edge_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  return fd;
 }
 
 /**
- * @brief Connect - invalid param.
+ * @brief Check the socket is closed by the peer in given time (milliseconds).
  */
-TEST(edge, connectInvalidParam05_n)
+static bool
+_test_wait_socket_closed (int fd, unsigned int timeout)
 {
-  nns_edge_h edge_h;
-  int ret;
-
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  struct timeval tv;
+  char buf[256];
+  ssize_t len;
 
-  ret = nns_edge_set_event_callback (edge_h, _test_edge_event_cb, NULL);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  tv.tv_sec = timeout / 1000U;
+  tv.tv_usec = (timeout % 1000U) * 1000U;
+  setsockopt (fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof (tv));
 
-  /* Invalid port number */
-  ret = nns_edge_connect (edge_h, "127.0.0.1", -1);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_connect (edge_h, "127.0.0.1", 0);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_connect (edge_h, "127.0.0.1", 77777);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  /* Read and discard the handshake messages until the peer closes the socket. */
+  do {
+    len = recv (fd, buf, sizeof (buf), 0);
+  } while (len > 0);
 
-  ret = nns_edge_release_handle (edge_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  return (len == 0);
 }
 
 /**
- * @brief Connect - invalid param.
+ * @brief Connect to local host, the peer which does not respond does not block other clients.
  */
-TEST(edge, connectInvalidParam06_n)
+TEST(edge, connectLocalDeadPeer)
 {
-  nns_edge_h edge_h;
-  int ret;
+  nns_edge_h server_h, client_h;
+  ne_test_data_s *_td_server, *_td_client;
+  int ret, port, dead_fd;
+  unsigned int retry;
+  char *val;
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _td_server = _get_test_data (true);
+  _td_client = _get_test_data (false);
+  ASSERT_TRUE (_td_server != NULL && _td_client != NULL);
+  port = nns_edge_get_available_port ();
 
-  ret = nns_edge_set_event_callback (edge_h, _test_edge_event_cb, NULL);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  /* Prepare server (127.0.0.1:port) */
+  val = nns_edge_strdup_printf ("%d", port);
+  nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &server_h);
+  nns_edge_set_event_callback (server_h, _test_edge_event_cb, _td_server);
+  nns_edge_set_info (server_h, "IP", "127.0.0.1");
+  nns_edge_set_info (server_h, "PORT", val);
+  nns_edge_set_info (server_h, "CAPS", "test server");
+  nns_edge_set_info (server_h, "HANDSHAKE_TIMEOUT", "10000");
+  _td_server->handle = server_h;
+  SAFE_FREE (val);
 
-  /* not started */
-  ret = nns_edge_connect (edge_h, "127.0.0.1", 80);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  /* Prepare client */
+  nns_edge_create_handle ("temp-client", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h);
+  nns_edge_set_event_callback (client_h, _test_edge_event_cb, _td_client);
+  nns_edge_set_info (client_h, "CAPS", "test client");
+  _td_client->handle = client_h;
 
-  ret = nns_edge_release_handle (edge_h);
+  ret = nns_edge_start (server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_start (client_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-}
 
-/**
- * @brief Disconnect - invalid param.
- */
-TEST(edge, disconnectInvalidParam01_n)
-{
-  int ret;
+  usleep (200000);
 
-  ret = nns_edge_disconnect (NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-}
+  /* The peer which does not send host info blocks one handshake worker. */
+  dead_fd = _test_connect_dead_peer (port);
+  EXPECT_TRUE (dead_fd >= 0);
 
-/**
- * @brief Disconnect - invalid param.
- */
-TEST(edge, disconnectInvalidParam02_n)
-{
-  nns_edge_h edge_h;
-  int ret;
+  usleep (100000);
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  ret = nns_edge_connect (client_h, "127.0.0.1", port);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC_DEAD);
+  usleep (200000);
 
-  ret = nns_edge_disconnect (edge_h);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  _test_send_request (client_h);
 
-  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC);
+  /* Wait for responding data before the handshake timeout of dead peer (5 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+  } while (_td_client->received == 0U && retry++ < 50U);
 
-  ret = nns_edge_release_handle (edge_h);
+  EXPECT_TRUE (_td_client->received > 0U);
+
+  ret = nns_edge_release_handle (server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_release_handle (client_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* The server closes the socket of dead peer when releasing the handle. */
+  EXPECT_TRUE (_test_wait_socket_closed (dead_fd, 1000U));
+  close (dead_fd);
+
+  _free_test_data (_td_server);
+  _free_test_data (_td_client);
 }
 
 /**
- * @brief Send - invalid param.
+ * @brief Connect to local host, the server closes the connection if the peer does not respond in time.
  */
-TEST(edge, sendInvalidParam01_n)
+TEST(edge, connectLocalHandshakeTimeout)
 {
-  nns_edge_data_h data_h;
-  int ret;
+  nns_edge_h server_h, client_h;
+  ne_test_data_s *_td_server, *_td_client;
+  int ret, port, dead_fd;
+  unsigned int retry;
+  char *val;
 
-  ret = nns_edge_data_create (&data_h);
+  _td_server = _get_test_data (true);
+  _td_client = _get_test_data (false);
+  ASSERT_TRUE (_td_server != NULL && _td_client != NULL);
+  port = nns_edge_get_available_port ();
+
+  /* Prepare server (127.0.0.1:port) with one handshake worker */
+  val = nns_edge_strdup_printf ("%d", port);
+  nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &server_h);
+  nns_edge_set_event_callback (server_h, _test_edge_event_cb, _td_server);
+  nns_edge_set_info (server_h, "IP", "127.0.0.1");
+  nns_edge_set_info (server_h, "PORT", val);
+  nns_edge_set_info (server_h, "CAPS", "test server");
+  nns_edge_set_info (server_h, "HANDSHAKE_WORKERS", "1");
+  nns_edge_set_info (server_h, "HANDSHAKE_TIMEOUT", "300");
+  _td_server->handle = server_h;
+  SAFE_FREE (val);
+
+  /* Prepare client */
+  nns_edge_create_handle ("temp-client", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h);
+  nns_edge_set_event_callback (client_h, _test_edge_event_cb, _td_client);
+  nns_edge_set_info (client_h, "CAPS", "test client");
+  _td_client->handle = client_h;
+
+  ret = nns_edge_start (server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_start (client_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_set_info (data_h, "client_id", "10");
+  usleep (200000);
+
+  dead_fd = _test_connect_dead_peer (port);
+  EXPECT_TRUE (dead_fd >= 0);
+
+  /* The server closes the socket after the handshake timeout. */
+  EXPECT_TRUE (_test_wait_socket_closed (dead_fd, 3000U));
+  close (dead_fd);
+
+  /* The worker handles next client after the timeout. */
+  ret = nns_edge_connect (client_h, "127.0.0.1", port);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_send (NULL, data_h);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  usleep (200000);
 
-  ret = nns_edge_data_destroy (data_h);
+  _test_send_request (client_h);
+
+  retry = 0U;
+  do {
+    usleep (100000);
+  } while (_td_client->received == 0U && retry++ < 50U);
+
+  EXPECT_TRUE (_td_client->received > 0U);
+
+  ret = nns_edge_release_handle (server_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_release_handle (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  _free_test_data (_td_server);
+  _free_test_data (_td_client);
 }
 
 /**
- * @brief Send - invalid param.
+ * @brief Connect to local host, duplex and pair clients are connected to the server.
  */
-TEST(edge, sendInvalidParam02_n)
+TEST(edge, connectLocalDuplex)
 {
-  nns_edge_h edge_h;
-  nns_edge_data_h data_h;
-  int ret;
+  nns_edge_h server_h, client_h[2];
+  ne_test_data_s *_td_server, *_td_client[2];
+  unsigned int i, retry;
+  int ret, port, fd;
+  char *val;
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _td_server = _get_test_data (true);
+  ASSERT_TRUE (_td_server != NULL);
+  port = nns_edge_get_available_port ();
 
-  ret = nns_edge_data_create (&data_h);
+  /* Prepare server (127.0.0.1:port) */
+  val = nns_edge_strdup_printf ("%d", port);
+  nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &server_h);
+  nns_edge_set_event_callback (server_h, _test_edge_event_cb, _td_server);
+  nns_edge_set_info (server_h, "IP", "127.0.0.1");
+  nns_edge_set_info (server_h, "PORT", val);
+  nns_edge_set_info (server_h, "CAPS", "test server");
+  _td_server->handle = server_h;
+  SAFE_FREE (val);
+
+  ret = nns_edge_start (server_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_set_info (data_h, "client_id", "10");
+  usleep (200000);
+
+  /* First client uses duplex connection, second one uses the listener. */
+  for (i = 0; i < 2U; i++) {
+    _td_client[i] = _get_test_data (false);
+    ASSERT_TRUE (_td_client[i] != NULL);
+
+    nns_edge_create_handle ("temp-client", NNS_EDGE_CONNECT_TYPE_TCP,
+        NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h[i]);
+    nns_edge_set_event_callback (client_h[i], _test_edge_event_cb,
+        _td_client[i]);
+    nns_edge_set_info (client_h[i], "CAPS", "test client");
+    nns_edge_set_info (client_h[i], "CONNECTION_MODE",
+        (i == 0U) ? "DUPLEX" : "PAIR");
+    _td_client[i]->handle = client_h[i];
+
+    ret = nns_edge_start (client_h[i]);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    ret = nns_edge_connect (client_h[i], "127.0.0.1", port);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+
+  /* Duplex client does not start the listener. */
+  val = NULL;
+  ret = nns_edge_get_info (client_h[0], "PORT", &val);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  fd = _test_connect_dead_peer ((int) strtol (val, NULL, 10));
+  EXPECT_TRUE (fd < 0);
+  if (fd >= 0)
+    close (fd);
+  SAFE_FREE (val);
 
-  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC_DEAD);
+  usleep (200000);
 
-  ret = nns_edge_send (edge_h, data_h);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  for (i = 0; i < 2U; i++)
+    _test_send_request (client_h[i]);
 
-  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC);
+  /* Wait for responding data (5 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+  } while ((_td_client[0]->received == 0U || _td_client[1]->received == 0U)
+      && retry++ < 50U);
 
-  ret = nns_edge_release_handle (edge_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_TRUE (_td_client[0]->received > 0U);
+  EXPECT_TRUE (_td_client[1]->received > 0U);
+  EXPECT_EQ (_td_server->received, 2U);
 
-  ret = nns_edge_data_destroy (data_h);
+  ret = nns_edge_release_handle (server_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  for (i = 0; i < 2U; i++) {
+    ret = nns_edge_release_handle (client_h[i]);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    _free_test_data (_td_client[i]);
+  }
+
+  _free_test_data (_td_server);
 }
 
+#if defined(ENABLE_SHM)
 /**
- * @brief Send - invalid param.
+ * @brief Connect to local host, the nodes send data with shared memory ring.
  */
-TEST(edge, sendInvalidParam03_n)
+TEST(edge, connectLocalShm)
 {
-  nns_edge_h edge_h;
-  int ret;
-
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_h server_h, client_h;
+  ne_test_data_s *_td_server, *_td_client;
+  unsigned int i, retry;
+  int ret, port;
+  char *val;
 
-  ret = nns_edge_send (edge_h, NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  _td_server = _get_test_data (true);
+  _td_client = _get_test_data (false);
+  ASSERT_TRUE (_td_server != NULL && _td_client != NULL);
+  port = nns_edge_get_available_port ();
 
-  ret = nns_edge_release_handle (edge_h);
+  /* Prepare server (127.0.0.1:port) */
+  val = nns_edge_strdup_printf ("%d", port);
+  nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &server_h);
+  nns_edge_set_event_callback (server_h, _test_edge_event_cb, _td_server);
+  nns_edge_set_info (server_h, "IP", "127.0.0.1");
+  nns_edge_set_info (server_h, "PORT", val);
+  nns_edge_set_info (server_h, "CAPS", "test server");
+  ret = nns_edge_set_info (server_h, "SHM_SIZE", "4096");
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-}
+  _td_server->handle = server_h;
+  SAFE_FREE (val);
 
-/**
- * @brief Set info - invalid param.
- */
-TEST(edge, setInfoInvalidParam01_n)
-{
-  int ret;
+  /* Small ring, some data is sent with socket when the ring is full. */
+  nns_edge_create_handle ("temp-client", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h);
+  nns_edge_set_event_callback (client_h, _test_edge_event_cb, _td_client);
+  nns_edge_set_info (client_h, "CAPS", "test client");
+  ret = nns_edge_set_info (client_h, "SHM_SIZE", "256");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _td_client->handle = client_h;
 
-  ret = nns_edge_set_info (NULL, "caps", "temp-caps");
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-}
+  ret = nns_edge_start (server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_start (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-/**
- * @brief Set info - invalid param.
- */
-TEST(edge, setInfoInvalidParam02_n)
-{
-  nns_edge_h edge_h;
-  int ret;
+  usleep (200000);
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  ret = nns_edge_connect (client_h, "127.0.0.1", port);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC_DEAD);
+  usleep (200000);
 
-  ret = nns_edge_set_info (edge_h, "caps", "temp-caps");
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  for (i = 0; i < 20U; i++)
+    _test_send_request (client_h);
 
-  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC);
+  /* Wait for responding data (5 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+  } while (_td_client->received < 20U && retry++ < 50U);
 
-  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (_td_server->received, 20U);
+  EXPECT_EQ (_td_client->received, 20U);
+
+  ret = nns_edge_release_handle (server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_release_handle (client_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  _free_test_data (_td_server);
+  _free_test_data (_td_client);
 }
+#endif /* ENABLE_SHM */
 
+#if defined(ENABLE_ZLIB)
 /**
- * @brief Set info - invalid param.
+ * @brief Connect to local host, the nodes send the memories compressed with zlib.
  */
-TEST(edge, setInfoInvalidParam03_n)
+TEST(edge, connectLocalCompression)
 {
-  nns_edge_h edge_h;
-  int ret;
+  nns_edge_h server_h, client_h;
+  ne_test_data_s *_td_server, *_td_client;
+  unsigned int i, retry;
+  int ret, port;
+  char *val;
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  _td_server = _get_test_data (true);
+  _td_client = _get_test_data (false);
+  ASSERT_TRUE (_td_server != NULL && _td_client != NULL);
+  port = nns_edge_get_available_port ();
+
+  /* Prepare server (127.0.0.1:port) */
+  val = nns_edge_strdup_printf ("%d", port);
+  nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &server_h);
+  nns_edge_set_event_callback (server_h, _test_edge_event_cb, _td_server);
+  nns_edge_set_info (server_h, "IP", "127.0.0.1");
+  nns_edge_set_info (server_h, "PORT", val);
+  nns_edge_set_info (server_h, "CAPS", "test server");
+  ret = nns_edge_set_info (server_h, "COMPRESSION", "ZLIB");
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (server_h, "COMPRESSION_THRESHOLD", "16");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _td_server->handle = server_h;
+  SAFE_FREE (val);
 
-  ret = nns_edge_set_info (edge_h, NULL, "temp-caps");
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_create_handle ("temp-client", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h);
+  nns_edge_set_event_callback (client_h, _test_edge_event_cb, _td_client);
+  nns_edge_set_info (client_h, "CAPS", "test client");
+  ret = nns_edge_set_info (client_h, "COMPRESSION", "zlib");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (client_h, "COMPRESSION_THRESHOLD", "0");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _td_client->handle = client_h;
 
-  ret = nns_edge_release_handle (edge_h);
+  ret = nns_edge_start (server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_start (client_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-}
 
-/**
- * @brief Set info - invalid param.
- */
-TEST(edge, setInfoInvalidParam04_n)
-{
-  nns_edge_h edge_h;
-  int ret;
+  usleep (200000);
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  ret = nns_edge_connect (client_h, "127.0.0.1", port);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_set_info (edge_h, "", "temp-caps");
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  usleep (200000);
 
-  ret = nns_edge_release_handle (edge_h);
+  for (i = 0; i < 10U; i++)
+    _test_send_request (client_h);
+
+  /* Wait for responding data (5 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+  } while (_td_client->received < 10U && retry++ < 50U);
+
+  EXPECT_EQ (_td_server->received, 10U);
+  EXPECT_EQ (_td_client->received, 10U);
+
+  ret = nns_edge_release_handle (server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_release_handle (client_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  _free_test_data (_td_server);
+  _free_test_data (_td_client);
 }
+#endif /* ENABLE_ZLIB */
 
 /**
- * @brief Set info - invalid param.
+ * @brief Connect to local host, check the statistics of the handles.
  */
-TEST(edge, setInfoInvalidParam05_n)
+TEST(edge, connectLocalStatistics)
 {
-  nns_edge_h edge_h;
-  int ret;
+  nns_edge_h server_h, client_h;
+  ne_test_data_s *_td_server, *_td_client;
+  unsigned int i, retry;
+  int ret, port;
+  char *val;
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _td_server = _get_test_data (true);
+  _td_client = _get_test_data (false);
+  ASSERT_TRUE (_td_server != NULL && _td_client != NULL);
+  port = nns_edge_get_available_port ();
 
-  ret = nns_edge_set_info (edge_h, "caps", NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  /* Prepare server (127.0.0.1:port) */
+  val = nns_edge_strdup_printf ("%d", port);
+  nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &server_h);
+  nns_edge_set_event_callback (server_h, _test_edge_event_cb, _td_server);
+  nns_edge_set_info (server_h, "IP", "127.0.0.1");
+  nns_edge_set_info (server_h, "PORT", val);
+  nns_edge_set_info (server_h, "CAPS", "test server");
+  _td_server->handle = server_h;
+  SAFE_FREE (val);
 
-  ret = nns_edge_release_handle (edge_h);
+  nns_edge_create_handle ("temp-client", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h);
+  nns_edge_set_event_callback (client_h, _test_edge_event_cb, _td_client);
+  nns_edge_set_info (client_h, "CAPS", "test client");
+  ret = nns_edge_set_info (client_h, "STATISTICS_TIMING", "TRUE");
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-}
+  ret = nns_edge_set_info (client_h, "STATISTICS_INTERVAL", "100");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _td_client->handle = client_h;
 
-/**
- * @brief Set info - invalid param.
- */
-TEST(edge, setInfoInvalidParam06_n)
-{
-  nns_edge_h edge_h;
-  int ret;
+  ret = nns_edge_start (server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_start (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  usleep (200000);
+
+  ret = nns_edge_connect (client_h, "127.0.0.1", port);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_set_info (edge_h, "caps", "");
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  usleep (200000);
 
-  ret = nns_edge_release_handle (edge_h);
+  for (i = 0; i < 10U; i++)
+    _test_send_request (client_h);
+
+  /* Wait for responding data (5 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+  } while (_td_client->received < 10U && retry++ < 50U);
+
+  EXPECT_EQ (_td_server->received, 10U);
+  EXPECT_EQ (_td_client->received, 10U);
+
+  ret = nns_edge_get_info (client_h, "STATISTICS", &val);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-}
+  EXPECT_TRUE (strstr (val, "frames_sent=10,bytes_sent=400,") != NULL);
+  EXPECT_TRUE (strstr (val, "frames_received=10,bytes_received=400,") != NULL);
+  EXPECT_TRUE (strstr (val, ",send_count=10,") != NULL);
+  EXPECT_TRUE (strstr (val, ",callback_count=10,") != NULL);
+  SAFE_FREE (val);
 
-/**
- * @brief Set info - invalid param.
- */
-TEST(edge, setInfoInvalidParam07_n)
-{
-  nns_edge_h edge_h;
-  int ret;
+  ret = nns_edge_get_info (server_h, "STATISTICS", &val);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_TRUE (strstr (val, "frames_sent=10,bytes_sent=400,") != NULL);
+  EXPECT_TRUE (strstr (val, "frames_received=10,bytes_received=400,") != NULL);
+  EXPECT_TRUE (strstr (val, "send_count=") == NULL);
+  SAFE_FREE (val);
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  ret = nns_edge_get_info (server_h, "STATISTICS_CONNECTIONS", &val);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_TRUE (strstr (val, "client_id=") != NULL);
+  EXPECT_TRUE (strstr (val, ",frames_received=10,bytes_received=400,") != NULL);
+  EXPECT_TRUE (strchr (val, ';') == NULL);
+  SAFE_FREE (val);
 
-  /* Not allowed key */
-  ret = nns_edge_set_info (edge_h, "id", "temp-id2");
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_set_info (edge_h, "client_id", "temp-cid");
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  /* The statistics event is emitted periodically. */
+  EXPECT_GT (_td_client->statistics, 0U);
+  EXPECT_EQ (_td_server->statistics, 0U);
 
-  ret = nns_edge_release_handle (edge_h);
+  ret = nns_edge_release_handle (server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_release_handle (client_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  _free_test_data (_td_server);
+  _free_test_data (_td_client);
 }
 
+
 /**
- * @brief Set info - invalid param.
+ * @brief Release the connected handles, the threads waiting for the sockets are woken up immediately.
  */
-TEST(edge, setInfoInvalidParam08_n)
+TEST(edge, connectLocalRelease)
 {
-  nns_edge_h edge_h;
-  int ret;
+  nns_edge_h server_h, client_h;
+  ne_test_data_s *_td_server, *_td_client;
+  unsigned int retry;
+  int64_t start;
+  int ret, port;
+  char *val;
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _td_server = _get_test_data (true);
+  _td_client = _get_test_data (false);
+  ASSERT_TRUE (_td_server != NULL && _td_client != NULL);
+  port = nns_edge_get_available_port ();
 
-  /* Invalid port number */
-  ret = nns_edge_set_info (edge_h, "port", "-1");
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_set_info (edge_h, "port", "77777");
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  /* Prepare server (127.0.0.1:port) */
+  val = nns_edge_strdup_printf ("%d", port);
+  nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &server_h);
+  nns_edge_set_event_callback (server_h, _test_edge_event_cb, _td_server);
+  nns_edge_set_info (server_h, "IP", "127.0.0.1");
+  nns_edge_set_info (server_h, "PORT", val);
+  nns_edge_set_info (server_h, "CAPS", "test server");
+  _td_server->handle = server_h;
+  SAFE_FREE (val);
 
-  ret = nns_edge_release_handle (edge_h);
+  nns_edge_create_handle ("temp-client", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h);
+  nns_edge_set_event_callback (client_h, _test_edge_event_cb, _td_client);
+  nns_edge_set_info (client_h, "CAPS", "test client");
+  _td_client->handle = client_h;
+
+  ret = nns_edge_start (server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_start (client_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-}
 
-/**
- * @brief Set info - invalid param.
- */
-TEST(edge, setInfoInvalidParam09_n)
-{
-  nns_edge_h edge_h;
-  int ret;
+  usleep (200000);
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  ret = nns_edge_connect (client_h, "127.0.0.1", port);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  /* Invalid option */
-  ret = nns_edge_set_info (edge_h, "QUEUE_SIZE", "15:INVALID_LEAKY");
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  usleep (200000);
 
-  ret = nns_edge_release_handle (edge_h);
+  _test_send_request (client_h);
+
+  /* Wait for responding data (5 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+  } while (_td_client->received < 1U && retry++ < 50U);
+
+  EXPECT_EQ (_td_client->received, 1U);
+
+  /* The handle does not wait for the timeout of the threads. */
+  start = nns_edge_get_monotonic_time ();
+  ret = nns_edge_release_handle (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_release_handle (server_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_LT (nns_edge_get_monotonic_time () - start, 100000);
+
+  _free_test_data (_td_server);
+  _free_test_data (_td_client);
 }
 
 /**
- * @brief Get info.
+ * @brief Edge event callback for test, check the order of received data and the server invokes the callback slowly.
  */
-TEST(edge, getInfo)
+static int
+_test_edge_dispatch_event_cb (nns_edge_event_h event_h, void *user_data)
 {
-  nns_edge_h edge_h;
-  char *value = NULL;
+  ne_test_data_s *_td = (ne_test_data_s *) user_data;
+  nns_edge_event_e event = NNS_EDGE_EVENT_UNKNOWN;
+  nns_edge_data_h data_h;
+  char *val;
   int ret;
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  ret = nns_edge_event_get_type (event_h, &event);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_set_info (edge_h, "capability", "capa-for-test");
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_set_info (edge_h, "topic", "topic-for-test");
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_set_info (edge_h, "ip", "165.213.201.100");
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_set_info (edge_h, "port", "2000");
+  if (event == NNS_EDGE_EVENT_NEW_DATA_RECEIVED) {
+    ret = nns_edge_event_parse_new_data (event_h, &data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+    /* The sequence number is optional, _test_send_request() does not set it. */
+    ret = nns_edge_data_get_info (data_h, "test-seq", &val);
+    if (ret == NNS_EDGE_ERROR_NONE) {
+      EXPECT_EQ ((unsigned int) strtoul (val, NULL, 10), _td->received);
+      SAFE_FREE (val);
+    }
+
+    ret = nns_edge_data_destroy (data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+    if (_td->is_server)
+      usleep (10000);
+  }
+
+  return _test_edge_event_cb (event_h, user_data);
+}
+
+/**
+ * @brief Connect to local host, the dispatch workers invoke the callback in order.
+ */
+TEST(edge, connectLocalDispatch)
+{
+  nns_edge_h server_h, client_h;
+  ne_test_data_s *_td_server, *_td_client;
+  nns_edge_data_h data_h;
+  nns_size_t data_len;
+  void *data;
+  unsigned int i, retry;
+  int ret, port;
+  char *val;
+
+  _td_server = _get_test_data (true);
+  _td_client = _get_test_data (false);
+  ASSERT_TRUE (_td_server != NULL && _td_client != NULL);
+  port = nns_edge_get_available_port ();
+
+  /* Prepare server (127.0.0.1:port) */
+  val = nns_edge_strdup_printf ("%d", port);
+  nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &server_h);
+  nns_edge_set_event_callback (server_h, _test_edge_dispatch_event_cb, _td_server);
+  nns_edge_set_info (server_h, "IP", "127.0.0.1");
+  nns_edge_set_info (server_h, "PORT", val);
+  nns_edge_set_info (server_h, "CAPS", "test server");
+  ret = nns_edge_set_info (server_h, "DISPATCH_THREADS", "2");
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_set_info (edge_h, "dest_ip", "165.213.201.101");
+  _td_server->handle = server_h;
+  SAFE_FREE (val);
+
+  nns_edge_create_handle ("temp-client", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h);
+  nns_edge_set_event_callback (client_h, _test_edge_dispatch_event_cb, _td_client);
+  nns_edge_set_info (client_h, "CAPS", "test client");
+  ret = nns_edge_set_info (client_h, "DISPATCH_THREADS", "1");
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_set_info (edge_h, "dest_port", "2001");
+  ret = nns_edge_set_info (client_h, "DISPATCH_QUEUE_SIZE", "0");
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_set_info (edge_h, "temp-key1", "temp-value1");
+  _td_client->handle = client_h;
+
+  ret = nns_edge_start (server_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_set_info (edge_h, "temp-key2", "temp-value2");
+  ret = nns_edge_start (client_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_get_info (edge_h, "ID", &value);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (value, "temp-id");
-  SAFE_FREE (value);
+  /* Cannot change the dispatch workers after starting the handle. */
+  ret = nns_edge_set_info (server_h, "DISPATCH_THREADS", "4");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
+  ret = nns_edge_set_info (server_h, "DISPATCH_QUEUE_SIZE", "4:NEW");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
 
-  ret = nns_edge_get_info (edge_h, "capability", &value);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (value, "capa-for-test");
-  SAFE_FREE (value);
+  usleep (200000);
 
-  ret = nns_edge_get_info (edge_h, "topic", &value);
+  ret = nns_edge_connect (client_h, "127.0.0.1", port);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (value, "topic-for-test");
-  SAFE_FREE (value);
 
-  ret = nns_edge_get_info (edge_h, "ip", &value);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (value, "165.213.201.100");
-  SAFE_FREE (value);
+  usleep (200000);
 
-  ret = nns_edge_get_info (edge_h, "port", &value);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (value, "2000");
-  SAFE_FREE (value);
+  data_len = 10U * sizeof (unsigned int);
+  for (i = 0; i < 20U; i++) {
+    data = malloc (data_len);
+    ASSERT_TRUE (data != NULL);
 
-  ret = nns_edge_get_info (edge_h, "dest_ip", &value);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (value, "165.213.201.101");
-  SAFE_FREE (value);
+    for (retry = 0; retry < 10U; retry++)
+      ((unsigned int *) data)[retry] = retry;
 
-  ret = nns_edge_get_info (edge_h, "dest_port", &value);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (value, "2001");
-  SAFE_FREE (value);
+    ret = nns_edge_data_create (&data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    ret = nns_edge_data_add (data_h, data, data_len, nns_edge_free);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    nns_edge_data_set_info (data_h, "test-key1", "test-value1");
+    nns_edge_data_set_info (data_h, "test-key2", "test-value2");
 
-  ret = nns_edge_get_info (edge_h, "temp-key1", &value);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (value, "temp-value1");
-  SAFE_FREE (value);
+    val = nns_edge_strdup_printf ("%u", i);
+    ret = nns_edge_data_set_info (data_h, "test-seq", val);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    SAFE_FREE (val);
 
-  ret = nns_edge_get_info (edge_h, "temp-key2", &value);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (value, "temp-value2");
-  SAFE_FREE (value);
+    ret = nns_edge_send (client_h, data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  /* Replace old value */
-  ret = nns_edge_set_info (edge_h, "temp-key2", "temp-value2-replaced");
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    ret = nns_edge_data_destroy (data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
 
-  ret = nns_edge_get_info (edge_h, "temp-key2", &value);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (value, "temp-value2-replaced");
-  SAFE_FREE (value);
+  /* Wait for responding data (5 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+  } while (_td_client->received < 20U && retry++ < 50U);
 
-  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (_td_server->received, 20U);
+  EXPECT_EQ (_td_client->received, 20U);
+
+  ret = nns_edge_release_handle (server_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_release_handle (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  _free_test_data (_td_server);
+  _free_test_data (_td_client);
 }
 
 /**
- * @brief Get info - invalid param.
+ * @brief Release the handle while the dispatch workers have the events in the queue.
  */
-TEST(edge, getInfoInvalidParam01_n)
+TEST(edge, connectLocalDispatchRelease)
 {
-  char *value = NULL;
-  int ret;
+  nns_edge_h server_h, client_h;
+  ne_test_data_s *_td_server, *_td_client;
+  unsigned int i, retry;
+  int ret, port;
+  char *val;
 
-  ret = nns_edge_get_info (NULL, "temp-key", &value);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-}
+  _td_server = _get_test_data (true);
+  _td_client = _get_test_data (false);
+  ASSERT_TRUE (_td_server != NULL && _td_client != NULL);
+  port = nns_edge_get_available_port ();
 
-/**
- * @brief Get info - invalid param.
- */
-TEST(edge, getInfoInvalidParam02_n)
-{
-  nns_edge_h edge_h;
-  char *value;
-  int ret;
+  /* Prepare server (127.0.0.1:port) */
+  val = nns_edge_strdup_printf ("%d", port);
+  nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &server_h);
+  nns_edge_set_event_callback (server_h, _test_edge_dispatch_event_cb, _td_server);
+  nns_edge_set_info (server_h, "IP", "127.0.0.1");
+  nns_edge_set_info (server_h, "PORT", val);
+  nns_edge_set_info (server_h, "CAPS", "test server");
+  nns_edge_set_info (server_h, "DISPATCH_THREADS", "1");
+  _td_server->handle = server_h;
+  SAFE_FREE (val);
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  nns_edge_create_handle ("temp-client", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h);
+  nns_edge_set_event_callback (client_h, _test_edge_event_cb, _td_client);
+  nns_edge_set_info (client_h, "CAPS", "test client");
+  _td_client->handle = client_h;
+
+  ret = nns_edge_start (server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_start (client_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC_DEAD);
+  usleep (200000);
 
-  ret = nns_edge_get_info (edge_h, "temp-key", &value);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_connect (client_h, "127.0.0.1", port);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC);
+  usleep (200000);
 
-  ret = nns_edge_release_handle (edge_h);
+  /* The server invokes the callback slowly, the events are waiting in the queue. */
+  for (i = 0; i < 10U; i++)
+    _test_send_request (client_h);
+
+  retry = 0U;
+  do {
+    usleep (10000);
+  } while (_td_server->received < 1U && retry++ < 100U);
+
+  ret = nns_edge_release_handle (server_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_LT (_td_server->received, 10U);
+
+  ret = nns_edge_release_handle (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  _free_test_data (_td_server);
+  _free_test_data (_td_client);
 }
 
 /**
- * @brief Get info - invalid param.
+ * @brief Connect to the server with unix domain socket, send a request and wait for responding data.
  */
-TEST(edge, getInfoInvalidParam03_n)
+static void
+_test_connect_uds (const char *server_host, int port)
 {
-  nns_edge_h edge_h;
-  char *value = NULL;
+  nns_edge_h server_h, client_h;
+  ne_test_data_s *_td_server, *_td_client;
+  unsigned int retry;
   int ret;
+  char *val;
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _td_server = _get_test_data (true);
+  _td_client = _get_test_data (false);
+  ASSERT_TRUE (_td_server != NULL && _td_client != NULL);
 
-  ret = nns_edge_get_info (edge_h, NULL, &value);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  val = nns_edge_strdup_printf ("%d", port);
+  nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_UDS,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &server_h);
+  nns_edge_set_event_callback (server_h, _test_edge_event_cb, _td_server);
+  nns_edge_set_info (server_h, "IP", server_host);
+  nns_edge_set_info (server_h, "PORT", val);
+  nns_edge_set_info (server_h, "CAPS", "test server");
+  _td_server->handle = server_h;
+  SAFE_FREE (val);
 
-  ret = nns_edge_release_handle (edge_h);
+  nns_edge_create_handle ("temp-client", NNS_EDGE_CONNECT_TYPE_UDS,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h);
+  nns_edge_set_event_callback (client_h, _test_edge_event_cb, _td_client);
+  nns_edge_set_info (client_h, "CAPS", "test client");
+  _td_client->handle = client_h;
+
+  ret = nns_edge_start (server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_start (client_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-}
 
-/**
- * @brief Get info - invalid param.
- */
-TEST(edge, getInfoInvalidParam04_n)
-{
-  nns_edge_h edge_h;
-  char *value = NULL;
-  int ret;
+  usleep (200000);
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  ret = nns_edge_connect (client_h, server_host, port);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_get_info (edge_h, "", &value);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  usleep (200000);
 
-  ret = nns_edge_release_handle (edge_h);
+  _test_send_request (client_h);
+
+  /* Wait for responding data (5 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+  } while (_td_client->received == 0U && retry++ < 50U);
+
+  EXPECT_EQ (_td_server->received, 1U);
+  EXPECT_EQ (_td_client->received, 1U);
+
+  ret = nns_edge_release_handle (server_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_release_handle (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  _free_test_data (_td_server);
+  _free_test_data (_td_client);
 }
 
 /**
- * @brief Get info - invalid param.
+ * @brief Connect to local host with unix domain socket in the abstract namespace.
  */
-TEST(edge, getInfoInvalidParam05_n)
+TEST(edge, connectLocalUds)
 {
-  nns_edge_h edge_h;
-  int ret;
+  _test_connect_uds ("localhost", nns_edge_get_available_port ());
+}
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+/**
+ * @brief Connect to local host with the file of unix domain socket.
+ */
+TEST(edge, connectLocalUdsPath)
+{
+  char *path;
 
-  ret = nns_edge_get_info (edge_h, "temp-key", NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  path = nns_edge_strdup_printf ("/tmp/nns-edge-test-%d.sock", (int) getpid ());
+  ASSERT_TRUE (path != NULL);
 
-  ret = nns_edge_release_handle (edge_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _test_connect_uds (path, 1);
+
+  /* The socket file is removed when releasing the handle. */
+  EXPECT_NE (access (path, F_OK), 0);
+  SAFE_FREE (path);
 }
 
 /**
- * @brief Get info - invalid param.
+ * @brief Start edge handle with unix domain socket - invalid path.
  */
-TEST(edge, getInfoInvalidParam06_n)
+TEST(edge, connectLocalUdsInvalidPath_n)
 {
   nns_edge_h edge_h;
+  char path[256];
   int ret;
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+  memset (path, 'a', sizeof (path) - 1);
+  path[0] = '/';
+  path[sizeof (path) - 1] = '\0';
+
+  ret = nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_UDS,
       NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_set_info (edge_h, "IP", path);
 
-  /* Cannot get the client ID if handle is server */
-  ret = nns_edge_get_info (edge_h, "client_id", NULL);
+  /* The path is longer than the limit of socket address. */
+  ret = nns_edge_start (edge_h);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
   ret = nns_edge_release_handle (edge_h);
@@ -1057,2441 +1577,8387 @@ TEST(edge, getInfoInvalidParam06_n)
 }
 
 /**
- * @brief Clear info of edge-data - invalid param.
+ * @brief Edge event callback for test, the server receives the batch and responds each data.
  */
-TEST(edgeData, clearInfoInvalidParam01_n)
+static int
+_test_edge_batch_event_cb (nns_edge_event_h event_h, void *user_data)
 {
+  ne_test_data_s *_td = (ne_test_data_s *) user_data;
+  nns_edge_event_e event = NNS_EDGE_EVENT_UNKNOWN;
+  nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len;
+  char *val;
+  unsigned int i, j, count = 0;
   int ret;
 
-  ret = nns_edge_data_clear_info (NULL);
-  EXPECT_NE (NNS_EDGE_ERROR_NONE, ret);
-}
+  ret = nns_edge_event_get_type (event_h, &event);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-/**
- * @brief Clear info of edge-data - invalid param.
- */
-TEST(edgeData, clearInfoInvalidParam02_n)
-{
-  nns_edge_data_h data_h;
-  int ret;
+  if (event != NNS_EDGE_EVENT_NEW_BATCH_RECEIVED)
+    return _test_edge_event_cb (event_h, user_data);
 
-  ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+  _td->batches++;
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+  ret = nns_edge_event_parse_batch_count (event_h, &count);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_clear_info (data_h);
-  EXPECT_NE (NNS_EDGE_ERROR_NONE, ret);
+  for (i = 0; i < count; i++) {
+    _td->received++;
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+    ret = nns_edge_event_parse_batch_data (event_h, i, &data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_destroy (data_h);
-  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+    ret = nns_edge_data_get_info (data_h, "test-key1", &val);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    EXPECT_STREQ (val, "test-value1");
+    SAFE_FREE (val);
+
+    ret = nns_edge_data_get (data_h, 0, &data, &data_len);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    EXPECT_EQ (data_len, 10U * sizeof (unsigned int));
+    for (j = 0; j < 10U; j++)
+      EXPECT_EQ (((unsigned int *) data)[j], j);
+
+    ret = nns_edge_send (_td->handle, data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+    ret = nns_edge_data_destroy (data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+
+  return NNS_EDGE_ERROR_NONE;
 }
 
 /**
- * @brief Clear info of edge data.
+ * @brief Connect to local host, the client sends the requests in batches. The server invokes the callback in the dispatch workers if dispatch_threads is given.
  */
-TEST(edgeData, clearInfo)
+static void
+_test_connect_batch (const char *batch_count, const char *batch_delay,
+    bool batch_event, const char *dispatch_threads, unsigned int n_requests,
+    unsigned int *batches)
 {
-  nns_edge_data_h data_h;
-  char *value = NULL;
-  int ret;
+  nns_edge_h server_h, client_h;
+  ne_test_data_s *_td_server, *_td_client;
+  unsigned int i, retry;
+  int ret, port;
+  char *val;
 
-  ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+  _td_server = _get_test_data (true);
+  _td_client = _get_test_data (false);
+  ASSERT_TRUE (_td_server != NULL && _td_client != NULL);
+  port = nns_edge_get_available_port ();
 
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
-  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+  /* Prepare server (127.0.0.1:port) */
+  val = nns_edge_strdup_printf ("%d", port);
+  nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &server_h);
+  nns_edge_set_event_callback (server_h, _test_edge_batch_event_cb, _td_server);
+  nns_edge_set_info (server_h, "IP", "127.0.0.1");
+  nns_edge_set_info (server_h, "PORT", val);
+  nns_edge_set_info (server_h, "CAPS", "test server");
+  ret = nns_edge_set_info (server_h, "BATCH_EVENT",
+      batch_event ? "BATCH" : "SPLIT");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  if (dispatch_threads) {
+    ret = nns_edge_set_info (server_h, "DISPATCH_THREADS", dispatch_threads);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+  _td_server->handle = server_h;
+  SAFE_FREE (val);
 
-  ret = nns_edge_data_get_info (data_h, "temp-key", &value);
-  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
-  EXPECT_STREQ ("temp-value", value);
-  SAFE_FREE (value);
+  nns_edge_create_handle ("temp-client", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h);
+  nns_edge_set_event_callback (client_h, _test_edge_event_cb, _td_client);
+  nns_edge_set_info (client_h, "CAPS", "test client");
+  ret = nns_edge_set_info (client_h, "BATCH_COUNT", batch_count);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (client_h, "BATCH_DELAY", batch_delay);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _td_client->handle = client_h;
 
-  ret = nns_edge_data_clear_info (data_h);
-  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+  ret = nns_edge_start (server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_start (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_get_info (data_h, "temp-key", &value);
-  EXPECT_NE (NNS_EDGE_ERROR_NONE, ret);
+  usleep (200000);
 
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
-  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+  ret = nns_edge_connect (client_h, "127.0.0.1", port);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_get_info (data_h, "temp-key", &value);
-  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
-  EXPECT_STREQ ("temp-value", value);
-  SAFE_FREE (value);
+  usleep (200000);
 
-  ret = nns_edge_data_destroy (data_h);
+  for (i = 0; i < n_requests; i++)
+    _test_send_request (client_h);
+
+  /* Wait for responding data (5 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+  } while (_td_client->received < n_requests && retry++ < 50U);
+
+  EXPECT_EQ (_td_server->received, n_requests);
+  EXPECT_EQ (_td_client->received, n_requests);
+  *batches = _td_server->batches;
+
+  ret = nns_edge_release_handle (server_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_release_handle (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  _free_test_data (_td_server);
+  _free_test_data (_td_client);
 }
 
 /**
- * @brief Create edge-data - invalid param.
+ * @brief Connect to local host, the batch is sent when it reaches max count.
  */
-TEST(edgeData, createInvalidParam01_n)
+TEST(edge, connectLocalBatchCount)
 {
-  int ret;
+  unsigned int batches = 0U;
 
-  ret = nns_edge_data_create (NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  _test_connect_batch ("8", "5000000", true, NULL, 16U, &batches);
+  EXPECT_EQ (batches, 2U);
 }
 
 /**
- * @brief Destroy edge-data - invalid param.
+ * @brief Connect to local host, the batch is sent after max delay.
  */
-TEST(edgeData, destroyInvalidParam01_n)
+TEST(edge, connectLocalBatchDelay)
 {
-  int ret;
+  unsigned int batches = 0U;
 
-  ret = nns_edge_data_destroy (NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  _test_connect_batch ("64", "100000", true, NULL, 3U, &batches);
+  EXPECT_EQ (batches, 1U);
 }
 
 /**
- * @brief Destroy edge-data - invalid param.
+ * @brief Connect to local host, the batch is sent when the queue is empty and the server receives each data.
  */
-TEST(edgeData, destroyInvalidParam02_n)
+TEST(edge, connectLocalBatchSplit)
 {
-  nns_edge_data_h data_h;
-  int ret;
-
-  ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+  unsigned int batches = 0U;
 
-  ret = nns_edge_data_destroy (data_h);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
-
-  ret = nns_edge_data_destroy (data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _test_connect_batch ("16", "0", false, NULL, 20U, &batches);
+  EXPECT_EQ (batches, 0U);
 }
 
 /**
- * @brief Validate edge-data.
+ * @brief Connect to local host, the dispatch workers take the data in the batch and invoke the callback.
  */
-TEST(edgeData, validate)
+TEST(edge, connectLocalBatchDispatch)
 {
-  nns_edge_data_h data_h;
-  int ret;
-
-  ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_data_is_valid (data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  unsigned int batches = 0U;
 
-  ret = nns_edge_data_destroy (data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _test_connect_batch ("8", "5000000", true, "2", 16U, &batches);
+  EXPECT_EQ (batches, 2U);
 }
 
 /**
- * @brief Validate edge-data - invalid param.
+ * @brief Connect to local host, the dispatch workers take the data in the batch and invoke the callback for each data.
  */
-TEST(edgeData, validateInvalidParam01_n)
+TEST(edge, connectLocalBatchSplitDispatch)
 {
-  int ret;
+  unsigned int batches = 0U;
 
-  ret = nns_edge_data_is_valid (NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  _test_connect_batch ("16", "0", false, "2", 20U, &batches);
+  EXPECT_EQ (batches, 0U);
 }
 
 /**
- * @brief Validate edge-data - invalid param.
+ * @brief Edge event callback for test, the client checks the request ID and round-trip time of the response.
  */
-TEST(edgeData, validateInvalidParam02_n)
+static int
+_test_edge_request_cb (nns_edge_event_h event_h, void *user_data)
 {
+  ne_test_data_s *_td = (ne_test_data_s *) user_data;
+  nns_edge_event_e event = NNS_EDGE_EVENT_UNKNOWN;
   nns_edge_data_h data_h;
+  uint64_t request_id = 0;
+  int64_t rtt = -1;
+  char *val;
   int ret;
 
-  ret = nns_edge_data_create (&data_h);
+  ret = nns_edge_event_get_type (event_h, &event);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+  if (event == NNS_EDGE_EVENT_NEW_DATA_RECEIVED) {
+    ret = nns_edge_event_parse_new_data (event_h, &data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_is_valid (data_h);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+    ret = nns_edge_data_get_request_id (data_h, &request_id);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    ret = nns_edge_data_get_request_rtt (data_h, &rtt);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    EXPECT_GE (rtt, 0);
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+    ret = nns_edge_data_get_info (data_h, "request_id", &val);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    EXPECT_EQ (strtoull (val, NULL, 10), request_id);
+    SAFE_FREE (val);
 
-  ret = nns_edge_data_destroy (data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    if (request_id > 0 && rtt >= 0)
+      _td->responses++;
+
+    ret = nns_edge_data_destroy (data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+
+  return _test_edge_event_cb (event_h, user_data);
 }
 
 /**
- * @brief Copy edge-data.
+ * @brief Connect to local host, the client sends the requests with the window and receives the responses with the request ID.
  */
-TEST(edgeData, copy)
+TEST(edge, connectLocalRequest)
 {
-  nns_edge_data_h src_h, desc_h;
-  void *data, *result;
-  nns_size_t data_len, result_len;
-  char *result_value;
-  unsigned int i, result_count;
-  int ret;
+  nns_edge_h server_h, client_h;
+  nns_edge_data_h data_h;
+  ne_test_data_s *_td_server, *_td_client;
+  unsigned int i, retry;
+  uint64_t request_id;
+  void *data;
+  int ret, port;
+  char *val;
 
-  data_len = 10U * sizeof (unsigned int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
+  _td_server = _get_test_data (true);
+  _td_client = _get_test_data (false);
+  ASSERT_TRUE (_td_server != NULL && _td_client != NULL);
+  port = nns_edge_get_available_port ();
 
-  for (i = 0; i < 10U; i++)
-    ((unsigned int *) data)[i] = i;
+  /* Prepare server (127.0.0.1:port) */
+  val = nns_edge_strdup_printf ("%d", port);
+  nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &server_h);
+  nns_edge_set_event_callback (server_h, _test_edge_event_cb, _td_server);
+  nns_edge_set_info (server_h, "IP", "127.0.0.1");
+  nns_edge_set_info (server_h, "PORT", val);
+  nns_edge_set_info (server_h, "CAPS", "test server");
+  _td_server->handle = server_h;
+  SAFE_FREE (val);
 
-  ret = nns_edge_data_create (&src_h);
+  nns_edge_create_handle ("temp-client", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h);
+  nns_edge_set_event_callback (client_h, _test_edge_request_cb, _td_client);
+  nns_edge_set_info (client_h, "CAPS", "test client");
+  ret = nns_edge_set_info (client_h, "REQUEST_WINDOW", "4");
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _td_client->handle = client_h;
 
-  ret = nns_edge_data_set_info (src_h, "temp-key1", "temp-data-val1");
+  ret = nns_edge_start (server_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_data_set_info (src_h, "temp-key2", "temp-data-val2");
+  ret = nns_edge_start (client_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_add (src_h, data, data_len, nns_edge_free);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  usleep (200000);
 
-  ret = nns_edge_data_copy (src_h, &desc_h);
+  ret = nns_edge_connect (client_h, "127.0.0.1", port);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_destroy (src_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  usleep (200000);
 
-  /* Compare data and info */
-  ret = nns_edge_data_get_count (desc_h, &result_count);
+  ret = nns_edge_get_info (client_h, "client_id", &val);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (result_count, 1U);
 
-  ret = nns_edge_data_get (desc_h, 0, &result, &result_len);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  for (i = 0; i < 10U; i++)
-    EXPECT_EQ (((unsigned int *) result)[i], i);
+  for (i = 0; i < 32U; i++) {
+    data = malloc (10U * sizeof (unsigned int));
+    ASSERT_TRUE (data != NULL);
+    for (unsigned int j = 0; j < 10U; j++)
+      ((unsigned int *) data)[j] = j;
 
-  ret = nns_edge_data_get_info (desc_h, "temp-key1", &result_value);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (result_value, "temp-data-val1");
-  SAFE_FREE (result_value);
+    nns_edge_data_create (&data_h);
+    nns_edge_data_add (data_h, data, 10U * sizeof (unsigned int), nns_edge_free);
+    nns_edge_data_set_info (data_h, "test-key1", "test-value1");
+    nns_edge_data_set_info (data_h, "test-key2", "test-value2");
+    nns_edge_data_set_info (data_h, "client_id", val);
 
-  ret = nns_edge_data_get_info (desc_h, "temp-key2", &result_value);
+    ret = nns_edge_send_request (client_h, data_h, &request_id);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    EXPECT_EQ (request_id, (uint64_t) i + 1U);
+
+    nns_edge_data_destroy (data_h);
+  }
+  SAFE_FREE (val);
+
+  /* Wait for responding data (5 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+  } while (_td_client->received < 32U && retry++ < 50U);
+
+  EXPECT_EQ (_td_server->received, 32U);
+  EXPECT_EQ (_td_client->received, 32U);
+  EXPECT_EQ (_td_client->responses, 32U);
+
+  ret = nns_edge_get_info (client_h, "REQUEST_COUNT", &val);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (result_value, "temp-data-val2");
-  SAFE_FREE (result_value);
+  EXPECT_STREQ (val, "0");
+  SAFE_FREE (val);
 
-  ret = nns_edge_data_destroy (desc_h);
+  ret = nns_edge_release_handle (server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_release_handle (client_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  _free_test_data (_td_server);
+  _free_test_data (_td_client);
 }
 
 /**
- * @brief Copy edge-data - invalid param.
+ * @brief Connect to local host, the request is removed from the window if the server does not respond.
  */
-TEST(edgeData, copyInvalidParam01_n)
+TEST(edge, connectLocalRequestTimeout)
 {
-  nns_edge_data_h desc_h;
-  int ret;
+  nns_edge_h server_h, client_h;
+  nns_edge_data_h data_h;
+  int64_t start;
+  int ret, port;
+  char *val;
 
-  ret = nns_edge_data_copy (NULL, &desc_h);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-}
+  port = nns_edge_get_available_port ();
 
-/**
- * @brief Copy edge-data - invalid param.
- */
-TEST(edgeData, copyInvalidParam02_n)
-{
-  nns_edge_data_h src_h, desc_h;
-  int ret;
+  /* The server does not respond without test data. */
+  val = nns_edge_strdup_printf ("%d", port);
+  nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &server_h);
+  nns_edge_set_event_callback (server_h, _test_edge_event_cb, NULL);
+  nns_edge_set_info (server_h, "IP", "127.0.0.1");
+  nns_edge_set_info (server_h, "PORT", val);
+  nns_edge_set_info (server_h, "CAPS", "test server");
+  SAFE_FREE (val);
 
-  ret = nns_edge_data_create (&src_h);
+  nns_edge_create_handle ("temp-client", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h);
+  nns_edge_set_event_callback (client_h, _test_edge_event_cb, NULL);
+  nns_edge_set_info (client_h, "CAPS", "test client");
+  ret = nns_edge_set_info (client_h, "REQUEST_WINDOW", "1");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (client_h, "REQUEST_TIMEOUT", "200");
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (src_h, NNS_EDGE_MAGIC_DEAD);
+  ret = nns_edge_start (server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_start (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_copy (src_h, &desc_h);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  usleep (200000);
 
-  nns_edge_handle_set_magic (src_h, NNS_EDGE_MAGIC);
-
-  ret = nns_edge_data_destroy (src_h);
+  ret = nns_edge_connect (client_h, "127.0.0.1", port);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-}
-
-/**
- * @brief Copy edge-data - invalid param.
- */
-TEST(edgeData, copyInvalidParam03_n)
-{
-  nns_edge_data_h src_h;
-  int ret;
 
-  ret = nns_edge_data_create (&src_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  usleep (200000);
 
-  ret = nns_edge_data_copy (src_h, NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_data_create (&data_h);
 
-  ret = nns_edge_data_destroy (src_h);
+  ret = nns_edge_send_request (client_h, data_h, NULL);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-}
-
-/**
- * @brief Add edge-data - max data limit.
- */
-TEST(edgeData, addMaxData_n)
-{
-  nns_edge_data_h data_h;
-  void *data;
-  nns_size_t data_len;
-  int i, ret;
 
-  data_len = 10U * sizeof (int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
+  ret = nns_edge_get_info (client_h, "REQUEST_COUNT", &val);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (val, "1");
+  SAFE_FREE (val);
 
-  ret = nns_edge_data_create (&data_h);
+  /* The window is full, wait until the first request expires. */
+  start = nns_edge_get_monotonic_time ();
+  ret = nns_edge_send_request (client_h, data_h, NULL);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_GE (nns_edge_get_monotonic_time () - start, 100000);
 
-  for (i = 0; i < NNS_EDGE_DATA_LIMIT; i++) {
-    ret = nns_edge_data_add (data_h, data, data_len, NULL);
-    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  }
+  ret = nns_edge_get_info (client_h, "REQUEST_COUNT", &val);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (val, "1");
+  SAFE_FREE (val);
 
-  ret = nns_edge_data_add (data_h, data, data_len, NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_data_destroy (data_h);
 
-  ret = nns_edge_data_destroy (data_h);
+  ret = nns_edge_release_handle (server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_release_handle (client_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  SAFE_FREE (data);
 }
 
 /**
- * @brief Add edge-data - invalid param.
+ * @brief Data struct to send the request in other thread.
  */
-TEST(edgeData, addInvalidParam01_n)
+typedef struct
 {
-  void *data;
-  nns_size_t data_len;
+  nns_edge_h handle;
+  nns_edge_data_h data_h;
   int ret;
+  bool done;
+} ne_test_request_s;
 
-  data_len = 10U * sizeof (int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
+/**
+ * @brief Thread to send the request, it waits until the window has room.
+ */
+static void *
+_test_thread_send_request (void *thread_data)
+{
+  ne_test_request_s *req = (ne_test_request_s *) thread_data;
 
-  ret = nns_edge_data_add (NULL, data, data_len, NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  req->ret = nns_edge_send_request (req->handle, req->data_h, NULL);
+  __atomic_store_n (&req->done, true, __ATOMIC_SEQ_CST);
 
-  SAFE_FREE (data);
+  return NULL;
 }
 
 /**
- * @brief Add edge-data - invalid param.
+ * @brief Fill the window of the requests without timeout, then wait for the thread sending next request until the window is released.
  */
-TEST(edgeData, addInvalidParam02_n)
+static void
+_test_request_window_wait (bool stop_client)
 {
-  nns_edge_data_h data_h;
-  void *data;
-  nns_size_t data_len;
-  int ret;
+  nns_edge_h server_h, client_h;
+  ne_test_request_s req;
+  pthread_t thread;
+  unsigned int retry;
+  int ret, port;
+  char *val;
 
-  data_len = 10U * sizeof (int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
+  port = nns_edge_get_available_port ();
 
-  ret = nns_edge_data_create (&data_h);
+  /* The server does not respond without test data. */
+  val = nns_edge_strdup_printf ("%d", port);
+  nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &server_h);
+  nns_edge_set_event_callback (server_h, _test_edge_event_cb, NULL);
+  nns_edge_set_info (server_h, "IP", "127.0.0.1");
+  nns_edge_set_info (server_h, "PORT", val);
+  nns_edge_set_info (server_h, "CAPS", "test server");
+  SAFE_FREE (val);
+
+  nns_edge_create_handle ("temp-client", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h);
+  nns_edge_set_event_callback (client_h, _test_edge_event_cb, NULL);
+  nns_edge_set_info (client_h, "CAPS", "test client");
+  ret = nns_edge_set_info (client_h, "REQUEST_WINDOW", "1");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (client_h, "REQUEST_TIMEOUT", "0");
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+  ret = nns_edge_start (server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_start (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_add (data_h, data, data_len, NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  usleep (200000);
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+  ret = nns_edge_connect (client_h, "127.0.0.1", port);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_destroy (data_h);
+  usleep (200000);
+
+  memset (&req, 0, sizeof (ne_test_request_s));
+  req.handle = client_h;
+  nns_edge_data_create (&req.data_h);
+
+  ret = nns_edge_send_request (client_h, req.data_h, NULL);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  SAFE_FREE (data);
-}
+  /* The window is full and the request does not expire. */
+  ret = pthread_create (&thread, NULL, _test_thread_send_request, &req);
+  ASSERT_EQ (ret, 0);
 
-/**
- * @brief Add edge-data - invalid param.
- */
-TEST(edgeData, addInvalidParam03_n)
-{
-  nns_edge_data_h data_h;
-  void *data;
-  nns_size_t data_len;
-  int ret;
+  usleep (300000);
+  EXPECT_FALSE (__atomic_load_n (&req.done, __ATOMIC_SEQ_CST));
 
-  data_len = 10U * sizeof (int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
+  if (stop_client) {
+    ret = nns_edge_stop (client_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  } else {
+    /* The connection is closed, the request sent to the server is removed. */
+    ret = nns_edge_release_handle (server_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    server_h = NULL;
+  }
 
-  ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  /* Wait for the thread (5 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+  } while (!__atomic_load_n (&req.done, __ATOMIC_SEQ_CST) && retry++ < 50U);
 
-  ret = nns_edge_data_add (data_h, NULL, data_len, NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_TRUE (__atomic_load_n (&req.done, __ATOMIC_SEQ_CST));
 
-  ret = nns_edge_data_destroy (data_h);
+  /* Releasing the handle wakes up the thread in any case. */
+  ret = nns_edge_release_handle (client_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  pthread_join (thread, NULL);
 
-  SAFE_FREE (data);
+  /* Without the connection, the request cannot be sent after the window is released. */
+  EXPECT_NE (req.ret, NNS_EDGE_ERROR_NONE);
+
+  if (server_h) {
+    ret = nns_edge_release_handle (server_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+
+  nns_edge_data_destroy (req.data_h);
 }
 
 /**
- * @brief Add edge-data - invalid param.
+ * @brief The thread waiting for the window of the requests returns when stopping the edge handle.
  */
-TEST(edgeData, addInvalidParam04_n)
+TEST(edge, connectLocalRequestStop)
 {
-  nns_edge_data_h data_h;
-  void *data;
-  nns_size_t data_len;
-  int ret;
-
-  data_len = 10U * sizeof (int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
-
-  ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_data_add (data_h, data, 0, NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_data_destroy (data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _test_request_window_wait (true);
+}
 
-  SAFE_FREE (data);
+/**
+ * @brief The requests sent to the closed connection are removed from the window.
+ */
+TEST(edge, connectLocalRequestClosed)
+{
+  _test_request_window_wait (false);
 }
 
 /**
- * @brief Get edge-data.
+ * @brief Connect to two servers with load balancing, and get the number of requests received in each server.
  */
-TEST(edgeData, get)
+static void
+_test_connect_balance (const char *policy, unsigned int *received)
 {
-  nns_edge_data_h data_h;
-  void *data, *result;
-  nns_size_t data_len, result_len;
-  unsigned int count;
-  int ret;
+  nns_edge_h server_h[2], client_h;
+  ne_test_data_s *_td_server[2], *_td_client;
+  unsigned int i, retry;
+  int ret, port[2];
+  char *val;
 
-  data_len = 10U * sizeof (int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
+  _td_client = _get_test_data (false);
+  ASSERT_TRUE (_td_client != NULL);
+
+  for (i = 0; i < 2U; i++) {
+    _td_server[i] = _get_test_data (true);
+    ASSERT_TRUE (_td_server[i] != NULL);
+    port[i] = nns_edge_get_available_port ();
+
+    val = nns_edge_strdup_printf ("%d", port[i]);
+    nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_TCP,
+        NNS_EDGE_NODE_TYPE_QUERY_SERVER, &server_h[i]);
+    nns_edge_set_event_callback (server_h[i], _test_edge_event_cb,
+        _td_server[i]);
+    nns_edge_set_info (server_h[i], "IP", "127.0.0.1");
+    nns_edge_set_info (server_h[i], "PORT", val);
+    nns_edge_set_info (server_h[i], "CAPS", "test server");
+    _td_server[i]->handle = server_h[i];
+    SAFE_FREE (val);
+
+    ret = nns_edge_start (server_h[i]);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
 
-  ret = nns_edge_data_create (&data_h);
+  nns_edge_create_handle ("temp-client", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h);
+  nns_edge_set_event_callback (client_h, _test_edge_event_cb, _td_client);
+  nns_edge_set_info (client_h, "CAPS", "test client");
+  nns_edge_set_info (client_h, "CONNECTION_MODE", "DUPLEX");
+  ret = nns_edge_set_info (client_h, "SERVER_COUNT", "2");
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_data_add (data_h, data, data_len, NULL);
+  ret = nns_edge_set_info (client_h, "LOAD_BALANCE", policy);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _td_client->handle = client_h;
 
-  ret = nns_edge_data_get_count (data_h, &count);
+  ret = nns_edge_start (client_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (count, 1U);
 
-  ret = nns_edge_data_get (data_h, 0, &result, &result_len);
+  usleep (200000);
+
+  for (i = 0; i < 2U; i++) {
+    ret = nns_edge_connect (client_h, "127.0.0.1", port[i]);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+
+  /* The client is connected to the servers, the connection is not duplicated. */
+  ret = nns_edge_connect (client_h, "127.0.0.1", port[0]);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (result, data);
-  EXPECT_EQ (result_len, data_len);
 
-  ret = nns_edge_data_destroy (data_h);
+  usleep (200000);
+
+  for (i = 0; i < 10U; i++) {
+    _test_send_request (client_h);
+    usleep (10000);
+  }
+
+  /* Wait for responding data (5 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+  } while (_td_client->received < 10U && retry++ < 50U);
+
+  EXPECT_EQ (_td_client->received, 10U);
+
+  ret = nns_edge_release_handle (client_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _free_test_data (_td_client);
 
-  SAFE_FREE (data);
+  for (i = 0; i < 2U; i++) {
+    received[i] = _td_server[i]->received;
+
+    ret = nns_edge_release_handle (server_h[i]);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    _free_test_data (_td_server[i]);
+  }
 }
 
 /**
- * @brief Get edge-data - invalid param.
+ * @brief Connect to local host, the client does not check the capability again when it connects to the server again.
  */
-TEST(edgeData, getInvalidParam01_n)
+TEST(edge, connectLocalCapabilityCache)
 {
-  void *data;
-  nns_size_t data_len;
-  int ret;
+  nns_edge_h server_h, client_h;
+  ne_test_data_s *_td_server, *_td_client;
+  unsigned int retry;
+  int ret, port;
+  char *val;
 
-  ret = nns_edge_data_get (NULL, 0, &data, &data_len);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-}
+  _td_server = _get_test_data (true);
+  _td_client = _get_test_data (false);
+  ASSERT_TRUE (_td_server != NULL && _td_client != NULL);
+  port = nns_edge_get_available_port ();
 
-/**
- * @brief Get edge-data - invalid param.
- */
-TEST(edgeData, getInvalidParam02_n)
-{
-  nns_edge_data_h data_h;
-  void *data, *result;
-  nns_size_t data_len, result_len;
-  int ret;
+  val = nns_edge_strdup_printf ("%d", port);
+  nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &server_h);
+  nns_edge_set_event_callback (server_h, _test_edge_event_cb, _td_server);
+  nns_edge_set_info (server_h, "IP", "127.0.0.1");
+  nns_edge_set_info (server_h, "PORT", val);
+  nns_edge_set_info (server_h, "CAPS", "test server");
+  _td_server->handle = server_h;
+  SAFE_FREE (val);
 
-  data_len = 10U * sizeof (int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
+  nns_edge_create_handle ("temp-client", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h);
+  nns_edge_set_event_callback (client_h, _test_edge_event_cb, _td_client);
+  nns_edge_set_info (client_h, "CAPS", "test client");
+  nns_edge_set_info (client_h, "CONNECTION_MODE", "DUPLEX");
+  ret = nns_edge_set_info (client_h, "CAPABILITY_CACHE", "TRUE");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _td_client->handle = client_h;
 
-  ret = nns_edge_data_create (&data_h);
+  ret = nns_edge_start (server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_start (client_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_add (data_h, data, data_len, NULL);
+  usleep (200000);
+
+  ret = nns_edge_connect (client_h, "127.0.0.1", port);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_disconnect (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_connect (client_h, "127.0.0.1", port);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+  usleep (200000);
 
-  ret = nns_edge_data_get (data_h, 0, &result, &result_len);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  _test_send_request (client_h);
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+  /* Wait for responding data (5 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+  } while (_td_client->received < 1U && retry++ < 50U);
 
-  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (_td_client->received, 1U);
+  EXPECT_EQ (_td_client->capabilities, 1U);
+
+  ret = nns_edge_release_handle (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_release_handle (server_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  SAFE_FREE (data);
+  _free_test_data (_td_server);
+  _free_test_data (_td_client);
 }
 
 /**
- * @brief Get edge-data - invalid param.
+ * @brief Connect to local host, the client sends the requests to the standby server when the connection is lost.
  */
-TEST(edgeData, getInvalidParam03_n)
+TEST(edge, connectLocalStandby)
 {
-  nns_edge_data_h data_h;
-  void *data, *result;
-  nns_size_t data_len, result_len;
-  int ret;
+  nns_edge_h server_h[2], client_h;
+  ne_test_data_s *_td_server[2], *_td_client;
+  unsigned int i, retry;
+  int ret, port[2];
+  char *val;
 
-  data_len = 10U * sizeof (int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
+  _td_client = _get_test_data (false);
+  ASSERT_TRUE (_td_client != NULL);
+
+  for (i = 0; i < 2U; i++) {
+    _td_server[i] = _get_test_data (true);
+    ASSERT_TRUE (_td_server[i] != NULL);
+    port[i] = nns_edge_get_available_port ();
+
+    val = nns_edge_strdup_printf ("%d", port[i]);
+    nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_TCP,
+        NNS_EDGE_NODE_TYPE_QUERY_SERVER, &server_h[i]);
+    nns_edge_set_event_callback (server_h[i], _test_edge_event_cb,
+        _td_server[i]);
+    nns_edge_set_info (server_h[i], "IP", "127.0.0.1");
+    nns_edge_set_info (server_h[i], "PORT", val);
+    nns_edge_set_info (server_h[i], "CAPS", "test server");
+    _td_server[i]->handle = server_h[i];
+    SAFE_FREE (val);
+
+    ret = nns_edge_start (server_h[i]);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
 
-  ret = nns_edge_data_create (&data_h);
+  nns_edge_create_handle ("temp-client", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h);
+  nns_edge_set_event_callback (client_h, _test_edge_event_cb, _td_client);
+  nns_edge_set_info (client_h, "CAPS", "test client");
+  nns_edge_set_info (client_h, "CONNECTION_MODE", "DUPLEX");
+  ret = nns_edge_set_info (client_h, "STANDBY", "TRUE");
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _td_client->handle = client_h;
 
-  ret = nns_edge_data_add (data_h, data, data_len, NULL);
+  ret = nns_edge_start (client_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  /* Invalid index */
-  ret = nns_edge_data_get (data_h, 1, &result, &result_len);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  usleep (200000);
 
-  ret = nns_edge_data_destroy (data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  /* The second server is the standby server. */
+  for (i = 0; i < 2U; i++) {
+    ret = nns_edge_connect (client_h, "127.0.0.1", port[i]);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
 
-  SAFE_FREE (data);
-}
+  usleep (200000);
 
-/**
- * @brief Get edge-data - invalid param.
- */
-TEST(edgeData, getInvalidParam04_n)
-{
-  nns_edge_data_h data_h;
-  void *data;
-  nns_size_t data_len, result_len;
-  int ret;
+  for (i = 0; i < 5U; i++) {
+    _test_send_request (client_h);
+    usleep (10000);
+  }
 
-  data_len = 10U * sizeof (int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
+  /* Wait for responding data (5 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+  } while (_td_client->received < 5U && retry++ < 50U);
 
-  ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (_td_client->received, 5U);
+  EXPECT_EQ (_td_server[0]->received, 5U);
+  EXPECT_EQ (_td_server[1]->received, 0U);
 
-  ret = nns_edge_data_add (data_h, data, data_len, NULL);
+  /* Close the first server, then the client switches to the standby server. */
+  ret = nns_edge_release_handle (server_h[0]);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_get (data_h, 0, NULL, &result_len);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  usleep (500000);
 
-  ret = nns_edge_data_destroy (data_h);
+  for (i = 0; i < 5U; i++) {
+    _test_send_request (client_h);
+    usleep (10000);
+  }
+
+  retry = 0U;
+  do {
+    usleep (100000);
+  } while (_td_client->received < 10U && retry++ < 50U);
+
+  EXPECT_EQ (_td_client->received, 10U);
+  EXPECT_EQ (_td_server[1]->received, 5U);
+  EXPECT_FALSE (_td_client->closed);
+  EXPECT_EQ (_td_client->capabilities, 2U);
+
+  ret = nns_edge_release_handle (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_release_handle (server_h[1]);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  SAFE_FREE (data);
+  for (i = 0; i < 2U; i++)
+    _free_test_data (_td_server[i]);
+  _free_test_data (_td_client);
 }
 
 /**
- * @brief Get edge-data - invalid param.
+ * @brief Connect to local host, the client sends the requests to two servers in turn.
  */
-TEST(edgeData, getInvalidParam05_n)
+TEST(edge, connectLocalBalanceRoundRobin)
 {
-  nns_edge_data_h data_h;
-  void *data, *result;
-  nns_size_t data_len;
-  int ret;
-
-  data_len = 10U * sizeof (int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
+  unsigned int received[2] = { 0U, 0U };
 
-  ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _test_connect_balance ("ROUND_ROBIN", received);
+  EXPECT_EQ (received[0], 5U);
+  EXPECT_EQ (received[1], 5U);
+}
 
-  ret = nns_edge_data_add (data_h, data, data_len, NULL);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+/**
+ * @brief Connect to local host, the client sends the requests to the server with the fewest outstanding requests.
+ */
+TEST(edge, connectLocalBalanceLeastOutstanding)
+{
+  unsigned int received[2] = { 0U, 0U };
 
-  ret = nns_edge_data_get (data_h, 0, &result, NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  _test_connect_balance ("LEAST_OUTSTANDING", received);
+  EXPECT_EQ (received[0] + received[1], 10U);
+  EXPECT_TRUE (received[0] > 0U && received[1] > 0U);
+}
 
-  ret = nns_edge_data_destroy (data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+/**
+ * @brief Connect to local host, the client sends the requests to the server with the lowest latency.
+ */
+TEST(edge, connectLocalBalanceLowestLatency)
+{
+  unsigned int received[2] = { 0U, 0U };
 
-  SAFE_FREE (data);
+  _test_connect_balance ("LOWEST_LATENCY", received);
+  EXPECT_EQ (received[0] + received[1], 10U);
+  EXPECT_TRUE (received[0] > 0U && received[1] > 0U);
 }
 
 /**
- * @brief Get count of edge-data - invalid param.
+ * @brief Create edge handle - invalid param.
  */
-TEST(edgeData, getCountInvalidParam01_n)
+TEST(edge, createHandleInvalidParam01_n)
 {
-  unsigned int count;
+  nns_edge_h edge_h;
   int ret;
 
-  ret = nns_edge_data_get_count (NULL, &count);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_UNKNOWN,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Get count of edge-data - invalid param.
+ * @brief Create edge handle - invalid param.
  */
-TEST(edgeData, getCountInvalidParam02_n)
+TEST(edge, createHandleInvalidParam02_n)
 {
-  nns_edge_data_h data_h;
-  void *data;
-  nns_size_t data_len;
-  unsigned int count;
   int ret;
 
-  data_len = 10U * sizeof (int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
-
-  ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_data_add (data_h, data, data_len, NULL);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+/**
+ * @brief Create edge handle - invalid param.
+ */
+TEST(edge, createHandleInvalidParam03_n)
+{
+  nns_edge_h edge_h;
+  int ret;
 
-  ret = nns_edge_data_get_count (data_h, &count);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_HYBRID,
+      NNS_EDGE_NODE_TYPE_UNKNOWN, &edge_h);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
-
-  ret = nns_edge_data_destroy (data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+/**
+ * @brief Start - invalid param.
+ */
+TEST(edge, startInvalidParam01_n)
+{
+  int ret;
 
-  SAFE_FREE (data);
+  ret = nns_edge_start (NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Get count of edge-data - invalid param.
+ * @brief Start - invalid param.
  */
-TEST(edgeData, getCountInvalidParam03_n)
+TEST(edge, startInvalidParam02_n)
 {
-  nns_edge_data_h data_h;
-  void *data;
-  nns_size_t data_len;
+  nns_edge_h edge_h;
   int ret;
 
-  data_len = 10U * sizeof (int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
-
-  ret = nns_edge_data_create (&data_h);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_add (data_h, data, data_len, NULL);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC_DEAD);
 
-  ret = nns_edge_data_get_count (data_h, NULL);
+  ret = nns_edge_start (edge_h);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_destroy (data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC);
 
-  SAFE_FREE (data);
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Set info of edge-data - invalid param.
+ * @brief Release edge handle - invalid param.
  */
-TEST(edgeData, setInfoInvalidParam01_n)
+TEST(edge, releaseHandleInvalidParam01_n)
 {
   int ret;
 
-  ret = nns_edge_data_set_info (NULL, "temp-key", "temp-value");
+  ret = nns_edge_release_handle (NULL);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Set info of edge-data - invalid param.
+ * @brief Release edge handle - invalid param.
  */
-TEST(edgeData, setInfoInvalidParam02_n)
+TEST(edge, releaseHandleInvalidParam02_n)
 {
-  nns_edge_data_h data_h;
+  nns_edge_h edge_h;
   int ret;
 
-  ret = nns_edge_data_create (&data_h);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC_DEAD);
 
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  ret = nns_edge_release_handle (edge_h);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC);
 
-  ret = nns_edge_data_destroy (data_h);
+  ret = nns_edge_release_handle (edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Set info of edge-data - invalid param.
+ * @brief Set event callback - null param to clear event callback.
  */
-TEST(edgeData, setInfoInvalidParam03_n)
+TEST(edge, setEventCbSetNullCallback)
 {
-  nns_edge_data_h data_h;
+  nns_edge_h edge_h;
+  ne_test_data_s *_td;
   int ret;
 
-  ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_data_set_info (data_h, NULL, "temp-value");
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  _td = _get_test_data (false);
+  ASSERT_TRUE (_td != NULL);
 
-  ret = nns_edge_data_destroy (data_h);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-}
 
-/**
- * @brief Set info of edge-data - invalid param.
- */
-TEST(edgeData, setInfoInvalidParam04_n)
-{
-  nns_edge_data_h data_h;
-  int ret;
+  ret = nns_edge_set_event_callback (edge_h, _test_edge_event_cb, _td);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_create (&data_h);
+  /* Set null param to clear event callback. */
+  ret = nns_edge_set_event_callback (edge_h, NULL, NULL);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_set_info (data_h, "temp-key", NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_TRUE (_td->event_cb_released);
 
-  ret = nns_edge_data_destroy (data_h);
+  ret = nns_edge_release_handle (edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  _free_test_data (_td);
 }
 
 /**
- * @brief Get info of edge-data - invalid param.
+ * @brief Set event callback - invalid param.
  */
-TEST(edgeData, getInfoInvalidParam01_n)
+TEST(edge, setEventCbInvalidParam01_n)
 {
-  char *value = NULL;
   int ret;
 
-  ret = nns_edge_data_get_info (NULL, "temp-key", &value);
+  ret = nns_edge_set_event_callback (NULL, _test_edge_event_cb, NULL);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Get info of edge-data - invalid param.
+ * @brief Set event callback - invalid param.
  */
-TEST(edgeData, getInfoInvalidParam02_n)
+TEST(edge, setEventCbInvalidParam02_n)
 {
-  nns_edge_data_h data_h;
-  char *value = NULL;
+  nns_edge_h edge_h;
+  ne_test_data_s *_td;
   int ret;
 
-  ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _td = _get_test_data (false);
+  ASSERT_TRUE (_td != NULL);
 
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC_DEAD);
 
-  ret = nns_edge_data_get_info (data_h, "temp-key", &value);
+  ret = nns_edge_set_event_callback (edge_h, _test_edge_event_cb, _td);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC);
 
-  ret = nns_edge_data_destroy (data_h);
+  ret = nns_edge_release_handle (edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  _free_test_data (_td);
 }
 
 /**
- * @brief Get info of edge-data - invalid param.
+ * @brief Connect - invalid param.
  */
-TEST(edgeData, getInfoInvalidParam03_n)
+TEST(edge, connectInvalidParam01_n)
 {
-  nns_edge_data_h data_h;
-  char *value = NULL;
   int ret;
 
-  ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_data_get_info (data_h, NULL, &value);
+  ret = nns_edge_connect (NULL, "127.0.0.1", 80);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_data_destroy (data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Get info of edge-data - invalid param.
+ * @brief Connect - invalid param.
  */
-TEST(edgeData, getInfoInvalidParam04_n)
+TEST(edge, connectInvalidParam02_n)
 {
-  nns_edge_data_h data_h;
+  nns_edge_h edge_h;
   int ret;
 
-  ret = nns_edge_data_create (&data_h);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  ret = nns_edge_set_event_callback (edge_h, _test_edge_event_cb, NULL);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_get_info (data_h, "temp-key", NULL);
+  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_connect (edge_h, "127.0.0.1", 80);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_destroy (data_h);
+  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_release_handle (edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Get info of edge-data - invalid param.
+ * @brief Connect - invalid param.
  */
-TEST(edgeData, getInfoInvalidParam05_n)
+TEST(edge, connectInvalidParam03_n)
 {
-  nns_edge_data_h data_h;
+  nns_edge_h edge_h;
   int ret;
 
-  ret = nns_edge_data_create (&data_h);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  ret = nns_edge_set_event_callback (edge_h, _test_edge_event_cb, NULL);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_get_info (data_h, "", NULL);
+  ret = nns_edge_connect (edge_h, NULL, 80);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_destroy (data_h);
+  ret = nns_edge_release_handle (edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Serialize meta in edge-data - invalid param.
+ * @brief Connect - invalid param.
  */
-TEST(edgeData, serializeInvalidParam01_n)
+TEST(edge, connectInvalidParam04_n)
 {
-  void *data;
-  nns_size_t data_len;
+  nns_edge_h edge_h;
   int ret;
 
-  ret = nns_edge_data_serialize_meta (NULL, &data, &data_len);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_event_callback (edge_h, _test_edge_event_cb, NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_connect (edge_h, "", 80);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Serialize meta in edge-data - invalid param.
+ * @brief Connect - invalid param.
  */
-TEST(edgeData, serializeInvalidParam02_n)
+TEST(edge, connectInvalidParam05_n)
 {
-  nns_edge_data_h data_h;
-  void *data;
-  nns_size_t data_len;
+  nns_edge_h edge_h;
   int ret;
 
-  ret = nns_edge_data_create (&data_h);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  ret = nns_edge_set_event_callback (edge_h, _test_edge_event_cb, NULL);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
-
-  ret = nns_edge_data_serialize_meta (data_h, &data, &data_len);
+  /* Invalid port number */
+  ret = nns_edge_connect (edge_h, "127.0.0.1", -1);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_connect (edge_h, "127.0.0.1", 0);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_connect (edge_h, "127.0.0.1", 77777);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
-
-  ret = nns_edge_data_destroy (data_h);
+  ret = nns_edge_release_handle (edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Serialize meta in edge-data - invalid param.
+ * @brief Connect - invalid param.
  */
-TEST(edgeData, serializeInvalidParam03_n)
+TEST(edge, connectInvalidParam06_n)
 {
-  nns_edge_data_h data_h;
-  nns_size_t data_len;
+  nns_edge_h edge_h;
   int ret;
 
-  ret = nns_edge_data_create (&data_h);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  ret = nns_edge_set_event_callback (edge_h, _test_edge_event_cb, NULL);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_serialize_meta (data_h, NULL, &data_len);
+  /* not started */
+  ret = nns_edge_connect (edge_h, "127.0.0.1", 80);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_destroy (data_h);
+  ret = nns_edge_release_handle (edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Serialize meta in edge-data - invalid param.
+ * @brief Disconnect - invalid param.
  */
-TEST(edgeData, serializeInvalidParam04_n)
+TEST(edge, disconnectInvalidParam01_n)
 {
-  nns_edge_data_h data_h;
-  void *data;
   int ret;
 
-  ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_disconnect (NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
 
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+/**
+ * @brief Disconnect - invalid param.
+ */
+TEST(edge, disconnectInvalidParam02_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_serialize_meta (data_h, &data, NULL);
+  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_disconnect (edge_h);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_destroy (data_h);
+  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_release_handle (edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Deserialize meta to edge-data - invalid param.
+ * @brief Send - invalid param.
  */
-TEST(edgeData, deserializeInvalidParam01_n)
+TEST(edge, sendInvalidParam01_n)
 {
   nns_edge_data_h data_h;
-  void *data;
-  nns_size_t data_len;
   int ret;
 
   ret = nns_edge_data_create (&data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_data_serialize_meta (data_h, &data, &data_len);
+  ret = nns_edge_data_set_info (data_h, "client_id", "10");
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_deserialize_meta (NULL, data, data_len);
+  ret = nns_edge_send (NULL, data_h);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
   ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  SAFE_FREE (data);
 }
 
 /**
- * @brief Deserialize meta to edge-data - invalid param.
+ * @brief Send - invalid param.
  */
-TEST(edgeData, deserializeInvalidParam02_n)
+TEST(edge, sendInvalidParam02_n)
 {
+  nns_edge_h edge_h;
   nns_edge_data_h data_h;
-  void *data;
-  nns_size_t data_len;
   int ret;
 
-  ret = nns_edge_data_create (&data_h);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  ret = nns_edge_data_create (&data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_serialize_meta (data_h, &data, &data_len);
+  ret = nns_edge_data_set_info (data_h, "client_id", "10");
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC_DEAD);
 
-  ret = nns_edge_data_deserialize_meta (data_h, data, data_len);
+  ret = nns_edge_send (edge_h, data_h);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC);
 
-  ret = nns_edge_data_destroy (data_h);
+  ret = nns_edge_release_handle (edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  SAFE_FREE (data);
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Deserialize meta to edge-data - invalid param.
+ * @brief Send - invalid param.
  */
-TEST(edgeData, deserializeInvalidParam03_n)
+TEST(edge, sendInvalidParam03_n)
 {
-  nns_edge_data_h data_h;
-  void *data;
-  nns_size_t data_len;
+  nns_edge_h edge_h;
   int ret;
 
-  ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_data_serialize_meta (data_h, &data, &data_len);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_deserialize_meta (data_h, NULL, data_len);
+  ret = nns_edge_send (edge_h, NULL);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_destroy (data_h);
+  ret = nns_edge_release_handle (edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
 
-  SAFE_FREE (data);
+/**
+ * @brief The number of released memories, for the test of ownership transfer.
+ */
+static unsigned int _released_mem = 0U;
+
+/**
+ * @brief Destroy callback to count the released memories.
+ */
+static void
+_test_release_mem (void *data)
+{
+  __atomic_fetch_add (&_released_mem, 1U, __ATOMIC_SEQ_CST);
+  nns_edge_free (data);
 }
 
 /**
- * @brief Deserialize meta to edge-data - invalid param.
+ * @brief Send data with ownership transfer, pub-sub on local host.
  */
-TEST(edgeData, deserializeInvalidParam04_n)
+TEST(edge, sendFullTransfer)
 {
+  nns_edge_h pub_h, sub_h;
+  ne_test_data_s *_td_pub, *_td_sub;
   nns_edge_data_h data_h;
-  void *data;
   nns_size_t data_len;
-  int ret;
+  void *data;
+  unsigned int i, n, retry;
+  int ret, port;
+  char *val;
 
-  ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _td_pub = _get_test_data (true);
+  _td_sub = _get_test_data (false);
+  ASSERT_TRUE (_td_pub != NULL && _td_sub != NULL);
+  port = nns_edge_get_available_port ();
+  _released_mem = 0U;
 
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  val = nns_edge_strdup_printf ("%d", port);
+  nns_edge_create_handle ("temp-pub", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_PUB, &pub_h);
+  nns_edge_set_event_callback (pub_h, _test_edge_event_cb, _td_pub);
+  nns_edge_set_info (pub_h, "IP", "127.0.0.1");
+  nns_edge_set_info (pub_h, "PORT", val);
+  nns_edge_set_info (pub_h, "CAPS", "test pub");
+  _td_pub->handle = pub_h;
+  SAFE_FREE (val);
 
-  ret = nns_edge_data_serialize_meta (data_h, &data, &data_len);
+  nns_edge_create_handle ("temp-sub", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_SUB, &sub_h);
+  nns_edge_set_event_callback (sub_h, _test_edge_event_cb, _td_sub);
+  nns_edge_set_info (sub_h, "CAPS", "test sub");
+  _td_sub->handle = sub_h;
+
+  ret = nns_edge_start (pub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_start (sub_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_deserialize_meta (data_h, data, 0);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  usleep (200000);
 
-  ret = nns_edge_data_destroy (data_h);
+  ret = nns_edge_connect (sub_h, "127.0.0.1", port);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  SAFE_FREE (data);
-}
-
-/**
- * @brief Serialize and deserialize the edge-data.
- */
-TEST(edgeDataSerialize, normal)
-{
-  nns_edge_data_h src_h, dest_h;
-  void *data1, *data2, *result, *serialized_data;
-  nns_size_t data_len, result_len, serialized_len;
-  char *result_value;
-  unsigned int i, result_count;
-  int ret;
+  /* Wait for the connection. */
+  retry = 0U;
+  do {
+    usleep (10000);
+    if (nns_edge_is_connected (pub_h) == NNS_EDGE_ERROR_NONE)
+      break;
+  } while (retry++ < 200U);
 
   data_len = 10U * sizeof (unsigned int);
-  data1 = malloc (data_len);
-  ASSERT_TRUE (data1 != NULL);
-
-  for (i = 0; i < 10U; i++)
-    ((unsigned int *) data1)[i] = i;
 
-  data2 = malloc (data_len * 2);
-  ASSERT_TRUE (data2 != NULL);
+  for (n = 0; n < 5U; n++) {
+    data = malloc (data_len);
+    ASSERT_TRUE (data != NULL);
 
-  for (i = 0; i < 20U; i++)
-    ((unsigned int *) data2)[i] = 20 - i;
+    for (i = 0; i < 10U; i++)
+      ((unsigned int *) data)[i] = i;
 
-  ret = nns_edge_data_create (&src_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    ret = nns_edge_data_create (&data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    ret = nns_edge_data_add (data_h, data, data_len, _test_release_mem);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    ret = nns_edge_data_set_info (data_h, "test-key1", "test-value1");
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    ret = nns_edge_data_set_info (data_h, "test-key2", "test-value2");
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_set_info (src_h, "temp-key1", "temp-data-val1");
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_data_set_info (src_h, "temp-key2", "temp-data-val2");
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    /* Edge handle owns the data, do not release it. */
+    ret = nns_edge_send_full (pub_h, data_h, NNS_EDGE_SEND_FLAG_TRANSFER);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    usleep (10000);
+  }
 
-  ret = nns_edge_data_add (src_h, data1, data_len, nns_edge_free);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_data_add (src_h, data2, data_len * 2, nns_edge_free);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  /* Wait for received data (20 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+    if (_td_sub->received >= 5U &&
+        __atomic_load_n (&_released_mem, __ATOMIC_SEQ_CST) >= 5U)
+      break;
+  } while (retry++ < 200U);
 
-  ret = nns_edge_data_serialize (src_h, &serialized_data, &serialized_len);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (_td_sub->received, 5U);
+  EXPECT_EQ (__atomic_load_n (&_released_mem, __ATOMIC_SEQ_CST), 5U);
 
-  ret = nns_edge_data_destroy (src_h);
+  ret = nns_edge_release_handle (sub_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_data_create (&dest_h);
+  ret = nns_edge_release_handle (pub_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_deserialize (dest_h, serialized_data, serialized_len);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _free_test_data (_td_pub);
+  _free_test_data (_td_sub);
+}
 
-  /* Compare data and info */
-  ret = nns_edge_data_get_count (dest_h, &result_count);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (result_count, 2U);
+/**
+ * @brief Size of Nth memory for the test of multiple memories.
+ */
+#define _TEST_MEM_SIZE(n) (((n) == 3U) ? (8U * 1024U * 1024U) : (((n) + 1U) * 64U))
 
-  ret = nns_edge_data_get (dest_h, 0, &result, &result_len);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  for (i = 0; i < 10U; i++)
-    EXPECT_EQ (((unsigned int *) result)[i], i);
+/**
+ * @brief Edge event callback for the test of multiple memories.
+ */
+static int
+_test_edge_multi_mem_cb (nns_edge_event_h event_h, void *user_data)
+{
+  ne_test_data_s *_td = (ne_test_data_s *) user_data;
+  nns_edge_event_e event = NNS_EDGE_EVENT_UNKNOWN;
+  nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len;
+  unsigned int i, count;
+  int ret;
 
-  ret = nns_edge_data_get (dest_h, 1, &result, &result_len);
+  ret = nns_edge_event_get_type (event_h, &event);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  for (i = 0; i < 20U; i++)
-    EXPECT_EQ (((unsigned int *) result)[i], 20 - i);
 
-  ret = nns_edge_data_get_info (dest_h, "temp-key1", &result_value);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (result_value, "temp-data-val1");
-  SAFE_FREE (result_value);
+  if (event != NNS_EDGE_EVENT_NEW_DATA_RECEIVED)
+    return NNS_EDGE_ERROR_NONE;
 
-  ret = nns_edge_data_get_info (dest_h, "temp-key2", &result_value);
+  ret = nns_edge_event_parse_new_data (event_h, &data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (result_value, "temp-data-val2");
-  SAFE_FREE (result_value);
 
-  ret = nns_edge_data_destroy (dest_h);
+  ret = nns_edge_data_get_count (data_h, &count);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (count, 8U);
 
-  SAFE_FREE (serialized_data);
-}
+  for (i = 0; i < count; i++) {
+    ret = nns_edge_data_get (data_h, i, &data, &data_len);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    EXPECT_EQ (data_len, _TEST_MEM_SIZE (i));
+    EXPECT_EQ (((unsigned char *) data)[0], i);
+    EXPECT_EQ (((unsigned char *) data)[data_len - 1], i);
+  }
 
-/**
- * @brief Serialize edge-data - invalid param.
- */
-TEST(edgeDataSerialize, invalidParam01_n)
-{
-  void *data;
-  nns_size_t data_len;
-  int ret;
+  nns_edge_data_destroy (data_h);
+  _td->received++;
 
-  ret = nns_edge_data_serialize (NULL, &data, &data_len);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  return NNS_EDGE_ERROR_NONE;
 }
 
 /**
- * @brief Serialize edge-data - invalid param.
+ * @brief Send data with multiple memories, pub-sub on local host with given header format.
  */
-TEST(edgeData, invalidParam02_n)
+static void
+_test_send_multiple_memories (const char *pub_header, const char *sub_header,
+    const char *pool_size)
 {
+  nns_edge_h pub_h, sub_h;
+  ne_test_data_s *_td_sub;
   nns_edge_data_h data_h;
   void *data;
-  nns_size_t data_len;
-  int ret;
+  unsigned int i, retry;
+  int ret, port;
+  char *val;
 
-  ret = nns_edge_data_create (&data_h);
+  _td_sub = _get_test_data (false);
+  ASSERT_TRUE (_td_sub != NULL);
+  port = nns_edge_get_available_port ();
+
+  val = nns_edge_strdup_printf ("%d", port);
+  nns_edge_create_handle ("temp-pub", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_PUB, &pub_h);
+  nns_edge_set_event_callback (pub_h, _test_edge_multi_mem_cb, NULL);
+  nns_edge_set_info (pub_h, "IP", "127.0.0.1");
+  nns_edge_set_info (pub_h, "PORT", val);
+  SAFE_FREE (val);
+
+  nns_edge_create_handle ("temp-sub", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_SUB, &sub_h);
+  nns_edge_set_event_callback (sub_h, _test_edge_multi_mem_cb, _td_sub);
+
+  if (pub_header) {
+    ret = nns_edge_set_info (pub_h, "DATA_HEADER", pub_header);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+  if (sub_header) {
+    ret = nns_edge_set_info (sub_h, "DATA_HEADER", sub_header);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+  if (pool_size) {
+    ret = nns_edge_set_info (sub_h, "POOL_SIZE", pool_size);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+
+  ret = nns_edge_start (pub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_start (sub_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  usleep (200000);
+
+  ret = nns_edge_connect (sub_h, "127.0.0.1", port);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+  retry = 0U;
+  do {
+    usleep (10000);
+    if (nns_edge_is_connected (pub_h) == NNS_EDGE_ERROR_NONE)
+      break;
+  } while (retry++ < 200U);
 
-  ret = nns_edge_data_serialize (data_h, &data, &data_len);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+  for (i = 0; i < 8U; i++) {
+    data = malloc (_TEST_MEM_SIZE (i));
+    ASSERT_TRUE (data != NULL);
+    memset (data, i, _TEST_MEM_SIZE (i));
+
+    ret = nns_edge_data_add (data_h, data, _TEST_MEM_SIZE (i), nns_edge_free);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+
+  ret = nns_edge_data_set_info (data_h, "test-key", "test-value");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  for (i = 0; i < 3U; i++) {
+    ret = nns_edge_send (pub_h, data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
 
   ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Wait for received data (20 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+    if (_td_sub->received >= 3U)
+      break;
+  } while (retry++ < 200U);
+
+  EXPECT_EQ (_td_sub->received, 3U);
+
+  ret = nns_edge_release_handle (sub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_release_handle (pub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  _free_test_data (_td_sub);
 }
 
 /**
- * @brief Clear raw data in edge-data - invalid param.
+ * @brief Send data with multiple memories, pub-sub on local host.
  */
-TEST(edgeData, clearInvalidParam01_n)
+TEST(edge, sendMultipleMemories)
 {
-  int ret;
-
-  ret = nns_edge_data_clear (NULL);
-  EXPECT_NE (NNS_EDGE_ERROR_NONE, ret);
+  _test_send_multiple_memories (NULL, NULL, NULL);
 }
 
 /**
- * @brief Clear raw data in edge-data - invalid param.
+ * @brief Send data with multiple memories, publisher sends legacy header.
  */
-TEST(edgeData, clearInvalidParam02_n)
+TEST(edge, sendMultipleMemoriesLegacy01)
 {
-  nns_edge_data_h data_h;
-  int ret;
-
-  ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
-
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
-
-  ret = nns_edge_data_clear (data_h);
-  EXPECT_NE (NNS_EDGE_ERROR_NONE, ret);
+  _test_send_multiple_memories ("LEGACY", "AUTO", NULL);
+}
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+/**
+ * @brief Send data with multiple memories, subscriber does not use compact header.
+ */
+TEST(edge, sendMultipleMemoriesLegacy02)
+{
+  _test_send_multiple_memories ("COMPACT", "LEGACY", NULL);
+}
 
-  ret = nns_edge_data_destroy (data_h);
-  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+/**
+ * @brief Send data with multiple memories, subscriber reuses the buffers in the pool.
+ */
+TEST(edge, sendMultipleMemoriesPool)
+{
+  _test_send_multiple_memories (NULL, NULL, "2");
 }
 
 /**
- * @brief Clear raw data in edge-data.
+ * @brief Send data to multiple subscribers in parallel (fan-out).
  */
-TEST(edgeData, clear)
+TEST(edge, sendFanOut)
 {
+  nns_edge_h pub_h, sub_h[3];
+  ne_test_data_s *_td_sub[3];
   nns_edge_data_h data_h;
   void *data;
-  nns_size_t data_len;
-  unsigned int count;
-  int ret;
+  unsigned int i, retry;
+  int ret, port;
+  char *val;
 
-  data_len = 10U * sizeof (int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
+  port = nns_edge_get_available_port ();
 
-  ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+  val = nns_edge_strdup_printf ("%d", port);
+  nns_edge_create_handle ("temp-pub", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_PUB, &pub_h);
+  nns_edge_set_event_callback (pub_h, _test_edge_multi_mem_cb, NULL);
+  nns_edge_set_info (pub_h, "IP", "127.0.0.1");
+  nns_edge_set_info (pub_h, "PORT", val);
+  SAFE_FREE (val);
 
-  ret = nns_edge_data_add (data_h, data, data_len, nns_edge_free);
-  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+  ret = nns_edge_set_info (pub_h, "CONN_QUEUE_SIZE", "4:NEW");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_get_count (data_h, &count);
-  EXPECT_EQ (NNS_EDGE_ERROR_NONE , ret);
-  EXPECT_EQ (1U, count);
+  ret = nns_edge_start (pub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_clear (data_h);
-  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+  usleep (200000);
 
-  ret = nns_edge_data_get_count (data_h, &count);
-  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
-  EXPECT_EQ (0U, count);
+  for (i = 0; i < 3U; i++) {
+    _td_sub[i] = _get_test_data (false);
+    ASSERT_TRUE (_td_sub[i] != NULL);
 
-  ret = nns_edge_data_destroy (data_h);
-  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
-}
+    nns_edge_create_handle ("temp-sub", NNS_EDGE_CONNECT_TYPE_TCP,
+        NNS_EDGE_NODE_TYPE_SUB, &sub_h[i]);
+    nns_edge_set_event_callback (sub_h[i], _test_edge_multi_mem_cb, _td_sub[i]);
 
-/**
- * @brief Serialize edge-data - invalid param.
- */
-TEST(edgeDataSerialize, invalidParam03_n)
-{
-  nns_edge_data_h data_h;
-  nns_size_t data_len;
-  int ret;
+    ret = nns_edge_start (sub_h[i]);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    ret = nns_edge_connect (sub_h[i], "127.0.0.1", port);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+
+  /* Wait for the publisher accepts all connections. */
+  usleep (500000);
 
   ret = nns_edge_data_create (&data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  for (i = 0; i < 8U; i++) {
+    data = malloc (_TEST_MEM_SIZE (i));
+    ASSERT_TRUE (data != NULL);
+    memset (data, i, _TEST_MEM_SIZE (i));
+
+    ret = nns_edge_data_add (data_h, data, _TEST_MEM_SIZE (i), nns_edge_free);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+
+  ret = nns_edge_data_set_info (data_h, "test-key", "test-value");
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_serialize (data_h, NULL, &data_len);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  for (i = 0; i < 3U; i++) {
+    ret = nns_edge_send (pub_h, data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
 
   ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Wait for received data (20 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+    if (_td_sub[0]->received >= 3U && _td_sub[1]->received >= 3U &&
+        _td_sub[2]->received >= 3U)
+      break;
+  } while (retry++ < 200U);
+
+  for (i = 0; i < 3U; i++) {
+    EXPECT_EQ (_td_sub[i]->received, 3U);
+
+    ret = nns_edge_release_handle (sub_h[i]);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    _free_test_data (_td_sub[i]);
+  }
+
+  ret = nns_edge_release_handle (pub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Serialize edge-data - invalid param.
+ * @brief Edge event callback for test, the subscriber keeps the sequence number of received data and consumes data slowly.
  */
-TEST(edgeDataSerialize, invalidParam04_n)
+static int
+_test_edge_slow_event_cb (nns_edge_event_h event_h, void *user_data)
 {
+  ne_test_data_s *_td = (ne_test_data_s *) user_data;
+  nns_edge_event_e event = NNS_EDGE_EVENT_UNKNOWN;
   nns_edge_data_h data_h;
-  void *data;
+  char *val;
   int ret;
 
-  ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  if (!_td)
+    return NNS_EDGE_ERROR_NONE;
 
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  ret = nns_edge_event_get_type (event_h, &event);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_serialize_meta (data_h, &data, NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  if (event == NNS_EDGE_EVENT_NEW_DATA_RECEIVED) {
+    ret = nns_edge_event_parse_new_data (event_h, &data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_destroy (data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-}
+    ret = nns_edge_data_get_info (data_h, "test-seq", &val);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    _td->last_seq = (unsigned int) strtoul (val, NULL, 10);
+    SAFE_FREE (val);
 
-/**
- * @brief Deserialize edge-data - invalid param.
- */
-TEST(edgeDataDeserialize, invalidParam01_n)
-{
-  void *data = NULL;
-  int ret;
+    ret = nns_edge_data_destroy (data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_deserialize (NULL, data, 10U);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+    usleep (50000);
+    _td->received++;
+  }
 
-  SAFE_FREE (data);
+  return NNS_EDGE_ERROR_NONE;
 }
 
 /**
- * @brief Deserialize edge-data - invalid param.
+ * @brief Send data to the subscriber which grants the credits, the publisher does not send data without the credits.
  */
-TEST(edgeDataDeserialize, invalidParam02_n)
+static void
+_test_flow_control (const char *policy)
 {
+  nns_edge_h pub_h, sub_h;
+  ne_test_data_s *_td_sub;
   nns_edge_data_h data_h;
-  void *data;
-  nns_size_t data_len;
-  int ret;
+  unsigned int i, retry;
+  int ret, port;
+  char *val;
 
-  ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _td_sub = _get_test_data (false);
+  ASSERT_TRUE (_td_sub != NULL);
+  port = nns_edge_get_available_port ();
 
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  val = nns_edge_strdup_printf ("%d", port);
+  nns_edge_create_handle ("temp-pub", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_PUB, &pub_h);
+  nns_edge_set_info (pub_h, "IP", "127.0.0.1");
+  nns_edge_set_info (pub_h, "PORT", val);
+  SAFE_FREE (val);
+
+  ret = nns_edge_set_info (pub_h, "FLOW_CONTROL", policy);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_serialize (data_h, &data, &data_len);
+  nns_edge_create_handle ("temp-sub", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_SUB, &sub_h);
+  nns_edge_set_event_callback (sub_h, _test_edge_slow_event_cb, _td_sub);
+  ret = nns_edge_set_info (sub_h, "FLOW_CREDITS", "2");
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _td_sub->handle = sub_h;
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+  ret = nns_edge_start (pub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_start (sub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_deserialize (data_h, data, data_len);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  /* Cannot change the credits after starting the handle. */
+  ret = nns_edge_set_info (sub_h, "FLOW_CREDITS", "4");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+  usleep (200000);
 
-  ret = nns_edge_data_destroy (data_h);
+  ret = nns_edge_connect (sub_h, "127.0.0.1", port);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  SAFE_FREE (data);
-}
+  /* Wait for the connection and the initial credits. */
+  retry = 0U;
+  do {
+    usleep (10000);
+    if (nns_edge_is_connected (pub_h) == NNS_EDGE_ERROR_NONE)
+      break;
+  } while (retry++ < 200U);
+  usleep (100000);
 
-/**
- * @brief Deserialize edge-data - invalid param.
- */
-TEST(edgeDataDeserialize, invalidParam03_n)
-{
-  nns_edge_data_h data_h;
-  void *data;
-  nns_size_t data_len;
-  int ret;
+  for (i = 0; i < 20U; i++) {
+    ret = nns_edge_data_create (&data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    val = nns_edge_strdup_printf ("%u", i);
+    ret = nns_edge_data_set_info (data_h, "test-seq", val);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    SAFE_FREE (val);
 
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+    ret = nns_edge_send_full (pub_h, data_h, NNS_EDGE_SEND_FLAG_TRANSFER);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+
+  /* The subscriber consumes the data with the credits, wait for the data sent later (2 seconds). */
+  usleep (500000);
+  retry = 0U;
+  do {
+    usleep (100000);
+  } while (_td_sub->received < 3U && retry++ < 15U);
+
+  EXPECT_GE (_td_sub->received, 2U);
+  EXPECT_LT (_td_sub->received, 20U);
+
+  /* The publisher sends the latest data when the subscriber grants new credits. */
+  if (strcasecmp (policy, "COALESCE") == 0)
+    EXPECT_EQ (_td_sub->last_seq, 19U);
+
+  ret = nns_edge_get_info (pub_h, "STATISTICS", &val);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_TRUE (val && strstr (val, "credit_dropped=0") == NULL);
+  SAFE_FREE (val);
 
-  ret = nns_edge_data_serialize (data_h, &data, &data_len);
+  ret = nns_edge_release_handle (sub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_release_handle (pub_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_deserialize (data_h, NULL, data_len);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  _free_test_data (_td_sub);
+}
 
-  ret = nns_edge_data_destroy (data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+/**
+ * @brief Send data with flow control, drop new data without the credits.
+ */
+TEST(edge, sendFlowControlDrop)
+{
+  _test_flow_control ("DROP");
+}
 
-  SAFE_FREE (data);
+/**
+ * @brief Send data with flow control, send the latest data when the credits are granted.
+ */
+TEST(edge, sendFlowControlCoalesce)
+{
+  _test_flow_control ("COALESCE");
 }
 
 /**
- * @brief Deserialize edge-data - invalid param.
+ * @brief Send data with flow control and the queue of the connection. The data dropped in the queue does not consume the credits.
  */
-TEST(edgeDataDeserialize, invalidParam04_n)
+static void
+_test_flow_control_queue (const char *key, const char *value)
 {
+  nns_edge_h pub_h, sub_h;
+  ne_test_data_s *_td_sub;
   nns_edge_data_h data_h;
-  void *data;
   nns_size_t data_len;
-  int ret;
+  void *data;
+  unsigned int i, retry;
+  int ret, port;
+  char *val;
 
-  ret = nns_edge_data_create (&data_h);
+  _td_sub = _get_test_data (false);
+  ASSERT_TRUE (_td_sub != NULL);
+  port = nns_edge_get_available_port ();
+
+  val = nns_edge_strdup_printf ("%d", port);
+  nns_edge_create_handle ("temp-pub", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_PUB, &pub_h);
+  nns_edge_set_info (pub_h, "IP", "127.0.0.1");
+  nns_edge_set_info (pub_h, "PORT", val);
+  SAFE_FREE (val);
+
+  ret = nns_edge_set_info (pub_h, key, value);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  nns_edge_create_handle ("temp-sub", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_SUB, &sub_h);
+  nns_edge_set_event_callback (sub_h, _test_edge_slow_event_cb, _td_sub);
+  ret = nns_edge_set_info (sub_h, "FLOW_CREDITS", "8");
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _td_sub->handle = sub_h;
 
-  ret = nns_edge_data_serialize (data_h, &data, &data_len);
+  ret = nns_edge_start (pub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_start (sub_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_deserialize (data_h, data, 1U);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  usleep (200000);
 
-  ret = nns_edge_data_destroy (data_h);
+  ret = nns_edge_connect (sub_h, "127.0.0.1", port);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  SAFE_FREE (data);
+  /* Wait for the connection and the initial credits. */
+  retry = 0U;
+  do {
+    usleep (10000);
+    if (nns_edge_is_connected (pub_h) == NNS_EDGE_ERROR_NONE)
+      break;
+  } while (retry++ < 200U);
+  usleep (100000);
+
+  /* Send large data at once, the queue of the connection drops most of the data with the credits. */
+  data_len = 4U * 1024U * 1024U;
+  for (i = 0; i < 20U; i++) {
+    ret = nns_edge_data_create (&data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+    data = calloc (1, data_len);
+    ASSERT_TRUE (data != NULL);
+    ret = nns_edge_data_add (data_h, data, data_len, nns_edge_free);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+    val = nns_edge_strdup_printf ("%u", i);
+    ret = nns_edge_data_set_info (data_h, "test-seq", val);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    SAFE_FREE (val);
+
+    ret = nns_edge_send_full (pub_h, data_h, NNS_EDGE_SEND_FLAG_TRANSFER);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+
+  usleep (1000000);
+
+  /* The publisher keeps the credits, the subscriber receives new data sent slowly. */
+  for (i = 20U; i < 30U; i++) {
+    ret = nns_edge_data_create (&data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+    val = nns_edge_strdup_printf ("%u", i);
+    ret = nns_edge_data_set_info (data_h, "test-seq", val);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    SAFE_FREE (val);
+
+    ret = nns_edge_send_full (pub_h, data_h, NNS_EDGE_SEND_FLAG_TRANSFER);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    usleep (100000);
+  }
+
+  /* Wait for the last data (5 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+  } while (_td_sub->last_seq < 29U && retry++ < 50U);
+
+  EXPECT_EQ (_td_sub->last_seq, 29U);
+
+  ret = nns_edge_release_handle (sub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_release_handle (pub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  _free_test_data (_td_sub);
 }
 
 /**
- * @brief Util to check serialized data - invalid param.
+ * @brief Send data with flow control in conflation mode, the publisher keeps the latest data in the queue.
  */
-TEST(edgeDataIsSerialized, invalidParam01_n)
+TEST(edge, sendFlowControlConflate)
 {
-  int ret;
-
-  ret = nns_edge_data_is_serialized (NULL, 1U);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  _test_flow_control_queue ("CONFLATE", "TRUE");
 }
 
 /**
- * @brief Util to check serialized data - invalid param.
+ * @brief Send data with flow control and the leaky queue of the connection.
  */
-TEST(edgeDataIsSerialized, invalidParam02_n)
+TEST(edge, sendFlowControlConnQueue)
 {
-  void *data;
-  int ret;
-
-  data = nns_edge_malloc (100U);
-  ASSERT_TRUE (data != NULL);
-  memset (data, 0, 100U);
-
-  /* invalid data key */
-  ret = nns_edge_data_is_serialized (data, 100U);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-
-  SAFE_FREE (data);
+  _test_flow_control_queue ("CONN_QUEUE_SIZE", "1:NEW");
 }
 
 /**
- * @brief Util to check serialized data - invalid param.
+ * @brief Send data in conflation mode, the subscriber receives the latest data.
  */
-TEST(edgeDataIsSerialized, invalidParam03_n)
+static void
+_test_conflate (bool pub_conflate)
 {
+  nns_edge_h pub_h, sub_h;
+  ne_test_data_s *_td_sub;
   nns_edge_data_h data_h;
-  void *data;
-  nns_size_t data_len;
-  int ret;
+  unsigned int i, retry;
+  int ret, port;
+  char *val;
 
-  ret = nns_edge_data_create (&data_h);
+  _td_sub = _get_test_data (false);
+  ASSERT_TRUE (_td_sub != NULL);
+  port = nns_edge_get_available_port ();
+
+  val = nns_edge_strdup_printf ("%d", port);
+  nns_edge_create_handle ("temp-pub", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_PUB, &pub_h);
+  nns_edge_set_info (pub_h, "IP", "127.0.0.1");
+  nns_edge_set_info (pub_h, "PORT", val);
+  SAFE_FREE (val);
+
+  ret = nns_edge_set_info (pub_h, "CONFLATE", pub_conflate ? "TRUE" : "FALSE");
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  nns_edge_create_handle ("temp-sub", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_SUB, &sub_h);
+  nns_edge_set_event_callback (sub_h, _test_edge_slow_event_cb, _td_sub);
+  ret = nns_edge_set_info (sub_h, "CONFLATE", "TRUE");
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _td_sub->handle = sub_h;
 
-  ret = nns_edge_data_serialize (data_h, &data, &data_len);
+  ret = nns_edge_start (pub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_start (sub_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  /* invalid data size */
-  ret = nns_edge_data_is_serialized (data, 1U);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  /* Cannot change the conflation mode after starting the handle. */
+  ret = nns_edge_set_info (sub_h, "CONFLATE", "FALSE");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
 
-  ret = nns_edge_data_destroy (data_h);
+  usleep (200000);
+
+  ret = nns_edge_connect (sub_h, "127.0.0.1", port);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  SAFE_FREE (data);
+  /* Wait for the connection. */
+  retry = 0U;
+  do {
+    usleep (10000);
+    if (nns_edge_is_connected (pub_h) == NNS_EDGE_ERROR_NONE)
+      break;
+  } while (retry++ < 200U);
+  usleep (100000);
+
+  for (i = 0; i < 20U; i++) {
+    ret = nns_edge_data_create (&data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+    val = nns_edge_strdup_printf ("%u", i);
+    ret = nns_edge_data_set_info (data_h, "test-seq", val);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    SAFE_FREE (val);
+
+    ret = nns_edge_send_full (pub_h, data_h, NNS_EDGE_SEND_FLAG_TRANSFER);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+
+  /* Wait for the latest data (5 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+  } while (_td_sub->last_seq < 19U && retry++ < 50U);
+  usleep (100000);
+
+  /* The old data is replaced in the queue of the publisher or skipped by the subscriber. */
+  EXPECT_EQ (_td_sub->last_seq, 19U);
+  EXPECT_LT (_td_sub->received, 20U);
+
+  if (!pub_conflate) {
+    ret = nns_edge_get_info (sub_h, "STATISTICS", &val);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    EXPECT_TRUE (val && strstr (val, "conflated=0") == NULL);
+    SAFE_FREE (val);
+  }
+
+  ret = nns_edge_release_handle (sub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_release_handle (pub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  _free_test_data (_td_sub);
 }
 
 /**
- * @brief Create edge event - invalid param.
+ * @brief Send data in conflation mode, the publisher and subscriber keep the latest data.
  */
-TEST(edgeEvent, createInvalidParam01_n)
+TEST(edge, sendConflate)
 {
-  nns_edge_event_h event_h;
-  int ret;
-
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_UNKNOWN, &event_h);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  _test_conflate (true);
 }
 
 /**
- * @brief Create edge event - invalid param.
+ * @brief Send data in conflation mode, the subscriber skips the old data.
  */
-TEST(edgeEvent, createInvalidParam02_n)
+TEST(edge, sendConflateReceiver)
 {
-  int ret;
-
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  _test_conflate (false);
 }
 
 /**
- * @brief Destroy edge event - invalid param.
+ * @brief Check the memory of test data, the byte at offset k of i-th memory is (k + i).
  */
-TEST(edgeEvent, destroyInvalidParam01_n)
+static bool
+_test_chunk_check_mem (void *data, nns_size_t len, nns_size_t offset, unsigned int index)
 {
-  int ret;
+  unsigned char *mem = (unsigned char *) data;
+  nns_size_t k;
 
-  ret = nns_edge_event_destroy (NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  for (k = 0; k < len; k++) {
+    if (mem[k] != (unsigned char) (offset + k + index))
+      return false;
+  }
+
+  return true;
 }
 
 /**
- * @brief Destroy edge event - invalid param.
+ * @brief Edge event callback for test, check the large data sent in chunks.
  */
-TEST(edgeEvent, destroyInvalidParam02_n)
+static int
+_test_edge_chunk_event_cb (nns_edge_event_h event_h, void *user_data)
 {
-  nns_edge_event_h event_h;
+  ne_test_data_s *_td = (ne_test_data_s *) user_data;
+  nns_edge_event_e event = NNS_EDGE_EVENT_UNKNOWN;
+  nns_edge_data_h data_h;
+  nns_size_t data_len, offset;
+  unsigned int i, count, index;
   void *data;
-  nns_size_t data_len;
+  char *val;
   int ret;
 
-  data_len = 10U * sizeof (int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
+  if (!_td)
+    return NNS_EDGE_ERROR_NONE;
 
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_event_set_data (event_h, data, data_len, nns_edge_free);
+  ret = nns_edge_event_get_type (event_h, &event);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC_DEAD);
-
-  ret = nns_edge_event_destroy (event_h);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  if (event != NNS_EDGE_EVENT_NEW_DATA_RECEIVED &&
+      event != NNS_EDGE_EVENT_NEW_CHUNK_RECEIVED)
+    return NNS_EDGE_ERROR_NONE;
 
-  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC);
+  ret = nns_edge_event_parse_new_data (event_h, &data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_destroy (event_h);
+  ret = nns_edge_data_get_count (data_h, &count);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-}
 
-/**
- * @brief Set edge event data - invalid param.
- */
-TEST(edgeEvent, setDataInvalidParam01_n)
-{
-  void *data;
-  nns_size_t data_len;
-  int ret;
+  if (event == NNS_EDGE_EVENT_NEW_DATA_RECEIVED) {
+    ret = nns_edge_data_get_info (data_h, "test-key", &val);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    EXPECT_STREQ (val, "test-value");
+    SAFE_FREE (val);
 
-  data_len = 10U * sizeof (int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
+    for (i = 0; i < count; i++) {
+      ret = nns_edge_data_get (data_h, i, &data, &data_len);
+      EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+      EXPECT_TRUE (_test_chunk_check_mem (data, data_len, 0, i));
+    }
 
-  ret = nns_edge_event_set_data (NULL, data, data_len, NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+    _td->received++;
+  } else {
+    EXPECT_EQ (count, 1U);
 
-  SAFE_FREE (data);
-}
+    ret = nns_edge_data_get_info (data_h, "mem_index", &val);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    index = (unsigned int) strtoul (val, NULL, 10);
+    SAFE_FREE (val);
 
-/**
- * @brief Set edge event data - invalid param.
- */
-TEST(edgeEvent, setDataInvalidParam02_n)
-{
-  nns_edge_event_h event_h;
-  void *data;
-  nns_size_t data_len;
-  int ret;
+    ret = nns_edge_data_get_info (data_h, "chunk_offset", &val);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    offset = (nns_size_t) strtoull (val, NULL, 10);
+    SAFE_FREE (val);
 
-  data_len = 10U * sizeof (int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
+    /* The first chunk has the information of edge data. */
+    if (index == 0U && offset == 0U) {
+      ret = nns_edge_data_get_info (data_h, "test-key", &val);
+      EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+      EXPECT_STREQ (val, "test-value");
+      SAFE_FREE (val);
+    }
 
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    ret = nns_edge_data_get (data_h, 0, &data, &data_len);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    EXPECT_LE (data_len, 4096U);
+    EXPECT_TRUE (_test_chunk_check_mem (data, data_len, offset, index));
 
-  ret = nns_edge_event_set_data (event_h, NULL, data_len, NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+    ret = nns_edge_data_get_info (data_h, "chunk_last", &val);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    if (val && strcmp (val, "TRUE") == 0)
+      _td->received++;
+    SAFE_FREE (val);
 
-  ret = nns_edge_event_destroy (event_h);
+    _td->chunks++;
+  }
+
+  ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  SAFE_FREE (data);
+  return NNS_EDGE_ERROR_NONE;
 }
 
 /**
- * @brief Set edge event data - invalid param.
+ * @brief Create test data with the memories of given sizes.
  */
-TEST(edgeEvent, setDataInvalidParam03_n)
+static nns_edge_data_h
+_test_chunk_create_data (const nns_size_t *sizes, unsigned int num)
 {
-  nns_edge_event_h event_h;
-  void *data;
-  nns_size_t data_len;
-  int ret;
-
-  data_len = 10U * sizeof (int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
+  nns_edge_data_h data_h;
+  unsigned char *mem;
+  nns_size_t k;
+  unsigned int i;
 
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_data_create (&data_h);
+  nns_edge_data_set_info (data_h, "test-key", "test-value");
 
-  ret = nns_edge_event_set_data (event_h, data, 0, NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  for (i = 0; i < num; i++) {
+    mem = (unsigned char *) malloc (sizes[i]);
+    for (k = 0; k < sizes[i]; k++)
+      mem[k] = (unsigned char) (k + i);
 
-  ret = nns_edge_event_destroy (event_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    nns_edge_data_add (data_h, mem, sizes[i], nns_edge_free);
+  }
 
-  SAFE_FREE (data);
+  return data_h;
 }
 
 /**
- * @brief Set edge event data - invalid param.
+ * @brief Send the large data in chunks, with the small data between the large data.
  */
-TEST(edgeEvent, setDataInvalidParam04_n)
+static void
+_test_send_chunk (bool chunk_event)
 {
-  nns_edge_event_h event_h;
-  void *data;
-  nns_size_t data_len;
-  int ret;
+  nns_edge_h pub_h, sub_h;
+  ne_test_data_s *_td_sub;
+  nns_edge_data_h data_h;
+  const nns_size_t large[2] = { 65636U, 3000U };
+  const nns_size_t small[1] = { 100U };
+  unsigned int i, retry;
+  int ret, port;
+  char *val;
 
-  data_len = 10U * sizeof (int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
+  _td_sub = _get_test_data (false);
+  ASSERT_TRUE (_td_sub != NULL);
+  port = nns_edge_get_available_port ();
 
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
+  val = nns_edge_strdup_printf ("%d", port);
+  nns_edge_create_handle ("temp-pub", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_PUB, &pub_h);
+  nns_edge_set_info (pub_h, "IP", "127.0.0.1");
+  nns_edge_set_info (pub_h, "PORT", val);
+  SAFE_FREE (val);
+
+  ret = nns_edge_set_info (pub_h, "CHUNK_SIZE", "4096");
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC_DEAD);
+  nns_edge_create_handle ("temp-sub", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_SUB, &sub_h);
+  nns_edge_set_event_callback (sub_h, _test_edge_chunk_event_cb, _td_sub);
+  ret = nns_edge_set_info (sub_h, "CHUNK_EVENT", chunk_event ? "TRUE" : "FALSE");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _td_sub->handle = sub_h;
 
-  ret = nns_edge_event_set_data (event_h, data, data_len, NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_start (pub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_start (sub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC);
+  /* Cannot change the chunk size after starting the handle. */
+  ret = nns_edge_set_info (pub_h, "CHUNK_SIZE", "8192");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
 
-  ret = nns_edge_event_destroy (event_h);
+  usleep (200000);
+
+  ret = nns_edge_connect (sub_h, "127.0.0.1", port);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  SAFE_FREE (data);
-}
+  /* Wait for the connection. */
+  retry = 0U;
+  do {
+    usleep (10000);
+    if (nns_edge_is_connected (pub_h) == NNS_EDGE_ERROR_NONE)
+      break;
+  } while (retry++ < 200U);
+  usleep (100000);
 
-/**
- * @brief Get edge event data.
- */
-TEST(edgeEvent, getData)
-{
-  nns_edge_event_h event_h;
-  void *input = NULL, *output = NULL;
-  nns_size_t input_len = 0U, output_len = 0U;
-  int ret;
+  for (i = 0; i < 5U; i++) {
+    data_h = _test_chunk_create_data (large, 2U);
+    ret = nns_edge_send_full (pub_h, data_h, NNS_EDGE_SEND_FLAG_TRANSFER);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  input_len = 10U * sizeof (int);
-  input = malloc (input_len);
-  ASSERT_TRUE (input != NULL);
+    data_h = _test_chunk_create_data (small, 1U);
+    ret = nns_edge_send_full (pub_h, data_h, NNS_EDGE_SEND_FLAG_TRANSFER);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
 
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  /* Wait for all data (5 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+  } while (_td_sub->received < 10U && retry++ < 50U);
+  usleep (100000);
 
-  ret = nns_edge_event_set_data (event_h, input, input_len, NULL);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (_td_sub->received, 10U);
 
-  ret = nns_edge_event_get_data (event_h, &output, &output_len);
+  /* The large data has 17 chunks of 1st memory and 1 chunk of 2nd memory. */
+  EXPECT_EQ (_td_sub->chunks, chunk_event ? 90U : 0U);
+
+  ret = nns_edge_get_info (sub_h, "STATISTICS", &val);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_TRUE (input == output);
-  EXPECT_TRUE (input_len == output_len);
+  EXPECT_TRUE (val &&
+      strstr (val, "frames_received=10,bytes_received=343680,") != NULL);
+  SAFE_FREE (val);
 
-  ret = nns_edge_event_destroy (event_h);
+  ret = nns_edge_release_handle (sub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_release_handle (pub_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  SAFE_FREE (input);
+  _free_test_data (_td_sub);
 }
 
 /**
- * @brief Get edge event data - invalid param.
+ * @brief Send the large data in chunks, the subscriber receives the complete data.
  */
-TEST(edgeEvent, getDataInvalidParam01_n)
+TEST(edge, sendChunk)
 {
-  void *data;
-  nns_size_t data_len;
-  int ret;
-
-  ret = nns_edge_event_get_data (NULL, &data, &data_len);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  _test_send_chunk (false);
 }
 
 /**
- * @brief Get edge event data - invalid param.
+ * @brief Send the large data in chunks, the subscriber receives the event for each chunk.
  */
-TEST(edgeEvent, getDataInvalidParam02_n)
+TEST(edge, sendChunkEvent)
 {
-  nns_edge_event_h event_h;
-  nns_size_t data_len;
-  int ret;
-
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_event_get_data (event_h, NULL, &data_len);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_event_destroy (event_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _test_send_chunk (true);
 }
 
 /**
- * @brief Get edge event data - invalid param.
+ * @brief Send with flags - invalid param.
  */
-TEST(edgeEvent, getDataInvalidParam03_n)
+TEST(edge, sendFullInvalidParam01_n)
 {
-  nns_edge_event_h event_h;
-  void *data;
+  nns_edge_h edge_h;
+  nns_edge_data_h data_h;
   int ret;
 
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_get_data (event_h, &data, NULL);
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Invalid flags */
+  ret = nns_edge_send_full (edge_h, data_h, 0xff00U);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_destroy (event_h);
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Get edge event data - invalid param.
+ * @brief Send with flags - no connection, caller still owns the data.
  */
-TEST(edgeEvent, getDataInvalidParam04_n)
+TEST(edge, sendFullInvalidParam02_n)
 {
-  nns_edge_event_h event_h;
-  void *data;
-  nns_size_t data_len;
+  nns_edge_h edge_h;
+  nns_edge_data_h data_h;
   int ret;
 
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC_DEAD);
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_get_data (event_h, &data, &data_len);
+  ret = nns_edge_send_full (edge_h, data_h, NNS_EDGE_SEND_FLAG_TRANSFER);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC);
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_destroy (event_h);
+  ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Get edge event type.
+ * @brief Allocate the buffer, the edge handle without custom connection uses nns_edge_malloc().
  */
-TEST(edgeEvent, getType)
+TEST(edge, allocBuffer)
 {
-  nns_edge_event_h event_h;
-  nns_edge_event_e event = NNS_EDGE_EVENT_UNKNOWN;
+  nns_edge_h edge_h;
+  nns_edge_data_h data_h;
+  nns_edge_data_destroy_cb destroy_cb = NULL;
+  void *buffer = NULL;
   int ret;
 
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_get_type (event_h, &event);
+  ret = nns_edge_alloc_buffer (edge_h, 100U, &buffer, &destroy_cb);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (event, NNS_EDGE_EVENT_CUSTOM);
+  EXPECT_TRUE (buffer != NULL);
+  EXPECT_TRUE (destroy_cb == nns_edge_free);
 
-  ret = nns_edge_event_destroy (event_h);
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_add (data_h, buffer, 100U, destroy_cb);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_release_handle (edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Get edge event type - invalid param.
+ * @brief Allocate the buffer - invalid param.
  */
-TEST(edgeEvent, getTypeInvalidParam01_n)
+TEST(edge, allocBufferInvalidParam01_n)
 {
-  nns_edge_event_e event;
+  nns_edge_h edge_h;
+  nns_edge_data_destroy_cb destroy_cb = NULL;
+  void *buffer = NULL;
   int ret;
 
-  ret = nns_edge_event_get_type (NULL, &event);
+  ret = nns_edge_alloc_buffer (NULL, 100U, &buffer, &destroy_cb);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_alloc_buffer (edge_h, 0U, &buffer, &destroy_cb);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_alloc_buffer (edge_h, 100U, NULL, &destroy_cb);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_alloc_buffer (edge_h, 100U, &buffer, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Get edge event type - invalid param.
+ * @brief Send the request - invalid param.
  */
-TEST(edgeEvent, getTypeInvalidParam02_n)
+TEST(edge, sendRequestInvalidParam01_n)
 {
-  nns_edge_event_h event_h;
+  nns_edge_data_h data_h;
   int ret;
 
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
+  ret = nns_edge_data_create (&data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_get_type (event_h, NULL);
+  ret = nns_edge_send_request (NULL, data_h, NULL);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_destroy (event_h);
+  ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Get edge event type - invalid param.
+ * @brief Send the request - invalid param.
  */
-TEST(edgeEvent, getTypeInvalidParam03_n)
+TEST(edge, sendRequestInvalidParam02_n)
 {
-  nns_edge_event_h event_h;
-  nns_edge_event_e event;
+  nns_edge_h edge_h;
   int ret;
 
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC_DEAD);
-
-  ret = nns_edge_event_get_type (event_h, &event);
+  ret = nns_edge_send_request (edge_h, NULL, NULL);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC);
-
-  ret = nns_edge_event_destroy (event_h);
+  ret = nns_edge_release_handle (edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Parse new data of edge event.
+ * @brief Send the request - invalid node type and no connection.
  */
-TEST(edgeEvent, parseNewData)
+TEST(edge, sendRequestInvalidParam03_n)
 {
-  nns_edge_event_h event_h;
-  nns_edge_data_h data_h, result_h;
-  void *data, *result;
-  nns_size_t data_len, result_len;
-  char *result_value;
-  unsigned int i, count;
+  nns_edge_h edge_h;
+  nns_edge_data_h data_h;
+  char *val = NULL;
   int ret;
 
-  data_len = 10U * sizeof (unsigned int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
-
-  for (i = 0; i < 10U; i++)
-    ((unsigned int *) data)[i] = i;
-
   ret = nns_edge_data_create (&data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_add (data_h, data, data_len, nns_edge_free);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_data_set_info (data_h, "temp-key1", "temp-data-val1");
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_data_set_info (data_h, "temp-key2", "temp-data-val2");
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_NEW_DATA_RECEIVED, &event_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_send_request (edge_h, data_h, NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NOT_SUPPORTED);
 
-  ret = nns_edge_event_set_data (event_h, data_h, sizeof (nns_edge_data_h), NULL);
+  ret = nns_edge_release_handle (edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_parse_new_data (event_h, &result_h);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  /* Compare data and info */
-  ret = nns_edge_data_get_count (result_h, &count);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (count, 1U);
+  /* Not started */
+  ret = nns_edge_send_request (edge_h, data_h, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_get (result_h, 0, &result, &result_len);
+  ret = nns_edge_start (edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  for (i = 0; i < 10U; i++)
-    EXPECT_EQ (((unsigned int *) result)[i], i);
 
-  ret = nns_edge_data_get_info (result_h, "temp-key1", &result_value);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (result_value, "temp-data-val1");
-  SAFE_FREE (result_value);
+  /* No connection, the request is removed from the window. */
+  ret = nns_edge_send_request (edge_h, data_h, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_get_info (result_h, "temp-key2", &result_value);
+  ret = nns_edge_get_info (edge_h, "REQUEST_COUNT", &val);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (result_value, "temp-data-val2");
-  SAFE_FREE (result_value);
+  EXPECT_STREQ (val, "0");
+  SAFE_FREE (val);
 
-  ret = nns_edge_event_destroy (event_h);
+  ret = nns_edge_release_handle (edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
   ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_data_destroy (result_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Parse new data of edge event - invalid param.
+ * @brief Set info - invalid param.
  */
-TEST(edgeEvent, parseNewDataInvalidParam01_n)
+TEST(edge, setInfoInvalidParam01_n)
 {
-  nns_edge_data_h data_h;
   int ret;
 
-  ret = nns_edge_event_parse_new_data (NULL, &data_h);
+  ret = nns_edge_set_info (NULL, "caps", "temp-caps");
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Parse new data of edge event - invalid param.
+ * @brief Set info - invalid param.
  */
-TEST(edgeEvent, parseNewDataInvalidParam02_n)
+TEST(edge, setInfoInvalidParam02_n)
 {
-  nns_edge_event_h event_h;
+  nns_edge_h edge_h;
   int ret;
 
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_NEW_DATA_RECEIVED, &event_h);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_parse_new_data (event_h, NULL);
+  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_set_info (edge_h, "caps", "temp-caps");
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_destroy (event_h);
+  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_release_handle (edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Parse new data of edge event - invalid param.
+ * @brief Set info - invalid param.
  */
-TEST(edgeEvent, parseNewDataInvalidParam03_n)
+TEST(edge, setInfoInvalidParam03_n)
 {
-  nns_edge_event_h event_h;
-  nns_edge_data_h data_h;
+  nns_edge_h edge_h;
   int ret;
 
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_NEW_DATA_RECEIVED, &event_h);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC_DEAD);
-
-  ret = nns_edge_event_parse_new_data (event_h, &data_h);
+  ret = nns_edge_set_info (edge_h, NULL, "temp-caps");
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC);
-
-  ret = nns_edge_event_destroy (event_h);
+  ret = nns_edge_release_handle (edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Parse new data of edge event - invalid param.
+ * @brief Set info - invalid param.
  */
-TEST(edgeEvent, parseNewDataInvalidParam04_n)
+TEST(edge, setInfoInvalidParam04_n)
 {
-  nns_edge_event_h event_h;
-  nns_edge_data_h data_h;
+  nns_edge_h edge_h;
   int ret;
 
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_parse_new_data (event_h, &data_h);
+  ret = nns_edge_set_info (edge_h, "", "temp-caps");
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_destroy (event_h);
+  ret = nns_edge_release_handle (edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Parse capability of edge event.
+ * @brief Set info - invalid param.
  */
-TEST(edgeEvent, parseCapability)
+TEST(edge, setInfoInvalidParam05_n)
 {
-  const char capability[] = "temp-capability";
-  nns_edge_event_h event_h;
-  char *caps = NULL;
+  nns_edge_h edge_h;
   int ret;
 
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_CAPABILITY, &event_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_event_set_data (event_h, (void *) capability, strlen (capability), NULL);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_parse_capability (event_h, &caps);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (caps, capability);
-  SAFE_FREE (caps);
+  ret = nns_edge_set_info (edge_h, "caps", NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_destroy (event_h);
+  ret = nns_edge_release_handle (edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Parse capability of edge event - invalid param.
+ * @brief Set info - invalid param.
  */
-TEST(edgeEvent, parseCapabilityInvalidParam01_n)
+TEST(edge, setInfoInvalidParam06_n)
 {
-  char *caps = NULL;
+  nns_edge_h edge_h;
   int ret;
 
-  ret = nns_edge_event_parse_capability (NULL, &caps);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_info (edge_h, "caps", "");
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Parse capability of edge event - invalid param.
+ * @brief Set info - invalid param.
  */
-TEST(edgeEvent, parseCapabilityInvalidParam02_n)
+TEST(edge, setInfoInvalidParam07_n)
 {
-  nns_edge_event_h event_h;
+  nns_edge_h edge_h;
   int ret;
 
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_CAPABILITY, &event_h);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_parse_capability (event_h, NULL);
+  /* Not allowed key */
+  ret = nns_edge_set_info (edge_h, "id", "temp-id2");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "client_id", "temp-cid");
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_destroy (event_h);
+  ret = nns_edge_release_handle (edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Parse capability of edge event - invalid param.
+ * @brief Set info - invalid param.
  */
-TEST(edgeEvent, parseCapabilityInvalidParam03_n)
+TEST(edge, setInfoInvalidParam08_n)
 {
-  nns_edge_event_h event_h;
-  char *caps = NULL;
+  nns_edge_h edge_h;
   int ret;
 
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_CAPABILITY, &event_h);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC_DEAD);
-
-  ret = nns_edge_event_parse_capability (event_h, &caps);
+  /* Invalid port number */
+  ret = nns_edge_set_info (edge_h, "port", "-1");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "port", "77777");
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC);
-
-  ret = nns_edge_event_destroy (event_h);
+  ret = nns_edge_release_handle (edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Parse capability of edge event - invalid param.
+ * @brief Set info - invalid param.
  */
-TEST(edgeEvent, parseCapabilityInvalidParam04_n)
+TEST(edge, setInfoInvalidParam09_n)
 {
-  nns_edge_event_h event_h;
-  char *caps = NULL;
+  nns_edge_h edge_h;
   int ret;
 
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_parse_capability (event_h, &caps);
+  /* Invalid option */
+  ret = nns_edge_set_info (edge_h, "QUEUE_SIZE", "15:INVALID_LEAKY");
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_destroy (event_h);
+  /* Invalid size */
+  ret = nns_edge_set_info (edge_h, "QUEUE_SIZE", "invalid");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "QUEUE_SIZE", ":OLD");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "QUEUE_SIZE", "-1");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "QUEUE_SIZE", "65537");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Create edge metadata - invalid param.
+ * @brief Set info - the preallocated queue cannot be enlarged after starting the edge handle.
  */
-TEST(edgeMeta, createInvalidParam01_n)
+TEST(edge, setInfoQueueSizeStarted_n)
 {
+  nns_edge_h edge_h;
+  char *val;
   int ret;
 
-  ret = nns_edge_metadata_create (NULL);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  val = nns_edge_strdup_printf ("%d", nns_edge_get_available_port ());
+  nns_edge_set_info (edge_h, "IP", "127.0.0.1");
+  nns_edge_set_info (edge_h, "PORT", val);
+  SAFE_FREE (val);
+
+  ret = nns_edge_set_info (edge_h, "QUEUE_SIZE", "4:OLD");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_start (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_info (edge_h, "QUEUE_SIZE", "8");
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "QUEUE_SIZE", "0");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  /* The size within the preallocated queue is allowed. */
+  ret = nns_edge_set_info (edge_h, "QUEUE_SIZE", "2:NEW");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Destroy edge metadata - invalid param.
+ * @brief Set info - invalid param.
  */
-TEST(edgeMeta, destroyInvalidParam01_n)
+TEST(edge, setInfoInvalidParam10_n)
 {
+  nns_edge_h edge_h;
   int ret;
 
-  ret = nns_edge_metadata_destroy (NULL);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Invalid I/O mode */
+  ret = nns_edge_set_info (edge_h, "IO_MODE", "INVALID_MODE");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Invalid number of workers */
+  ret = nns_edge_set_info (edge_h, "IO_MODE", "REACTOR:0");
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Set edge metadata - invalid param.
+ * @brief Set info - invalid param.
  */
-TEST(edgeMeta, setInvalidParam01_n)
+TEST(edge, setInfoInvalidParam11_n)
 {
+  nns_edge_h edge_h;
   int ret;
 
-  ret = nns_edge_metadata_set (NULL, "temp-key", "temp-value");
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Invalid header format */
+  ret = nns_edge_set_info (edge_h, "DATA_HEADER", "INVALID_HEADER");
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Set edge metadata - invalid param.
+ * @brief Set info - invalid param.
  */
-TEST(edgeMeta, setInvalidParam02_n)
+TEST(edge, setInfoInvalidParam12_n)
 {
-  nns_edge_metadata_h meta;
+  nns_edge_h edge_h;
   int ret;
 
-  ret = nns_edge_metadata_create (&meta);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_metadata_set (meta, NULL, "temp-value");
+  /* Invalid pool size */
+  ret = nns_edge_set_info (edge_h, "POOL_SIZE", "invalid");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "POOL_SIZE", "3:NEW");
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_metadata_destroy (meta);
+  ret = nns_edge_release_handle (edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Set edge metadata - invalid param.
+ * @brief Set info - invalid param.
  */
-TEST(edgeMeta, setInvalidParam03_n)
+TEST(edge, setInfoInvalidParam13_n)
 {
-  nns_edge_metadata_h meta;
+  nns_edge_h edge_h;
   int ret;
 
-  ret = nns_edge_metadata_create (&meta);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_PUB, &edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_metadata_set (meta, "", "temp-value");
+  /* Invalid queue size of the connection */
+  ret = nns_edge_set_info (edge_h, "CONN_QUEUE_SIZE", "invalid");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "CONN_QUEUE_SIZE", ":OLD");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "CONN_QUEUE_SIZE", "3:invalid");
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_metadata_destroy (meta);
+  ret = nns_edge_release_handle (edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Set edge metadata - invalid param.
+ * @brief Set edge info - invalid param.
  */
-TEST(edgeMeta, setInvalidParam04_n)
+TEST(edge, setInfoInvalidParam14_n)
 {
-  nns_edge_metadata_h meta;
+  nns_edge_h edge_h;
   int ret;
 
-  ret = nns_edge_metadata_create (&meta);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_metadata_set (meta, "temp-key", NULL);
+  /* Invalid number of handshake workers */
+  ret = nns_edge_set_info (edge_h, "HANDSHAKE_WORKERS", "invalid");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "HANDSHAKE_WORKERS", "0");
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_metadata_destroy (meta);
+  /* Invalid handshake timeout */
+  ret = nns_edge_set_info (edge_h, "HANDSHAKE_TIMEOUT", "invalid");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "HANDSHAKE_TIMEOUT", "100ms");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_start (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Cannot change the workers after starting the handle */
+  ret = nns_edge_set_info (edge_h, "HANDSHAKE_WORKERS", "2");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Set edge metadata - invalid param.
+ * @brief Get info of the handshake workers and timeout.
  */
-TEST(edgeMeta, setInvalidParam05_n)
+TEST(edge, getInfoHandshake)
 {
-  nns_edge_metadata_h meta;
+  nns_edge_h edge_h;
+  char *value = NULL;
   int ret;
 
-  ret = nns_edge_metadata_create (&meta);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_metadata_set (meta, "temp-key", "");
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_get_info (edge_h, "HANDSHAKE_WORKERS", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "4");
+  SAFE_FREE (value);
 
-  ret = nns_edge_metadata_destroy (meta);
+  ret = nns_edge_get_info (edge_h, "HANDSHAKE_TIMEOUT", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "5000");
+  SAFE_FREE (value);
+
+  ret = nns_edge_set_info (edge_h, "HANDSHAKE_WORKERS", "8");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "HANDSHAKE_TIMEOUT", "0");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "HANDSHAKE_WORKERS", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "8");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "HANDSHAKE_TIMEOUT", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "0");
+  SAFE_FREE (value);
+
+  ret = nns_edge_release_handle (edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Get edge metadata - invalid param.
+ * @brief Set edge info - invalid param.
  */
-TEST(edgeMeta, getInvalidParam01_n)
+TEST(edge, setInfoInvalidParam15_n)
 {
-  char *value = NULL;
+  nns_edge_h edge_h;
   int ret;
 
-  ret = nns_edge_metadata_get (NULL, "temp-key", &value);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Invalid connection mode */
+  ret = nns_edge_set_info (edge_h, "CONNECTION_MODE", "invalid");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_start (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Cannot change the connection mode after starting the handle */
+  ret = nns_edge_set_info (edge_h, "CONNECTION_MODE", "DUPLEX");
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Get edge metadata - invalid param.
+ * @brief Get info of the connection mode.
  */
-TEST(edgeMeta, getInvalidParam02_n)
+TEST(edge, getInfoConnectionMode)
 {
-  nns_edge_metadata_h meta;
+  nns_edge_h edge_h;
   char *value = NULL;
   int ret;
 
-  ret = nns_edge_metadata_create (&meta);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_metadata_get (meta, NULL, &value);
+  ret = nns_edge_get_info (edge_h, "CONNECTION_MODE", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "PAIR");
+  SAFE_FREE (value);
+
+  ret = nns_edge_set_info (edge_h, "CONNECTION_MODE", "duplex");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "CONNECTION_MODE", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "DUPLEX");
+  SAFE_FREE (value);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set info of the shared memory - invalid param.
+ */
+TEST(edge, setInfoInvalidParam16_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_info (edge_h, "SHM_SIZE", "invalid");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "SHM_SIZE", "-1");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "SHM_SIZE", "1024x");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "SHM_SIZE", "99999999999");
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_metadata_destroy (meta);
+  ret = nns_edge_release_handle (edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Get edge metadata - invalid param.
+ * @brief Get info of the shared memory.
  */
-TEST(edgeMeta, getInvalidParam03_n)
+TEST(edge, getInfoShmSize)
 {
-  nns_edge_metadata_h meta;
+  nns_edge_h edge_h;
   char *value = NULL;
   int ret;
 
-  ret = nns_edge_metadata_create (&meta);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_metadata_get (meta, "", &value);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_get_info (edge_h, "SHM_SIZE", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "0");
+  SAFE_FREE (value);
 
-  ret = nns_edge_metadata_destroy (meta);
+  ret = nns_edge_set_info (edge_h, "SHM_SIZE", "1048576");
+#if defined(ENABLE_SHM)
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "SHM_SIZE", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "1048576");
+  SAFE_FREE (value);
+#else
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NOT_SUPPORTED);
+#endif
+
+  ret = nns_edge_release_handle (edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Get edge metadata - invalid param.
+ * @brief Set info of the batch - invalid param.
  */
-TEST(edgeMeta, getInvalidParam04_n)
+TEST(edge, setInfoInvalidParam17_n)
 {
-  nns_edge_metadata_h meta;
+  nns_edge_h edge_h;
   int ret;
 
-  ret = nns_edge_metadata_create (&meta);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_metadata_get (meta, "temp-key", NULL);
+  ret = nns_edge_set_info (edge_h, "BATCH_COUNT", "65");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "BATCH_COUNT", "invalid");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "BATCH_BYTES", "-1");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "BATCH_DELAY", "10ms");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "BATCH_EVENT", "invalid");
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_metadata_destroy (meta);
+  ret = nns_edge_start (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Cannot change max count after starting the handle */
+  ret = nns_edge_set_info (edge_h, "BATCH_COUNT", "8");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Copy edge metadata.
+ * @brief Get info of the batch.
  */
-TEST(edgeMeta, copy)
+TEST(edge, getInfoBatch)
 {
-  nns_edge_metadata_h src, desc;
+  nns_edge_h edge_h;
   char *value = NULL;
   int ret;
 
-  ret = nns_edge_metadata_create (&src);
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_metadata_create (&desc);
+
+  ret = nns_edge_get_info (edge_h, "BATCH_COUNT", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "0");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "BATCH_EVENT", &value);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "SPLIT");
+  SAFE_FREE (value);
 
-  ret = nns_edge_metadata_set (src, "temp-key1", "temp-value1");
+  ret = nns_edge_set_info (edge_h, "BATCH_COUNT", "16");
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_metadata_set (src, "temp-key2", "temp-value2");
+  ret = nns_edge_set_info (edge_h, "BATCH_BYTES", "65536");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "BATCH_DELAY", "2000");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "BATCH_EVENT", "batch");
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  /* Replace old value */
-  ret = nns_edge_metadata_set (src, "temp-key2", "temp-value2-replaced");
+  ret = nns_edge_get_info (edge_h, "BATCH_COUNT", &value);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "16");
+  SAFE_FREE (value);
 
-  ret = nns_edge_metadata_copy (desc, src);
+  ret = nns_edge_get_info (edge_h, "BATCH_BYTES", &value);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "65536");
+  SAFE_FREE (value);
 
-  ret = nns_edge_metadata_get (desc, "temp-key1", &value);
+  ret = nns_edge_get_info (edge_h, "BATCH_DELAY", &value);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (value, "temp-value1");
+  EXPECT_STREQ (value, "2000");
   SAFE_FREE (value);
 
-  ret = nns_edge_metadata_get (desc, "temp-key2", &value);
+  ret = nns_edge_get_info (edge_h, "BATCH_EVENT", &value);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (value, "temp-value2-replaced");
+  EXPECT_STREQ (value, "BATCH");
   SAFE_FREE (value);
 
-  ret = nns_edge_metadata_destroy (src);
+  ret = nns_edge_release_handle (edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_metadata_destroy (desc);
+}
+
+/**
+ * @brief Set info of the requests - invalid param.
+ */
+TEST(edge, setInfoInvalidParam18_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_info (edge_h, "REQUEST_WINDOW", "0");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "REQUEST_WINDOW", "4097");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "REQUEST_WINDOW", "invalid");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "REQUEST_TIMEOUT", "-1");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "REQUEST_COUNT", "1");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_start (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Cannot change the window after starting the handle */
+  ret = nns_edge_set_info (edge_h, "REQUEST_WINDOW", "8");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Copy edge metadata - invalid param.
+ * @brief Get info of the requests.
+ */
+TEST(edge, getInfoRequest)
+{
+  nns_edge_h edge_h;
+  char *value = NULL;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "REQUEST_WINDOW", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "64");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "REQUEST_TIMEOUT", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "10000");
+  SAFE_FREE (value);
+
+  ret = nns_edge_set_info (edge_h, "REQUEST_WINDOW", "16");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "REQUEST_TIMEOUT", "0");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "REQUEST_WINDOW", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "16");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "REQUEST_TIMEOUT", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "0");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "REQUEST_COUNT", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "0");
+  SAFE_FREE (value);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set info of the load balancing - invalid param.
+ */
+TEST(edge, setInfoInvalidParam19_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_info (edge_h, "LOAD_BALANCE", "invalid");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "SERVER_COUNT", "0");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "SERVER_COUNT", "65");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "SERVER_COUNT", "invalid");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "LOAD", "-1");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "LOAD", "invalid");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_start (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Cannot change the policy after starting the handle */
+  ret = nns_edge_set_info (edge_h, "LOAD_BALANCE", "ROUND_ROBIN");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get info of the load balancing.
+ */
+TEST(edge, getInfoBalance)
+{
+  nns_edge_h edge_h;
+  char *value = NULL;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "LOAD_BALANCE", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "NONE");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "SERVER_COUNT", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "1");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "LOAD", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "0");
+  SAFE_FREE (value);
+
+  ret = nns_edge_set_info (edge_h, "LOAD_BALANCE", "least_outstanding");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "SERVER_COUNT", "4");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "LOAD", "3");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "LOAD_BALANCE", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "LEAST_OUTSTANDING");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "SERVER_COUNT", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "4");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "LOAD", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "3");
+  SAFE_FREE (value);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set info of MQTT message - invalid param.
+ */
+TEST(edge, setInfoInvalidParam20_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_HYBRID,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_info (edge_h, "MQTT_QOS", "-1");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "MQTT_QOS", "3");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "MQTT_QOS", "invalid");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "MQTT_RETAIN", "invalid");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "MQTT_HOST_QOS", "3");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "MQTT_HOST_RETAIN", "1");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get info of MQTT message.
+ */
+TEST(edge, getInfoMqttQos)
+{
+  nns_edge_h edge_h;
+  char *value = NULL;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_HYBRID,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "MQTT_QOS", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "1");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "MQTT_RETAIN", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "TRUE");
+  SAFE_FREE (value);
+
+  ret = nns_edge_set_info (edge_h, "MQTT_QOS", "0");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "MQTT_RETAIN", "false");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "MQTT_HOST_QOS", "2");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "MQTT_HOST_RETAIN", "TRUE");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "MQTT_QOS", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "0");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "MQTT_RETAIN", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "FALSE");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "MQTT_HOST_QOS", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "2");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "MQTT_HOST_RETAIN", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "TRUE");
+  SAFE_FREE (value);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set info of compression - invalid param.
+ */
+TEST(edge, setInfoInvalidParam21_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_info (edge_h, "COMPRESSION", "invalid");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
+  ret = nns_edge_set_info (edge_h, "COMPRESSION_THRESHOLD", "-1");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "COMPRESSION_THRESHOLD", "invalid");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get info of dispatch workers.
+ */
+TEST(edge, getInfoDispatch)
+{
+  nns_edge_h edge_h;
+  char *value = NULL;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "DISPATCH_THREADS", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "0");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "DISPATCH_QUEUE_SIZE", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "64:OLD");
+  SAFE_FREE (value);
+
+  ret = nns_edge_set_info (edge_h, "DISPATCH_THREADS", "4");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "DISPATCH_QUEUE_SIZE", "8:new");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "DISPATCH_THREADS", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "4");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "DISPATCH_QUEUE_SIZE", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "8:NEW");
+  SAFE_FREE (value);
+
+  ret = nns_edge_set_info (edge_h, "DISPATCH_QUEUE_SIZE", "0");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "DISPATCH_QUEUE_SIZE", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "0:OLD");
+  SAFE_FREE (value);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set info of dispatch workers - invalid param.
+ */
+TEST(edge, setInfoInvalidParam23_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_info (edge_h, "DISPATCH_THREADS", "65");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
+  ret = nns_edge_set_info (edge_h, "DISPATCH_THREADS", "invalid");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
+  ret = nns_edge_set_info (edge_h, "DISPATCH_QUEUE_SIZE", "invalid");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
+  ret = nns_edge_set_info (edge_h, "DISPATCH_QUEUE_SIZE", "4:invalid");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get info of flow control.
+ */
+TEST(edge, getInfoFlowControl)
+{
+  nns_edge_h edge_h;
+  char *value = NULL;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "FLOW_CREDITS", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "0");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "FLOW_CONTROL", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "DROP");
+  SAFE_FREE (value);
+
+  ret = nns_edge_set_info (edge_h, "FLOW_CREDITS", "16");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "FLOW_CONTROL", "coalesce");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "FLOW_CREDITS", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "16");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "FLOW_CONTROL", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "COALESCE");
+  SAFE_FREE (value);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set info of flow control - invalid param.
+ */
+TEST(edge, setInfoInvalidParam24_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_info (edge_h, "FLOW_CREDITS", "65536");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
+  ret = nns_edge_set_info (edge_h, "FLOW_CREDITS", "invalid");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
+  ret = nns_edge_set_info (edge_h, "FLOW_CONTROL", "invalid");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get info of conflation mode.
+ */
+TEST(edge, getInfoConflate)
+{
+  nns_edge_h edge_h;
+  char *value = NULL;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_PUB, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "CONFLATE", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "FALSE");
+  SAFE_FREE (value);
+
+  ret = nns_edge_set_info (edge_h, "CONFLATE", "true");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "CONFLATE", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "TRUE");
+  SAFE_FREE (value);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set info of conflation mode - invalid param.
+ */
+TEST(edge, setInfoInvalidParam25_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_PUB, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_info (edge_h, "CONFLATE", "invalid");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get info of chunked transfer.
+ */
+TEST(edge, getInfoChunk)
+{
+  nns_edge_h edge_h;
+  char *value = NULL;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_PUB, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "CHUNK_SIZE", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "0");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "CHUNK_EVENT", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "FALSE");
+  SAFE_FREE (value);
+
+  ret = nns_edge_set_info (edge_h, "CHUNK_SIZE", "1048576");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "CHUNK_EVENT", "true");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "CHUNK_SIZE", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "1048576");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "CHUNK_EVENT", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "TRUE");
+  SAFE_FREE (value);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set info of chunked transfer - invalid param.
+ */
+TEST(edge, setInfoInvalidParam26_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_PUB, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_info (edge_h, "CHUNK_SIZE", "1023");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
+  ret = nns_edge_set_info (edge_h, "CHUNK_SIZE", "-4096");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
+  ret = nns_edge_set_info (edge_h, "CHUNK_SIZE", "invalid");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
+  ret = nns_edge_set_info (edge_h, "CHUNK_EVENT", "invalid");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get info of server connection.
+ */
+TEST(edge, getInfoServerConnection)
+{
+  nns_edge_h edge_h;
+  char *value = NULL;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "CAPABILITY_CACHE", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "FALSE");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "CONNECT_PARALLEL", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "1");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "STANDBY", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "FALSE");
+  SAFE_FREE (value);
+
+  ret = nns_edge_set_info (edge_h, "CAPABILITY_CACHE", "true");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "CONNECT_PARALLEL", "4");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "STANDBY", "true");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "CAPABILITY_CACHE", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "TRUE");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "CONNECT_PARALLEL", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "4");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "STANDBY", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "TRUE");
+  SAFE_FREE (value);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set info of server connection - invalid param.
+ */
+TEST(edge, setInfoInvalidParam27_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_info (edge_h, "CAPABILITY_CACHE", "invalid");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
+  ret = nns_edge_set_info (edge_h, "CONNECT_PARALLEL", "0");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
+  ret = nns_edge_set_info (edge_h, "CONNECT_PARALLEL", "9");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
+  ret = nns_edge_set_info (edge_h, "CONNECT_PARALLEL", "-1");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
+  ret = nns_edge_set_info (edge_h, "STANDBY", "invalid");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get info of statistics.
+ */
+TEST(edge, getInfoStatistics)
+{
+  nns_edge_h edge_h;
+  char *value = NULL;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "STATISTICS", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "frames_sent=0,bytes_sent=0,frames_received=0,"
+      "bytes_received=0,send_errors=0,queue_depth=0,queue_dropped=0,conn_dropped=0,"
+      "credit_dropped=0,conflated=0");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "STATISTICS_CONNECTIONS", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "STATISTICS_TIMING", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "FALSE");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "STATISTICS_INTERVAL", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "0");
+  SAFE_FREE (value);
+
+  ret = nns_edge_set_info (edge_h, "STATISTICS_TIMING", "true");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "STATISTICS_INTERVAL", "500");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "STATISTICS_TIMING", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "TRUE");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "STATISTICS_INTERVAL", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "500");
+  SAFE_FREE (value);
+
+  /* The durations are added with the timing option. */
+  ret = nns_edge_get_info (edge_h, "STATISTICS", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_TRUE (strstr (value, ",send_count=0,") != NULL);
+  EXPECT_TRUE (strstr (value, ",callback_p99_us=0") != NULL);
+  SAFE_FREE (value);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set info of statistics - invalid param.
+ */
+TEST(edge, setInfoInvalidParam22_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Read-only keys */
+  ret = nns_edge_set_info (edge_h, "STATISTICS", "frames_sent=0");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
+  ret = nns_edge_set_info (edge_h, "STATISTICS_CONNECTIONS", "");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_info (edge_h, "STATISTICS_TIMING", "invalid");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
+  ret = nns_edge_set_info (edge_h, "STATISTICS_INTERVAL", "-1");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
+  ret = nns_edge_set_info (edge_h, "STATISTICS_INTERVAL", "invalid");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get info of compression.
+ */
+TEST(edge, getInfoCompression)
+{
+  nns_edge_h edge_h;
+  char *value = NULL;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "COMPRESSION", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "NONE");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "COMPRESSION_THRESHOLD", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "1024");
+  SAFE_FREE (value);
+
+  /* The algorithm is available if its library is found when building nnstreamer-edge. */
+  ret = nns_edge_set_info (edge_h, "COMPRESSION", "LZ4");
+  if (nns_edge_compress_is_supported (NNS_EDGE_COMPRESS_LZ4)) {
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+    ret = nns_edge_get_info (edge_h, "COMPRESSION", &value);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    EXPECT_STREQ (value, "LZ4");
+    SAFE_FREE (value);
+  } else {
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NOT_SUPPORTED);
+  }
+
+  ret = nns_edge_set_info (edge_h, "COMPRESSION", "none");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "COMPRESSION_THRESHOLD", "4096");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "COMPRESSION", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "NONE");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "COMPRESSION_THRESHOLD", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "4096");
+  SAFE_FREE (value);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get info of queue size of the connection.
+ */
+TEST(edge, getInfoConnQueueSize)
+{
+  nns_edge_h edge_h;
+  char *value = NULL;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_PUB, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "CONN_QUEUE_SIZE", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "0:OLD");
+  SAFE_FREE (value);
+
+  ret = nns_edge_set_info (edge_h, "CONN_QUEUE_SIZE", "5:NEW");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "CONN_QUEUE_SIZE", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "5:NEW");
+  SAFE_FREE (value);
+
+  ret = nns_edge_set_info (edge_h, "CONN_QUEUE_SIZE", "2");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "CONN_QUEUE_SIZE", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "2:OLD");
+  SAFE_FREE (value);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get info of buffer pool size.
+ */
+TEST(edge, getInfoPoolSize)
+{
+  nns_edge_h edge_h;
+  char *value = NULL;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "POOL_SIZE", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "0");
+  SAFE_FREE (value);
+
+  ret = nns_edge_set_info (edge_h, "POOL_SIZE", "8");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "POOL_SIZE", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "8");
+  SAFE_FREE (value);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get info of data header format.
+ */
+TEST(edge, getInfoDataHeader)
+{
+  nns_edge_h edge_h;
+  char *value = NULL;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "DATA_HEADER", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "AUTO");
+  SAFE_FREE (value);
+
+  ret = nns_edge_set_info (edge_h, "DATA_HEADER", "legacy");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "DATA_HEADER", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "LEGACY");
+  SAFE_FREE (value);
+
+  ret = nns_edge_set_info (edge_h, "DATA_HEADER", "COMPACT");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "DATA_HEADER", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "COMPACT");
+  SAFE_FREE (value);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get info of I/O mode.
+ */
+TEST(edge, getInfoIoMode)
+{
+  nns_edge_h edge_h;
+  char *value = NULL;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "IO_MODE", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "THREAD");
+  SAFE_FREE (value);
+
+  ret = nns_edge_set_info (edge_h, "IO_MODE", "reactor:3");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "IO_MODE", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "REACTOR:3");
+  SAFE_FREE (value);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get info.
+ */
+TEST(edge, getInfo)
+{
+  nns_edge_h edge_h;
+  char *value = NULL;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_info (edge_h, "capability", "capa-for-test");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "topic", "topic-for-test");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "ip", "165.213.201.100");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "port", "2000");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "dest_ip", "165.213.201.101");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "dest_port", "2001");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "temp-key1", "temp-value1");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "temp-key2", "temp-value2");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "ID", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "temp-id");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "capability", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "capa-for-test");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "topic", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "topic-for-test");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "ip", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "165.213.201.100");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "port", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "2000");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "dest_ip", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "165.213.201.101");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "dest_port", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "2001");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "temp-key1", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "temp-value1");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "temp-key2", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "temp-value2");
+  SAFE_FREE (value);
+
+  /* Replace old value */
+  ret = nns_edge_set_info (edge_h, "temp-key2", "temp-value2-replaced");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "temp-key2", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "temp-value2-replaced");
+  SAFE_FREE (value);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get info - invalid param.
+ */
+TEST(edge, getInfoInvalidParam01_n)
+{
+  char *value = NULL;
+  int ret;
+
+  ret = nns_edge_get_info (NULL, "temp-key", &value);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get info - invalid param.
+ */
+TEST(edge, getInfoInvalidParam02_n)
+{
+  nns_edge_h edge_h;
+  char *value;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_get_info (edge_h, "temp-key", &value);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get info - invalid param.
+ */
+TEST(edge, getInfoInvalidParam03_n)
+{
+  nns_edge_h edge_h;
+  char *value = NULL;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, NULL, &value);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get info - invalid param.
+ */
+TEST(edge, getInfoInvalidParam04_n)
+{
+  nns_edge_h edge_h;
+  char *value = NULL;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "", &value);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get info - invalid param.
+ */
+TEST(edge, getInfoInvalidParam05_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "temp-key", NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get info - invalid param.
+ */
+TEST(edge, getInfoInvalidParam06_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Cannot get the client ID if handle is server */
+  ret = nns_edge_get_info (edge_h, "client_id", NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Clear info of edge-data - invalid param.
+ */
+TEST(edgeData, clearInfoInvalidParam01_n)
+{
+  int ret;
+
+  ret = nns_edge_data_clear_info (NULL);
+  EXPECT_NE (NNS_EDGE_ERROR_NONE, ret);
+}
+
+/**
+ * @brief Clear info of edge-data - invalid param.
+ */
+TEST(edgeData, clearInfoInvalidParam02_n)
+{
+  nns_edge_data_h data_h;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_data_clear_info (data_h);
+  EXPECT_NE (NNS_EDGE_ERROR_NONE, ret);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+}
+
+/**
+ * @brief Clear info of edge data.
+ */
+TEST(edgeData, clearInfo)
+{
+  nns_edge_data_h data_h;
+  char *value = NULL;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+
+  ret = nns_edge_data_get_info (data_h, "temp-key", &value);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+  EXPECT_STREQ ("temp-value", value);
+  SAFE_FREE (value);
+
+  ret = nns_edge_data_clear_info (data_h);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+
+  ret = nns_edge_data_get_info (data_h, "temp-key", &value);
+  EXPECT_NE (NNS_EDGE_ERROR_NONE, ret);
+
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+
+  ret = nns_edge_data_get_info (data_h, "temp-key", &value);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+  EXPECT_STREQ ("temp-value", value);
+  SAFE_FREE (value);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set and get the client ID of edge data.
+ */
+TEST(edgeData, clientId)
+{
+  nns_edge_data_h data_h, copied_h;
+  char *value = NULL;
+  int64_t client_id;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_set_client_id (data_h, 1234567890123LL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_get_client_id (data_h, &client_id);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (client_id, 1234567890123LL);
+
+  /* The client ID is also available with info key. */
+  ret = nns_edge_data_get_info (data_h, "client_id", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "1234567890123");
+  SAFE_FREE (value);
+
+  ret = nns_edge_data_set_info (data_h, "CLIENT_ID", "-5");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_get_client_id (data_h, &client_id);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (client_id, -5LL);
+
+  /* Copied data has same client ID. */
+  ret = nns_edge_data_copy (data_h, &copied_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_get_client_id (copied_h, &client_id);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (client_id, -5LL);
+
+  ret = nns_edge_data_destroy (copied_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_clear_info (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_get_client_id (data_h, &client_id);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_get_info (data_h, "client_id", &value);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set the client ID of edge data - invalid param.
+ */
+TEST(edgeData, setClientIdInvalidParam01_n)
+{
+  nns_edge_data_h data_h;
+  int ret;
+
+  ret = nns_edge_data_set_client_id (NULL, 10);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+  ret = nns_edge_data_set_client_id (data_h, 10);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get the client ID of edge data - invalid param.
+ */
+TEST(edgeData, getClientIdInvalidParam01_n)
+{
+  nns_edge_data_h data_h;
+  int64_t client_id;
+  int ret;
+
+  ret = nns_edge_data_get_client_id (NULL, &client_id);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_get_client_id (data_h, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Not a number, the value is kept in metadata. */
+  ret = nns_edge_data_set_info (data_h, "client_id", "invalid");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_get_client_id (data_h, &client_id);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+  ret = nns_edge_data_get_client_id (data_h, &client_id);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set the request ID of edge data with info key.
+ */
+TEST(edgeData, requestId)
+{
+  nns_edge_data_h data_h, copied_h;
+  uint64_t request_id;
+  int64_t rtt;
+  char *value = NULL;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_get_request_id (data_h, &request_id);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_set_info (data_h, "request_id", "18446744073709551615");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_get_request_id (data_h, &request_id);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (request_id, UINT64_MAX);
+
+  ret = nns_edge_data_get_info (data_h, "REQUEST_ID", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "18446744073709551615");
+  SAFE_FREE (value);
+
+  /* The round-trip time is measured by query client only. */
+  ret = nns_edge_data_get_request_rtt (data_h, &rtt);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Copied data has same request ID. */
+  ret = nns_edge_data_copy (data_h, &copied_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_get_request_id (copied_h, &request_id);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (request_id, UINT64_MAX);
+
+  ret = nns_edge_data_destroy (copied_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_clear_info (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_get_request_id (data_h, &request_id);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get the request ID of edge data - invalid param.
+ */
+TEST(edgeData, getRequestIdInvalidParam01_n)
+{
+  nns_edge_data_h data_h;
+  uint64_t request_id;
+  int ret;
+
+  ret = nns_edge_data_get_request_id (NULL, &request_id);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_get_request_id (data_h, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  /* 0 and negative value are not the request ID, the value is kept in metadata. */
+  ret = nns_edge_data_set_info (data_h, "request_id", "0");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_get_request_id (data_h, &request_id);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_set_info (data_h, "request_id", "-1");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_get_request_id (data_h, &request_id);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+  ret = nns_edge_data_get_request_id (data_h, &request_id);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get the round-trip time of edge data - invalid param.
+ */
+TEST(edgeData, getRequestRttInvalidParam01_n)
+{
+  nns_edge_data_h data_h;
+  int64_t rtt;
+  int ret;
+
+  ret = nns_edge_data_get_request_rtt (NULL, &rtt);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_get_request_rtt (data_h, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_get_request_rtt (data_h, &rtt);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+  ret = nns_edge_data_get_request_rtt (data_h, &rtt);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Serialize edge data with the client ID.
+ */
+TEST(edgeDataSerialize, clientId)
+{
+  nns_edge_data_h src_h, dest_h;
+  void *data;
+  nns_size_t data_len;
+  int64_t client_id;
+  char *value = NULL;
+  int ret;
+
+  ret = nns_edge_data_create (&src_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_client_id (src_h, 77);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info (src_h, "temp-key", "temp-value");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_serialize (src_h, &data, &data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_create (&dest_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_deserialize (dest_h, data, data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_get_client_id (dest_h, &client_id);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (client_id, 77LL);
+
+  ret = nns_edge_data_get_info (dest_h, "temp-key", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "temp-value");
+  SAFE_FREE (value);
+
+  SAFE_FREE (data);
+  ret = nns_edge_data_destroy (src_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_destroy (dest_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Create edge-data - invalid param.
+ */
+TEST(edgeData, createInvalidParam01_n)
+{
+  int ret;
+
+  ret = nns_edge_data_create (NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Destroy edge-data - invalid param.
+ */
+TEST(edgeData, destroyInvalidParam01_n)
+{
+  int ret;
+
+  ret = nns_edge_data_destroy (NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Destroy edge-data - invalid param.
+ */
+TEST(edgeData, destroyInvalidParam02_n)
+{
+  nns_edge_data_h data_h;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Increase the reference count of edge-data.
+ */
+TEST(edgeData, ref)
+{
+  nns_edge_data_h data_h;
+  unsigned int count;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  EXPECT_TRUE (nns_edge_data_ref (data_h) == data_h);
+  EXPECT_TRUE (nns_edge_data_ref (data_h) == data_h);
+
+  /* The data is valid until releasing all references. */
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_get_count (data_h, &count);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (count, 0U);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Increase the reference count of edge-data - invalid param.
+ */
+TEST(edgeData, refInvalidParam01_n)
+{
+  nns_edge_data_h data_h;
+  int ret;
+
+  EXPECT_TRUE (nns_edge_data_ref (NULL) == NULL);
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+  EXPECT_TRUE (nns_edge_data_ref (data_h) == NULL);
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Validate edge-data.
+ */
+TEST(edgeData, validate)
+{
+  nns_edge_data_h data_h;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_is_valid (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Validate edge-data - invalid param.
+ */
+TEST(edgeData, validateInvalidParam01_n)
+{
+  int ret;
+
+  ret = nns_edge_data_is_valid (NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Validate edge-data - invalid param.
+ */
+TEST(edgeData, validateInvalidParam02_n)
+{
+  nns_edge_data_h data_h;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_data_is_valid (data_h);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Copy edge-data.
+ */
+TEST(edgeData, copy)
+{
+  nns_edge_data_h src_h, desc_h;
+  void *data, *result;
+  nns_size_t data_len, result_len;
+  char *result_value;
+  unsigned int i, result_count;
+  int ret;
+
+  data_len = 10U * sizeof (unsigned int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  for (i = 0; i < 10U; i++)
+    ((unsigned int *) data)[i] = i;
+
+  ret = nns_edge_data_create (&src_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_set_info (src_h, "temp-key1", "temp-data-val1");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info (src_h, "temp-key2", "temp-data-val2");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_add (src_h, data, data_len, nns_edge_free);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_copy (src_h, &desc_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (src_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Compare data and info */
+  ret = nns_edge_data_get_count (desc_h, &result_count);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (result_count, 1U);
+
+  ret = nns_edge_data_get (desc_h, 0, &result, &result_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  for (i = 0; i < 10U; i++)
+    EXPECT_EQ (((unsigned int *) result)[i], i);
+
+  ret = nns_edge_data_get_info (desc_h, "temp-key1", &result_value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (result_value, "temp-data-val1");
+  SAFE_FREE (result_value);
+
+  ret = nns_edge_data_get_info (desc_h, "temp-key2", &result_value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (result_value, "temp-data-val2");
+  SAFE_FREE (result_value);
+
+  ret = nns_edge_data_destroy (desc_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Copy edge-data - invalid param.
+ */
+TEST(edgeData, copyInvalidParam01_n)
+{
+  nns_edge_data_h desc_h;
+  int ret;
+
+  ret = nns_edge_data_copy (NULL, &desc_h);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Copy edge-data - invalid param.
+ */
+TEST(edgeData, copyInvalidParam02_n)
+{
+  nns_edge_data_h src_h, desc_h;
+  int ret;
+
+  ret = nns_edge_data_create (&src_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (src_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_data_copy (src_h, &desc_h);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (src_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_data_destroy (src_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Copy edge-data - invalid param.
+ */
+TEST(edgeData, copyInvalidParam03_n)
+{
+  nns_edge_data_h src_h;
+  int ret;
+
+  ret = nns_edge_data_create (&src_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_copy (src_h, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (src_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief The number of the memories allocated and released with the test allocator.
+ */
+static unsigned int _allocated_mem = 0U;
+static unsigned int _freed_mem = 0U;
+
+/**
+ * @brief Allocator for test.
+ */
+static void *
+_test_alloc_mem (nns_size_t size, void *user_data)
+{
+  EXPECT_TRUE (user_data == &_allocated_mem);
+  _allocated_mem++;
+  return malloc (size);
+}
+
+/**
+ * @brief Release the memory allocated with the test allocator.
+ */
+static void
+_test_free_mem (void *data, void *user_data)
+{
+  EXPECT_TRUE (user_data == &_allocated_mem);
+  _freed_mem++;
+  free (data);
+}
+
+/**
+ * @brief Copy and deserialize edge-data with the allocator.
+ */
+TEST(edgeData, setAllocator)
+{
+  nns_edge_data_h src_h, dest_h;
+  void *data, *serialized, *result;
+  nns_size_t data_len, serialized_len, result_len;
+  int ret;
+
+  _allocated_mem = _freed_mem = 0U;
+  ret = nns_edge_data_set_allocator (_test_alloc_mem, _test_free_mem, &_allocated_mem);
+  ASSERT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  data_len = 10U * sizeof (unsigned int);
+  data = calloc (1, data_len);
+  ASSERT_TRUE (data != NULL);
+
+  ret = nns_edge_data_create (&src_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_add (src_h, data, data_len, nns_edge_free);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_add (src_h, data, data_len, NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info (src_h, "temp-key", "temp-value");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_copy (src_h, &dest_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (_allocated_mem, 2U);
+
+  ret = nns_edge_data_get (dest_h, 1, &result, &result_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (result_len, data_len);
+  EXPECT_EQ (memcmp (result, data, data_len), 0);
+
+  /* Cannot change the allocator while the memories are not released. */
+  ret = nns_edge_data_set_allocator (NULL, NULL, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (dest_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (_freed_mem, 2U);
+
+  ret = nns_edge_data_serialize (src_h, &serialized, &serialized_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_create (&dest_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_deserialize (dest_h, serialized, serialized_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (_allocated_mem, 4U);
+
+  ret = nns_edge_data_destroy (dest_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (_freed_mem, 4U);
+
+  ret = nns_edge_data_destroy (src_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  SAFE_FREE (serialized);
+
+  ret = nns_edge_data_set_allocator (NULL, NULL, NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* The default allocator does not call the test allocator. */
+  ret = nns_edge_data_create (&src_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_add (src_h, &data_len, sizeof (nns_size_t), NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_copy (src_h, &dest_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_destroy (dest_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_destroy (src_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (_allocated_mem, 4U);
+  EXPECT_EQ (_freed_mem, 4U);
+}
+
+/**
+ * @brief Set the allocator - invalid param.
+ */
+TEST(edgeData, setAllocatorInvalidParam01_n)
+{
+  int ret;
+
+  ret = nns_edge_data_set_allocator (_test_alloc_mem, NULL, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_set_allocator (NULL, _test_free_mem, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Add edge-data - max data limit.
+ */
+TEST(edgeData, addMaxData_n)
+{
+  nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len;
+  int i, ret;
+
+  data_len = 10U * sizeof (int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  for (i = 0; i < NNS_EDGE_DATA_LIMIT; i++) {
+    ret = nns_edge_data_add (data_h, data, data_len, NULL);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+
+  ret = nns_edge_data_add (data_h, data, data_len, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Add edge-data - invalid param.
+ */
+TEST(edgeData, addInvalidParam01_n)
+{
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  data_len = 10U * sizeof (int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  ret = nns_edge_data_add (NULL, data, data_len, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Add edge-data - invalid param.
+ */
+TEST(edgeData, addInvalidParam02_n)
+{
+  nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  data_len = 10U * sizeof (int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_data_add (data_h, data, data_len, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Add edge-data - invalid param.
+ */
+TEST(edgeData, addInvalidParam03_n)
+{
+  nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  data_len = 10U * sizeof (int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_add (data_h, NULL, data_len, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Add edge-data - invalid param.
+ */
+TEST(edgeData, addInvalidParam04_n)
+{
+  nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  data_len = 10U * sizeof (int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_add (data_h, data, 0, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Get edge-data.
+ */
+TEST(edgeData, get)
+{
+  nns_edge_data_h data_h;
+  void *data, *result;
+  nns_size_t data_len, result_len;
+  unsigned int count;
+  int ret;
+
+  data_len = 10U * sizeof (int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_add (data_h, data, data_len, NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_get_count (data_h, &count);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (count, 1U);
+
+  ret = nns_edge_data_get (data_h, 0, &result, &result_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (result, data);
+  EXPECT_EQ (result_len, data_len);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Get edge-data - invalid param.
+ */
+TEST(edgeData, getInvalidParam01_n)
+{
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  ret = nns_edge_data_get (NULL, 0, &data, &data_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get edge-data - invalid param.
+ */
+TEST(edgeData, getInvalidParam02_n)
+{
+  nns_edge_data_h data_h;
+  void *data, *result;
+  nns_size_t data_len, result_len;
+  int ret;
+
+  data_len = 10U * sizeof (int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_add (data_h, data, data_len, NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_data_get (data_h, 0, &result, &result_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Get edge-data - invalid param.
+ */
+TEST(edgeData, getInvalidParam03_n)
+{
+  nns_edge_data_h data_h;
+  void *data, *result;
+  nns_size_t data_len, result_len;
+  int ret;
+
+  data_len = 10U * sizeof (int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_add (data_h, data, data_len, NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Invalid index */
+  ret = nns_edge_data_get (data_h, 1, &result, &result_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Get edge-data - invalid param.
+ */
+TEST(edgeData, getInvalidParam04_n)
+{
+  nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len, result_len;
+  int ret;
+
+  data_len = 10U * sizeof (int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_add (data_h, data, data_len, NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_get (data_h, 0, NULL, &result_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Get edge-data - invalid param.
+ */
+TEST(edgeData, getInvalidParam05_n)
+{
+  nns_edge_data_h data_h;
+  void *data, *result;
+  nns_size_t data_len;
+  int ret;
+
+  data_len = 10U * sizeof (int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_add (data_h, data, data_len, NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_get (data_h, 0, &result, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Get count of edge-data - invalid param.
+ */
+TEST(edgeData, getCountInvalidParam01_n)
+{
+  unsigned int count;
+  int ret;
+
+  ret = nns_edge_data_get_count (NULL, &count);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get count of edge-data - invalid param.
+ */
+TEST(edgeData, getCountInvalidParam02_n)
+{
+  nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len;
+  unsigned int count;
+  int ret;
+
+  data_len = 10U * sizeof (int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_add (data_h, data, data_len, NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_data_get_count (data_h, &count);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Get count of edge-data - invalid param.
+ */
+TEST(edgeData, getCountInvalidParam03_n)
+{
+  nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  data_len = 10U * sizeof (int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_add (data_h, data, data_len, NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_get_count (data_h, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Set info of edge-data - invalid param.
+ */
+TEST(edgeData, setInfoInvalidParam01_n)
+{
+  int ret;
+
+  ret = nns_edge_data_set_info (NULL, "temp-key", "temp-value");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set info of edge-data - invalid param.
+ */
+TEST(edgeData, setInfoInvalidParam02_n)
+{
+  nns_edge_data_h data_h;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set info of edge-data - invalid param.
+ */
+TEST(edgeData, setInfoInvalidParam03_n)
+{
+  nns_edge_data_h data_h;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_set_info (data_h, NULL, "temp-value");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set info of edge-data - invalid param.
+ */
+TEST(edgeData, setInfoInvalidParam04_n)
+{
+  nns_edge_data_h data_h;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_set_info (data_h, "temp-key", NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get info of edge-data - invalid param.
+ */
+TEST(edgeData, getInfoInvalidParam01_n)
+{
+  char *value = NULL;
+  int ret;
+
+  ret = nns_edge_data_get_info (NULL, "temp-key", &value);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get info of edge-data - invalid param.
+ */
+TEST(edgeData, getInfoInvalidParam02_n)
+{
+  nns_edge_data_h data_h;
+  char *value = NULL;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_data_get_info (data_h, "temp-key", &value);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get info of edge-data - invalid param.
+ */
+TEST(edgeData, getInfoInvalidParam03_n)
+{
+  nns_edge_data_h data_h;
+  char *value = NULL;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_get_info (data_h, NULL, &value);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get info of edge-data - invalid param.
+ */
+TEST(edgeData, getInfoInvalidParam04_n)
+{
+  nns_edge_data_h data_h;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_get_info (data_h, "temp-key", NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get info of edge-data - invalid param.
+ */
+TEST(edgeData, getInfoInvalidParam05_n)
+{
+  nns_edge_data_h data_h;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_get_info (data_h, "", NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Serialize meta in edge-data - invalid param.
+ */
+TEST(edgeData, serializeInvalidParam01_n)
+{
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  ret = nns_edge_data_serialize_meta (NULL, &data, &data_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Serialize meta in edge-data - invalid param.
+ */
+TEST(edgeData, serializeInvalidParam02_n)
+{
+  nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_data_serialize_meta (data_h, &data, &data_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Serialize meta in edge-data - invalid param.
+ */
+TEST(edgeData, serializeInvalidParam03_n)
+{
+  nns_edge_data_h data_h;
+  nns_size_t data_len;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_serialize_meta (data_h, NULL, &data_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Serialize meta in edge-data - invalid param.
+ */
+TEST(edgeData, serializeInvalidParam04_n)
+{
+  nns_edge_data_h data_h;
+  void *data;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_serialize_meta (data_h, &data, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Deserialize meta to edge-data - invalid param.
+ */
+TEST(edgeData, deserializeInvalidParam01_n)
+{
+  nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_serialize_meta (data_h, &data, &data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_deserialize_meta (NULL, data, data_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Deserialize meta to edge-data - invalid param.
+ */
+TEST(edgeData, deserializeInvalidParam02_n)
+{
+  nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_serialize_meta (data_h, &data, &data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_data_deserialize_meta (data_h, data, data_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Deserialize meta to edge-data - invalid param.
+ */
+TEST(edgeData, deserializeInvalidParam03_n)
+{
+  nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_serialize_meta (data_h, &data, &data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_deserialize_meta (data_h, NULL, data_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Deserialize meta to edge-data - invalid param.
+ */
+TEST(edgeData, deserializeInvalidParam04_n)
+{
+  nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_serialize_meta (data_h, &data, &data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_deserialize_meta (data_h, data, 0);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Serialize and deserialize the edge-data.
+ */
+TEST(edgeDataSerialize, normal)
+{
+  nns_edge_data_h src_h, dest_h;
+  void *data1, *data2, *result, *serialized_data;
+  nns_size_t data_len, result_len, serialized_len;
+  char *result_value;
+  unsigned int i, result_count;
+  int ret;
+
+  data_len = 10U * sizeof (unsigned int);
+  data1 = malloc (data_len);
+  ASSERT_TRUE (data1 != NULL);
+
+  for (i = 0; i < 10U; i++)
+    ((unsigned int *) data1)[i] = i;
+
+  data2 = malloc (data_len * 2);
+  ASSERT_TRUE (data2 != NULL);
+
+  for (i = 0; i < 20U; i++)
+    ((unsigned int *) data2)[i] = 20 - i;
+
+  ret = nns_edge_data_create (&src_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_set_info (src_h, "temp-key1", "temp-data-val1");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info (src_h, "temp-key2", "temp-data-val2");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_add (src_h, data1, data_len, nns_edge_free);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_add (src_h, data2, data_len * 2, nns_edge_free);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_serialize (src_h, &serialized_data, &serialized_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (src_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_create (&dest_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_deserialize (dest_h, serialized_data, serialized_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Compare data and info */
+  ret = nns_edge_data_get_count (dest_h, &result_count);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (result_count, 2U);
+
+  ret = nns_edge_data_get (dest_h, 0, &result, &result_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  for (i = 0; i < 10U; i++)
+    EXPECT_EQ (((unsigned int *) result)[i], i);
+
+  ret = nns_edge_data_get (dest_h, 1, &result, &result_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  for (i = 0; i < 20U; i++)
+    EXPECT_EQ (((unsigned int *) result)[i], 20 - i);
+
+  ret = nns_edge_data_get_info (dest_h, "temp-key1", &result_value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (result_value, "temp-data-val1");
+  SAFE_FREE (result_value);
+
+  ret = nns_edge_data_get_info (dest_h, "temp-key2", &result_value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (result_value, "temp-data-val2");
+  SAFE_FREE (result_value);
+
+  ret = nns_edge_data_destroy (dest_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (serialized_data);
+}
+
+/**
+ * @brief Serialize edge-data with compact header.
+ */
+TEST(edgeDataSerialize, compactHeader)
+{
+  nns_edge_data_h src_h, dest_h;
+  void *data1, *result, *serialized_data, *legacy_data;
+  nns_size_t data_len, result_len, serialized_len, legacy_len;
+  char *result_value;
+  unsigned int i, result_count;
+  int ret;
+
+  data_len = 10U * sizeof (unsigned int);
+  data1 = malloc (data_len);
+  ASSERT_TRUE (data1 != NULL);
+
+  for (i = 0; i < 10U; i++)
+    ((unsigned int *) data1)[i] = i;
+
+  ret = nns_edge_data_create (&src_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_set_info (src_h, "temp-key", "temp-data-val");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_add (src_h, data1, data_len, nns_edge_free);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_serialize_full (src_h, NNS_EDGE_DATA_HEADER_COMPACT,
+      &serialized_data, &serialized_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_serialize (src_h, &legacy_data, &legacy_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_LT (serialized_len, legacy_len);
+
+  ret = nns_edge_data_is_serialized (serialized_data, serialized_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (src_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_create (&dest_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_deserialize (dest_h, serialized_data, serialized_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Compare data and info */
+  ret = nns_edge_data_get_count (dest_h, &result_count);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (result_count, 1U);
+
+  ret = nns_edge_data_get (dest_h, 0, &result, &result_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (result_len, data_len);
+  for (i = 0; i < 10U; i++)
+    EXPECT_EQ (((unsigned int *) result)[i], i);
+
+  ret = nns_edge_data_get_info (dest_h, "temp-key", &result_value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (result_value, "temp-data-val");
+  SAFE_FREE (result_value);
+
+  ret = nns_edge_data_destroy (dest_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (serialized_data);
+  SAFE_FREE (legacy_data);
+}
+
+/**
+ * @brief Serialize edge-data with compact header - invalid param.
+ */
+TEST(edgeDataSerialize, compactHeaderInvalidParam01_n)
+{
+  nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_serialize_full (data_h, (nns_edge_data_header_e) -1,
+      &data, &data_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Serialize edge-data - invalid param.
+ */
+TEST(edgeDataSerialize, invalidParam01_n)
+{
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  ret = nns_edge_data_serialize (NULL, &data, &data_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Serialize edge-data - invalid param.
+ */
+TEST(edgeData, invalidParam02_n)
+{
+  nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_data_serialize (data_h, &data, &data_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Clear raw data in edge-data - invalid param.
+ */
+TEST(edgeData, clearInvalidParam01_n)
+{
+  int ret;
+
+  ret = nns_edge_data_clear (NULL);
+  EXPECT_NE (NNS_EDGE_ERROR_NONE, ret);
+}
+
+/**
+ * @brief Clear raw data in edge-data - invalid param.
+ */
+TEST(edgeData, clearInvalidParam02_n)
+{
+  nns_edge_data_h data_h;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_data_clear (data_h);
+  EXPECT_NE (NNS_EDGE_ERROR_NONE, ret);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+}
+
+/**
+ * @brief Clear raw data in edge-data.
+ */
+TEST(edgeData, clear)
+{
+  nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len;
+  unsigned int count;
+  int ret;
+
+  data_len = 10U * sizeof (int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+
+  ret = nns_edge_data_add (data_h, data, data_len, nns_edge_free);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+
+  ret = nns_edge_data_get_count (data_h, &count);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE , ret);
+  EXPECT_EQ (1U, count);
+
+  ret = nns_edge_data_clear (data_h);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+
+  ret = nns_edge_data_get_count (data_h, &count);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+  EXPECT_EQ (0U, count);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+}
+
+/**
+ * @brief Serialize edge-data - invalid param.
+ */
+TEST(edgeDataSerialize, invalidParam03_n)
+{
+  nns_edge_data_h data_h;
+  nns_size_t data_len;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_serialize (data_h, NULL, &data_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Serialize edge-data - invalid param.
+ */
+TEST(edgeDataSerialize, invalidParam04_n)
+{
+  nns_edge_data_h data_h;
+  void *data;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_serialize_meta (data_h, &data, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Deserialize edge-data - invalid param.
+ */
+TEST(edgeDataDeserialize, invalidParam01_n)
+{
+  void *data = NULL;
+  int ret;
+
+  ret = nns_edge_data_deserialize (NULL, data, 10U);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Deserialize edge-data - invalid param.
+ */
+TEST(edgeDataDeserialize, invalidParam02_n)
+{
+  nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_serialize (data_h, &data, &data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_data_deserialize (data_h, data, data_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Deserialize edge-data - invalid param.
+ */
+TEST(edgeDataDeserialize, invalidParam03_n)
+{
+  nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_serialize (data_h, &data, &data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_deserialize (data_h, NULL, data_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Deserialize edge-data - invalid param.
+ */
+TEST(edgeDataDeserialize, invalidParam04_n)
+{
+  nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_serialize (data_h, &data, &data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_deserialize (data_h, data, 1U);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Serialize edge-data into the buffer and deserialize it without copying the memories.
+ */
+TEST(edgeDataSerialize, serializeIntoNocopy)
+{
+  nns_edge_data_h src_h, dest_h;
+  void *data, *buffer, *serialized, *result;
+  nns_size_t data_len, len, serialized_len, result_len;
+  char *result_value;
+  unsigned int i;
+  int ret;
+
+  data_len = 10U * sizeof (unsigned int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  for (i = 0; i < 10U; i++)
+    ((unsigned int *) data)[i] = i;
+
+  ret = nns_edge_data_create (&src_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info (src_h, "temp-key", "temp-value");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_add (src_h, data, data_len, nns_edge_free);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Get the size of serialized data. */
+  len = 0U;
+  ret = nns_edge_data_serialize_into (src_h, NULL, 0U, &len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_OUT_OF_MEMORY);
+
+  ret = nns_edge_data_serialize (src_h, &serialized, &serialized_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (len, serialized_len);
+
+  buffer = malloc (len);
+  ASSERT_TRUE (buffer != NULL);
+
+  ret = nns_edge_data_serialize_into (src_h, buffer, len - 1U, &len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_OUT_OF_MEMORY);
+  ret = nns_edge_data_serialize_into (src_h, buffer, len, &len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (len, serialized_len);
+
+  /* Same data except for the version key with the time. */
+  EXPECT_EQ (memcmp ((char *) buffer + serialized_len - data_len,
+      (char *) serialized + serialized_len - data_len, data_len), 0);
+  SAFE_FREE (serialized);
+
+  ret = nns_edge_data_destroy (src_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_create (&dest_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Edge data takes the buffer, and the memory refers to the buffer. */
+  ret = nns_edge_data_deserialize_nocopy (dest_h, buffer, len, nns_edge_free);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_get (dest_h, 0, &result, &result_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (result_len, data_len);
+  EXPECT_TRUE ((char *) result > (char *) buffer &&
+      (char *) result + result_len <= (char *) buffer + len);
+  for (i = 0; i < 10U; i++)
+    EXPECT_EQ (((unsigned int *) result)[i], i);
+
+  ret = nns_edge_data_get_info (dest_h, "temp-key", &result_value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (result_value, "temp-value");
+  SAFE_FREE (result_value);
+
+  /* The reference keeps the buffer. */
+  EXPECT_TRUE (nns_edge_data_ref (dest_h) != NULL);
+  ret = nns_edge_data_destroy (dest_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_get (dest_h, 0, &result, &result_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (((unsigned int *) result)[9], 9U);
+
+  ret = nns_edge_data_destroy (dest_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Serialize edge-data into the buffer - invalid param.
+ */
+TEST(edgeDataSerialize, serializeIntoInvalidParam01_n)
+{
+  nns_edge_data_h data_h;
+  char buffer[16];
+  nns_size_t len;
+  int ret;
+
+  ret = nns_edge_data_serialize_into (NULL, buffer, sizeof (buffer), &len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_serialize_into (data_h, buffer, sizeof (buffer), NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+#if defined(ENABLE_ZLIB)
+/**
+ * @brief Serialize edge-data with compressed memories and deserialize it.
+ */
+TEST(edgeDataSerialize, serializeCompressed)
+{
+  nns_edge_data_h src_h, dest_h;
+  void *data1, *data2, *buffer, *result;
+  nns_size_t data1_len, data2_len, len, required, result_len;
+  char *result_value;
+  unsigned int i, count;
+  int ret;
+
+  /* The first memory compresses, the second memory is smaller than the threshold. */
+  data1_len = 1024U * sizeof (unsigned int);
+  data1 = malloc (data1_len);
+  ASSERT_TRUE (data1 != NULL);
+  for (i = 0; i < 1024U; i++)
+    ((unsigned int *) data1)[i] = i % 10U;
+
+  data2_len = 10U * sizeof (unsigned int);
+  data2 = malloc (data2_len);
+  ASSERT_TRUE (data2 != NULL);
+  for (i = 0; i < 10U; i++)
+    ((unsigned int *) data2)[i] = i;
+
+  ret = nns_edge_data_create (&src_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info (src_h, "temp-key", "temp-value");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_add (src_h, data1, data1_len, nns_edge_free);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_add (src_h, data2, data2_len, nns_edge_free);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Get the size of serialized data without compression. */
+  required = 0U;
+  ret = nns_edge_data_serialize_compressed_into (src_h, NNS_EDGE_COMPRESS_ZLIB,
+      1024U, NULL, 0U, &required);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_OUT_OF_MEMORY);
+  EXPECT_GT (required, data1_len + data2_len);
+
+  buffer = malloc (required);
+  ASSERT_TRUE (buffer != NULL);
+
+  ret = nns_edge_data_serialize_compressed_into (src_h, NNS_EDGE_COMPRESS_ZLIB,
+      1024U, buffer, required, &len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_LT (len, required - data1_len / 2U);
+
+  ret = nns_edge_data_is_serialized (buffer, len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (src_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_create (&dest_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_deserialize (dest_h, buffer, len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  SAFE_FREE (buffer);
+
+  ret = nns_edge_data_get_count (dest_h, &count);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (count, 2U);
+
+  ret = nns_edge_data_get (dest_h, 0, &result, &result_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (result_len, data1_len);
+  for (i = 0; i < 1024U; i++)
+    EXPECT_EQ (((unsigned int *) result)[i], i % 10U);
+
+  ret = nns_edge_data_get (dest_h, 1, &result, &result_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (result_len, data2_len);
+  for (i = 0; i < 10U; i++)
+    EXPECT_EQ (((unsigned int *) result)[i], i);
+
+  ret = nns_edge_data_get_info (dest_h, "temp-key", &result_value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (result_value, "temp-value");
+  SAFE_FREE (result_value);
+
+  ret = nns_edge_data_destroy (dest_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+#endif /* ENABLE_ZLIB */
+
+/**
+ * @brief Serialize edge-data with compressed memories - invalid param.
+ */
+TEST(edgeDataSerialize, serializeCompressedInvalidParam01_n)
+{
+  nns_edge_data_h data_h;
+  char buffer[16];
+  nns_size_t len;
+  int ret;
+
+  ret = nns_edge_data_serialize_compressed_into (NULL, NNS_EDGE_COMPRESS_ZLIB,
+      0U, buffer, sizeof (buffer), &len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_serialize_compressed_into (data_h, NNS_EDGE_COMPRESS_ZLIB,
+      0U, buffer, sizeof (buffer), NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
+  ret = nns_edge_data_serialize_compressed_into (data_h, NNS_EDGE_COMPRESS_NONE,
+      0U, buffer, sizeof (buffer), &len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NOT_SUPPORTED);
+  ret = nns_edge_data_serialize_compressed_into (data_h,
+      NNS_EDGE_COMPRESS_UNKNOWN, 0U, buffer, sizeof (buffer), &len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NOT_SUPPORTED);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Deserialize edge-data without copying the memories - invalid param.
+ */
+TEST(edgeDataDeserialize, nocopyInvalidParam01_n)
+{
+  nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_serialize (data_h, &data, &data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_deserialize_nocopy (NULL, data, data_len, nns_edge_free);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_deserialize_nocopy (data_h, NULL, data_len, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  /* The buffer is not released if the function fails. */
+  ret = nns_edge_data_deserialize_nocopy (data_h, data, 1U, nns_edge_free);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Util to check serialized data - invalid param.
+ */
+TEST(edgeDataIsSerialized, invalidParam01_n)
+{
+  int ret;
+
+  ret = nns_edge_data_is_serialized (NULL, 1U);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Util to check serialized data - invalid param.
+ */
+TEST(edgeDataIsSerialized, invalidParam02_n)
+{
+  void *data;
+  int ret;
+
+  data = nns_edge_malloc (100U);
+  ASSERT_TRUE (data != NULL);
+  memset (data, 0, 100U);
+
+  /* invalid data key */
+  ret = nns_edge_data_is_serialized (data, 100U);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Util to check serialized data - invalid param.
+ */
+TEST(edgeDataIsSerialized, invalidParam03_n)
+{
+  nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_serialize (data_h, &data, &data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* invalid data size */
+  ret = nns_edge_data_is_serialized (data, 1U);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Util to check serialized data with compact header - invalid param.
+ */
+TEST(edgeDataIsSerialized, invalidParam04_n)
+{
+  nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_add (data_h, nns_edge_strdup ("temp-data"), 10U,
+      nns_edge_free);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_serialize_full (data_h, NNS_EDGE_DATA_HEADER_COMPACT,
+      &data, &data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* truncated header */
+  ret = nns_edge_data_is_serialized (data, 2U);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_is_serialized (data, 30U);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  /* invalid data size */
+  ret = nns_edge_data_is_serialized (data, data_len - 1U);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Create edge event - invalid param.
+ */
+TEST(edgeEvent, createInvalidParam01_n)
+{
+  nns_edge_event_h event_h;
+  int ret;
+
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_UNKNOWN, &event_h);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Create edge event - invalid param.
+ */
+TEST(edgeEvent, createInvalidParam02_n)
+{
+  int ret;
+
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Destroy edge event - invalid param.
+ */
+TEST(edgeEvent, destroyInvalidParam01_n)
+{
+  int ret;
+
+  ret = nns_edge_event_destroy (NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Destroy edge event - invalid param.
+ */
+TEST(edgeEvent, destroyInvalidParam02_n)
+{
+  nns_edge_event_h event_h;
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  data_len = 10U * sizeof (int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_set_data (event_h, data, data_len, nns_edge_free);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set edge event data - invalid param.
+ */
+TEST(edgeEvent, setDataInvalidParam01_n)
+{
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  data_len = 10U * sizeof (int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  ret = nns_edge_event_set_data (NULL, data, data_len, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Set edge event data - invalid param.
+ */
+TEST(edgeEvent, setDataInvalidParam02_n)
+{
+  nns_edge_event_h event_h;
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  data_len = 10U * sizeof (int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_set_data (event_h, NULL, data_len, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Set edge event data - invalid param.
+ */
+TEST(edgeEvent, setDataInvalidParam03_n)
+{
+  nns_edge_event_h event_h;
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  data_len = 10U * sizeof (int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_set_data (event_h, data, 0, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Set edge event data - invalid param.
+ */
+TEST(edgeEvent, setDataInvalidParam04_n)
+{
+  nns_edge_event_h event_h;
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  data_len = 10U * sizeof (int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_event_set_data (event_h, data, data_len, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Get edge event data.
+ */
+TEST(edgeEvent, getData)
+{
+  nns_edge_event_h event_h;
+  void *input = NULL, *output = NULL;
+  nns_size_t input_len = 0U, output_len = 0U;
+  int ret;
+
+  input_len = 10U * sizeof (int);
+  input = malloc (input_len);
+  ASSERT_TRUE (input != NULL);
+
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_set_data (event_h, input, input_len, NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_get_data (event_h, &output, &output_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_TRUE (input == output);
+  EXPECT_TRUE (input_len == output_len);
+
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (input);
+}
+
+/**
+ * @brief Get edge event data - invalid param.
+ */
+TEST(edgeEvent, getDataInvalidParam01_n)
+{
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  ret = nns_edge_event_get_data (NULL, &data, &data_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get edge event data - invalid param.
+ */
+TEST(edgeEvent, getDataInvalidParam02_n)
+{
+  nns_edge_event_h event_h;
+  nns_size_t data_len;
+  int ret;
+
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_get_data (event_h, NULL, &data_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get edge event data - invalid param.
+ */
+TEST(edgeEvent, getDataInvalidParam03_n)
+{
+  nns_edge_event_h event_h;
+  void *data;
+  int ret;
+
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_get_data (event_h, &data, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get edge event data - invalid param.
+ */
+TEST(edgeEvent, getDataInvalidParam04_n)
+{
+  nns_edge_event_h event_h;
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_event_get_data (event_h, &data, &data_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get edge event type.
+ */
+TEST(edgeEvent, getType)
+{
+  nns_edge_event_h event_h;
+  nns_edge_event_e event = NNS_EDGE_EVENT_UNKNOWN;
+  int ret;
+
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_get_type (event_h, &event);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (event, NNS_EDGE_EVENT_CUSTOM);
+
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get edge event type - invalid param.
+ */
+TEST(edgeEvent, getTypeInvalidParam01_n)
+{
+  nns_edge_event_e event;
+  int ret;
+
+  ret = nns_edge_event_get_type (NULL, &event);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get edge event type - invalid param.
+ */
+TEST(edgeEvent, getTypeInvalidParam02_n)
+{
+  nns_edge_event_h event_h;
+  int ret;
+
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_get_type (event_h, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get edge event type - invalid param.
+ */
+TEST(edgeEvent, getTypeInvalidParam03_n)
+{
+  nns_edge_event_h event_h;
+  nns_edge_event_e event;
+  int ret;
+
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_event_get_type (event_h, &event);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Parse new data of edge event.
+ */
+TEST(edgeEvent, parseNewData)
+{
+  nns_edge_event_h event_h;
+  nns_edge_data_h data_h, result_h;
+  void *data, *result;
+  nns_size_t data_len, result_len;
+  char *result_value;
+  unsigned int i, count;
+  int ret;
+
+  data_len = 10U * sizeof (unsigned int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  for (i = 0; i < 10U; i++)
+    ((unsigned int *) data)[i] = i;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_add (data_h, data, data_len, nns_edge_free);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_set_info (data_h, "temp-key1", "temp-data-val1");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info (data_h, "temp-key2", "temp-data-val2");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_NEW_DATA_RECEIVED, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_set_data (event_h, data_h, sizeof (nns_edge_data_h), NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_parse_new_data (event_h, &result_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Compare data and info */
+  ret = nns_edge_data_get_count (result_h, &count);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (count, 1U);
+
+  ret = nns_edge_data_get (result_h, 0, &result, &result_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  for (i = 0; i < 10U; i++)
+    EXPECT_EQ (((unsigned int *) result)[i], i);
+
+  ret = nns_edge_data_get_info (result_h, "temp-key1", &result_value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (result_value, "temp-data-val1");
+  SAFE_FREE (result_value);
+
+  ret = nns_edge_data_get_info (result_h, "temp-key2", &result_value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (result_value, "temp-data-val2");
+  SAFE_FREE (result_value);
+
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (result_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Parse new data of edge event - invalid param.
+ */
+TEST(edgeEvent, parseNewDataInvalidParam01_n)
+{
+  nns_edge_data_h data_h;
+  int ret;
+
+  ret = nns_edge_event_parse_new_data (NULL, &data_h);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Parse new data of edge event - invalid param.
+ */
+TEST(edgeEvent, parseNewDataInvalidParam02_n)
+{
+  nns_edge_event_h event_h;
+  int ret;
+
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_NEW_DATA_RECEIVED, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_parse_new_data (event_h, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Parse new data of edge event - invalid param.
+ */
+TEST(edgeEvent, parseNewDataInvalidParam03_n)
+{
+  nns_edge_event_h event_h;
+  nns_edge_data_h data_h;
+  int ret;
+
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_NEW_DATA_RECEIVED, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_event_parse_new_data (event_h, &data_h);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Parse new data of edge event - invalid param.
+ */
+TEST(edgeEvent, parseNewDataInvalidParam04_n)
+{
+  nns_edge_event_h event_h;
+  nns_edge_data_h data_h;
+  int ret;
+
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_parse_new_data (event_h, &data_h);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Parse the batch of edge event.
+ */
+TEST(edgeEvent, parseBatchData)
+{
+  nns_edge_event_h event_h;
+  nns_edge_data_h batch[2], result_h;
+  void *data, *result;
+  nns_size_t data_len, result_len;
+  unsigned int i, count;
+  int ret;
+
+  data_len = 10U * sizeof (unsigned int);
+
+  for (i = 0; i < 2U; i++) {
+    data = malloc (data_len);
+    ASSERT_TRUE (data != NULL);
+    memset (data, (int) i + 1, data_len);
+
+    ret = nns_edge_data_create (&batch[i]);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    ret = nns_edge_data_add (batch[i], data, data_len, nns_edge_free);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_NEW_BATCH_RECEIVED, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_set_data (event_h, batch, sizeof (batch), NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_parse_batch_count (event_h, &count);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (count, 2U);
+
+  for (i = 0; i < 2U; i++) {
+    ret = nns_edge_event_parse_batch_data (event_h, i, &result_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+    ret = nns_edge_data_get (result_h, 0, &result, &result_len);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    EXPECT_EQ (result_len, data_len);
+    EXPECT_EQ (((unsigned char *) result)[0], i + 1U);
+
+    ret = nns_edge_data_destroy (result_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+
+  /* Invalid index */
+  ret = nns_edge_event_parse_batch_data (event_h, 2U, &result_h);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  for (i = 0; i < 2U; i++) {
+    ret = nns_edge_data_destroy (batch[i]);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+}
+
+/**
+ * @brief Parse the batch count of edge event - invalid param.
+ */
+TEST(edgeEvent, parseBatchCountInvalidParam01_n)
+{
+  unsigned int count;
+  int ret;
+
+  ret = nns_edge_event_parse_batch_count (NULL, &count);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Parse the batch count of edge event - invalid param.
+ */
+TEST(edgeEvent, parseBatchCountInvalidParam02_n)
+{
+  nns_edge_event_h event_h;
+  unsigned int count;
+  int ret;
+
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_NEW_BATCH_RECEIVED, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_parse_batch_count (event_h, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Invalid event type */
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_NEW_DATA_RECEIVED, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_parse_batch_count (event_h, &count);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Parse the batch data of edge event - invalid param.
+ */
+TEST(edgeEvent, parseBatchDataInvalidParam01_n)
+{
+  nns_edge_data_h data_h;
+  int ret;
+
+  ret = nns_edge_event_parse_batch_data (NULL, 0U, &data_h);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Parse the batch data of edge event - invalid param.
+ */
+TEST(edgeEvent, parseBatchDataInvalidParam02_n)
+{
+  nns_edge_event_h event_h;
+  nns_edge_data_h data_h;
+  int ret;
+
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_NEW_BATCH_RECEIVED, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_parse_batch_data (event_h, 0U, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Empty batch */
+  ret = nns_edge_event_parse_batch_data (event_h, 0U, &data_h);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Parse capability of edge event.
+ */
+TEST(edgeEvent, parseCapability)
+{
+  const char capability[] = "temp-capability";
+  nns_edge_event_h event_h;
+  char *caps = NULL;
+  int ret;
+
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_CAPABILITY, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_set_data (event_h, (void *) capability, strlen (capability), NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_parse_capability (event_h, &caps);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (caps, capability);
+  SAFE_FREE (caps);
+
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Parse capability of edge event - invalid param.
+ */
+TEST(edgeEvent, parseCapabilityInvalidParam01_n)
+{
+  char *caps = NULL;
+  int ret;
+
+  ret = nns_edge_event_parse_capability (NULL, &caps);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Parse capability of edge event - invalid param.
+ */
+TEST(edgeEvent, parseCapabilityInvalidParam02_n)
+{
+  nns_edge_event_h event_h;
+  int ret;
+
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_CAPABILITY, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_parse_capability (event_h, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Parse capability of edge event - invalid param.
+ */
+TEST(edgeEvent, parseCapabilityInvalidParam03_n)
+{
+  nns_edge_event_h event_h;
+  char *caps = NULL;
+  int ret;
+
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_CAPABILITY, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_event_parse_capability (event_h, &caps);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Parse capability of edge event - invalid param.
+ */
+TEST(edgeEvent, parseCapabilityInvalidParam04_n)
+{
+  nns_edge_event_h event_h;
+  char *caps = NULL;
+  int ret;
+
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_parse_capability (event_h, &caps);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Parse statistics of edge event.
+ */
+TEST(edgeEvent, parseStatistics)
+{
+  const char statistics[] = "frames_sent=1,bytes_sent=4";
+  nns_edge_event_h event_h;
+  char *stats = NULL;
+  int ret;
+
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_STATISTICS, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_set_data (event_h, (void *) statistics, strlen (statistics) + 1, NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_parse_statistics (event_h, &stats);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (stats, statistics);
+  SAFE_FREE (stats);
+
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Parse statistics of edge event - invalid param.
+ */
+TEST(edgeEvent, parseStatisticsInvalidParam01_n)
+{
+  char *stats = NULL;
+  int ret;
+
+  ret = nns_edge_event_parse_statistics (NULL, &stats);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Parse statistics of edge event - invalid param.
+ */
+TEST(edgeEvent, parseStatisticsInvalidParam02_n)
+{
+  nns_edge_event_h event_h;
+  int ret;
+
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_STATISTICS, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_parse_statistics (event_h, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Parse statistics of edge event - invalid param.
+ */
+TEST(edgeEvent, parseStatisticsInvalidParam03_n)
+{
+  nns_edge_event_h event_h;
+  char *stats = NULL;
+  int ret;
+
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_CAPABILITY, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_parse_statistics (event_h, &stats);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Create edge metadata - invalid param.
+ */
+TEST(edgeMeta, createInvalidParam01_n)
+{
+  int ret;
+
+  ret = nns_edge_metadata_create (NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Destroy edge metadata - invalid param.
+ */
+TEST(edgeMeta, destroyInvalidParam01_n)
+{
+  int ret;
+
+  ret = nns_edge_metadata_destroy (NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set edge metadata - invalid param.
+ */
+TEST(edgeMeta, setInvalidParam01_n)
+{
+  int ret;
+
+  ret = nns_edge_metadata_set (NULL, "temp-key", "temp-value");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set edge metadata - invalid param.
+ */
+TEST(edgeMeta, setInvalidParam02_n)
+{
+  nns_edge_metadata_h meta;
+  int ret;
+
+  ret = nns_edge_metadata_create (&meta);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_set (meta, NULL, "temp-value");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_destroy (meta);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set edge metadata - invalid param.
+ */
+TEST(edgeMeta, setInvalidParam03_n)
+{
+  nns_edge_metadata_h meta;
+  int ret;
+
+  ret = nns_edge_metadata_create (&meta);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_set (meta, "", "temp-value");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_destroy (meta);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set edge metadata - invalid param.
+ */
+TEST(edgeMeta, setInvalidParam04_n)
+{
+  nns_edge_metadata_h meta;
+  int ret;
+
+  ret = nns_edge_metadata_create (&meta);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_set (meta, "temp-key", NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_destroy (meta);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set edge metadata - invalid param.
+ */
+TEST(edgeMeta, setInvalidParam05_n)
+{
+  nns_edge_metadata_h meta;
+  int ret;
+
+  ret = nns_edge_metadata_create (&meta);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_set (meta, "temp-key", "");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_destroy (meta);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get edge metadata - invalid param.
+ */
+TEST(edgeMeta, getInvalidParam01_n)
+{
+  char *value = NULL;
+  int ret;
+
+  ret = nns_edge_metadata_get (NULL, "temp-key", &value);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get edge metadata - invalid param.
+ */
+TEST(edgeMeta, getInvalidParam02_n)
+{
+  nns_edge_metadata_h meta;
+  char *value = NULL;
+  int ret;
+
+  ret = nns_edge_metadata_create (&meta);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_get (meta, NULL, &value);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_destroy (meta);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get edge metadata - invalid param.
+ */
+TEST(edgeMeta, getInvalidParam03_n)
+{
+  nns_edge_metadata_h meta;
+  char *value = NULL;
+  int ret;
+
+  ret = nns_edge_metadata_create (&meta);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_get (meta, "", &value);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_destroy (meta);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get edge metadata - invalid param.
+ */
+TEST(edgeMeta, getInvalidParam04_n)
+{
+  nns_edge_metadata_h meta;
+  int ret;
+
+  ret = nns_edge_metadata_create (&meta);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_get (meta, "temp-key", NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_destroy (meta);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Copy edge metadata.
+ */
+TEST(edgeMeta, copy)
+{
+  nns_edge_metadata_h src, desc;
+  char *value = NULL;
+  int ret;
+
+  ret = nns_edge_metadata_create (&src);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_create (&desc);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_set (src, "temp-key1", "temp-value1");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_set (src, "temp-key2", "temp-value2");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Replace old value */
+  ret = nns_edge_metadata_set (src, "temp-key2", "temp-value2-replaced");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_copy (desc, src);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_get (desc, "temp-key1", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "temp-value1");
+  SAFE_FREE (value);
+
+  ret = nns_edge_metadata_get (desc, "temp-key2", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "temp-value2-replaced");
+  SAFE_FREE (value);
+
+  ret = nns_edge_metadata_destroy (src);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_destroy (desc);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Copy edge metadata - invalid param.
+ */
+TEST(edgeMeta, copyInvalidParam01_n)
+{
+  nns_edge_metadata_h src;
+  int ret;
+
+  ret = nns_edge_metadata_create (&src);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_copy (NULL, src);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_destroy (src);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Copy edge metadata - invalid param.
+ */
+TEST(edgeMeta, copyInvalidParam02_n)
+{
+  nns_edge_metadata_h desc;
+  int ret;
+
+  ret = nns_edge_metadata_create (&desc);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_copy (desc, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_destroy (desc);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Serialize edge metadata.
+ */
+TEST(edgeMeta, serialize)
+{
+  nns_edge_metadata_h src, desc;
+  char *value;
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  ret = nns_edge_metadata_create (&src);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_create (&desc);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_set (src, "temp-key1", "temp-value1");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_set (src, "temp-key2", "temp-value2");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_set (src, "temp-key3", "temp-value3");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_serialize (src, &data, &data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_deserialize (desc, data, data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_get (desc, "temp-key1", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "temp-value1");
+  SAFE_FREE (value);
+
+  ret = nns_edge_metadata_get (desc, "temp-key2", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "temp-value2");
+  SAFE_FREE (value);
+
+  ret = nns_edge_metadata_get (desc, "temp-key3", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "temp-value3");
+  SAFE_FREE (value);
+
+  ret = nns_edge_metadata_destroy (src);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_destroy (desc);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Serialize edge metadata - invalid param.
+ */
+TEST(edgeMeta, serializeInvalidParam01_n)
+{
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  ret = nns_edge_metadata_serialize (NULL, &data, &data_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Serialize edge metadata - invalid param.
+ */
+TEST(edgeMeta, serializeInvalidParam02_n)
+{
+  nns_edge_metadata_h meta;
+  nns_size_t data_len;
+  int ret;
+
+  ret = nns_edge_metadata_create (&meta);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_serialize (meta, NULL, &data_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_destroy (meta);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Serialize edge metadata - invalid param.
+ */
+TEST(edgeMeta, serializeInvalidParam03_n)
+{
+  nns_edge_metadata_h meta;
+  void *data;
+  int ret;
+
+  ret = nns_edge_metadata_create (&meta);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_serialize (meta, &data, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_destroy (meta);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Deserialize edge metadata - invalid param.
+ */
+TEST(edgeMeta, deserializeInvalidParam01_n)
+{
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  data_len = 10U + sizeof (unsigned int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+  ((unsigned int *) data)[0] = 0U;
+
+  ret = nns_edge_metadata_deserialize (NULL, data, data_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Deserialize edge metadata - invalid param.
+ */
+TEST(edgeMeta, deserializeInvalidParam02_n)
+{
+  nns_edge_metadata_h meta;
+  nns_size_t data_len;
+  int ret;
+
+  data_len = 10U + sizeof (unsigned int);
+
+  ret = nns_edge_metadata_create (&meta);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_deserialize (meta, NULL, data_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_destroy (meta);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Deserialize edge metadata - invalid param.
+ */
+TEST(edgeMeta, deserializeInvalidParam03_n)
+{
+  nns_edge_metadata_h meta;
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  data_len = 10U + sizeof (unsigned int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+  ((unsigned int *) data)[0] = 0U;
+
+  ret = nns_edge_metadata_create (&meta);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_deserialize (meta, data, 0);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_destroy (meta);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Deserialize edge metadata - invalid param.
+ */
+TEST(edgeMeta, deserializeInvalidParam04_n)
+{
+  nns_edge_metadata_h meta;
+  char *value = NULL;
+  char data[16];
+  int ret;
+
+  /* 1 key-value pair, the value is not terminated. */
+  ((uint32_t *) data)[0] = 1U;
+  memcpy (data + sizeof (uint32_t), "key\0value", 9);
+  memset (data + sizeof (uint32_t) + 9, 'a', sizeof (data) - sizeof (uint32_t) - 9);
+
+  ret = nns_edge_metadata_create (&meta);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_deserialize (meta, data, sizeof (data));
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_get (meta, "key", &value);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_destroy (meta);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Copied edge metadata shares the key-value pairs until one of them is changed.
+ */
+TEST(edgeMeta, copyOnWrite)
+{
+  nns_edge_metadata_h src, dest;
+  const void *src_data, *dest_data;
+  nns_size_t src_len, dest_len;
+  char *value = NULL;
+  int ret;
+
+  ret = nns_edge_metadata_create (&src);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_create (&dest);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_set (src, "temp-key1", "temp-value1");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_set (src, "temp-key2", "temp-value2");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_copy (dest, src);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Same serialized data */
+  ret = nns_edge_metadata_get_serialized (src, &src_data, &src_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_get_serialized (dest, &dest_data, &dest_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_TRUE (src_data == dest_data);
+  EXPECT_EQ (src_len, dest_len);
+
+  /* Setting same value does not change the metadata. */
+  ret = nns_edge_metadata_set (dest, "TEMP-KEY1", "temp-value1");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_get_serialized (dest, &dest_data, &dest_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_TRUE (src_data == dest_data);
+
+  /* Change the copied metadata, the source is not changed. */
+  ret = nns_edge_metadata_set (dest, "temp-key1", "temp-value1-changed");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_set (dest, "temp-key3", "temp-value3");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_get (src, "temp-key1", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "temp-value1");
+  SAFE_FREE (value);
+  ret = nns_edge_metadata_get (src, "temp-key3", &value);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_get (dest, "temp-key1", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "temp-value1-changed");
+  SAFE_FREE (value);
+  ret = nns_edge_metadata_get (dest, "temp-key2", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "temp-value2");
+  SAFE_FREE (value);
+
+  ret = nns_edge_metadata_get_serialized (dest, &dest_data, &dest_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_TRUE (src_data != dest_data);
+
+  /* Clear the source, the copied metadata is not changed. */
+  ret = nns_edge_metadata_clear (src);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_get (dest, "temp-key2", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "temp-value2");
+  SAFE_FREE (value);
+
+  ret = nns_edge_metadata_destroy (src);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_destroy (dest);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Serialized edge metadata is kept until the metadata is changed.
+ */
+TEST(edgeMeta, getSerialized)
+{
+  nns_edge_metadata_h src, dest;
+  const void *data, *cached;
+  nns_size_t data_len, cached_len;
+  char *value = NULL;
+  char key[32], val[32];
+  unsigned int i;
+  int ret;
+
+  ret = nns_edge_metadata_create (&src);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_create (&dest);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Empty metadata */
+  ret = nns_edge_metadata_get_serialized (src, &data, &data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_TRUE (data == NULL);
+  EXPECT_EQ (data_len, 0U);
+
+  for (i = 0; i < 100U; i++) {
+    snprintf (key, sizeof (key), "temp-key%u", i);
+    snprintf (val, sizeof (val), "temp-value%u", i);
+
+    ret = nns_edge_metadata_set (src, key, val);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+
+  ret = nns_edge_metadata_get_serialized (src, &data, &data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_get_serialized (src, &cached, &cached_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_TRUE (data == cached);
+  EXPECT_EQ (data_len, cached_len);
+
+  ret = nns_edge_metadata_deserialize (dest, data, data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Deserialize same data again, the metadata is not changed. */
+  ret = nns_edge_metadata_get_serialized (dest, &cached, &cached_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_deserialize (dest, data, data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_get_serialized (dest, &data, &data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_TRUE (data == cached);
+  EXPECT_EQ (data_len, cached_len);
+
+  for (i = 0; i < 100U; i++) {
+    snprintf (key, sizeof (key), "TEMP-KEY%u", i);
+    snprintf (val, sizeof (val), "temp-value%u", i);
+
+    ret = nns_edge_metadata_get (dest, key, &value);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    EXPECT_STREQ (value, val);
+    SAFE_FREE (value);
+  }
+
+  ret = nns_edge_metadata_destroy (src);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_destroy (dest);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get serialized edge metadata - invalid param.
+ */
+TEST(edgeMeta, getSerializedInvalidParam01_n)
+{
+  nns_edge_metadata_h meta;
+  const void *data;
+  nns_size_t data_len;
+  int ret;
+
+  ret = nns_edge_metadata_get_serialized (NULL, &data, &data_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_create (&meta);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_get_serialized (meta, NULL, &data_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_get_serialized (meta, &data, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_destroy (meta);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Class to set up and tear down queue testing
+ */
+class edgeQueue: public ::testing::Test
+{
+  protected:
+    virtual void SetUp() override
+    {
+      EXPECT_EQ (nns_edge_queue_create (&queue_h), NNS_EDGE_ERROR_NONE);
+    }
+
+    virtual void TearDown() override
+    {
+      EXPECT_EQ (nns_edge_queue_destroy (queue_h), NNS_EDGE_ERROR_NONE);
+    }
+
+  protected:
+    nns_edge_queue_h queue_h;
+};
+
+/**
+ * @brief Thread to push new data into queue.
+ */
+static void *
+_test_thread_edge_queue_push (void *thread_data)
+{
+  nns_edge_queue_h queue_h = thread_data;
+  unsigned int i, j;
+  void *data;
+  nns_size_t dsize;
+
+  for (i = 0; i < 6U; i++) {
+    usleep (50000);
+
+    dsize = 5 * sizeof (unsigned int);
+    data = malloc (dsize);
+    if (data) {
+      for (j = 0; j < 5U; j++)
+        ((unsigned int *) data)[j] = i * 10U + j;
+    }
+
+    EXPECT_EQ (nns_edge_queue_push (queue_h, data, dsize, nns_edge_free),
+      NNS_EDGE_ERROR_NONE);
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief Push and pop data.
+ */
+TEST_F(edgeQueue, pushData)
+{
+  void *data1, *data2, *data3, *result;
+  nns_size_t dsize, rsize;
+  unsigned int i, len = 0U;
+
+  dsize = 5 * sizeof (unsigned int);
+
+  data1 = malloc (dsize);
+  ASSERT_TRUE (data1 != NULL);
+  for (i = 0; i < 5U; i++)
+    ((unsigned int *) data1)[i] = i + 10U;
+
+  data2 = malloc (dsize);
+  ASSERT_TRUE (data1 != NULL);
+  for (i = 0; i < 5U; i++)
+    ((unsigned int *) data2)[i] = i + 20U;
+
+  data3 = malloc (dsize);
+  ASSERT_TRUE (data1 != NULL);
+  for (i = 0; i < 5U; i++)
+    ((unsigned int *) data3)[i] = i + 30U;
+
+  EXPECT_EQ (nns_edge_queue_push (queue_h, data1, dsize, NULL), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_queue_get_length (queue_h, &len), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (len, 1U);
+
+  EXPECT_EQ (nns_edge_queue_push (queue_h, data2, dsize, NULL), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_queue_get_length (queue_h, &len), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (len, 2U);
+
+  EXPECT_EQ (nns_edge_queue_push (queue_h, data3, dsize, NULL), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_queue_get_length (queue_h, &len), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (len, 3U);
+
+  rsize = 0U;
+  EXPECT_EQ (nns_edge_queue_pop (queue_h, &result, &rsize), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_queue_get_length (queue_h, &len), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (len, 2U);
+  EXPECT_EQ (result, data1);
+  EXPECT_EQ (dsize, rsize);
+  for (i = 0; i < 5U; i++)
+    EXPECT_EQ (((unsigned int *) result)[i], i + 10U);
+
+  rsize = 0U;
+  EXPECT_EQ (nns_edge_queue_pop (queue_h, &result, &rsize), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_queue_get_length (queue_h, &len), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (len, 1U);
+  EXPECT_EQ (result, data2);
+  EXPECT_EQ (dsize, rsize);
+  for (i = 0; i < 5U; i++)
+    EXPECT_EQ (((unsigned int *) result)[i], i + 20U);
+
+  rsize = 0U;
+  EXPECT_EQ (nns_edge_queue_pop (queue_h, &result, &rsize), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_queue_get_length (queue_h, &len), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (len, 0U);
+  EXPECT_EQ (result, data3);
+  EXPECT_EQ (dsize, rsize);
+  for (i = 0; i < 5U; i++)
+    EXPECT_EQ (((unsigned int *) result)[i], i + 30U);
+
+  EXPECT_EQ (nns_edge_queue_push (queue_h, data1, dsize, nns_edge_free), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_queue_get_length (queue_h, &len), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (len, 1U);
+
+  EXPECT_EQ (nns_edge_queue_push (queue_h, data2, dsize, nns_edge_free), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_queue_get_length (queue_h, &len), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (len, 2U);
+
+  EXPECT_EQ (nns_edge_queue_push (queue_h, data3, dsize, nns_edge_free), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_queue_get_length (queue_h, &len), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (len, 3U);
+}
+
+/**
+ * @brief Wait for pushing data.
+ */
+TEST_F(edgeQueue, pushDataOnThread)
+{
+  pthread_t push_thread;
+  pthread_attr_t attr;
+  unsigned int i, j, len, retry;
+
+  pthread_attr_init (&attr);
+  pthread_attr_setdetachstate (&attr, PTHREAD_CREATE_DETACHED);
+  pthread_create (&push_thread, &attr, _test_thread_edge_queue_push, queue_h);
+  pthread_attr_destroy (&attr);
+
+  for (i = 0; i < 3U; i++) {
+    void *result = NULL;
+    nns_size_t rsize = 0U;
+
+    EXPECT_EQ (nns_edge_queue_wait_pop (queue_h, 0U, &result, &rsize), NNS_EDGE_ERROR_NONE);
+
+    for (j = 0; j < 5U; j++)
+      EXPECT_EQ (((unsigned int *) result)[j], i * 10U + j);
+    EXPECT_EQ (rsize, 5 * sizeof (unsigned int));
+
+    SAFE_FREE (result);
+  }
+
+  len = retry = 0U;
+  do {
+    usleep (20000);
+    EXPECT_EQ (nns_edge_queue_get_length (queue_h, &len), NNS_EDGE_ERROR_NONE);
+  } while (len < 3U && retry++ < 200U);
+}
+
+/**
+ * @brief Create queue - invalid param.
+ */
+TEST_F(edgeQueue, createInvalidParam01_n)
+{
+  EXPECT_EQ (nns_edge_queue_create (NULL), NNS_EDGE_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Destroy queue - invalid param.
+ */
+TEST_F(edgeQueue, destroyInvalidParam01_n)
+{
+  EXPECT_EQ (nns_edge_queue_destroy (NULL), NNS_EDGE_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Destroy queue - invalid param.
+ */
+TEST_F(edgeQueue, destroyInvalidParam02_n)
+{
+  nns_edge_handle_set_magic (queue_h, NNS_EDGE_MAGIC_DEAD);
+  EXPECT_EQ (nns_edge_queue_destroy (queue_h), NNS_EDGE_ERROR_INVALID_PARAMETER);
+  nns_edge_handle_set_magic (queue_h, NNS_EDGE_MAGIC);
+}
+
+/**
+ * @brief Get length of queue - invalid param.
+ */
+TEST_F(edgeQueue, getLengthInvalidParam01_n)
+{
+  unsigned int len = 0U;
+
+  EXPECT_EQ (nns_edge_queue_get_length (NULL, &len), NNS_EDGE_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Get length of queue - invalid param.
+ */
+TEST_F(edgeQueue, getLengthInvalidParam02_n)
+{
+  EXPECT_EQ (nns_edge_queue_get_length (queue_h, NULL), NNS_EDGE_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Get length of queue - invalid param.
+ */
+TEST_F(edgeQueue, getLengthInvalidParam03_n)
+{
+  unsigned int len = 0U;
+
+  nns_edge_handle_set_magic (queue_h, NNS_EDGE_MAGIC_DEAD);
+  EXPECT_EQ (nns_edge_queue_get_length (queue_h, &len), NNS_EDGE_ERROR_INVALID_PARAMETER);
+  nns_edge_handle_set_magic (queue_h, NNS_EDGE_MAGIC);
+}
+
+/**
+ * @brief Set limit of queue.
+ */
+TEST_F(edgeQueue, setLimit)
+{
+  void *data;
+  nns_size_t dsize;
+  unsigned int i, len = 0U;
+
+  dsize = sizeof (unsigned int);
+  data = malloc (dsize);
+  ASSERT_TRUE (data != NULL);
+
+  EXPECT_EQ (nns_edge_queue_set_limit (queue_h, 3U, NNS_EDGE_QUEUE_LEAK_NEW), NNS_EDGE_ERROR_NONE);
+
+  for (i = 0; i < 5U; i++)
+    nns_edge_queue_push (queue_h, data, dsize, NULL);
+
+  EXPECT_EQ (nns_edge_queue_get_length (queue_h, &len), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (len, 3U);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Set leaky option of queue.
+ */
+TEST_F(edgeQueue, setLeaky)
+{
+  void *data;
+  nns_size_t dsize, rsize;
+  unsigned int i, len = 0U;
+  uint64_t dropped = 0U;
+  int ret;
+
+  /* leaky option new */
+  EXPECT_EQ (nns_edge_queue_set_limit (queue_h, 3U, NNS_EDGE_QUEUE_LEAK_NEW), NNS_EDGE_ERROR_NONE);
+
+  dsize = sizeof (unsigned int);
+
+  for (i = 0; i < 5U; i++) {
+    data = malloc (dsize);
+    ASSERT_TRUE (data != NULL);
+
+    *((unsigned int *) data) = i + 1;
+
+    ret = nns_edge_queue_push (queue_h, data, dsize, nns_edge_free);
+    if (i < 3U) {
+      EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    } else {
+      EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+      SAFE_FREE (data);
+    }
+  }
+
+  EXPECT_EQ (nns_edge_queue_get_length (queue_h, &len), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (len, 3U);
+  EXPECT_EQ (nns_edge_queue_get_dropped (queue_h, &dropped), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (dropped, 2U);
+
+  EXPECT_EQ (nns_edge_queue_pop (queue_h, &data, &rsize), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (*((unsigned int *) data), 1U);
+  SAFE_FREE (data);
+  EXPECT_EQ (nns_edge_queue_pop (queue_h, &data, &rsize), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (*((unsigned int *) data), 2U);
+  SAFE_FREE (data);
+  EXPECT_EQ (nns_edge_queue_pop (queue_h, &data, &rsize), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (*((unsigned int *) data), 3U);
+  SAFE_FREE (data);
+
+  EXPECT_EQ (nns_edge_queue_get_length (queue_h, &len), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (len, 0U);
+
+  /* leaky option old */
+  EXPECT_EQ (nns_edge_queue_set_limit (queue_h, 3U, NNS_EDGE_QUEUE_LEAK_OLD), NNS_EDGE_ERROR_NONE);
+
+  for (i = 0; i < 5U; i++) {
+    data = malloc (dsize);
+    ASSERT_TRUE (data != NULL);
+
+    *((unsigned int *) data) = i + 1;
+
+    EXPECT_EQ (nns_edge_queue_push (queue_h, data, dsize, nns_edge_free), NNS_EDGE_ERROR_NONE);
+  }
+
+  EXPECT_EQ (nns_edge_queue_get_length (queue_h, &len), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (len, 3U);
+  EXPECT_EQ (nns_edge_queue_get_dropped (queue_h, &dropped), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (dropped, 4U);
+
+  EXPECT_EQ (nns_edge_queue_pop (queue_h, &data, &rsize), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (*((unsigned int *) data), 3U);
+  SAFE_FREE (data);
+  EXPECT_EQ (nns_edge_queue_pop (queue_h, &data, &rsize), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (*((unsigned int *) data), 4U);
+  SAFE_FREE (data);
+  EXPECT_EQ (nns_edge_queue_pop (queue_h, &data, &rsize), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (*((unsigned int *) data), 5U);
+  SAFE_FREE (data);
+
+  EXPECT_EQ (nns_edge_queue_get_length (queue_h, &len), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (len, 0U);
+}
+
+/**
+ * @brief Get the number of dropped data - invalid param.
+ */
+TEST_F(edgeQueue, getDroppedInvalidParam01_n)
+{
+  uint64_t dropped = 0U;
+
+  EXPECT_EQ (nns_edge_queue_get_dropped (NULL, &dropped), NNS_EDGE_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Get the number of dropped data - invalid param.
+ */
+TEST_F(edgeQueue, getDroppedInvalidParam02_n)
+{
+  EXPECT_EQ (nns_edge_queue_get_dropped (queue_h, NULL), NNS_EDGE_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Set limit of queue - invalid param.
+ */
+TEST_F(edgeQueue, setLimitInvalidParam01_n)
+{
+  EXPECT_EQ (nns_edge_queue_set_limit (NULL, 5U, NNS_EDGE_QUEUE_LEAK_NEW), NNS_EDGE_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Set limit of queue - invalid param.
+ */
+TEST_F(edgeQueue, setLimitInvalidParam02_n)
+{
+  nns_edge_handle_set_magic (queue_h, NNS_EDGE_MAGIC_DEAD);
+  EXPECT_EQ (nns_edge_queue_set_limit (queue_h, 5U, NNS_EDGE_QUEUE_LEAK_NEW), NNS_EDGE_ERROR_INVALID_PARAMETER);
+  nns_edge_handle_set_magic (queue_h, NNS_EDGE_MAGIC);
+}
+
+/**
+ * @brief Push data into queue - invalid param.
  */
-TEST(edgeMeta, copyInvalidParam01_n)
+TEST_F(edgeQueue, pushInvalidParam01_n)
 {
-  nns_edge_metadata_h src;
-  int ret;
+  void *data;
+  nns_size_t dsize;
 
-  ret = nns_edge_metadata_create (&src);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  dsize = 5 * sizeof (unsigned int);
+  data = malloc (dsize);
+  ASSERT_TRUE (data != NULL);
 
-  ret = nns_edge_metadata_copy (NULL, src);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_queue_push (NULL, data, dsize, NULL), NNS_EDGE_ERROR_INVALID_PARAMETER);
 
-  ret = nns_edge_metadata_destroy (src);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  SAFE_FREE (data);
 }
 
 /**
- * @brief Copy edge metadata - invalid param.
+ * @brief Push data into queue - invalid param.
  */
-TEST(edgeMeta, copyInvalidParam02_n)
+TEST_F(edgeQueue, pushInvalidParam02_n)
 {
-  nns_edge_metadata_h desc;
-  int ret;
-
-  ret = nns_edge_metadata_create (&desc);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_metadata_copy (desc, NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  nns_size_t dsize;
 
-  ret = nns_edge_metadata_destroy (desc);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  dsize = 5 * sizeof (unsigned int);
+  EXPECT_EQ (nns_edge_queue_push (queue_h, NULL, dsize, NULL), NNS_EDGE_ERROR_INVALID_PARAMETER);
 }
 
 /**
- * @brief Serialize edge metadata.
+ * @brief Push data into queue - invalid param.
  */
-TEST(edgeMeta, serialize)
+TEST_F(edgeQueue, pushInvalidParam03_n)
 {
-  nns_edge_metadata_h src, desc;
-  char *value;
   void *data;
-  nns_size_t data_len;
-  int ret;
-
-  ret = nns_edge_metadata_create (&src);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_metadata_create (&desc);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_metadata_set (src, "temp-key1", "temp-value1");
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_metadata_set (src, "temp-key2", "temp-value2");
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_metadata_set (src, "temp-key3", "temp-value3");
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_metadata_serialize (src, &data, &data_len);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  data = malloc (5 * sizeof (unsigned int));
+  ASSERT_TRUE (data != NULL);
 
-  ret = nns_edge_metadata_deserialize (desc, data, data_len);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_queue_push (queue_h, data, 0U, NULL), NNS_EDGE_ERROR_INVALID_PARAMETER);
 
-  ret = nns_edge_metadata_get (desc, "temp-key1", &value);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (value, "temp-value1");
-  SAFE_FREE (value);
+  SAFE_FREE (data);
+}
 
-  ret = nns_edge_metadata_get (desc, "temp-key2", &value);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (value, "temp-value2");
-  SAFE_FREE (value);
+/**
+ * @brief Push data into queue - invalid param.
+ */
+TEST_F(edgeQueue, pushInvalidParam04_n)
+{
+  void *data;
+  nns_size_t dsize;
 
-  ret = nns_edge_metadata_get (desc, "temp-key3", &value);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (value, "temp-value3");
-  SAFE_FREE (value);
+  dsize = 5 * sizeof (unsigned int);
+  data = malloc (dsize);
+  ASSERT_TRUE (data != NULL);
 
-  ret = nns_edge_metadata_destroy (src);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_metadata_destroy (desc);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_handle_set_magic (queue_h, NNS_EDGE_MAGIC_DEAD);
+  EXPECT_EQ (nns_edge_queue_push (queue_h, data, dsize, NULL), NNS_EDGE_ERROR_INVALID_PARAMETER);
+  nns_edge_handle_set_magic (queue_h, NNS_EDGE_MAGIC);
 
   SAFE_FREE (data);
 }
 
 /**
- * @brief Serialize edge metadata - invalid param.
+ * @brief Pop data from queue - invalid param.
  */
-TEST(edgeMeta, serializeInvalidParam01_n)
+TEST_F(edgeQueue, popInvalidParam01_n)
 {
   void *data;
-  nns_size_t data_len;
-  int ret;
+  nns_size_t size;
 
-  ret = nns_edge_metadata_serialize (NULL, &data, &data_len);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_queue_pop (NULL, &data, &size), NNS_EDGE_ERROR_INVALID_PARAMETER);
 }
 
 /**
- * @brief Serialize edge metadata - invalid param.
+ * @brief Pop data from queue - invalid param.
  */
-TEST(edgeMeta, serializeInvalidParam02_n)
+TEST_F(edgeQueue, popInvalidParam02_n)
 {
-  nns_edge_metadata_h meta;
-  nns_size_t data_len;
-  int ret;
+  nns_size_t size;
 
-  ret = nns_edge_metadata_create (&meta);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_queue_pop (queue_h, NULL, &size), NNS_EDGE_ERROR_INVALID_PARAMETER);
+}
 
-  ret = nns_edge_metadata_serialize (meta, NULL, &data_len);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+/**
+ * @brief Pop data from queue - invalid param.
+ */
+TEST_F(edgeQueue, popInvalidParam03_n)
+{
+  void *data;
 
-  ret = nns_edge_metadata_destroy (meta);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_queue_pop (queue_h, &data, NULL), NNS_EDGE_ERROR_INVALID_PARAMETER);
 }
 
 /**
- * @brief Serialize edge metadata - invalid param.
+ * @brief Pop data from queue - invalid param.
  */
-TEST(edgeMeta, serializeInvalidParam03_n)
+TEST_F(edgeQueue, popInvalidParam04_n)
 {
-  nns_edge_metadata_h meta;
   void *data;
-  int ret;
+  nns_size_t size;
 
-  ret = nns_edge_metadata_create (&meta);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_handle_set_magic (queue_h, NNS_EDGE_MAGIC_DEAD);
+  EXPECT_EQ (nns_edge_queue_pop (queue_h, &data, &size), NNS_EDGE_ERROR_INVALID_PARAMETER);
+  nns_edge_handle_set_magic (queue_h, NNS_EDGE_MAGIC);
+}
 
-  ret = nns_edge_metadata_serialize (meta, &data, NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+/**
+ * @brief Wait and pop data from queue, timed out.
+ */
+TEST_F(edgeQueue, waitPopTimedout)
+{
+  void *data;
+  nns_size_t size;
 
-  ret = nns_edge_metadata_destroy (meta);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_queue_wait_pop (queue_h, 10U, &data, &size), NNS_EDGE_ERROR_IO);
 }
 
 /**
- * @brief Deserialize edge metadata - invalid param.
+ * @brief Wait and pop data from stopped queue, the queue does not wait for new data.
  */
-TEST(edgeMeta, deserializeInvalidParam01_n)
+TEST_F(edgeQueue, waitPopStopped)
 {
   void *data;
-  nns_size_t data_len;
-  int ret;
+  nns_size_t size;
+  unsigned int len;
 
-  data_len = 10U + sizeof (unsigned int);
-  data = malloc (data_len);
+  data = malloc (sizeof (unsigned int));
   ASSERT_TRUE (data != NULL);
-  ((unsigned int *) data)[0] = 0U;
+  EXPECT_EQ (nns_edge_queue_push (queue_h, data, sizeof (unsigned int), nns_edge_free), NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_metadata_deserialize (NULL, data, data_len);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_queue_stop (queue_h), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_queue_get_length (queue_h, &len), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (len, 0U);
 
-  SAFE_FREE (data);
+  /* Infinite timeout, returns immediately. */
+  EXPECT_EQ (nns_edge_queue_wait_pop (queue_h, 0U, &data, &size), NNS_EDGE_ERROR_IO);
 }
 
 /**
- * @brief Deserialize edge metadata - invalid param.
+ * @brief Stop the queue - invalid param.
  */
-TEST(edgeMeta, deserializeInvalidParam02_n)
+TEST_F(edgeQueue, stopInvalidParam01_n)
 {
-  nns_edge_metadata_h meta;
-  nns_size_t data_len;
-  int ret;
+  EXPECT_EQ (nns_edge_queue_stop (NULL), NNS_EDGE_ERROR_INVALID_PARAMETER);
+}
 
-  data_len = 10U + sizeof (unsigned int);
+/**
+ * @brief Wait and pop data from queue - invalid param.
+ */
+TEST_F(edgeQueue, waitPopInvalidParam01_n)
+{
+  void *data;
+  nns_size_t size;
 
-  ret = nns_edge_metadata_create (&meta);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_queue_wait_pop (NULL, 10U, &data, &size), NNS_EDGE_ERROR_INVALID_PARAMETER);
+}
 
-  ret = nns_edge_metadata_deserialize (meta, NULL, data_len);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+/**
+ * @brief Wait and pop data from queue - invalid param.
+ */
+TEST_F(edgeQueue, waitPopInvalidParam02_n)
+{
+  nns_size_t size;
 
-  ret = nns_edge_metadata_destroy (meta);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_queue_wait_pop (queue_h, 10U, NULL, &size), NNS_EDGE_ERROR_INVALID_PARAMETER);
 }
 
 /**
- * @brief Deserialize edge metadata - invalid param.
+ * @brief Wait and pop data from queue - invalid param.
  */
-TEST(edgeMeta, deserializeInvalidParam03_n)
+TEST_F(edgeQueue, waitPopInvalidParam03_n)
 {
-  nns_edge_metadata_h meta;
   void *data;
-  nns_size_t data_len;
-  int ret;
-
-  data_len = 10U + sizeof (unsigned int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
-  ((unsigned int *) data)[0] = 0U;
 
-  ret = nns_edge_metadata_create (&meta);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_metadata_deserialize (meta, data, 0);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_queue_wait_pop (queue_h, 10U, &data, NULL), NNS_EDGE_ERROR_INVALID_PARAMETER);
+}
 
-  ret = nns_edge_metadata_destroy (meta);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+/**
+ * @brief Wait and pop data from queue - invalid param.
+ */
+TEST_F(edgeQueue, waitPopInvalidParam04_n)
+{
+  void *data;
+  nns_size_t size;
 
-  SAFE_FREE (data);
+  nns_edge_handle_set_magic (queue_h, NNS_EDGE_MAGIC_DEAD);
+  EXPECT_EQ (nns_edge_queue_wait_pop (queue_h, 10U, &data, &size), NNS_EDGE_ERROR_INVALID_PARAMETER);
+  nns_edge_handle_set_magic (queue_h, NNS_EDGE_MAGIC);
 }
 
 /**
- * @brief Class to set up and tear down queue testing
+ * @brief Class to set up and tear down queue testing with ring buffer
  */
-class edgeQueue: public ::testing::Test
+class edgeQueueRing: public ::testing::Test
 {
   protected:
     virtual void SetUp() override
     {
-      EXPECT_EQ (nns_edge_queue_create (&queue_h), NNS_EDGE_ERROR_NONE);
+      EXPECT_EQ (nns_edge_queue_create_full (&queue_h, 4U), NNS_EDGE_ERROR_NONE);
     }
 
     virtual void TearDown() override
@@ -3504,120 +9970,57 @@ class edgeQueue: public ::testing::Test
 };
 
 /**
- * @brief Thread to push new data into queue.
- */
-static void *
-_test_thread_edge_queue_push (void *thread_data)
-{
-  nns_edge_queue_h queue_h = thread_data;
-  unsigned int i, j;
-  void *data;
-  nns_size_t dsize;
-
-  for (i = 0; i < 6U; i++) {
-    usleep (50000);
-
-    dsize = 5 * sizeof (unsigned int);
-    data = malloc (dsize);
-    if (data) {
-      for (j = 0; j < 5U; j++)
-        ((unsigned int *) data)[j] = i * 10U + j;
-    }
-
-    EXPECT_EQ (nns_edge_queue_push (queue_h, data, dsize, nns_edge_free),
-      NNS_EDGE_ERROR_NONE);
-  }
-
-  return NULL;
-}
-
-/**
- * @brief Push and pop data.
+ * @brief Push and pop data in the ring buffer, wrapping around the end.
  */
-TEST_F(edgeQueue, pushData)
+TEST_F(edgeQueueRing, pushData)
 {
-  void *data1, *data2, *data3, *result;
+  void *data, *result;
   nns_size_t dsize, rsize;
   unsigned int i, len = 0U;
 
-  dsize = 5 * sizeof (unsigned int);
-
-  data1 = malloc (dsize);
-  ASSERT_TRUE (data1 != NULL);
-  for (i = 0; i < 5U; i++)
-    ((unsigned int *) data1)[i] = i + 10U;
-
-  data2 = malloc (dsize);
-  ASSERT_TRUE (data1 != NULL);
-  for (i = 0; i < 5U; i++)
-    ((unsigned int *) data2)[i] = i + 20U;
-
-  data3 = malloc (dsize);
-  ASSERT_TRUE (data1 != NULL);
-  for (i = 0; i < 5U; i++)
-    ((unsigned int *) data3)[i] = i + 30U;
+  dsize = sizeof (unsigned int);
 
-  EXPECT_EQ (nns_edge_queue_push (queue_h, data1, dsize, NULL), NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (nns_edge_queue_get_length (queue_h, &len), NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (len, 1U);
+  for (i = 0; i < 10U; i++) {
+    data = malloc (dsize);
+    ASSERT_TRUE (data != NULL);
+    *((unsigned int *) data) = i;
 
-  EXPECT_EQ (nns_edge_queue_push (queue_h, data2, dsize, NULL), NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (nns_edge_queue_get_length (queue_h, &len), NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (len, 2U);
+    EXPECT_EQ (nns_edge_queue_push (queue_h, data, dsize, nns_edge_free), NNS_EDGE_ERROR_NONE);
 
-  EXPECT_EQ (nns_edge_queue_push (queue_h, data3, dsize, NULL), NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (nns_edge_queue_get_length (queue_h, &len), NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (len, 3U);
+    if (i % 3U == 2U) {
+      unsigned int j;
 
-  rsize = 0U;
-  EXPECT_EQ (nns_edge_queue_pop (queue_h, &result, &rsize), NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (nns_edge_queue_get_length (queue_h, &len), NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (len, 2U);
-  EXPECT_EQ (result, data1);
-  EXPECT_EQ (dsize, rsize);
-  for (i = 0; i < 5U; i++)
-    EXPECT_EQ (((unsigned int *) result)[i], i + 10U);
+      for (j = i - 2U; j <= i; j++) {
+        EXPECT_EQ (nns_edge_queue_pop (queue_h, &result, &rsize), NNS_EDGE_ERROR_NONE);
+        EXPECT_EQ (*((unsigned int *) result), j);
+        EXPECT_EQ (rsize, dsize);
+        SAFE_FREE (result);
+      }
+    }
+  }
 
-  rsize = 0U;
-  EXPECT_EQ (nns_edge_queue_pop (queue_h, &result, &rsize), NNS_EDGE_ERROR_NONE);
+  /* 10 data pushed and 9 data popped */
   EXPECT_EQ (nns_edge_queue_get_length (queue_h, &len), NNS_EDGE_ERROR_NONE);
   EXPECT_EQ (len, 1U);
-  EXPECT_EQ (result, data2);
-  EXPECT_EQ (dsize, rsize);
-  for (i = 0; i < 5U; i++)
-    EXPECT_EQ (((unsigned int *) result)[i], i + 20U);
 
-  rsize = 0U;
   EXPECT_EQ (nns_edge_queue_pop (queue_h, &result, &rsize), NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (nns_edge_queue_get_length (queue_h, &len), NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (len, 0U);
-  EXPECT_EQ (result, data3);
-  EXPECT_EQ (dsize, rsize);
-  for (i = 0; i < 5U; i++)
-    EXPECT_EQ (((unsigned int *) result)[i], i + 30U);
-
-  EXPECT_EQ (nns_edge_queue_push (queue_h, data1, dsize, nns_edge_free), NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (nns_edge_queue_get_length (queue_h, &len), NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (len, 1U);
-
-  EXPECT_EQ (nns_edge_queue_push (queue_h, data2, dsize, nns_edge_free), NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (nns_edge_queue_get_length (queue_h, &len), NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (len, 2U);
+  EXPECT_EQ (*((unsigned int *) result), 9U);
+  SAFE_FREE (result);
 
-  EXPECT_EQ (nns_edge_queue_push (queue_h, data3, dsize, nns_edge_free), NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (nns_edge_queue_get_length (queue_h, &len), NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (len, 3U);
+  EXPECT_EQ (nns_edge_queue_pop (queue_h, &result, &rsize), NNS_EDGE_ERROR_IO);
 }
 
 /**
- * @brief Wait for pushing data.
+ * @brief Push and pop data in the ring buffer on other thread.
  */
-TEST_F(edgeQueue, pushDataOnThread)
+TEST_F(edgeQueueRing, pushDataOnThread)
 {
   pthread_t push_thread;
   pthread_attr_t attr;
   unsigned int i, j, len, retry;
 
+  EXPECT_EQ (nns_edge_queue_set_limit (queue_h, 0U, NNS_EDGE_QUEUE_LEAK_OLD), NNS_EDGE_ERROR_NONE);
+
   pthread_attr_init (&attr);
   pthread_attr_setdetachstate (&attr, PTHREAD_CREATE_DETACHED);
   pthread_create (&push_thread, &attr, _test_thread_edge_queue_push, queue_h);
@@ -3644,360 +10047,754 @@ TEST_F(edgeQueue, pushDataOnThread)
 }
 
 /**
- * @brief Create queue - invalid param.
+ * @brief Set leaky option of the ring buffer, the limit cannot exceed the capacity.
  */
-TEST_F(edgeQueue, createInvalidParam01_n)
+TEST_F(edgeQueueRing, setLeaky)
 {
-  EXPECT_EQ (nns_edge_queue_create (NULL), NNS_EDGE_ERROR_INVALID_PARAMETER);
+  void *data;
+  nns_size_t dsize, rsize;
+  unsigned int i, len = 0U;
+  int ret;
+
+  /* leaky option new, limit 0 means the capacity */
+  EXPECT_EQ (nns_edge_queue_set_limit (queue_h, 0U, NNS_EDGE_QUEUE_LEAK_NEW), NNS_EDGE_ERROR_NONE);
+
+  dsize = sizeof (unsigned int);
+
+  for (i = 0; i < 6U; i++) {
+    data = malloc (dsize);
+    ASSERT_TRUE (data != NULL);
+
+    *((unsigned int *) data) = i + 1;
+
+    ret = nns_edge_queue_push (queue_h, data, dsize, nns_edge_free);
+    if (i < 4U) {
+      EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    } else {
+      EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+      SAFE_FREE (data);
+    }
+  }
+
+  EXPECT_EQ (nns_edge_queue_get_length (queue_h, &len), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (len, 4U);
+
+  EXPECT_EQ (nns_edge_queue_pop (queue_h, &data, &rsize), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (*((unsigned int *) data), 1U);
+  SAFE_FREE (data);
+
+  EXPECT_EQ (nns_edge_queue_clear (queue_h), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_queue_get_length (queue_h, &len), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (len, 0U);
+
+  /* leaky option old, limit is smaller than the capacity */
+  EXPECT_EQ (nns_edge_queue_set_limit (queue_h, 2U, NNS_EDGE_QUEUE_LEAK_OLD), NNS_EDGE_ERROR_NONE);
+
+  for (i = 0; i < 5U; i++) {
+    data = malloc (dsize);
+    ASSERT_TRUE (data != NULL);
+
+    *((unsigned int *) data) = i + 1;
+
+    EXPECT_EQ (nns_edge_queue_push (queue_h, data, dsize, nns_edge_free), NNS_EDGE_ERROR_NONE);
+  }
+
+  EXPECT_EQ (nns_edge_queue_get_length (queue_h, &len), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (len, 2U);
+
+  EXPECT_EQ (nns_edge_queue_pop (queue_h, &data, &rsize), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (*((unsigned int *) data), 4U);
+  SAFE_FREE (data);
+  EXPECT_EQ (nns_edge_queue_pop (queue_h, &data, &rsize), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (*((unsigned int *) data), 5U);
+  SAFE_FREE (data);
 }
 
 /**
- * @brief Destroy queue - invalid param.
+ * @brief Wait for the data in the ring buffer.
  */
-TEST_F(edgeQueue, destroyInvalidParam01_n)
+TEST_F(edgeQueueRing, waitPopTimedout)
 {
-  EXPECT_EQ (nns_edge_queue_destroy (NULL), NNS_EDGE_ERROR_INVALID_PARAMETER);
+  void *data;
+  nns_size_t size;
+
+  EXPECT_EQ (nns_edge_queue_wait_pop (queue_h, 10U, &data, &size), NNS_EDGE_ERROR_IO);
 }
 
 /**
- * @brief Destroy queue - invalid param.
+ * @brief Create queue with ring buffer - invalid param.
  */
-TEST_F(edgeQueue, destroyInvalidParam02_n)
+TEST_F(edgeQueueRing, createInvalidParam01_n)
 {
-  nns_edge_handle_set_magic (queue_h, NNS_EDGE_MAGIC_DEAD);
-  EXPECT_EQ (nns_edge_queue_destroy (queue_h), NNS_EDGE_ERROR_INVALID_PARAMETER);
-  nns_edge_handle_set_magic (queue_h, NNS_EDGE_MAGIC);
+  EXPECT_EQ (nns_edge_queue_create_full (NULL, 4U), NNS_EDGE_ERROR_INVALID_PARAMETER);
 }
 
 /**
- * @brief Get length of queue - invalid param.
+ * @brief Get the capacity of the ring buffer.
  */
-TEST_F(edgeQueue, getLengthInvalidParam01_n)
+TEST_F(edgeQueueRing, getCapacity)
 {
-  unsigned int len = 0U;
+  nns_edge_queue_h list_h;
+  unsigned int capacity = 0U;
 
-  EXPECT_EQ (nns_edge_queue_get_length (NULL, &len), NNS_EDGE_ERROR_INVALID_PARAMETER);
+  EXPECT_EQ (nns_edge_queue_get_capacity (queue_h, &capacity), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (capacity, 4U);
+
+  EXPECT_EQ (nns_edge_queue_create (&list_h), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_queue_get_capacity (list_h, &capacity), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (capacity, 0U);
+  EXPECT_EQ (nns_edge_queue_destroy (list_h), NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Get length of queue - invalid param.
+ * @brief Get the capacity of the ring buffer - invalid param.
  */
-TEST_F(edgeQueue, getLengthInvalidParam02_n)
+TEST_F(edgeQueueRing, getCapacityInvalidParam01_n)
 {
-  EXPECT_EQ (nns_edge_queue_get_length (queue_h, NULL), NNS_EDGE_ERROR_INVALID_PARAMETER);
+  unsigned int capacity;
+
+  EXPECT_EQ (nns_edge_queue_get_capacity (NULL, &capacity), NNS_EDGE_ERROR_INVALID_PARAMETER);
 }
 
 /**
- * @brief Get length of queue - invalid param.
+ * @brief Get the capacity of the ring buffer - invalid param.
  */
-TEST_F(edgeQueue, getLengthInvalidParam03_n)
+TEST_F(edgeQueueRing, getCapacityInvalidParam02_n)
 {
-  unsigned int len = 0U;
+  EXPECT_EQ (nns_edge_queue_get_capacity (queue_h, NULL), NNS_EDGE_ERROR_INVALID_PARAMETER);
+}
 
-  nns_edge_handle_set_magic (queue_h, NNS_EDGE_MAGIC_DEAD);
-  EXPECT_EQ (nns_edge_queue_get_length (queue_h, &len), NNS_EDGE_ERROR_INVALID_PARAMETER);
-  nns_edge_handle_set_magic (queue_h, NNS_EDGE_MAGIC);
+/**
+ * @brief Set the limit of the ring buffer - invalid param.
+ */
+TEST_F(edgeQueueRing, setLimitInvalidParam01_n)
+{
+  EXPECT_EQ (nns_edge_queue_set_limit (queue_h, 5U, NNS_EDGE_QUEUE_LEAK_NEW), NNS_EDGE_ERROR_INVALID_PARAMETER);
 }
 
 /**
- * @brief Set limit of queue.
+ * @brief Class to set up and tear down buffer pool testing
  */
-TEST_F(edgeQueue, setLimit)
+class edgePool: public ::testing::Test
 {
-  void *data;
-  nns_size_t dsize;
-  unsigned int i, len = 0U;
+  protected:
+    virtual void SetUp() override
+    {
+      EXPECT_EQ (nns_edge_pool_create (&pool_h), NNS_EDGE_ERROR_NONE);
+    }
 
-  dsize = sizeof (unsigned int);
-  data = malloc (dsize);
-  ASSERT_TRUE (data != NULL);
+    virtual void TearDown() override
+    {
+      EXPECT_EQ (nns_edge_pool_destroy (pool_h), NNS_EDGE_ERROR_NONE);
+    }
 
-  EXPECT_EQ (nns_edge_queue_set_limit (queue_h, 3U, NNS_EDGE_QUEUE_LEAK_NEW), NNS_EDGE_ERROR_NONE);
+  protected:
+    nns_edge_pool_h pool_h;
+};
 
-  for (i = 0; i < 5U; i++)
-    nns_edge_queue_push (queue_h, data, dsize, NULL);
+/**
+ * @brief Allocate and reuse the buffers in the pool.
+ */
+TEST_F(edgePool, allocReuse)
+{
+  void *data1, *data2, *data3;
 
-  EXPECT_EQ (nns_edge_queue_get_length (queue_h, &len), NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (len, 3U);
+  EXPECT_EQ (nns_edge_pool_set_limit (pool_h, 2U), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_pool_get_limit (pool_h), 2U);
 
-  SAFE_FREE (data);
+  data1 = nns_edge_pool_alloc (pool_h, 100U);
+  ASSERT_TRUE (data1 != NULL);
+  memset (data1, 1, 100U);
+  nns_edge_pool_release (pool_h, data1, 100U);
+
+  /* Same size class, the released buffer is reused. */
+  data2 = nns_edge_pool_alloc (pool_h, 120U);
+  EXPECT_EQ (data2, data1);
+  memset (data2, 2, 120U);
+
+  /* Different size class. */
+  data3 = nns_edge_pool_alloc (pool_h, 1000U);
+  ASSERT_TRUE (data3 != NULL);
+  EXPECT_NE (data3, data2);
+  memset (data3, 3, 1000U);
+
+  nns_edge_pool_release (pool_h, data2, 120U);
+  nns_edge_pool_release (pool_h, data3, 1000U);
 }
 
 /**
- * @brief Set leaky option of queue.
+ * @brief Release the buffers exceeding the limit.
  */
-TEST_F(edgeQueue, setLeaky)
+TEST_F(edgePool, allocLimit)
 {
-  void *data;
-  nns_size_t dsize, rsize;
-  unsigned int i, len = 0U;
-  int ret;
+  void *data[4];
+  unsigned int i;
 
-  /* leaky option new */
-  EXPECT_EQ (nns_edge_queue_set_limit (queue_h, 3U, NNS_EDGE_QUEUE_LEAK_NEW), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_pool_set_limit (pool_h, 2U), NNS_EDGE_ERROR_NONE);
 
-  dsize = sizeof (unsigned int);
+  for (i = 0; i < 4U; i++) {
+    data[i] = nns_edge_pool_alloc (pool_h, 4096U);
+    ASSERT_TRUE (data[i] != NULL);
+  }
 
-  for (i = 0; i < 5U; i++) {
-    data = malloc (dsize);
-    ASSERT_TRUE (data != NULL);
+  for (i = 0; i < 4U; i++)
+    nns_edge_pool_release (pool_h, data[i], 4096U);
 
-    *((unsigned int *) data) = i + 1;
+  /* Shrink the pool, and disable it. */
+  EXPECT_EQ (nns_edge_pool_set_limit (pool_h, 1U), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_pool_set_limit (pool_h, 0U), NNS_EDGE_ERROR_NONE);
 
-    ret = nns_edge_queue_push (queue_h, data, dsize, nns_edge_free);
-    if (i < 3U) {
-      EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-    } else {
-      EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-      SAFE_FREE (data);
-    }
-  }
+  data[0] = nns_edge_pool_alloc (pool_h, 4096U);
+  ASSERT_TRUE (data[0] != NULL);
+  nns_edge_pool_release (pool_h, data[0], 4096U);
+}
 
-  EXPECT_EQ (nns_edge_queue_get_length (queue_h, &len), NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (len, 3U);
+/**
+ * @brief Allocator for test, the memory is aligned to 64 bytes.
+ */
+static void *
+_test_alloc_aligned_mem (nns_size_t size, void *user_data)
+{
+  void *mem = NULL;
 
-  EXPECT_EQ (nns_edge_queue_pop (queue_h, &data, &rsize), NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (*((unsigned int *) data), 1U);
-  SAFE_FREE (data);
-  EXPECT_EQ (nns_edge_queue_pop (queue_h, &data, &rsize), NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (*((unsigned int *) data), 2U);
-  SAFE_FREE (data);
-  EXPECT_EQ (nns_edge_queue_pop (queue_h, &data, &rsize), NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (*((unsigned int *) data), 3U);
-  SAFE_FREE (data);
+  UNUSED (user_data);
+  if (posix_memalign (&mem, 64U, size) != 0)
+    return NULL;
+
+  return mem;
+}
+
+/**
+ * @brief Release the memory allocated with the aligned test allocator.
+ */
+static void
+_test_free_aligned_mem (void *data, void *user_data)
+{
+  UNUSED (user_data);
+  free (data);
+}
+
+/**
+ * @brief The buffer from the pool keeps the alignment of the allocator.
+ */
+TEST_F(edgePool, allocAlignment)
+{
+  void *data1, *data2;
+
+  ASSERT_EQ (nns_edge_data_set_allocator (_test_alloc_aligned_mem,
+      _test_free_aligned_mem, NULL), NNS_EDGE_ERROR_NONE);
+
+  /* Allocate exact size with disabled pool, and reuse the buffer in size class. */
+  data1 = nns_edge_pool_alloc (pool_h, 100U);
+  ASSERT_TRUE (data1 != NULL);
+  EXPECT_EQ ((uintptr_t) data1 % 64U, 0U);
+  nns_edge_pool_release (pool_h, data1, 100U);
+
+  EXPECT_EQ (nns_edge_pool_set_limit (pool_h, 1U), NNS_EDGE_ERROR_NONE);
+  data1 = nns_edge_pool_alloc (pool_h, 4000U);
+  ASSERT_TRUE (data1 != NULL);
+  EXPECT_EQ ((uintptr_t) data1 % 64U, 0U);
+  memset (data1, 1, 4000U);
+  nns_edge_pool_release (pool_h, data1, 4000U);
+
+  data2 = nns_edge_pool_alloc (pool_h, 4096U);
+  EXPECT_EQ (data2, data1);
+  memset (data2, 2, 4096U);
+  nns_edge_pool_release (pool_h, data2, 4096U);
+
+  EXPECT_EQ (nns_edge_pool_set_limit (pool_h, 0U), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_data_set_allocator (NULL, NULL, NULL), NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Create buffer pool - invalid param.
+ */
+TEST_F(edgePool, createInvalidParam01_n)
+{
+  EXPECT_EQ (nns_edge_pool_create (NULL), NNS_EDGE_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Destroy buffer pool - invalid param.
+ */
+TEST_F(edgePool, destroyInvalidParam01_n)
+{
+  EXPECT_EQ (nns_edge_pool_destroy (NULL), NNS_EDGE_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Set limit of buffer pool - invalid param.
+ */
+TEST_F(edgePool, setLimitInvalidParam01_n)
+{
+  EXPECT_EQ (nns_edge_pool_set_limit (NULL, 1U), NNS_EDGE_ERROR_INVALID_PARAMETER);
+}
 
-  EXPECT_EQ (nns_edge_queue_get_length (queue_h, &len), NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (len, 0U);
+/**
+ * @brief Allocate buffer - invalid param.
+ */
+TEST_F(edgePool, allocInvalidParam01_n)
+{
+  EXPECT_TRUE (nns_edge_pool_alloc (NULL, 10U) == NULL);
+}
 
-  /* leaky option old */
-  EXPECT_EQ (nns_edge_queue_set_limit (queue_h, 3U, NNS_EDGE_QUEUE_LEAK_OLD), NNS_EDGE_ERROR_NONE);
+/**
+ * @brief Allocate buffer - invalid param.
+ */
+TEST_F(edgePool, allocInvalidParam02_n)
+{
+  EXPECT_TRUE (nns_edge_pool_alloc (pool_h, 0U) == NULL);
+}
 
-  for (i = 0; i < 5U; i++) {
-    data = malloc (dsize);
-    ASSERT_TRUE (data != NULL);
+/**
+ * @brief Util to get the version.
+ */
+TEST(edgeUtil, getVersion)
+{
+  unsigned int major1, minor1, micro1;
+  unsigned int major2, minor2, micro2;
+  uint64_t ver_key;
+  char *ver_string;
 
-    *((unsigned int *) data) = i + 1;
+  nns_edge_get_version (&major1, &minor1, &micro1);
+  ver_key = nns_edge_generate_version_key ();
+  EXPECT_TRUE (nns_edge_parse_version_key (ver_key, &major2, &minor2, &micro2));
+  EXPECT_EQ (major1, major2);
+  EXPECT_EQ (minor1, minor2);
+  EXPECT_EQ (micro1, micro2);
 
-    EXPECT_EQ (nns_edge_queue_push (queue_h, data, dsize, nns_edge_free), NNS_EDGE_ERROR_NONE);
-  }
+  ver_string = nns_edge_strdup_printf ("%u.%u.%u", major1, minor1, micro1);
+  EXPECT_STREQ (ver_string, VERSION);
+  nns_edge_free (ver_string);
+}
 
-  EXPECT_EQ (nns_edge_queue_get_length (queue_h, &len), NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (len, 3U);
+/**
+ * @brief Util to get the features in the version key.
+ */
+TEST(edgeUtil, getVersionFeatures)
+{
+  uint64_t ver_key;
+  uint32_t features;
 
-  EXPECT_EQ (nns_edge_queue_pop (queue_h, &data, &rsize), NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (*((unsigned int *) data), 3U);
-  SAFE_FREE (data);
-  EXPECT_EQ (nns_edge_queue_pop (queue_h, &data, &rsize), NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (*((unsigned int *) data), 4U);
-  SAFE_FREE (data);
-  EXPECT_EQ (nns_edge_queue_pop (queue_h, &data, &rsize), NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (*((unsigned int *) data), 5U);
-  SAFE_FREE (data);
+  ver_key = nns_edge_generate_version_key ();
+  features = nns_edge_parse_version_features (ver_key);
+  EXPECT_EQ (features, (uint32_t) NNS_EDGE_FEATURE_ALL);
+  EXPECT_TRUE (features & NNS_EDGE_FEATURE_COMPACT_HEADER);
+  EXPECT_TRUE (features & NNS_EDGE_FEATURE_DUPLEX);
 
-  EXPECT_EQ (nns_edge_queue_get_length (queue_h, &len), NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (len, 0U);
+  /* Old version key does not have features. */
+  ver_key &= ~(0xfffULL << 36);
+  EXPECT_TRUE (nns_edge_parse_version_key (ver_key, NULL, NULL, NULL));
+  EXPECT_EQ (nns_edge_parse_version_features (ver_key), 0U);
 }
 
 /**
- * @brief Set limit of queue - invalid param.
+ * @brief Util to get the features in the version key - invalid param.
  */
-TEST_F(edgeQueue, setLimitInvalidParam01_n)
+TEST(edgeUtil, getVersionFeaturesInvalidParam01_n)
 {
-  EXPECT_EQ (nns_edge_queue_set_limit (NULL, 5U, NNS_EDGE_QUEUE_LEAK_NEW), NNS_EDGE_ERROR_INVALID_PARAMETER);
+  EXPECT_EQ (nns_edge_parse_version_features (0ULL), 0U);
 }
 
 /**
- * @brief Set limit of queue - invalid param.
+ * @brief Get the compression algorithm and its name.
  */
-TEST_F(edgeQueue, setLimitInvalidParam02_n)
+TEST(edgeCompress, parseName)
 {
-  nns_edge_handle_set_magic (queue_h, NNS_EDGE_MAGIC_DEAD);
-  EXPECT_EQ (nns_edge_queue_set_limit (queue_h, 5U, NNS_EDGE_QUEUE_LEAK_NEW), NNS_EDGE_ERROR_INVALID_PARAMETER);
-  nns_edge_handle_set_magic (queue_h, NNS_EDGE_MAGIC);
+  EXPECT_EQ (nns_edge_compress_parse ("NONE"), NNS_EDGE_COMPRESS_NONE);
+  EXPECT_EQ (nns_edge_compress_parse ("zlib"), NNS_EDGE_COMPRESS_ZLIB);
+  EXPECT_EQ (nns_edge_compress_parse ("Lz4"), NNS_EDGE_COMPRESS_LZ4);
+  EXPECT_EQ (nns_edge_compress_parse ("ZSTD"), NNS_EDGE_COMPRESS_ZSTD);
+  EXPECT_STREQ (nns_edge_compress_get_name (NNS_EDGE_COMPRESS_ZLIB), "ZLIB");
+  EXPECT_EQ (nns_edge_compress_get_feature (NNS_EDGE_COMPRESS_ZSTD),
+      NNS_EDGE_FEATURE_COMPRESS_ZSTD);
+  EXPECT_FALSE (nns_edge_compress_is_supported (NNS_EDGE_COMPRESS_NONE));
 }
 
 /**
- * @brief Push data into queue - invalid param.
+ * @brief Get the compression algorithm - invalid param.
  */
-TEST_F(edgeQueue, pushInvalidParam01_n)
+TEST(edgeCompress, parseNameInvalidParam01_n)
 {
-  void *data;
-  nns_size_t dsize;
+  EXPECT_EQ (nns_edge_compress_parse (NULL), NNS_EDGE_COMPRESS_UNKNOWN);
+  EXPECT_EQ (nns_edge_compress_parse (""), NNS_EDGE_COMPRESS_UNKNOWN);
+  EXPECT_EQ (nns_edge_compress_parse ("invalid"), NNS_EDGE_COMPRESS_UNKNOWN);
+  EXPECT_TRUE (nns_edge_compress_get_name (NNS_EDGE_COMPRESS_UNKNOWN) == NULL);
+  EXPECT_EQ (nns_edge_compress_get_feature (NNS_EDGE_COMPRESS_UNKNOWN), 0U);
+}
 
-  dsize = 5 * sizeof (unsigned int);
-  data = malloc (dsize);
-  ASSERT_TRUE (data != NULL);
+#if defined(ENABLE_ZLIB)
+/**
+ * @brief Compress and decompress the memory with zlib.
+ */
+TEST(edgeCompress, compressZlib)
+{
+  char src[1024], dst[1024], result[1024];
+  nns_size_t len;
+  int ret;
 
-  EXPECT_EQ (nns_edge_queue_push (NULL, data, dsize, NULL), NNS_EDGE_ERROR_INVALID_PARAMETER);
+  memset (src, 'a', sizeof (src));
 
-  SAFE_FREE (data);
+  len = sizeof (src) - 1U;
+  ret = nns_edge_compress (NNS_EDGE_COMPRESS_ZLIB, src, sizeof (src), dst, &len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_LT (len, sizeof (src));
+
+  ret = nns_edge_decompress (NNS_EDGE_COMPRESS_ZLIB, dst, len, result,
+      sizeof (result));
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (memcmp (src, result, sizeof (src)), 0);
+
+  /* The size of original memory is different. */
+  ret = nns_edge_decompress (NNS_EDGE_COMPRESS_ZLIB, dst, len, result,
+      sizeof (result) - 1U);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Push data into queue - invalid param.
+ * @brief Compress the memory which does not compress.
  */
-TEST_F(edgeQueue, pushInvalidParam02_n)
+TEST(edgeCompress, compressZlibNoGain_n)
 {
-  nns_size_t dsize;
+  unsigned char src[256], dst[256];
+  nns_size_t len;
+  unsigned int i;
+  int ret;
 
-  dsize = 5 * sizeof (unsigned int);
-  EXPECT_EQ (nns_edge_queue_push (queue_h, NULL, dsize, NULL), NNS_EDGE_ERROR_INVALID_PARAMETER);
+  for (i = 0; i < sizeof (src); i++)
+    src[i] = (unsigned char) ((i * 167U + 13U) ^ (i >> 3));
+
+  len = sizeof (src) - 1U;
+  ret = nns_edge_compress (NNS_EDGE_COMPRESS_ZLIB, src, sizeof (src), dst, &len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_OUT_OF_MEMORY);
 }
 
 /**
- * @brief Push data into queue - invalid param.
+ * @brief Decompress the memory - invalid param.
  */
-TEST_F(edgeQueue, pushInvalidParam03_n)
+TEST(edgeCompress, decompressInvalidParam01_n)
 {
-  void *data;
+  char src[64], dst[64];
+  int ret;
 
-  data = malloc (5 * sizeof (unsigned int));
-  ASSERT_TRUE (data != NULL);
+  memset (src, 'a', sizeof (src));
 
-  EXPECT_EQ (nns_edge_queue_push (queue_h, data, 0U, NULL), NNS_EDGE_ERROR_INVALID_PARAMETER);
+  ret = nns_edge_decompress (NNS_EDGE_COMPRESS_ZLIB, src, sizeof (src), dst,
+      sizeof (dst));
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_IO);
+  ret = nns_edge_decompress (NNS_EDGE_COMPRESS_ZLIB, NULL, sizeof (src), dst,
+      sizeof (dst));
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
+  ret = nns_edge_decompress (NNS_EDGE_COMPRESS_ZLIB, src, sizeof (src), NULL,
+      sizeof (dst));
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
+}
+#endif /* ENABLE_ZLIB */
 
-  SAFE_FREE (data);
+/**
+ * @brief Compress the memory - invalid param.
+ */
+TEST(edgeCompress, compressInvalidParam01_n)
+{
+  char src[64], dst[64];
+  nns_size_t len;
+  int ret;
+
+  memset (src, 'a', sizeof (src));
+
+  len = sizeof (dst);
+  ret = nns_edge_compress (NNS_EDGE_COMPRESS_NONE, src, sizeof (src), dst, &len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NOT_SUPPORTED);
+  ret = nns_edge_compress (NNS_EDGE_COMPRESS_ZLIB, NULL, sizeof (src), dst, &len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
+  ret = nns_edge_compress (NNS_EDGE_COMPRESS_ZLIB, src, 0U, dst, &len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
+  ret = nns_edge_compress (NNS_EDGE_COMPRESS_ZLIB, src, sizeof (src), dst, NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_INVALID_PARAMETER);
 }
 
+#if defined(ENABLE_SHM)
 /**
- * @brief Push data into queue - invalid param.
+ * @brief Send and receive data with shared memory ring.
  */
-TEST_F(edgeQueue, pushInvalidParam04_n)
+TEST(edgeShm, allocAndGet)
 {
-  void *data;
-  nns_size_t dsize;
+  nns_edge_shm_h sender, receiver;
+  nns_size_t offset = 0;
+  char *data, *recv;
+  int ret;
 
-  dsize = 5 * sizeof (unsigned int);
-  data = malloc (dsize);
+  ret = nns_edge_shm_create (1024U, &sender);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_shm_open (nns_edge_shm_get_name (sender), &receiver);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  data = (char *) nns_edge_shm_alloc (sender, 100U, &offset);
   ASSERT_TRUE (data != NULL);
+  EXPECT_EQ ((uintptr_t) data % NNS_EDGE_SHM_ALIGN, 0U);
+  memset (data, 'a', 100U);
 
-  nns_edge_handle_set_magic (queue_h, NNS_EDGE_MAGIC_DEAD);
-  EXPECT_EQ (nns_edge_queue_push (queue_h, data, dsize, NULL), NNS_EDGE_ERROR_INVALID_PARAMETER);
-  nns_edge_handle_set_magic (queue_h, NNS_EDGE_MAGIC);
+  recv = (char *) nns_edge_shm_get (receiver, offset, 100U);
+  ASSERT_TRUE (recv != NULL);
+  EXPECT_EQ (recv[0], 'a');
+  EXPECT_EQ (recv[99], 'a');
 
-  SAFE_FREE (data);
+  ret = nns_edge_shm_release (receiver, offset);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Released record is not available. */
+  recv = (char *) nns_edge_shm_get (receiver, offset, 100U);
+  EXPECT_TRUE (recv == NULL);
+
+  ret = nns_edge_shm_close (receiver);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_shm_close (sender);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Pop data from queue - invalid param.
+ * @brief The ring is full, the space is reused after releasing the records.
  */
-TEST_F(edgeQueue, popInvalidParam01_n)
+TEST(edgeShm, ringFull)
 {
+  nns_edge_shm_h sender, receiver;
+  nns_size_t offset[3];
+  unsigned int i;
   void *data;
-  nns_size_t size;
+  int ret;
 
-  EXPECT_EQ (nns_edge_queue_pop (NULL, &data, &size), NNS_EDGE_ERROR_INVALID_PARAMETER);
+  /* Each record uses 256 bytes (header and data), the ring has 2 records. */
+  ret = nns_edge_shm_create (512U, &sender);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_shm_open (nns_edge_shm_get_name (sender), &receiver);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  for (i = 0; i < 2U; i++) {
+    data = nns_edge_shm_alloc (sender, 192U, &offset[i]);
+    EXPECT_TRUE (data != NULL);
+  }
+
+  data = nns_edge_shm_alloc (sender, 192U, &offset[2]);
+  EXPECT_TRUE (data == NULL);
+
+  /* Release the oldest record and write new record from the beginning. */
+  ret = nns_edge_shm_release (receiver, offset[0]);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  data = nns_edge_shm_alloc (sender, 192U, &offset[2]);
+  EXPECT_TRUE (data != NULL);
+  EXPECT_EQ (offset[2], offset[0]);
+
+  data = nns_edge_shm_alloc (sender, 192U, &offset[0]);
+  EXPECT_TRUE (data == NULL);
+
+  ret = nns_edge_shm_release (receiver, offset[1]);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_shm_release (receiver, offset[2]);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* The ring is empty, the largest record is available. */
+  data = nns_edge_shm_alloc (sender, 448U, &offset[0]);
+  EXPECT_TRUE (data != NULL);
+
+  ret = nns_edge_shm_close (receiver);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_shm_close (sender);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Pop data from queue - invalid param.
+ * @brief The record does not fit at the end of the ring, it is written from the beginning.
  */
-TEST_F(edgeQueue, popInvalidParam02_n)
+TEST(edgeShm, wrapAround)
 {
-  nns_size_t size;
+  nns_edge_shm_h sender, receiver;
+  nns_size_t offset[3];
+  char *data;
+  int ret;
 
-  EXPECT_EQ (nns_edge_queue_pop (queue_h, NULL, &size), NNS_EDGE_ERROR_INVALID_PARAMETER);
+  ret = nns_edge_shm_create (1024U, &sender);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_shm_open (nns_edge_shm_get_name (sender), &receiver);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* 384 bytes for each record */
+  data = (char *) nns_edge_shm_alloc (sender, 320U, &offset[0]);
+  EXPECT_TRUE (data != NULL);
+  data = (char *) nns_edge_shm_alloc (sender, 320U, &offset[1]);
+  EXPECT_TRUE (data != NULL);
+
+  ret = nns_edge_shm_release (receiver, offset[0]);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* 256 bytes remain at the end, new record is written at offset 0. */
+  data = (char *) nns_edge_shm_alloc (sender, 320U, &offset[2]);
+  ASSERT_TRUE (data != NULL);
+  EXPECT_EQ (offset[2], 0U);
+  memset (data, 'b', 320U);
+
+  data = (char *) nns_edge_shm_get (receiver, offset[2], 320U);
+  ASSERT_TRUE (data != NULL);
+  EXPECT_EQ (data[319], 'b');
+
+  data = (char *) nns_edge_shm_get (receiver, offset[1], 320U);
+  EXPECT_TRUE (data != NULL);
+
+  ret = nns_edge_shm_close (receiver);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_shm_close (sender);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Pop data from queue - invalid param.
+ * @brief Create shared memory - invalid param.
  */
-TEST_F(edgeQueue, popInvalidParam03_n)
+TEST(edgeShm, createInvalidParam01_n)
 {
-  void *data;
+  nns_edge_shm_h shm;
+  int ret;
 
-  EXPECT_EQ (nns_edge_queue_pop (queue_h, &data, NULL), NNS_EDGE_ERROR_INVALID_PARAMETER);
+  ret = nns_edge_shm_create (0U, &shm);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Pop data from queue - invalid param.
+ * @brief Create shared memory - invalid param.
  */
-TEST_F(edgeQueue, popInvalidParam04_n)
+TEST(edgeShm, createInvalidParam02_n)
 {
-  void *data;
-  nns_size_t size;
+  int ret;
 
-  nns_edge_handle_set_magic (queue_h, NNS_EDGE_MAGIC_DEAD);
-  EXPECT_EQ (nns_edge_queue_pop (queue_h, &data, &size), NNS_EDGE_ERROR_INVALID_PARAMETER);
-  nns_edge_handle_set_magic (queue_h, NNS_EDGE_MAGIC);
+  ret = nns_edge_shm_create (1024U, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Wait and pop data from queue, timed out.
+ * @brief Open shared memory - invalid param.
  */
-TEST_F(edgeQueue, waitPopTimedout)
+TEST(edgeShm, openInvalidParam01_n)
 {
-  void *data;
-  nns_size_t size;
+  nns_edge_shm_h shm;
+  int ret;
 
-  EXPECT_EQ (nns_edge_queue_wait_pop (queue_h, 10U, &data, &size), NNS_EDGE_ERROR_IO);
+  ret = nns_edge_shm_open (NULL, &shm);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_shm_open ("/nns-edge-invalid-name", &shm);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Wait and pop data from queue - invalid param.
+ * @brief Open shared memory - invalid param.
  */
-TEST_F(edgeQueue, waitPopInvalidParam01_n)
+TEST(edgeShm, openInvalidParam02_n)
 {
-  void *data;
-  nns_size_t size;
+  nns_edge_shm_h sender;
+  int ret;
 
-  EXPECT_EQ (nns_edge_queue_wait_pop (NULL, 10U, &data, &size), NNS_EDGE_ERROR_INVALID_PARAMETER);
+  ret = nns_edge_shm_create (1024U, &sender);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_shm_open (nns_edge_shm_get_name (sender), NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_shm_close (sender);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Wait and pop data from queue - invalid param.
+ * @brief Close shared memory - invalid param.
  */
-TEST_F(edgeQueue, waitPopInvalidParam02_n)
+TEST(edgeShm, closeInvalidParam01_n)
 {
-  nns_size_t size;
+  int ret;
 
-  EXPECT_EQ (nns_edge_queue_wait_pop (queue_h, 10U, NULL, &size), NNS_EDGE_ERROR_INVALID_PARAMETER);
+  ret = nns_edge_shm_close (NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Wait and pop data from queue - invalid param.
+ * @brief Allocate the record - invalid param.
  */
-TEST_F(edgeQueue, waitPopInvalidParam03_n)
+TEST(edgeShm, allocInvalidParam01_n)
 {
-  void *data;
+  nns_edge_shm_h sender, receiver;
+  nns_size_t offset;
+  int ret;
 
-  EXPECT_EQ (nns_edge_queue_wait_pop (queue_h, 10U, &data, NULL), NNS_EDGE_ERROR_INVALID_PARAMETER);
+  ret = nns_edge_shm_create (1024U, &sender);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_shm_open (nns_edge_shm_get_name (sender), &receiver);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  EXPECT_TRUE (nns_edge_shm_alloc (NULL, 64U, &offset) == NULL);
+  EXPECT_TRUE (nns_edge_shm_alloc (sender, 64U, NULL) == NULL);
+  EXPECT_TRUE (nns_edge_shm_alloc (sender, 2048U, &offset) == NULL);
+
+  /* The receiver cannot write the record. */
+  EXPECT_TRUE (nns_edge_shm_alloc (receiver, 64U, &offset) == NULL);
+
+  ret = nns_edge_shm_close (receiver);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_shm_close (sender);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Wait and pop data from queue - invalid param.
+ * @brief Get the record - invalid param.
  */
-TEST_F(edgeQueue, waitPopInvalidParam04_n)
+TEST(edgeShm, getInvalidParam01_n)
 {
-  void *data;
-  nns_size_t size;
+  nns_edge_shm_h sender, receiver;
+  nns_size_t offset = 0;
+  int ret;
 
-  nns_edge_handle_set_magic (queue_h, NNS_EDGE_MAGIC_DEAD);
-  EXPECT_EQ (nns_edge_queue_wait_pop (queue_h, 10U, &data, &size), NNS_EDGE_ERROR_INVALID_PARAMETER);
-  nns_edge_handle_set_magic (queue_h, NNS_EDGE_MAGIC);
+  ret = nns_edge_shm_create (1024U, &sender);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_shm_open (nns_edge_shm_get_name (sender), &receiver);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  EXPECT_TRUE (nns_edge_shm_alloc (sender, 64U, &offset) != NULL);
+
+  EXPECT_TRUE (nns_edge_shm_get (NULL, offset, 64U) == NULL);
+  /* Invalid size, offset and not written position */
+  EXPECT_TRUE (nns_edge_shm_get (receiver, offset, 128U) == NULL);
+  EXPECT_TRUE (nns_edge_shm_get (receiver, offset + 1U, 64U) == NULL);
+  EXPECT_TRUE (nns_edge_shm_get (receiver, 512U, 64U) == NULL);
+  EXPECT_TRUE (nns_edge_shm_get (receiver, 4096U, 64U) == NULL);
+
+  ret = nns_edge_shm_close (receiver);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_shm_close (sender);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Util to get the version.
+ * @brief Release the record - invalid param.
  */
-TEST(edgeUtil, getVersion)
+TEST(edgeShm, releaseInvalidParam01_n)
 {
-  unsigned int major1, minor1, micro1;
-  unsigned int major2, minor2, micro2;
-  uint64_t ver_key;
-  char *ver_string;
+  nns_edge_shm_h sender, receiver;
+  int ret;
 
-  nns_edge_get_version (&major1, &minor1, &micro1);
-  ver_key = nns_edge_generate_version_key ();
-  EXPECT_TRUE (nns_edge_parse_version_key (ver_key, &major2, &minor2, &micro2));
-  EXPECT_EQ (major1, major2);
-  EXPECT_EQ (minor1, minor2);
-  EXPECT_EQ (micro1, micro2);
+  ret = nns_edge_shm_create (1024U, &sender);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_shm_open (nns_edge_shm_get_name (sender), &receiver);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ver_string = nns_edge_strdup_printf ("%u.%u.%u", major1, minor1, micro1);
-  EXPECT_STREQ (ver_string, VERSION);
-  nns_edge_free (ver_string);
+  ret = nns_edge_shm_release (NULL, 0U);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_shm_release (receiver, 0U);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_shm_release (receiver, 4096U);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_shm_close (receiver);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_shm_close (sender);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
+#endif /* ENABLE_SHM */
 
 /**
  * @brief Main gtest